@@ -107,6 +107,9 @@ test_component drc 32 32 48000 "$FullTest"
 # test with multiband-drc
 test_component drc_multiband 32 32 48000 "$FullTest"
 
+# test with limiter
+test_component limiter 32 32 48000 "$FullTest"
+
 # test with src
 test_component src 24 24 48000 "$FullTest"
 
@@ -119,4 +122,12 @@ test_component aria 24 24 48000 "$FullTest"
 # test with asrc
 test_component asrc 32 32 48000 "$FullTest"
 
+# test with stft
+test_component stft 32 32 48000 "$FullTest"
+
+# test the compiled topology cache
+echo "------------------------------------------------------------"
+echo "test topology cache"
+./tplg_cache_test.sh || die "topology cache test failed!\n"
+
 echo "All tests are done!"
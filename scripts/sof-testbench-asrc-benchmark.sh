@@ -0,0 +1,76 @@
+#!/bin/bash
+# SPDX-License-Identifier: BSD-3-Clause
+
+set -e
+
+usage() {
+    echo "Usage: $0 <options>"
+    echo "  -c <channels list>, default \"2 4 6 8\""
+    echo "  -d <directory> directory to place logs and code profiling reports"
+    echo "  -h shows this text"
+    echo "  -r <input rates list>, default \"16000 32000 44100 48000 96000\""
+    echo "  -x runs testbench with xt-run simulator with profiling"
+    echo
+    echo "The ASRC converts the input rate to 48 kHz. The topology"
+    echo "sof-hda-benchmark-asrc_multich32.tplg is built with scripts/build-tools.sh -Y."
+    echo
+    echo "Example: measure native build MCPS for 8 channels 44.1 kHz to 48 kHz"
+    echo "$0 -c 8 -r 44100"
+    echo
+}
+
+if [ -z "${SOF_WORKSPACE}" ]; then
+    echo "Error: environment variable SOF_WORKSPACE need to be set to top level sof directory"
+    exit 1
+fi
+
+CHANNELS="2 4 6 8"
+RATES="16000 32000 44100 48000 96000"
+PDIR=$SOF_WORKSPACE/sof/tools/testbench/profile
+XTRUN=
+
+while getopts "c:d:hr:x" opt; do
+    case "${opt}" in
+        c)
+	    CHANNELS=${OPTARG}
+	    ;;
+        d)
+	    PDIR=${OPTARG}
+	    ;;
+        h)
+	    usage
+	    exit
+	    ;;
+        r)
+	    RATES=${OPTARG}
+	    ;;
+        x)
+	    XTRUN=-x
+	    ;;
+        *)
+	    usage
+	    exit
+	    ;;
+    esac
+done
+shift $((OPTIND-1))
+
+HELPER=$SOF_WORKSPACE/sof/scripts/sof-testbench-helper.sh
+mkdir -p "$PDIR"
+echo "Logs are stored to $PDIR"
+printf "%-10s %-10s %s\n" "channels" "rate in" "MCPS"
+
+for ch in $CHANNELS
+do
+    for fs in $RATES
+    do
+	LOG="$PDIR/log-asrc-${ch}ch-${fs}.txt"
+	PROFILE=()
+	if [ -n "$XTRUN" ]; then
+	    PROFILE=(-p "$PDIR/profile-asrc-${ch}ch-${fs}.txt")
+	fi
+	$HELPER $XTRUN "${PROFILE[@]}" -m asrc_multich -c "$ch" -r "$fs" -R 48000 -n 1,2 > "$LOG"
+	MCPS=$(grep "Pipeline MCPS" "$LOG" | awk '{print $3}')
+	printf "%-10s %-10s %s\n" "$ch" "$fs" "${MCPS:-n/a}"
+    done
+done
@@ -16,6 +16,7 @@ usage() {
     echo "  -o <output wav>, default none"
     echo "  -p <profiling result text>, use with -x, default none"
     echo "  -r <rate>, default 48000"
+    echo "  -R <output rate>, default same as input rate, for sample rate converters"
     echo "  -t <force topology>, default none, e.g. production/sof-hda-generic.tplg"
     echo "  -v runs with valgrind, not available with -x"
     echo "  -x runs testbench with xt-run simulator"
@@ -45,6 +46,7 @@ RATE_OUT=48000
 CHANNELS_IN=2
 CHANNELS_OUT=2
 PIPELINES="1,2"
+RATE_OUT_SET=
 INFILE1=$(mktemp --tmpdir=/tmp in-XXXX.raw)
 OUTFILE1=$(mktemp --tmpdir=/tmp out-XXXX.raw)
 TRACEFILE=$(mktemp --tmpdir=/tmp trace-XXXX.txt)
@@ -55,7 +57,7 @@ PROFILE=false
 TPLG0=
 VALGRIND=
 
-while getopts "b:c:hi:km:n:o:p:r:t:vx" opt; do
+while getopts "b:c:hi:km:n:o:p:r:R:t:vx" opt; do
     case "${opt}" in
         b)
 	    BITS=${OPTARG}
@@ -91,6 +93,9 @@ while getopts "b:c:hi:km:n:o:p:r:t:vx" opt; do
 	    RATE_IN=${OPTARG}
 	    RATE_OUT=${OPTARG}
 	    ;;
+        R)
+	    RATE_OUT_SET=${OPTARG}
+	    ;;
         t)
 	    TPLG0=${OPTARG}
 	    ;;
@@ -108,6 +113,10 @@ while getopts "b:c:hi:km:n:o:p:r:t:vx" opt; do
 done
 shift $((OPTIND-1))
 
+if [ -n "$RATE_OUT_SET" ]; then
+    RATE_OUT=$RATE_OUT_SET
+fi
+
 echo Converting clip "$CLIP" to raw input
 if [[ "$BITS" == "24" ]]; then
     # Sox does not support S24_4LE format
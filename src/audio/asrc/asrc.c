@@ -257,7 +257,16 @@ static int asrc_initialize_buffers(struct asrc_farrow *src_obj)
 	src_obj->buffer_length = src_obj->filter_length * 2;
 	src_obj->buffer_write_position = src_obj->filter_length - 1;
 
-	if (src_obj->bit_depth == 32) {
+	if (src_obj->channel_parallel) {
+		/* One frame interleaved buffer for all channels */
+		buffer_size = src_obj->buffer_length * src_obj->num_channels *
+			sizeof(int32_t);
+		buf_32 = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, buffer_size);
+		if (!buf_32)
+			return -ENOMEM;
+
+		src_obj->ring_buffer32_mch = buf_32;
+	} else if (src_obj->bit_depth == 32) {
 		buffer_size = src_obj->buffer_length * sizeof(int32_t);
 
 		for (ch = 0; ch < src_obj->num_channels; ch++) {
@@ -293,7 +302,10 @@ static void asrc_release_buffers(struct asrc_farrow *src_obj)
 	if (!src_obj)
 		return;
 
-	if (src_obj->bit_depth == 32)
+	if (src_obj->channel_parallel) {
+		rfree(src_obj->ring_buffer32_mch);
+		src_obj->ring_buffer32_mch = NULL;
+	} else if (src_obj->bit_depth == 32) {
 		for (ch = 0; ch < src_obj->num_channels; ch++) {
 			buf_32 = src_obj->ring_buffers32[ch];
 
@@ -302,7 +314,7 @@ static void asrc_release_buffers(struct asrc_farrow *src_obj)
 				rfree(buf_32);
 			}
 		}
-	else
+	} else {
 		for (ch = 0; ch < src_obj->num_channels; ch++) {
 			buf_16 = src_obj->ring_buffers16[ch];
 
@@ -311,6 +323,7 @@ static void asrc_release_buffers(struct asrc_farrow *src_obj)
 				rfree(buf_16);
 			}
 		}
+	}
 }
 
 static int asrc_free(struct processing_module *mod)
@@ -509,6 +522,7 @@ static int asrc_trigger(struct processing_module *mod, int cmd)
 		}
 
 		cd->ts_count = 0;
+		asrc_drift_init(&cd->drift, cd->skew);
 		ret = asrc_dai_configure_timestamp(cd);
 		if (ret) {
 			comp_err(dev, "No timestamp capability in DAI");
@@ -705,15 +719,11 @@ static int asrc_control_loop(struct comp_dev *dev, struct comp_data *cd)
 #else
 	struct timestamp_data tsd;
 #endif
-	int64_t tmp;
 	int32_t delta_sample;
 	int32_t delta_ts;
 	int32_t sample;
 	int32_t ts;
-	int32_t skew;
-	int32_t f_ds_dt;
-	int32_t f_ck_fs;
-	int ts_ret;
+	int ret;
 
 	if (!cd->track_drift)
 		return 0;
@@ -724,10 +734,10 @@ static int asrc_control_loop(struct comp_dev *dev, struct comp_data *cd)
 		return 0;
 	}
 
-	ts_ret = asrc_dai_get_timestamp(cd, &tsd);
+	ret = asrc_dai_get_timestamp(cd, &tsd);
 	asrc_dai_start_timestamp(cd);
-	if (ts_ret)
-		return ts_ret;
+	if (ret)
+		return ret;
 
 	ts = (int32_t)(tsd.walclk); /* Let it wrap, diff unwraps */
 	sample = (int32_t)(tsd.sample); /* Let it wrap, diff unwraps */
@@ -744,23 +754,20 @@ static int asrc_control_loop(struct comp_dev *dev, struct comp_data *cd)
 		return 0;
 	}
 
-	/* Prevent divide by zero */
-	if (delta_sample == 0 || tsd.walclk_rate == 0) {
-		comp_err(dev, "asrc_control_loop(), DAI timestamp failed");
-		return -EINVAL;
+	ret = asrc_drift_update(&cd->drift, delta_ts, delta_sample,
+				cd->asrc_obj->fs_sec, tsd.walclk_rate);
+	if (ret == -ERANGE) {
+		comp_warn(dev, "asrc_control_loop(), timestamp glitch %d %d",
+			  delta_sample, delta_ts);
+		return 0;
 	}
 
-	/* fraction f_ds_dt is Q20.12
-	 * fraction f_cd_fs is Q1.31
-	 * drift needs to be Q2.30
-	 */
-	f_ds_dt = (delta_ts << 12) / delta_sample;
-	f_ck_fs = ((int64_t)cd->asrc_obj->fs_sec << 31) / tsd.walclk_rate;
-	skew = q_multsr_sat_32x32(f_ds_dt, f_ck_fs, 13);
+	if (ret) {
+		comp_err(dev, "asrc_control_loop(), DAI timestamp failed");
+		return ret;
+	}
 
-	/* tmp is Q4.60, shift and round to Q2.30 */
-	tmp = ((int64_t)COEF_C1) * skew + ((int64_t)COEF_C2) * cd->skew;
-	cd->skew = sat_int32(Q_SHIFT_RND(tmp, 60, 30));
+	cd->skew = asrc_drift_get_skew(&cd->drift);
 	asrc_update_drift(dev, cd->asrc_obj, cd->skew);
 
 	/* Track skew variation, it helps to analyze possible problems
@@ -768,7 +775,7 @@ static int asrc_control_loop(struct comp_dev *dev, struct comp_data *cd)
 	 */
 	cd->skew_min = MIN(cd->skew, cd->skew_min);
 	cd->skew_max = MAX(cd->skew, cd->skew_max);
-	comp_dbg(dev, "skew %d %d %d %d", delta_sample, delta_ts, skew, cd->skew);
+	comp_dbg(dev, "skew %d %d %d", delta_sample, delta_ts, cd->skew);
 	return 0;
 }
 
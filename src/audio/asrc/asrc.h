@@ -9,6 +9,7 @@
 #include <sof/audio/module_adapter/module/generic.h>
 #include <sof/audio/audio_stream.h>
 #include <sof/audio/component.h>
+#include "asrc_drift.h"
 #include "asrc_farrow.h"
 
 struct comp_data;
@@ -70,17 +71,10 @@ int asrc_dai_get_timestamp(struct comp_data *cd, struct dai_ts_data *tsd);
 int asrc_dai_get_timestamp(struct comp_data *cd, struct timestamp_data *tsd);
 #endif
 /* Simple count value to prevent first delta timestamp
- * from being input to low-pass filter.
+ * from being input to drift estimator.
  */
 #define TS_STABLE_DIFF_COUNT	2
 
-/* Low pass filter coefficient for measured drift factor,
- * The low pass function is y(n) = c1 * x(n) + c2 * y(n -1)
- * coefficient c2 needs to be 1 - c1.
- */
-#define COEF_C1		Q_CONVERT_FLOAT(0.01, 30)
-#define COEF_C2		Q_CONVERT_FLOAT(0.99, 30)
-
 typedef void (*asrc_proc_func)(struct processing_module *mod,
 			       const struct audio_stream *source,
 			       struct audio_stream *sink,
@@ -100,6 +94,7 @@ struct comp_data {
 	uint32_t copy_count;	/* Count copy() operations  */
 	int32_t ts_prev;
 	int32_t sample_prev;
+	struct asrc_drift drift;	/* Drift estimator for DAI timestamps */
 	int32_t skew;		/* Rate factor in Q2.30 */
 	int32_t skew_min;
 	int32_t skew_max;
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/format.h>
+#include <sof/math/numbers.h>
+#include <errno.h>
+#include <stdint.h>
+#include "asrc_drift.h"
+
+void asrc_drift_init(struct asrc_drift *drift, int32_t skew)
+{
+	drift->phase = 0;
+	drift->integrator = skew;
+	drift->skew = skew;
+	drift->glitch_count = 0;
+}
+
+int asrc_drift_update(struct asrc_drift *drift, int32_t delta_ts,
+		      int32_t delta_sample, uint32_t fs, uint32_t walclk_rate)
+{
+	int64_t nominal;
+	int64_t actual;
+	int64_t delta_phase;
+	int64_t glitch;
+	int64_t tmp;
+	int32_t error;
+
+	if (delta_ts <= 0 || delta_sample <= 0 || !fs || !walclk_rate)
+		return -EINVAL;
+
+	/* Number of samples at nominal rate in delta_ts, Q43.20. The
+	 * division is done in two parts to avoid overflow. A truncated
+	 * result would bias the skew since the phase accumulates it.
+	 */
+	tmp = (int64_t)delta_ts * fs;
+	nominal = (tmp / walclk_rate) << 20;
+	nominal += ((tmp % walclk_rate) << 20) / walclk_rate;
+
+	/* Transferred samples scaled with the skew estimate, Q2.30 x Q31.0
+	 * is shifted and rounded to Q43.20.
+	 */
+	actual = Q_SHIFT_RND((int64_t)delta_sample * drift->skew, 30, 20);
+
+	delta_phase = nominal - actual;
+	glitch = ((int64_t)delta_sample << 20) >> ASRC_DRIFT_PHASE_GLITCH_SHIFT;
+	if (delta_phase > glitch || delta_phase < -glitch) {
+		drift->glitch_count++;
+		return -ERANGE;
+	}
+
+	drift->phase += delta_phase;
+
+	/* Phase error normalized by period is the loop filter input as
+	 * Q2.30 rate error.
+	 */
+	error = sat_int32((drift->phase << 10) / delta_sample);
+	tmp = (int64_t)drift->integrator + (error >> ASRC_DRIFT_KI_SHIFT);
+	drift->integrator = MIN(MAX(tmp, ASRC_DRIFT_SKEW_MIN), ASRC_DRIFT_SKEW_MAX);
+	tmp = (int64_t)drift->integrator + (error >> ASRC_DRIFT_KP_SHIFT);
+	drift->skew = MIN(MAX(tmp, ASRC_DRIFT_SKEW_MIN), ASRC_DRIFT_SKEW_MAX);
+	return 0;
+}
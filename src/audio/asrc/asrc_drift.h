@@ -0,0 +1,82 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+/* @brief    Drift estimator for the asynchronous sample rate converter.
+ *
+ * The estimator is a second order phase-locked loop. The phase detector
+ * compares the number of samples the DAI has transferred against the number
+ * of samples the current rate skew estimate predicts from the elapsed wall
+ * clock time. The accumulated phase error is fed into a proportional-integral
+ * loop filter that updates the skew incrementally. Since the timestamp deltas
+ * telescope into the accumulated phase the jitter of individual timestamps
+ * does not accumulate, and a drifting clock is followed without a growing
+ * buffer level error as happens with a low-pass filtered per period skew.
+ */
+
+#ifndef __SOF_AUDIO_ASRC_ASRC_DRIFT_H__
+#define __SOF_AUDIO_ASRC_ASRC_DRIFT_H__
+
+#include <sof/audio/format.h>
+#include <stdint.h>
+
+/* Loop filter gains as right shifts of the phase error normalized by
+ * period length. The values give a well damped response with a time
+ * constant of about 128 periods.
+ */
+#define ASRC_DRIFT_KP_SHIFT		7
+#define ASRC_DRIFT_KI_SHIFT		15
+
+/* A single update that moves the phase more than 1/8 of the period is
+ * considered a timestamp glitch, e.g. due to a missed period. The update
+ * is dropped, the phase error and the loop filter keep their state and
+ * asrc_drift_update() returns -ERANGE.
+ */
+#define ASRC_DRIFT_PHASE_GLITCH_SHIFT	3
+
+/* Skew limits in Q2.30, the same range is accepted by asrc_update_drift() */
+#define ASRC_DRIFT_SKEW_MIN		Q_CONVERT_FLOAT(0.5, 30)
+#define ASRC_DRIFT_SKEW_MAX		INT32_MAX
+
+struct asrc_drift {
+	int64_t phase;		/* Accumulated phase error, samples in Q43.20 */
+	int32_t integrator;	/* Loop filter integrator, Q2.30 */
+	int32_t skew;		/* Estimated rate skew, Q2.30 */
+	uint32_t glitch_count;	/* Number of rejected updates */
+};
+
+/**
+ * @brief Initialize the drift estimator.
+ *
+ * @param[out] drift Estimator state.
+ * @param[in] skew Initial rate skew in Q2.30, e.g. from a previous run.
+ */
+void asrc_drift_init(struct asrc_drift *drift, int32_t skew);
+
+/**
+ * @brief Update the drift estimate with a new timestamp delta.
+ *
+ * @param[in,out] drift Estimator state.
+ * @param[in] delta_ts Elapsed wall clock ticks since previous update.
+ * @param[in] delta_sample Number of samples transferred by DAI in delta_ts.
+ * @param[in] fs Nominal sample rate of the DAI side in Hz.
+ * @param[in] walclk_rate Wall clock rate in Hz.
+ * @return 0 if the skew estimate was updated, -ERANGE if the update was
+ *	   rejected as a glitch, -EINVAL for invalid input.
+ */
+int asrc_drift_update(struct asrc_drift *drift, int32_t delta_ts,
+		      int32_t delta_sample, uint32_t fs, uint32_t walclk_rate);
+
+/**
+ * @brief Get the current rate skew estimate.
+ *
+ * @param[in] drift Estimator state.
+ * @return Rate skew in Q2.30.
+ */
+static inline int32_t asrc_drift_get_skew(const struct asrc_drift *drift)
+{
+	return drift->skew;
+}
+
+#endif /* __SOF_AUDIO_ASRC_ASRC_DRIFT_H__ */
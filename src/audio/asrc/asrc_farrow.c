@@ -393,6 +393,19 @@ enum asrc_error_code asrc_initialise(struct comp_dev *dev,
 	src_obj->is_initialised = false;
 	src_obj->is_updated = false;
 
+	/* Select the 32 bit filter and the matching ring buffer layout */
+	src_obj->ring_buffer32_mch = NULL;
+	src_obj->channel_parallel = false;
+	src_obj->fir_filter32 = &asrc_fir_filter32;
+	src_obj->write_to_ring_buffer32 = &asrc_write_to_ring_buffer32;
+#ifdef ASRC_CHANNEL_PARALLEL
+	if (bit_depth == 32 && ASRC_CHANNEL_PARALLEL(num_channels)) {
+		src_obj->channel_parallel = true;
+		src_obj->fir_filter32 = &asrc_fir_filter32_mch;
+		src_obj->write_to_ring_buffer32 = &asrc_write_to_ring_buffer32_mch;
+	}
+#endif
+
 	/* check conversion ratios */
 	if (src_obj->fs_ratio == 0 || src_obj->fs_ratio_inv == 0) {
 		comp_err(dev, "asrc_initialise(), fail to calculate ratios");
@@ -957,6 +970,41 @@ void asrc_write_to_ring_buffer32(struct asrc_farrow  *src_obj,
 	}
 }
 
+void asrc_write_to_ring_buffer32_mch(struct asrc_farrow *src_obj,
+				     int32_t **input_buffers, int index_input_frame)
+{
+	int32_t *buffer_p;
+	int32_t *buffer_redundant_p;
+	int nch = src_obj->num_channels;
+	int ch;
+	int m;
+
+	/* update the buffer_write_position */
+	(src_obj->buffer_write_position)--;
+
+	/* since it's a ring buffer we need a wrap around */
+	if (src_obj->buffer_write_position < 0)
+		src_obj->buffer_write_position += (src_obj->buffer_length >> 1);
+
+	/* handle input format */
+	if (src_obj->input_format == ASRC_IOF_INTERLEAVED)
+		m = nch * index_input_frame;
+	else
+		m = index_input_frame; /* For SRC_IOF_DEINTERLEAVED */
+
+	/*
+	 * The ring buffer stores the channels of a frame next to each
+	 * other. The frame is written twice to the redundant halves of
+	 * the buffer, see asrc_write_to_ring_buffer32().
+	 */
+	buffer_p = &src_obj->ring_buffer32_mch[src_obj->buffer_write_position * nch];
+	buffer_redundant_p = buffer_p + (src_obj->buffer_length >> 1) * nch;
+	for (ch = 0; ch < nch; ch++) {
+		buffer_p[ch] = input_buffers[ch][m];
+		buffer_redundant_p[ch] = input_buffers[ch][m];
+	}
+}
+
 enum asrc_error_code asrc_process_push16(struct comp_dev *dev,
 					 struct asrc_farrow *src_obj,
 					 int16_t **__restrict input_buffers,
@@ -1117,8 +1165,8 @@ enum asrc_error_code asrc_process_push32(struct comp_dev *dev,
 			/* Filter and write output sample to
 			 * output_buffer
 			 */
-			asrc_fir_filter32(src_obj, output_buffers,
-					  src_obj->io_buffer_idx);
+			(*src_obj->fir_filter32)(src_obj, output_buffers,
+						 src_obj->io_buffer_idx);
 
 			/* Update time and index */
 			src_obj->time_value += src_obj->fs_ratio;
@@ -1132,8 +1180,8 @@ enum asrc_error_code asrc_process_push32(struct comp_dev *dev,
 			(*output_num_frames)++;
 		} else {
 			/* Consume input sample */
-			asrc_write_to_ring_buffer32(src_obj, input_buffers,
-						    index_input_frame);
+			(*src_obj->write_to_ring_buffer32)(src_obj, input_buffers,
+							   index_input_frame);
 			index_input_frame++;
 
 			/* Update time */
@@ -1316,9 +1364,9 @@ enum asrc_error_code asrc_process_pull32(struct comp_dev *dev,
 			if (src_obj->io_buffer_idx == write_index)
 				break;
 
-			asrc_write_to_ring_buffer32(src_obj,
-						    input_buffers,
-						    src_obj->io_buffer_idx);
+			(*src_obj->write_to_ring_buffer32)(src_obj,
+							   input_buffers,
+							   src_obj->io_buffer_idx);
 			src_obj->io_buffer_idx++;
 
 			/* Wrap around */
@@ -1338,8 +1386,8 @@ enum asrc_error_code asrc_process_pull32(struct comp_dev *dev,
 			(*src_obj->calc_ir)(src_obj);
 
 			/* Filter and write output sample to output_buffer */
-			asrc_fir_filter32(src_obj, output_buffers,
-					  index_output_frame);
+			(*src_obj->fir_filter32)(src_obj, output_buffers,
+						 index_output_frame);
 
 			/* Update time and index */
 			src_obj->time_value += src_obj->fs_ratio_inv;
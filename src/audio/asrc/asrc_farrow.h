@@ -42,6 +42,8 @@
 #define IAS_SRC_FARROW_H
 
 #include <sof/audio/component.h>
+#include <sof/common.h>
+#include <sof/platform.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -52,6 +54,20 @@
  */
 #define ASRC_MAX_FILTER_LENGTH	128
 
+/*
+ * Condition to use the channel parallel 32 bit filter. The kernel
+ * filters all channels in one pass over the impulse response from a
+ * frame interleaved ring buffer. The HiFi5 version filters channel
+ * pairs loaded as aligned 64 bit words so it needs an even number of
+ * channels. The HiFi3 build uses only the per channel filter.
+ */
+#if SOF_USE_HIFI(NONE, ASRC)
+#define ASRC_CHANNEL_PARALLEL(nch)	((nch) > 2 && (nch) <= PLATFORM_MAX_CHANNELS)
+#elif SOF_USE_MIN_HIFI(5, ASRC)
+#define ASRC_CHANNEL_PARALLEL(nch)	((nch) > 2 && (nch) <= PLATFORM_MAX_CHANNELS && \
+					 !((nch) & 1))
+#endif
+
 /*
  * @brief Define whether the input and output buffers shall be
  * interleaved or not.
@@ -150,6 +166,12 @@ struct asrc_farrow {
 	int16_t **ring_buffers16;	/*!< Pointer to the pointers to the */
 					/*!< 16 bit ring buffers for each */
 					/*!< channel */
+	int32_t *ring_buffer32_mch;	/*!< Frame interleaved 32 bit ring */
+					/*!< buffer for all channels, used */
+					/*!< instead of ring_buffers32 with */
+					/*!< the channel parallel filter */
+	bool channel_parallel;	/*!< Flag is set if the channel parallel */
+				/*!< 32 bit filter is used */
 
 	/* + IO ring_buffer status */
 	enum asrc_buffer_mode io_buffer_mode; /*!< Mode in which IO buffers */
@@ -209,6 +231,14 @@ struct asrc_farrow {
 	/* + function pointer */
 	void (*calc_ir)(struct asrc_farrow *src_obj);	/*!< Pointer */
 	/*!< to the function which calculates the impulse response */
+	void (*fir_filter32)(struct asrc_farrow *src_obj,
+			     int32_t **output_buffers,
+			     int index_output_frame);	/*!< Pointer */
+	/*!< to the 32 bit filter function */
+	void (*write_to_ring_buffer32)(struct asrc_farrow *src_obj,
+				       int32_t **input_buffers,
+				       int index_input_frame);	/*!< Pointer */
+	/*!< to the 32 bit ring buffer write function */
 };
 
 /*
@@ -640,6 +670,14 @@ void asrc_fir_filter16(struct asrc_farrow *src_obj,
 		       int16_t **output_buffers,
 		       int index_output_frame);
 
+/*
+ * Write value of 32 bit input buffers to the frame interleaved ring
+ * buffer of the channel parallel filter
+ */
+void asrc_write_to_ring_buffer32_mch(struct asrc_farrow *src_obj,
+				     int32_t **input_buffers,
+				     int index_input_frame);
+
 /*
  * Filter the 32 bit ring buffer values with impulse_response
  */
@@ -647,6 +685,14 @@ void asrc_fir_filter32(struct asrc_farrow *src_obj,
 		       int32_t **output_buffers,
 		       int index_output_frame);
 
+/*
+ * Filter the frame interleaved 32 bit ring buffer values of all
+ * channels with impulse_response in one pass
+ */
+void asrc_fir_filter32_mch(struct asrc_farrow *src_obj,
+			   int32_t **output_buffers,
+			   int index_output_frame);
+
 /*
  * Calculates the impulse response. This impulse response is then
  * applied to the buffered signal, in order to generate the output.
@@ -111,6 +111,54 @@ void asrc_fir_filter32(struct asrc_farrow *src_obj, int32_t **output_buffers,
 	}
 }
 
+void asrc_fir_filter32_mch(struct asrc_farrow *src_obj, int32_t **output_buffers,
+			   int index_output_frame)
+{
+	int64_t prod[PLATFORM_MAX_CHANNELS];
+	const int32_t *filter_p;
+	const int32_t *buffer_p;
+	int32_t coef;
+	const int nch = src_obj->num_channels;
+	int ch;
+	int n;
+	int i;
+
+	if (src_obj->output_format == ASRC_IOF_INTERLEAVED)
+		i = nch * index_output_frame;
+	else
+		i = index_output_frame;
+
+	/* Pointer to the beginning of the impulse response */
+	filter_p = &src_obj->impulse_response[0];
+
+	/* Pointer to the first buffered frame, channels are next to
+	 * each other.
+	 */
+	buffer_p = &src_obj->ring_buffer32_mch[src_obj->buffer_write_position * nch];
+
+	/* Initialise the accumulators */
+	for (ch = 0; ch < nch; ch++)
+		prod[ch] = 0;
+
+	/* Iterate over the filter bins. The coefficient is loaded once
+	 * and applied to all channels of the frame. The inner loop over
+	 * contiguous samples and independent accumulators can be
+	 * vectorized by the compiler. The arithmetic is the same as in
+	 * asrc_fir_filter32().
+	 */
+	for (n = 0; n < src_obj->filter_length; n++) {
+		coef = *filter_p++ >> 8;
+		for (ch = 0; ch < nch; ch++)
+			prod[ch] += (int64_t)buffer_p[ch] * coef;
+
+		buffer_p += nch;
+	}
+
+	/* Store in (de-)interleaved format in the output buffers */
+	for (ch = 0; ch < nch; ch++)
+		output_buffers[ch][i] = sat_int32(Q_SHIFT(prod[ch], 53, 31));
+}
+
 /* + ALGORITHM SPECIFIC FUNCTIONS */
 
 void asrc_calc_impulse_response_n4(struct asrc_farrow *src_obj)
@@ -148,6 +148,94 @@ void asrc_fir_filter32(struct asrc_farrow *src_obj, int32_t **output_buffers,
 	}
 }
 
+void asrc_fir_filter32_mch(struct asrc_farrow *src_obj, int32_t **output_buffers,
+			   int index_output_frame)
+{
+	ae_valign align_filter;
+	ae_f64 prod0;
+	ae_f64 prod1;
+	ae_f64 prod2;
+	ae_f64 prod3;
+	ae_f32x2 buffer0;
+	ae_f32x2 buffer1;
+	ae_f32x2 filter01;
+	ae_f32x2 filter0;
+	ae_f32x2 filter1;
+	const ae_f32x2 *filter_p;
+	const ae_int32x2 *buffer_p;
+	const int nch = src_obj->num_channels;
+	const int stride = nch * sizeof(int32_t);
+	int n_limit;
+	int ch;
+	int n;
+	int i;
+
+	/*
+	 * Two filter bins of two channels are accumulated per iteration.
+	 * Also handle possible interleaved output.
+	 */
+	n_limit = src_obj->filter_length >> 1;
+	if (src_obj->output_format == ASRC_IOF_INTERLEAVED)
+		i = nch * index_output_frame;
+	else
+		i = index_output_frame;
+
+	/* Iterate over channel pairs, the number of channels is even */
+	for (ch = 0; ch < nch; ch += 2) {
+		/* Pointer to the beginning of the impulse response */
+		filter_p = (const ae_f32x2 *)&src_obj->impulse_response[0];
+
+		/* Pointer to the channel pair in the first buffered frame.
+		 * With even number of channels the pair is 64 bit aligned.
+		 */
+		buffer_p = (const ae_int32x2 *)
+			&src_obj->ring_buffer32_mch[src_obj->buffer_write_position * nch + ch];
+
+		/* Allows unaligned load of 64 bit per cycle */
+		align_filter = AE_LA64_PP(filter_p);
+
+		/* Initialise the accumulators */
+		prod0 = AE_ZERO64();
+		prod1 = AE_ZERO64();
+		prod2 = AE_ZERO64();
+		prod3 = AE_ZERO64();
+
+		/* Iterate over the filter bins */
+		for (n = 0; n < n_limit; n++) {
+			/* Load two bins of the impulse response and
+			 * replicate them to both halves
+			 */
+			AE_LA32X2_IP(filter01, align_filter, filter_p);
+			filter0 = AE_SEL32_HH(filter01, filter01);
+			filter1 = AE_SEL32_LL(filter01, filter01);
+
+			/* Load the channel pair from two buffered frames */
+			AE_L32X2_XP(buffer0, buffer_p, stride);
+			AE_L32X2_XP(buffer1, buffer_p, stride);
+
+			/* Multiply and accumulate */
+			AE_MULAF32R_HH(prod0, buffer0, filter0);
+			AE_MULAF32R_LL(prod1, buffer0, filter0);
+			AE_MULAF32R_HH(prod2, buffer1, filter1);
+			AE_MULAF32R_LL(prod3, buffer1, filter1);
+		}
+
+		/* Add up the accumulators of each channel */
+		prod0 = AE_ADD64S(prod0, prod2);
+		prod1 = AE_ADD64S(prod1, prod3);
+
+		/* Shift with saturation, use buffer0 as scratch */
+		buffer0 = AE_SLAI32S(AE_ROUND32X2F48SASYM(prod0, prod1), 1);
+
+		/* Store in (de-)interleaved format in the output buffers,
+		 * the high half is the first channel of the pair
+		 */
+		AE_S32_L_X(buffer0, (ae_f32 *)&output_buffers[ch + 1][i], 0);
+		buffer0 = AE_SEL32_HH(buffer0, buffer0);
+		AE_S32_L_X(buffer0, (ae_f32 *)&output_buffers[ch][i], 0);
+	}
+}
+
 /* + ALGORITHM SPECIFIC FUNCTIONS */
 
 void asrc_calc_impulse_response_n4(struct asrc_farrow *src_obj)
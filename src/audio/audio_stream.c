@@ -44,6 +44,26 @@ void audio_stream_set_align(const uint32_t byte_align,
 	audio_stream_recalc_align(stream);
 }
 EXPORT_SYMBOL(audio_stream_set_align);
+
+void audio_stream_alias_update(struct audio_stream *stream)
+{
+	struct audio_stream *s;
+	uint32_t avail = 0;
+
+	while (stream->alias_source)
+		stream = stream->alias_source;
+
+	for (s = stream; s; s = s->alias_sink)
+		avail += s->avail;
+
+	/* the head stream can only be written where none of the chain has data */
+	for (s = stream; s; s = s->alias_sink) {
+		s->free = s->size - avail;
+		avail -= s->avail;
+	}
+}
+EXPORT_SYMBOL(audio_stream_alias_update);
+
 void audio_stream_init(struct audio_stream *audio_stream, void *buff_addr, uint32_t size)
 {
 	audio_stream->size = size;
@@ -15,6 +15,7 @@
 #include <sof_versions.h>
 #include <sof/lib/cpu-clk-manager.h>
 #include <sof/lib/cpu.h>
+#include <sof/lib/heap_telemetry.h>
 #include <sof/platform.h>
 #include <sof/lib_manager.h>
 #include <rtos/clk.h>
@@ -512,6 +513,19 @@ static int io_perf_monitor_state_set(const char *data)
 #endif
 }
 
+static int basefw_heap_telemetry_get(uint32_t *data_off_size, char *data)
+{
+#if CONFIG_DEBUG_HEAP_TELEMETRY
+	*data_off_size = heap_telemetry_get((struct heap_telemetry_data *)data,
+					    SOF_IPC_MSG_MAX_SIZE);
+
+	return *data_off_size ? IPC4_SUCCESS : IPC4_ERROR_INVALID_PARAM;
+#else
+	/* disabled, or a Zephyr build where the heap is not instrumented */
+	return IPC4_UNAVAILABLE;
+#endif
+}
+
 static int basefw_get_large_config(struct comp_dev *dev,
 				   uint32_t param_id,
 				   bool first_block,
@@ -559,6 +573,8 @@ static int basefw_get_large_config(struct comp_dev *dev,
 		return io_global_perf_state_get(data_offset, data);
 	case IPC4_IO_GLOBAL_PERF_DATA:
 		return io_global_perf_data_get(data_offset, data);
+	case IPC4_HEAP_TELEMETRY_GET:
+		return basefw_heap_telemetry_get(data_offset, data);
 
 	/* TODO: add more support */
 	case IPC4_DSP_RESOURCE_STATE:
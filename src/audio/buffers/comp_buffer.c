@@ -133,6 +133,10 @@ static void comp_buffer_reset(struct sof_audio_buffer *audio_buffer)
 	audio_stream_reset(&buffer->stream);
 	/* clear buffer contents */
 	buffer_zero(buffer);
+
+	/* drop the transactions not delivered yet */
+	if (buffer->notify)
+		buffer->notify->pending.transaction_amount = 0;
 }
 
 /* free component in the pipeline */
@@ -151,13 +155,26 @@ static void comp_buffer_free(struct sof_audio_buffer *audio_buffer)
 
 	buf_dbg(buffer, "buffer_free()");
 
+	if (buffer->notify) {
+		buffer_notify_flush(buffer);
+		buffer_listener_unregister(buffer, NULL, NOTIFIER_ID_BUFFER_PRODUCE);
+		buffer_listener_unregister(buffer, NULL, NOTIFIER_ID_BUFFER_CONSUME);
+	}
+
 	notifier_event(buffer, NOTIFIER_ID_BUFFER_FREE,
 		       NOTIFIER_TARGET_CORE_LOCAL, &cb_data, sizeof(cb_data));
 
 	/* In case some listeners didn't unregister from buffer's callbacks */
 	notifier_unregister_all(NULL, buffer);
 
-	rfree(buffer->stream.addr);
+	/* unlink from the alias chain, the memory is owned by the head of the chain */
+	if (buffer->stream.alias_sink)
+		buffer->stream.alias_sink->alias_source = buffer->stream.alias_source;
+
+	if (buffer->stream.alias_source)
+		buffer->stream.alias_source->alias_sink = buffer->stream.alias_sink;
+	else if (!buffer->stream.alias_sink)
+		rfree(buffer->stream.addr);
 }
 
 static struct source_ops comp_buffer_source_ops = {
@@ -318,6 +335,11 @@ int buffer_set_size(struct comp_buffer *buffer, uint32_t size, uint32_t alignmen
 	if (size == audio_stream_get_size(&buffer->stream))
 		return 0;
 
+	if (buffer->stream.alias_source || buffer->stream.alias_sink) {
+		buf_err(buffer, "resize of aliased buffer");
+		return -EBUSY;
+	}
+
 	if (!alignment)
 		new_ptr = rbrealloc(audio_stream_get_addr(&buffer->stream), SOF_MEM_FLAG_NO_COPY,
 				    buffer->caps, size, audio_stream_get_size(&buffer->stream));
@@ -398,6 +420,78 @@ int buffer_set_size_range(struct comp_buffer *buffer, size_t preferred_size, siz
 	return 0;
 }
 
+static void buffer_stream_set_memory(struct audio_stream *stream, void *addr, uint32_t size)
+{
+	audio_stream_set_addr(stream, addr);
+	audio_stream_set_size(stream, size);
+	audio_stream_set_end_addr(stream, (char *)addr + size);
+	audio_stream_reset(stream);
+}
+
+int buffer_alias(struct comp_buffer *source, struct comp_buffer *sink)
+{
+	CORE_CHECK_STRUCT(&source->audio_buffer);
+	CORE_CHECK_STRUCT(&sink->audio_buffer);
+
+	if (source->stream.alias_sink || sink->stream.alias_source || sink->stream.alias_sink)
+		return -EBUSY;
+
+	/* a reset or zeroing of one stream would drop the data of the others */
+	if (source->no_alias || sink->no_alias)
+		return -EPERM;
+
+	/* the chain must hold what the sink consumer expects to find */
+	if (audio_stream_get_size(&source->stream) < audio_stream_get_size(&sink->stream))
+		return -EINVAL;
+
+	buf_dbg(sink, "buffer_alias(): to buffer %u", buf_get_id(source));
+
+	rfree(audio_stream_get_addr(&sink->stream));
+	sink->alias_size = audio_stream_get_size(&sink->stream);
+
+	sink->stream.alias_source = &source->stream;
+	source->stream.alias_sink = &sink->stream;
+	buffer_stream_set_memory(&sink->stream, audio_stream_get_addr(&source->stream),
+				 audio_stream_get_size(&source->stream));
+	audio_stream_reset(&source->stream);
+
+	return 0;
+}
+
+int buffer_unalias(struct comp_buffer *buffer)
+{
+	struct audio_stream *source;
+	struct audio_stream *stream;
+	void *addr;
+
+	CORE_CHECK_STRUCT(&buffer->audio_buffer);
+
+	if (!buffer->stream.alias_source)
+		return 0;
+
+	addr = rballoc_align(0, buffer->caps, buffer->alias_size, PLATFORM_DCACHE_ALIGN);
+	if (!addr) {
+		buf_err(buffer, "unalias can't alloc %u bytes type %u",
+			buffer->alias_size, buffer->caps);
+		return -ENOMEM;
+	}
+
+	buf_dbg(buffer, "buffer_unalias()");
+
+	source = buffer->stream.alias_source;
+	source->alias_sink = NULL;
+	buffer->stream.alias_source = NULL;
+	audio_stream_alias_update(source);
+
+	/* buffers still aliased to this one follow it to the new memory */
+	for (stream = &buffer->stream; stream; stream = stream->alias_sink)
+		buffer_stream_set_memory(stream, addr, buffer->alias_size);
+
+	buffer_zero(buffer);
+
+	return 0;
+}
+
 int buffer_set_params(struct comp_buffer *buffer,
 		      struct sof_ipc_stream_params *params, bool force_update)
 {
@@ -451,13 +545,130 @@ bool buffer_params_match(struct comp_buffer *buffer,
 	return true;
 }
 
+int buffer_listener_register(struct comp_buffer *buffer, void *receiver, enum notify_id type,
+			     notifier_callback_t cb)
+{
+	struct buffer_notify *notify = buffer->notify;
+	struct buffer_listener *listener;
+	uint32_t flags;
+
+	assert(type == NOTIFIER_ID_BUFFER_PRODUCE || type == NOTIFIER_ID_BUFFER_CONSUME);
+
+	listener = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, sizeof(*listener));
+	if (!listener)
+		return -ENOMEM;
+
+	if (!notify) {
+		notify = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, sizeof(*notify));
+		if (!notify) {
+			rfree(listener);
+			return -ENOMEM;
+		}
+
+		list_init(&notify->listeners);
+		notify->pending.buffer = buffer;
+	}
+
+	listener->receiver = receiver;
+	listener->type = type;
+	listener->cb = cb;
+
+	irq_local_disable(flags);
+	list_item_append(&listener->list, &notify->listeners);
+	notify->types |= BIT(type);
+	buffer->notify = notify;
+	irq_local_enable(flags);
+
+	return 0;
+}
+EXPORT_SYMBOL(buffer_listener_register);
+
+void buffer_listener_unregister(struct comp_buffer *buffer, void *receiver,
+				enum notify_id type)
+{
+	struct buffer_notify *notify = buffer->notify;
+	struct buffer_listener *listener;
+	struct list_item *item, *tmp;
+	uint32_t types = 0;
+	uint32_t flags;
+
+	if (!notify)
+		return;
+
+	irq_local_disable(flags);
+
+	list_for_item_safe(item, tmp, &notify->listeners) {
+		listener = container_of(item, struct buffer_listener, list);
+		if (listener->type == type && (!receiver || listener->receiver == receiver)) {
+			list_item_del(&listener->list);
+			rfree(listener);
+		} else {
+			types |= BIT(listener->type);
+		}
+	}
+
+	/* a pending transaction nobody listens to anymore is dropped */
+	if (!(types & BIT(notify->pending_type)))
+		notify->pending.transaction_amount = 0;
+
+	notify->types = types;
+	if (!types)
+		buffer->notify = NULL;
+
+	irq_local_enable(flags);
+
+	if (!types)
+		rfree(notify);
+}
+EXPORT_SYMBOL(buffer_listener_unregister);
+
+void buffer_notify_flush(struct comp_buffer *buffer)
+{
+	struct buffer_notify *notify = buffer->notify;
+	struct buffer_cb_transact cb_data = notify->pending;
+	struct buffer_listener *listener;
+	struct list_item *item;
+
+	if (!cb_data.transaction_amount)
+		return;
+
+	notify->pending.transaction_amount = 0;
+
+	list_for_item(item, &notify->listeners) {
+		listener = container_of(item, struct buffer_listener, list);
+		if (listener->type == notify->pending_type)
+			listener->cb(listener->receiver, notify->pending_type, &cb_data);
+	}
+}
+EXPORT_SYMBOL(buffer_notify_flush);
+
+/* add a transaction to the pending notification of a buffer with listeners */
+static void buffer_notify_transact(struct comp_buffer *buffer, enum notify_id type,
+				   void *addr, uint32_t bytes)
+{
+	struct buffer_notify *notify = buffer->notify;
+	struct buffer_cb_transact *pending = &notify->pending;
+
+	if (!(notify->types & BIT(type)))
+		return;
+
+	/* keep produce and consume in order and never cover more than the whole buffer */
+	if (pending->transaction_amount &&
+	    (notify->pending_type != type ||
+	     pending->transaction_amount + bytes > audio_stream_get_size(&buffer->stream)))
+		buffer_notify_flush(buffer);
+
+	if (!pending->transaction_amount) {
+		notify->pending_type = type;
+		pending->transaction_begin_address = addr;
+	}
+
+	pending->transaction_amount += bytes;
+}
+
 void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
 {
-	struct buffer_cb_transact cb_data = {
-		.buffer = buffer,
-		.transaction_amount = bytes,
-		.transaction_begin_address = audio_stream_get_wptr(&buffer->stream),
-	};
+	void *addr = audio_stream_get_wptr(&buffer->stream);
 
 	/* return if no bytes */
 	if (!bytes) {
@@ -476,8 +687,8 @@ void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
 
 	audio_stream_produce(&buffer->stream, bytes);
 
-	notifier_event(buffer, NOTIFIER_ID_BUFFER_PRODUCE,
-		       NOTIFIER_TARGET_CORE_LOCAL, &cb_data, sizeof(cb_data));
+	if (buffer->notify)
+		buffer_notify_transact(buffer, NOTIFIER_ID_BUFFER_PRODUCE, addr, bytes);
 
 #if CONFIG_SOF_LOG_DBG_BUFFER
 	buf_dbg(buffer, "comp_update_buffer_produce(), ((buffer->avail << 16) | buffer->free) = %08x, ((buffer->id << 16) | buffer->size) = %08x",
@@ -494,11 +705,7 @@ void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
 
 void comp_update_buffer_consume(struct comp_buffer *buffer, uint32_t bytes)
 {
-	struct buffer_cb_transact cb_data = {
-		.buffer = buffer,
-		.transaction_amount = bytes,
-		.transaction_begin_address = audio_stream_get_rptr(&buffer->stream),
-	};
+	void *addr = audio_stream_get_rptr(&buffer->stream);
 
 	CORE_CHECK_STRUCT(&buffer->audio_buffer);
 
@@ -519,8 +726,8 @@ void comp_update_buffer_consume(struct comp_buffer *buffer, uint32_t bytes)
 
 	audio_stream_consume(&buffer->stream, bytes);
 
-	notifier_event(buffer, NOTIFIER_ID_BUFFER_CONSUME,
-		       NOTIFIER_TARGET_CORE_LOCAL, &cb_data, sizeof(cb_data));
+	if (buffer->notify)
+		buffer_notify_transact(buffer, NOTIFIER_ID_BUFFER_CONSUME, addr, bytes);
 
 #if CONFIG_SOF_LOG_DBG_BUFFER
 	buf_dbg(buffer, "comp_update_buffer_consume(), (buffer->avail << 16) | buffer->free = %08x, (buffer->id << 16) | buffer->size = %08x, (buffer->r_ptr - buffer->addr) << 16 | (buffer->w_ptr - buffer->addr)) = %08x",
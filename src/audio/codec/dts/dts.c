@@ -143,6 +143,8 @@ static int dts_codec_init(struct processing_module *mod)
 
 	comp_dbg(dev, "dts_codec_init() start");
 
+	mod->raw_data_zero_copy = true;
+
 	dts_result = dtsSofInterfaceInit((DtsSofInterfaceInst **)&(codec->private),
 		dts_effect_allocate_codec_memory, dts_effect_free_codec_memory, mod);
 	ret = dts_effect_convert_sof_interface_result(dev, dts_result);
@@ -261,8 +263,7 @@ dts_codec_process(struct processing_module *mod,
 			return ret;
 	}
 
-	memcpy_s(codec->mpd.in_buff, codec->mpd.in_buff_size,
-		 input_buffers[0].data, codec->mpd.in_buff_size);
+	module_input_read(&input_buffers[0], 0, codec->mpd.in_buff, codec->mpd.in_buff_size);
 	codec->mpd.avail = codec->mpd.in_buff_size;
 
 	comp_dbg(dev, "dts_codec_process() start");
@@ -280,9 +281,7 @@ dts_codec_process(struct processing_module *mod,
 	}
 
 	/* copy the produced samples into the output buffer */
-	memcpy_s(output_buffers[0].data, codec->mpd.produced, codec->mpd.out_buff,
-		 codec->mpd.produced);
-	output_buffers[0].size = codec->mpd.produced;
+	module_output_write(&output_buffers[0], codec->mpd.out_buff, codec->mpd.produced);
 
 	comp_dbg(dev, "dts_codec_process() done");
 
@@ -40,6 +40,17 @@ SOF_DEFINE_REG_UUID(component);
 
 DECLARE_TR_CTX(comp_tr, SOF_UUID(component_uuid), LOG_LEVEL_INFO);
 
+/* The UUID is folded to 32 bits and spread over the buckets with
+ * multiplicative hashing. The UUID in IPC messages may be unaligned.
+ */
+static uint32_t comp_driver_hash(const void *uuid)
+{
+	uint32_t w[UUID_SIZE / sizeof(uint32_t)];
+
+	memcpy_s(w, sizeof(w), uuid, UUID_SIZE);
+	return ((w[0] ^ w[1] ^ w[2] ^ w[3]) * 0x9e3779b1u) >> (32 - COMP_DRIVER_HASH_BITS);
+}
+
 int comp_register(struct comp_driver_info *drv)
 {
 	struct comp_driver_list *drivers = comp_drivers_get();
@@ -47,6 +58,7 @@ int comp_register(struct comp_driver_info *drv)
 
 	key = k_spin_lock(&drivers->lock);
 	list_item_prepend(&drv->list, &drivers->list);
+	list_item_prepend(&drv->hash_list, &drivers->hash[comp_driver_hash(drv->drv->uid)]);
 	k_spin_unlock(&drivers->lock, key);
 
 	return 0;
@@ -60,9 +72,25 @@ void comp_unregister(struct comp_driver_info *drv)
 
 	key = k_spin_lock(&drivers->lock);
 	list_item_del(&drv->list);
+	list_item_del(&drv->hash_list);
 	k_spin_unlock(&drivers->lock, key);
 }
 
+const struct comp_driver *comp_driver_find_by_uuid(const void *uuid)
+{
+	struct comp_driver_list *drivers = comp_drivers_get();
+	struct comp_driver_info *info;
+	struct list_item *clist;
+
+	list_for_item(clist, &drivers->hash[comp_driver_hash(uuid)]) {
+		info = container_of(clist, struct comp_driver_info, hash_list);
+		if (!memcmp(info->drv->uid, uuid, UUID_SIZE))
+			return info->drv;
+	}
+
+	return NULL;
+}
+
 /* NOTE: Keep the component state diagram up to date:
  * sof-docs/developer_guides/firmware/components/images/comp-dev-states.pu
  */
@@ -156,9 +184,13 @@ EXPORT_SYMBOL(comp_set_state);
 
 void sys_comp_init(struct sof *sof)
 {
+	int i;
+
 	sof->comp_drivers = platform_shared_get(&cd, sizeof(cd));
 
 	list_init(&sof->comp_drivers->list);
+	for (i = 0; i < COMP_DRIVER_HASH_SIZE; i++)
+		list_init(&sof->comp_drivers->hash[i]);
 	k_spinlock_init(&sof->comp_drivers->lock);
 }
 
@@ -382,6 +414,10 @@ int audio_stream_copy(const struct audio_stream *source, uint32_t ioffset,
 	size_t bytes_snk;
 	size_t bytes_copied;
 
+	/* nothing to move for streams sharing memory in place */
+	if (src == snk)
+		return samples;
+
 	while (bytes) {
 		bytes_src = audio_stream_bytes_without_wrap(source, src);
 		bytes_snk = audio_stream_bytes_without_wrap(sink, snk);
@@ -465,6 +501,20 @@ void audio_stream_copy_to_linear(const struct audio_stream *source, int ioffset,
 	}
 }
 
+/* deliver the buffer notifications coalesced during a copy */
+static void comp_notify_flush(struct comp_dev *dev)
+{
+	struct comp_buffer *buffer;
+
+	comp_dev_for_each_producer(dev, buffer)
+		if (buffer->notify)
+			buffer_notify_flush(buffer);
+
+	comp_dev_for_each_consumer(dev, buffer)
+		if (buffer->notify)
+			buffer_notify_flush(buffer);
+}
+
 /** See comp_ops::copy */
 int comp_copy(struct comp_dev *dev)
 {
@@ -500,6 +550,7 @@ int comp_copy(struct comp_dev *dev)
 #endif
 
 		ret = dev->drv->ops.copy(dev);
+		comp_notify_flush(dev);
 
 #ifdef CONFIG_SOF_TELEMETRY_PERFORMANCE_MEASUREMENTS
 		const uint32_t cycles_consumed = (uint32_t)telemetry_timestamp() - begin_stamp;
@@ -187,6 +187,29 @@ int copier_gain_input32(struct comp_buffer *buff, enum copier_gain_state state,
 			enum copier_gain_envelope_dir dir,
 			struct copier_gain_params *gain_params, uint32_t frames);
 
+/**
+ * @brief Converts the source to the sink and applies gain in the same loop.
+ *
+ * This function reads the source from its read pointer and writes the sink from its
+ * write pointer with the sample conversion of pcm_get_conversion_function() and the
+ * gain of the given state applied. The result is bit exact with the conversion
+ * followed by copier_gain_input16() or copier_gain_input32(). The pointers of the
+ * buffers are not updated.
+ *
+ * @param source The pointer to the source buffer.
+ * @param sink The pointer to the sink buffer.
+ * @param state The state of the gain processing.
+ * @param dir Direction of the gain envelope change.
+ * @param gain_params The pointer to the copier_gain_params structure.
+ * @param frames The number of frames to be processed.
+ * @return 0 on success, -ENOTSUP if the formats or channels need separate passes.
+ *
+ * Only the generic C gain code implements it, see CONFIG_COPIER_GAIN_CONVERT.
+ */
+int copier_gain_convert(struct comp_buffer *source, struct comp_buffer *sink,
+			enum copier_gain_state state, enum copier_gain_envelope_dir dir,
+			struct copier_gain_params *gain_params, uint32_t frames);
+
 /**
  * @brief Applies gain to the input audio buffer, selects the appropriate gain method.
  *
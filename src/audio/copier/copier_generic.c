@@ -5,6 +5,7 @@
 // Author: Andrula Song <xiaoyuan.song@intel.com>
 
 #include <ipc4/base-config.h>
+#include <ipc4/module.h>
 #include <sof/audio/component_ext.h>
 #include <module/module/base.h>
 #include <sof/common.h>
@@ -106,6 +107,21 @@ int copier_gain_set_fade_params(struct comp_dev *dev, struct copier_gain_params
 	return 0;
 }
 
+static void copier_gain_update_state(struct copier_gain_params *gain_params,
+				     enum copier_gain_state state,
+				     enum copier_gain_envelope_dir dir, uint32_t frames)
+{
+	if (state == MUTE) {
+		gain_params->silence_sg_count += frames;
+	} else if (state == TRANS_GAIN) {
+		gain_params->fade_in_sg_count += frames;
+		if (dir == GAIN_ADD)
+			gain_params->gain_env += gain_params->step_i64 * frames;
+		else
+			gain_params->gain_env -= gain_params->step_i64 * frames;
+	}
+}
+
 int copier_gain_input16(struct comp_buffer *buff, enum copier_gain_state state,
 			enum copier_gain_envelope_dir dir,
 			struct copier_gain_params *gain_params, uint32_t frames)
@@ -164,7 +180,7 @@ int copier_gain_input16(struct comp_buffer *buff, enum copier_gain_state state,
 
 			/* Apply fade */
 			for (j = 0; j < nch; j++) {
-				dst += j;
+				dst_tmp = dst + j;
 				/* Quadratic fade part in Q15 format*/
 				gain_env_sq = q_multsr_16x16(gain_env[j], gain_env[j], 15);
 
@@ -175,8 +191,8 @@ int copier_gain_input16(struct comp_buffer *buff, enum copier_gain_state state,
 						      gain_env_sq, 15);
 
 				for (i = 0; i < nmax; i += nch)
-					dst[i] = q_multsr_sat_16x16(dst[i], gain,
-								    GAIN_Q10_INT_SHIFT);
+					dst_tmp[i] = q_multsr_sat_16x16(dst_tmp[i], gain,
+									GAIN_Q10_INT_SHIFT);
 			}
 			samples -= nmax;
 			dst = audio_stream_wrap(&buff->stream, dst + nmax);
@@ -184,15 +200,7 @@ int copier_gain_input16(struct comp_buffer *buff, enum copier_gain_state state,
 		break;
 	}
 
-	if (state == MUTE) {
-		gain_params->silence_sg_count += frames;
-	} else if (state == TRANS_GAIN) {
-		gain_params->fade_in_sg_count += frames;
-		if (dir == GAIN_ADD)
-			gain_params->gain_env += gain_params->step_i64 * frames;
-		else
-			gain_params->gain_env -= gain_params->step_i64 * frames;
-	}
+	copier_gain_update_state(gain_params, state, dir, frames);
 
 	return 0;
 }
@@ -255,7 +263,7 @@ int copier_gain_input32(struct comp_buffer *buff, enum copier_gain_state state,
 
 			/* Apply fade */
 			for (j = 0; j < nch; j++) {
-				dst += j;
+				dst_tmp = dst + j;
 				/* Quadratic fade part in Q15 format*/
 				gain_env_sq = q_multsr_16x16(gain_env[j], gain_env[j], 15);
 
@@ -266,8 +274,8 @@ int copier_gain_input32(struct comp_buffer *buff, enum copier_gain_state state,
 						      gain_env_sq, 15);
 
 				for (i = 0; i < nmax; i += nch)
-					dst[i] =  q_multsr_sat_32x32(dst[i], gain,
-								     GAIN_Q10_INT_SHIFT);
+					dst_tmp[i] = q_multsr_sat_32x32(dst_tmp[i], gain,
+									GAIN_Q10_INT_SHIFT);
 			}
 			samples -= nmax;
 			dst = audio_stream_wrap(&buff->stream, dst + nmax);
@@ -275,16 +283,108 @@ int copier_gain_input32(struct comp_buffer *buff, enum copier_gain_state state,
 		break;
 	}
 
-	if (state == MUTE) {
-		gain_params->silence_sg_count += frames;
-	} else if (state == TRANS_GAIN) {
-		gain_params->fade_in_sg_count += frames;
-		if (dir == GAIN_ADD)
-			gain_params->gain_env += gain_params->step_i64 * frames;
-		else
-			gain_params->gain_env -= gain_params->step_i64 * frames;
+	copier_gain_update_state(gain_params, state, dir, frames);
+
+	return 0;
+}
+
+/*
+ * Gain of each channel in Q10, computed as in copier_gain_input16() and
+ * copier_gain_input32(). Mute is a zero gain, the result is the same as
+ * zeroing the samples.
+ */
+static void copier_gain_channels(struct copier_gain_params *gain_params,
+				 enum copier_gain_state state, int16_t *gain, int nch)
+{
+	int16_t gain_env_i16 = gain_params->gain_env >> I64_TO_I16_SHIFT;
+	int16_t gain_env, gain_env_sq;
+	int j;
+
+	for (j = 0; j < nch; j++) {
+		switch (state) {
+		case MUTE:
+			gain[j] = 0;
+			break;
+		case TRANS_GAIN:
+			gain_env = gain_env_i16 + gain_params->init_gain[j];
+			gain_env_sq = q_multsr_16x16(gain_env, gain_env, 15);
+			gain[j] = q_multsr_16x16(gain_params->gain_coeffs[j], gain_env_sq, 15);
+			break;
+		default:
+			gain[j] = gain_params->gain_coeffs[j];
+			break;
+		}
+	}
+}
+
+int copier_gain_convert(struct comp_buffer *source, struct comp_buffer *sink,
+			enum copier_gain_state state, enum copier_gain_envelope_dir dir,
+			struct copier_gain_params *gain_params, uint32_t frames)
+{
+	enum sof_ipc_frame source_fmt = audio_stream_get_frm_fmt(&source->stream);
+	enum sof_ipc_frame sink_fmt = audio_stream_get_frm_fmt(&sink->stream);
+	const int nch = audio_stream_get_channels(&sink->stream);
+	int samples = frames * nch;
+	int source_bytes = audio_stream_sample_bytes(&source->stream);
+	int sink_bytes = audio_stream_sample_bytes(&sink->stream);
+	uint8_t *src = audio_stream_get_rptr(&source->stream);
+	uint8_t *dst = audio_stream_get_wptr(&sink->stream);
+	int16_t gain[MAX_GAIN_COEFFS_CNT];
+	int16_t *s16, *d16;
+	int32_t *s32, *d32;
+	int ch = 0;
+	int i, n;
+
+	if (nch > MAX_GAIN_COEFFS_CNT || audio_stream_get_channels(&source->stream) != nch)
+		return -ENOTSUP;
+
+	if ((source_fmt != SOF_IPC_FRAME_S16_LE && source_fmt != SOF_IPC_FRAME_S32_LE) ||
+	    (sink_fmt != SOF_IPC_FRAME_S16_LE && sink_fmt != SOF_IPC_FRAME_S32_LE))
+		return -ENOTSUP;
+
+	copier_gain_channels(gain_params, state, gain, nch);
+
+	while (samples) {
+		n = audio_stream_bytes_without_wrap(&source->stream, src) / source_bytes;
+		n = MIN(n, audio_stream_bytes_without_wrap(&sink->stream, dst) / sink_bytes);
+		n = MIN(n, samples);
+		s16 = (int16_t *)src;
+		s32 = (int32_t *)src;
+		d16 = (int16_t *)dst;
+		d32 = (int32_t *)dst;
+
+		/* the sample conversions are the ones of pcm_get_conversion_function() */
+		if (source_fmt == SOF_IPC_FRAME_S16_LE && sink_fmt == SOF_IPC_FRAME_S16_LE) {
+			for (i = 0; i < n; i++) {
+				d16[i] = q_multsr_sat_16x16(s16[i], gain[ch], GAIN_Q10_INT_SHIFT);
+				ch = ch + 1 < nch ? ch + 1 : 0;
+			}
+		} else if (source_fmt == SOF_IPC_FRAME_S16_LE) {
+			for (i = 0; i < n; i++) {
+				d32[i] = q_multsr_sat_32x32(s16[i] << 16, gain[ch],
+							    GAIN_Q10_INT_SHIFT);
+				ch = ch + 1 < nch ? ch + 1 : 0;
+			}
+		} else if (sink_fmt == SOF_IPC_FRAME_S16_LE) {
+			for (i = 0; i < n; i++) {
+				d16[i] = q_multsr_sat_16x16(sat_int16(Q_SHIFT_RND(s32[i], 31, 15)),
+							    gain[ch], GAIN_Q10_INT_SHIFT);
+				ch = ch + 1 < nch ? ch + 1 : 0;
+			}
+		} else {
+			for (i = 0; i < n; i++) {
+				d32[i] = q_multsr_sat_32x32(s32[i], gain[ch], GAIN_Q10_INT_SHIFT);
+				ch = ch + 1 < nch ? ch + 1 : 0;
+			}
+		}
+
+		samples -= n;
+		src = audio_stream_wrap(&source->stream, src + n * source_bytes);
+		dst = audio_stream_wrap(&sink->stream, dst + n * sink_bytes);
 	}
 
+	copier_gain_update_state(gain_params, state, dir, frames);
+
 	return 0;
 }
 
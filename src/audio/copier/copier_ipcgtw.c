@@ -192,6 +192,9 @@ int copier_ipcgtw_params(struct ipcgtw_data *ipcgtw_data, struct comp_dev *dev,
 		return err;
 	}
 
+	/* written from the IPC context and reset by IPC4_IPCGWCMD_FLUSH_DATA */
+	buf->no_alias = true;
+
 	return 0;
 }
 
@@ -583,8 +583,9 @@ static int crossover_prepare(struct processing_module *mod,
 			return -EINVAL;
 		}
 
-		cd->crossover_split = crossover_find_split_func(cd->config->num_sinks);
-		if (!cd->crossover_split) {
+		cd->crossover_split_block =
+			crossover_find_split_block_func(cd->config->num_sinks);
+		if (!cd->crossover_split_block) {
 			comp_err(dev, "crossover_prepare(), No split function matching num_sinks %i",
 				 cd->config->num_sinks);
 			return -EINVAL;
@@ -617,7 +618,7 @@ static int crossover_reset(struct processing_module *mod)
 	crossover_reset_state(cd);
 
 	cd->crossover_process = NULL;
-	cd->crossover_split = NULL;
+	cd->crossover_split_block = NULL;
 
 	return 0;
 }
@@ -16,6 +16,8 @@
 #include "crossover_user.h"
 
 #define CROSSOVER_LR4_NUM_BIQUADS 2
+/* Frames of a channel processed with one crossover_split_block call */
+#define CROSSOVER_BLOCK_FRAMES 16
 
 struct comp_buffer;
 struct comp_dev;
@@ -70,7 +72,7 @@ struct comp_data {
 	struct sof_crossover_config *config;      /**< pointer to setup blob */
 	enum sof_ipc_frame source_format;         /**< source frame format */
 	crossover_process crossover_process;      /**< processing function */
-	crossover_split crossover_split;          /**< split function */
+	crossover_split_block crossover_split_block; /**< block split function */
 };
 
 struct crossover_proc_fnmap {
@@ -87,6 +87,47 @@ static void crossover_generic_split_4way(int32_t in,
 				    z2, &out[2], &out[3]);
 }
 
+/*
+ * The block versions run each LR4 filter of the split tree over the whole
+ * block. The intermediate signals of the tree are kept in the band
+ * buffers that are computed last from them.
+ */
+static void crossover_generic_split_block_2way(int32_t *in, int32_t *out[], int n,
+					       struct crossover_state *state)
+{
+	iir_df1_4th_block(&state->lowpass[0], in, out[0], n);
+	iir_df1_4th_block(&state->highpass[0], in, out[1], n);
+}
+
+static void crossover_generic_split_block_3way(int32_t *in, int32_t *out[], int n,
+					       struct crossover_state *state)
+{
+	int i;
+
+	iir_df1_4th_block(&state->highpass[0], in, out[2], n);
+	iir_df1_4th_block(&state->lowpass[0], in, out[0], n);
+
+	/* Realign the phase of out[0], the input is free for the high pass */
+	iir_df1_4th_block(&state->highpass[1], out[0], in, n);
+	iir_df1_4th_block(&state->lowpass[1], out[0], out[0], n);
+	for (i = 0; i < n; i++)
+		out[0][i] = sat_int32((int64_t)out[0][i] + in[i]);
+
+	iir_df1_4th_block(&state->lowpass[2], out[2], out[1], n);
+	iir_df1_4th_block(&state->highpass[2], out[2], out[2], n);
+}
+
+static void crossover_generic_split_block_4way(int32_t *in, int32_t *out[], int n,
+					       struct crossover_state *state)
+{
+	iir_df1_4th_block(&state->lowpass[1], in, out[0], n);
+	iir_df1_4th_block(&state->highpass[1], in, out[2], n);
+	iir_df1_4th_block(&state->highpass[0], out[0], out[1], n);
+	iir_df1_4th_block(&state->lowpass[0], out[0], out[0], n);
+	iir_df1_4th_block(&state->highpass[2], out[2], out[3], n);
+	iir_df1_4th_block(&state->lowpass[2], out[2], out[2], n);
+}
+
 static void crossover_default_pass(struct comp_data *cd,
 				   struct input_stream_buffer *bsource,
 				   struct output_stream_buffer **bsinks,
@@ -105,76 +146,124 @@ static void crossover_default_pass(struct comp_data *cd,
 }
 
 #if CONFIG_FORMAT_S16LE
+/**
+ * \brief Processes audio frames with a crossover filter for s16 format.
+ *
+ * This function divides audio data from an input stream into multiple output
+ * streams based on a crossover filter. It reads the input audio data of a
+ * channel in blocks, applies the crossover filter to the block, and writes
+ * the processed audio data to the connected output streams.
+ *
+ * \param cd Pointer to the component data structure which holds the crossover state.
+ * \param bsource Pointer to the input stream buffer structure.
+ * \param bsinks Array of pointers to output stream buffer structures.
+ * \param num_sinks Number of output stream buffers in the bsinks array.
+ * \param frames Number of audio frames to process.
+ */
 static void crossover_s16_default(struct comp_data *cd,
 				  struct input_stream_buffer *bsource,
 				  struct output_stream_buffer **bsinks,
 				  int32_t num_sinks,
 				  uint32_t frames)
 {
+	int32_t bands[SOF_CROSSOVER_MAX_STREAMS][CROSSOVER_BLOCK_FRAMES];
+	int32_t *out[SOF_CROSSOVER_MAX_STREAMS];
+	int32_t in[CROSSOVER_BLOCK_FRAMES];
 	struct crossover_state *state;
 	const struct audio_stream *source_stream = bsource->data;
 	struct audio_stream *sink_stream;
 	int16_t *x, *y;
-	int ch, i, j;
+	int ch, i, j, k, n;
 	int idx;
 	int nch = audio_stream_get_channels(source_stream);
-	int32_t out[num_sinks];
+
+	for (j = 0; j < SOF_CROSSOVER_MAX_STREAMS; j++)
+		out[j] = bands[j];
 
 	for (ch = 0; ch < nch; ch++) {
-		idx = ch;
 		state = &cd->state[ch];
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s16(source_stream, idx);
-			cd->crossover_split(*x << 16, out, state);
+		for (i = 0; i < frames; i += n) {
+			n = MIN(frames - i, CROSSOVER_BLOCK_FRAMES);
+			idx = i * nch + ch;
+			for (k = 0; k < n; k++, idx += nch) {
+				x = audio_stream_read_frag_s16(source_stream, idx);
+				in[k] = *x << 16;
+			}
+
+			cd->crossover_split_block(in, out, n, state);
 
 			for (j = 0; j < num_sinks; j++) {
 				if (!bsinks[j])
 					continue;
 				sink_stream = bsinks[j]->data;
-				y = audio_stream_write_frag_s16(sink_stream,
-								idx);
-				*y = sat_int16(Q_SHIFT_RND(out[j], 31, 15));
+				idx = i * nch + ch;
+				for (k = 0; k < n; k++, idx += nch) {
+					y = audio_stream_write_frag_s16(sink_stream, idx);
+					*y = sat_int16(Q_SHIFT_RND(bands[j][k], 31, 15));
+				}
 			}
-
-			idx += nch;
 		}
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE */
 
 #if CONFIG_FORMAT_S24LE
+/**
+ * \brief Processes audio frames with a crossover filter for s24 format.
+ *
+ * This function divides audio data from an input stream into multiple output
+ * streams based on a crossover filter. It reads the input audio data of a
+ * channel in blocks, applies the crossover filter to the block, and writes
+ * the processed audio data to the connected output streams.
+ *
+ * \param cd Pointer to the component data structure which holds the crossover state.
+ * \param bsource Pointer to the input stream buffer structure.
+ * \param bsinks Array of pointers to output stream buffer structures.
+ * \param num_sinks Number of output stream buffers in the bsinks array.
+ * \param frames Number of audio frames to process.
+ */
 static void crossover_s24_default(struct comp_data *cd,
 				  struct input_stream_buffer *bsource,
 				  struct output_stream_buffer **bsinks,
 				  int32_t num_sinks,
 				  uint32_t frames)
 {
+	int32_t bands[SOF_CROSSOVER_MAX_STREAMS][CROSSOVER_BLOCK_FRAMES];
+	int32_t *out[SOF_CROSSOVER_MAX_STREAMS];
+	int32_t in[CROSSOVER_BLOCK_FRAMES];
 	struct crossover_state *state;
 	const struct audio_stream *source_stream = bsource->data;
 	struct audio_stream *sink_stream;
 	int32_t *x, *y;
-	int ch, i, j;
+	int ch, i, j, k, n;
 	int idx;
 	int nch = audio_stream_get_channels(source_stream);
-	int32_t out[num_sinks];
+
+	for (j = 0; j < SOF_CROSSOVER_MAX_STREAMS; j++)
+		out[j] = bands[j];
 
 	for (ch = 0; ch < nch; ch++) {
-		idx = ch;
 		state = &cd->state[ch];
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source_stream, idx);
-			cd->crossover_split(*x << 8, out, state);
+		for (i = 0; i < frames; i += n) {
+			n = MIN(frames - i, CROSSOVER_BLOCK_FRAMES);
+			idx = i * nch + ch;
+			for (k = 0; k < n; k++, idx += nch) {
+				x = audio_stream_read_frag_s32(source_stream, idx);
+				in[k] = *x << 8;
+			}
+
+			cd->crossover_split_block(in, out, n, state);
 
 			for (j = 0; j < num_sinks; j++) {
 				if (!bsinks[j])
 					continue;
 				sink_stream = bsinks[j]->data;
-				y = audio_stream_write_frag_s32(sink_stream,
-								idx);
-				*y = sat_int24(Q_SHIFT_RND(out[j], 31, 23));
+				idx = i * nch + ch;
+				for (k = 0; k < n; k++, idx += nch) {
+					y = audio_stream_write_frag_s32(sink_stream, idx);
+					*y = sat_int24(Q_SHIFT_RND(bands[j][k], 31, 23));
+				}
 			}
-
-			idx += nch;
 		}
 	}
 }
@@ -185,9 +274,9 @@ static void crossover_s24_default(struct comp_data *cd,
  * \brief Processes audio frames with a crossover filter for s32 format.
  *
  * This function divides audio data from an input stream into multiple output
- * streams based on a crossover filter. It reads the input audio data, applies
- * the crossover filter, and writes the processed audio data to active output
- * streams.
+ * streams based on a crossover filter. It reads the input audio data of a
+ * channel in blocks, applies the crossover filter to the block, and writes
+ * the processed audio data to the connected output streams.
  *
  * \param cd Pointer to the component data structure which holds the crossover state.
  * \param bsource Pointer to the input stream buffer structure.
@@ -201,49 +290,52 @@ static void crossover_s32_default(struct comp_data *cd,
 				  int32_t num_sinks,
 				  uint32_t frames)
 {
-	/* Array to hold active sink streams; initialized to null */
-	struct audio_stream *sink_stream[SOF_CROSSOVER_MAX_STREAMS] = { NULL };
+	/* Planar output bands of a block, and pointers to them */
+	int32_t bands[SOF_CROSSOVER_MAX_STREAMS][CROSSOVER_BLOCK_FRAMES];
+	int32_t *out[SOF_CROSSOVER_MAX_STREAMS];
+	/* Input block of one channel */
+	int32_t in[CROSSOVER_BLOCK_FRAMES];
 	struct crossover_state *state;
 	/* Source stream to read audio data from */
 	const struct audio_stream *source_stream = bsource->data;
+	struct audio_stream *sink_stream;
 	int32_t *x, *y;
-	int ch, i, j;
+	int ch, i, j, k, n;
 	int idx;
-	/* Counter for active sink streams */
-	int active_sinks = 0;
 	/* Number of channels in the source stream */
 	int nch = audio_stream_get_channels(source_stream);
-	/* Output buffer for processed data */
-	int32_t out[num_sinks];
 
-	/* Identify active sinks, avoid processing null sinks later */
-	for (j = 0; j < num_sinks; j++) {
-		if (bsinks[j])
-			sink_stream[active_sinks++] = bsinks[j]->data;
-	}
+	for (j = 0; j < SOF_CROSSOVER_MAX_STREAMS; j++)
+		out[j] = bands[j];
 
-	/* Process for each channel */
 	/* Loop through each channel in the source stream */
 	for (ch = 0; ch < nch; ch++) {
 		/* Set current crossover state for this channel */
 		state = &cd->state[ch];
-		/* Iterate over frames */
-		/* Loop through each frame */
-		for (i = 0, idx = ch; i < frames; i++, idx += nch) {
-			/* Read source */
-			/* Read the current audio frame for the channel */
-			x = audio_stream_read_frag_s32(source_stream, idx);
-			/* Apply the crossover split logic to the audio data */
-			cd->crossover_split(*x, out, state);
-
-			/* Write output to active sinks */
-			/* Write processed output to active sinks */
-			for (j = 0; j < active_sinks; j++) {
-				/* Write processed data to sink */
-				y = audio_stream_write_frag_s32(sink_stream[j], idx);
-				*y = out[j];
+		/* Loop through the frames in blocks */
+		for (i = 0; i < frames; i += n) {
+			n = MIN(frames - i, CROSSOVER_BLOCK_FRAMES);
+			/* Read the block of the channel from the source */
+			idx = i * nch + ch;
+			for (k = 0; k < n; k++, idx += nch) {
+				x = audio_stream_read_frag_s32(source_stream, idx);
+				in[k] = *x;
 			}
 
+			/* Apply the crossover split logic to the block */
+			cd->crossover_split_block(in, out, n, state);
+
+			/* Write processed output to connected sinks, band j to sink j */
+			for (j = 0; j < num_sinks; j++) {
+				if (!bsinks[j])
+					continue;
+				sink_stream = bsinks[j]->data;
+				idx = i * nch + ch;
+				for (k = 0; k < n; k++, idx += nch) {
+					y = audio_stream_write_frag_s32(sink_stream, idx);
+					*y = bands[j][k];
+				}
+			}
 		}
 	}
 }
@@ -288,3 +380,9 @@ const crossover_split crossover_split_fnmap[] = {
 };
 
 const size_t crossover_split_fncount = ARRAY_SIZE(crossover_split_fnmap);
+
+const crossover_split_block crossover_split_block_fnmap[] = {
+	crossover_generic_split_block_2way,
+	crossover_generic_split_block_3way,
+	crossover_generic_split_block_4way,
+};
@@ -246,6 +246,66 @@ static int dai_get_fifo(struct dai *dai, int direction, int stream_id)
 	return fifo_address;
 }
 
+#if CONFIG_IPC_MAJOR_4
+/*
+ * Copies the DMA buffer to the local buffer with the copier gain applied to
+ * the copied frames. The local buffer can still hold frames that weren't
+ * consumed, those are not touched. With CONFIG_COPIER_GAIN_CONVERT, when the
+ * gain isn't unity and the DMA conversion is a plain format conversion, the
+ * gain is applied in the conversion loop instead of in a second pass over
+ * the local buffer.
+ */
+static int dai_copy_with_gain(struct dai_data *dd, struct comp_dev *dev, uint32_t bytes)
+{
+	struct copier_gain_params *gain_params = dd->gain_data;
+	struct comp_buffer *source = dd->dma_buffer;
+	struct comp_buffer *sink = dd->local_buffer;
+	uint32_t frames = bytes / audio_stream_frame_bytes(&source->stream);
+	uint32_t sink_bytes = frames * audio_stream_frame_bytes(&sink->stream);
+	void *start = audio_stream_get_wptr(&sink->stream);
+	void *rptr, *wptr;
+	int ret;
+
+#if CONFIG_COPIER_GAIN_CONVERT
+	enum copier_gain_state state;
+	bool fuse = gain_params && dd->process ==
+		    pcm_get_conversion_function(audio_stream_get_frm_fmt(&source->stream),
+						audio_stream_get_frm_fmt(&sink->stream));
+#if CONFIG_INTEL_ADSP_MIC_PRIVACY
+	struct copier_data *cd = module_get_private_data(comp_mod(dev));
+
+	/* mic privacy processes the converted data before the gain */
+	if (cd->mic_priv)
+		fuse = false;
+#endif
+
+	if (fuse) {
+		state = copier_gain_eval_state(gain_params);
+		if ((state != STATIC_GAIN || !gain_params->unity_gain) &&
+		    !copier_gain_convert(source, sink, state, GAIN_ADD, gain_params, frames)) {
+			buffer_stream_writeback(sink, sink_bytes);
+			comp_update_buffer_produce(sink, sink_bytes);
+			return 0;
+		}
+	}
+#endif
+
+	stream_copy_from_no_consume(dev, source, sink, dd->process, bytes, dd->chmap);
+
+	/* copier_gain_input() starts from the read pointer, point both to the copied frames */
+	rptr = audio_stream_get_rptr(&sink->stream);
+	wptr = audio_stream_get_wptr(&sink->stream);
+	audio_stream_set_rptr(&sink->stream, start);
+	audio_stream_set_wptr(&sink->stream, start);
+	ret = copier_gain_input(dev, sink, gain_params, GAIN_ADD, sink_bytes);
+	buffer_stream_writeback(sink, sink_bytes);
+	audio_stream_set_rptr(&sink->stream, rptr);
+	audio_stream_set_wptr(&sink->stream, wptr);
+
+	return ret;
+}
+#endif
+
 /* this is called by DMA driver every time descriptor has completed */
 static enum sof_dma_cb_status
 dai_dma_cb(struct dai_data *dd, struct comp_dev *dev, uint32_t bytes,
@@ -323,17 +383,20 @@ dai_dma_cb(struct dai_data *dd, struct comp_dev *dev, uint32_t bytes,
 		 * so no need to check the return value of stream_copy_from_no_consume().
 		 */
 
-		ret = stream_copy_from_no_consume(dev, dd->dma_buffer, dd->local_buffer,
-						  dd->process, bytes, dd->chmap);
 #if CONFIG_IPC_MAJOR_4
-		/* Apply gain to the local buffer */
 		if (dd->ipc_config.apply_gain) {
-			ret = copier_gain_input(dev, dd->local_buffer, dd->gain_data,
-						GAIN_ADD, bytes);
+			ret = dai_copy_with_gain(dd, dev, bytes);
 			if (ret)
-				comp_err(dev, "copier_gain_input() failed err=%d", ret);
-			buffer_stream_writeback(dd->local_buffer, bytes);
+				comp_err(dev, "copier gain failed err=%d", ret);
+		} else {
+			ret = stream_copy_from_no_consume(dev, dd->dma_buffer, dd->local_buffer,
+							  dd->process, bytes, dd->chmap);
 		}
+#else
+		ret = stream_copy_from_no_consume(dev, dd->dma_buffer, dd->local_buffer,
+						  dd->process, bytes, dd->chmap);
+#endif
+#if CONFIG_IPC_MAJOR_4
 
 		/* Skip in case of endpoint DAI devices created by the copier */
 		if (converter) {
@@ -922,6 +985,16 @@ static int dai_set_dma_buffer(struct dai_data *dd, struct comp_dev *dev,
 	else
 		dd->local_buffer = comp_dev_get_first_data_consumer(dev);
 
+#if CONFIG_INTEL_ADSP_MIC_PRIVACY
+	/* mic privacy zeroes the whole capture buffer while streaming */
+	if (dev->direction == SOF_IPC_STREAM_CAPTURE) {
+		struct copier_data *cd = module_get_private_data(comp_mod(dev));
+
+		if (cd->mic_priv)
+			dd->local_buffer->no_alias = true;
+	}
+#endif
+
 	/* check if already configured */
 	if (dev->state == COMP_STATE_PREPARE) {
 		comp_info(dev, "component has been already configured.");
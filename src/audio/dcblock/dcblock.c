@@ -94,6 +94,7 @@ static int dcblock_init(struct processing_module *mod)
 		return -ENOMEM;
 
 	md->private = cd;
+	mod->process_in_place = true;
 	cd->dcblock_func = NULL;
 
 	/* component model data handler */
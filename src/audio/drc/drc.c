@@ -193,6 +193,7 @@ __cold static int drc_init(struct processing_module *mod)
 	 */
 	cd->enabled = true;
 	cd->enable_switch = true;
+	mod->process_in_place = true;
 	return 0;
 
 cd_fail:
@@ -21,6 +21,9 @@
 
 LOG_MODULE_DECLARE(eq_fir, CONFIG_SOF_LOG_LEVEL);
 
+/* Samples of a channel filtered with one fir_32x16_block() call */
+#define EQ_FIR_BLOCK_SAMPLES	32
+
 #if CONFIG_FORMAT_S16LE
 void eq_fir_s16(struct fir_state_32x16 fir[], struct input_stream_buffer *bsource,
 		struct output_stream_buffer *bsink, int frames)
@@ -28,11 +31,11 @@ void eq_fir_s16(struct fir_state_32x16 fir[], struct input_stream_buffer *bsourc
 	struct audio_stream *source = bsource->data;
 	struct audio_stream *sink = bsink->data;
 	struct fir_state_32x16 *filter;
-	int32_t z;
+	int32_t block[EQ_FIR_BLOCK_SAMPLES];
 	int16_t *x0, *y0;
 	int16_t *x = audio_stream_get_rptr(source);
 	int16_t *y = audio_stream_get_wptr(sink);
-	int nmax, n, i, j;
+	int nmax, n, i, j, k, m;
 	int nch = audio_stream_get_channels(source);
 	int remaining_samples = frames * nch;
 
@@ -45,11 +48,17 @@ void eq_fir_s16(struct fir_state_32x16 fir[], struct input_stream_buffer *bsourc
 			x0 = x + j;
 			y0 = y + j;
 			filter = &fir[j];
-			for (i = 0; i < n; i += nch) {
-				z = fir_32x16(filter, *x0 << 16);
-				*y0 = sat_int16(Q_SHIFT_RND(z, 31, 15));
-				x0 += nch;
-				y0 += nch;
+			for (i = n / nch; i > 0; i -= m) {
+				m = MIN(EQ_FIR_BLOCK_SAMPLES, i);
+				for (k = 0; k < m; k++) {
+					block[k] = *x0 << 16;
+					x0 += nch;
+				}
+				fir_32x16_block(filter, block, block, m);
+				for (k = 0; k < m; k++) {
+					*y0 = sat_int16(Q_SHIFT_RND(block[k], 31, 15));
+					y0 += nch;
+				}
 			}
 		}
 		remaining_samples -= n;
@@ -66,11 +75,11 @@ void eq_fir_s24(struct fir_state_32x16 fir[], struct input_stream_buffer *bsourc
 	struct audio_stream *source = bsource->data;
 	struct audio_stream *sink = bsink->data;
 	struct fir_state_32x16 *filter;
-	int32_t z;
+	int32_t block[EQ_FIR_BLOCK_SAMPLES];
 	int32_t *x0, *y0;
 	int32_t *x = audio_stream_get_rptr(source);
 	int32_t *y = audio_stream_get_wptr(sink);
-	int nmax, n, i, j;
+	int nmax, n, i, j, k, m;
 	int nch = audio_stream_get_channels(source);
 	int remaining_samples = frames * nch;
 
@@ -83,11 +92,17 @@ void eq_fir_s24(struct fir_state_32x16 fir[], struct input_stream_buffer *bsourc
 			x0 = x + j;
 			y0 = y + j;
 			filter = &fir[j];
-			for (i = 0; i < n; i += nch) {
-				z = fir_32x16(filter, *x0 << 8);
-				*y0 = sat_int24(Q_SHIFT_RND(z, 31, 23));
-				x0 += nch;
-				y0 += nch;
+			for (i = n / nch; i > 0; i -= m) {
+				m = MIN(EQ_FIR_BLOCK_SAMPLES, i);
+				for (k = 0; k < m; k++) {
+					block[k] = *x0 << 8;
+					x0 += nch;
+				}
+				fir_32x16_block(filter, block, block, m);
+				for (k = 0; k < m; k++) {
+					*y0 = sat_int24(Q_SHIFT_RND(block[k], 31, 23));
+					y0 += nch;
+				}
 			}
 		}
 		remaining_samples -= n;
@@ -104,10 +119,11 @@ void eq_fir_s32(struct fir_state_32x16 fir[], struct input_stream_buffer *bsourc
 	struct audio_stream *source = bsource->data;
 	struct audio_stream *sink = bsink->data;
 	struct fir_state_32x16 *filter;
+	int32_t block[EQ_FIR_BLOCK_SAMPLES];
 	int32_t *x0, *y0;
 	int32_t *x = audio_stream_get_rptr(source);
 	int32_t *y = audio_stream_get_wptr(sink);
-	int nmax, n, i, j;
+	int nmax, n, i, j, k, m;
 	int nch = audio_stream_get_channels(source);
 	int remaining_samples = frames * nch;
 
@@ -120,10 +136,17 @@ void eq_fir_s32(struct fir_state_32x16 fir[], struct input_stream_buffer *bsourc
 			x0 = x + j;
 			y0 = y + j;
 			filter = &fir[j];
-			for (i = 0; i < n; i += nch) {
-				*y0 = fir_32x16(filter, *x0);
-				x0 += nch;
-				y0 += nch;
+			for (i = n / nch; i > 0; i -= m) {
+				m = MIN(EQ_FIR_BLOCK_SAMPLES, i);
+				for (k = 0; k < m; k++) {
+					block[k] = *x0;
+					x0 += nch;
+				}
+				fir_32x16_block(filter, block, block, m);
+				for (k = 0; k < m; k++) {
+					*y0 = block[k];
+					y0 += nch;
+				}
 			}
 		}
 		remaining_samples -= n;
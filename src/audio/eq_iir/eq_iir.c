@@ -87,6 +87,7 @@ static int eq_iir_init(struct processing_module *mod)
 	for (i = 0; i < PLATFORM_MAX_CHANNELS; i++)
 		iir_reset_df1(&cd->iir[i]);
 
+	mod->process_in_place = true;
 	return 0;
 err:
 	rfree(cd);
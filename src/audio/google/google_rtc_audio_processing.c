@@ -15,6 +15,7 @@
 #include <sof/audio/format.h>
 #include <sof/audio/kpb.h>
 #include <sof/audio/pipeline.h>
+#include <sof/audio/sink_source_utils.h>
 #include <sof/common.h>
 #include <rtos/panic.h>
 #include <sof/ipc/msg.h>
@@ -91,9 +92,6 @@ struct google_rtc_audio_processing_comp_data {
 #endif
 	int ref_framesz;
 	int cap_framesz;
-	void (*mic_copy)(struct sof_source *src, int frames, float **dst_bufs, int frame0);
-	void (*ref_copy)(struct sof_source *src, int frames, float **dst_bufs, int frame0);
-	void (*out_copy)(struct sof_sink *dst, int frames, float **src_bufs);
 };
 
 /* The underlying API is not sparse-aware, so rather than try to
@@ -115,128 +113,26 @@ void GoogleRtcFree(void *ptr)
 	return rfree(ptr);
 }
 
-static ALWAYS_INLINE float clamp_rescale(float max_val, float x)
+static void source_copy(struct sof_source *src, int frames, float **dst_bufs, int frame0)
 {
-	float min = -1.0f;
-	float max = 1.0f - 1.0f / max_val;
-
-	return max_val * (x < min ? min : (x > max ? max : x));
-}
-
-static ALWAYS_INLINE float s16_to_float(const char *ptr)
-{
-	float scale = -(float)SHRT_MIN;
-	float x = *(int16_t *)ptr;
-
-	return (1.0f / scale) * x;
-}
-
-static ALWAYS_INLINE void float_to_s16(float x, char *dst)
-{
-	*(int16_t *)dst = (int16_t)clamp_rescale(-(float)SHRT_MIN, x);
-}
-
-static ALWAYS_INLINE float s32_to_float(const char *ptr)
-{
-	float scale = -(float)INT_MIN;
-	float x = *(int32_t *)ptr;
-
-	return (1.0f / scale) * x;
-}
-
-static ALWAYS_INLINE void float_to_s32(float x, char *dst)
-{
-	*(int32_t *)dst = (int16_t)clamp_rescale(-(float)INT_MIN, x);
-}
-
-static ALWAYS_INLINE void source_to_float(struct sof_source *src, float **dst_bufs,
-					  float (*cvt_fn)(const char *),
-					  int sample_sz, int frame0, int frames)
-{
-	size_t chan = source_get_channels(src);
-	size_t bytes = frames * chan * sample_sz;
-	int i, c, err, ndst = MIN(chan, CHAN_MAX);
-	const char *buf, *bufstart, *bufend;
+	size_t chan = MIN(source_get_channels(src), CHAN_MAX);
 	float *dst[CHAN_MAX];
-	size_t bufsz;
+	int i, err;
 
-	for (i = 0; i < ndst; i++)
+	for (i = 0; i < chan; i++)
 		dst[i] = &dst_bufs[i][frame0];
 
-	err = source_get_data(src, bytes, (void *)&buf, (void *)&bufstart, &bufsz);
+	err = source_to_planar_float(src, dst, chan, frames);
 	assert(err == 0);
-	bufend = &bufstart[bufsz];
-
-	while (frames) {
-		size_t n = MIN(frames, (bufsz - (buf - bufstart)) / (chan * sample_sz));
-
-		for (i = 0; i < n; i++) {
-			for  (c = 0; c < ndst; c++) {
-				*dst[c]++ = cvt_fn(buf);
-				buf += sample_sz;
-			}
-			buf += sample_sz * (chan - ndst); /* skip unused channels */
-		}
-		frames -= n;
-		if (buf >= bufend)
-			buf = bufstart;
-	}
-	source_release_data(src, bytes);
 }
 
-static ALWAYS_INLINE void float_to_sink(struct sof_sink *dst, float **src_bufs,
-					void (*cvt_fn)(float, char *),
-					int sample_sz, int frames)
+static void sink_copy(struct sof_sink *dst, int frames, float **src_bufs)
 {
-	size_t chan = sink_get_channels(dst);
-	size_t bytes = frames * chan * sample_sz;
-	int i, c, err, nsrc = MIN(chan, CHAN_MAX);
-	char *buf, *bufstart, *bufend;
-	float *src[CHAN_MAX];
-	size_t bufsz;
-
-	for (i = 0; i < nsrc; i++)
-		src[i] = &src_bufs[i][0];
+	size_t chan = MIN(sink_get_channels(dst), CHAN_MAX);
+	int err;
 
-	err = sink_get_buffer(dst, bytes, (void *)&buf, (void *)&bufstart, &bufsz);
+	err = sink_from_planar_float(dst, src_bufs, chan, frames);
 	assert(err == 0);
-	bufend = &bufstart[bufsz];
-
-	while (frames) {
-		size_t n = MIN(frames, (bufsz - (buf - bufstart)) / (chan * sample_sz));
-
-		for (i = 0; i < n; i++) {
-			for  (c = 0; c < nsrc; c++) {
-				cvt_fn(*src[c]++, buf);
-				buf += sample_sz;
-			}
-			buf += sample_sz * (chan - nsrc); /* skip unused channels */
-		}
-		frames -= n;
-		if (buf >= bufend)
-			buf = bufstart;
-	}
-	sink_commit_buffer(dst, bytes);
-}
-
-static void source_copy16(struct sof_source *src, int frames, float **dst_bufs, int frame0)
-{
-	source_to_float(src, dst_bufs, s16_to_float, sizeof(int16_t), frame0, frames);
-}
-
-static void source_copy32(struct sof_source *src, int frames, float **dst_bufs, int frame0)
-{
-	source_to_float(src, dst_bufs, s32_to_float, sizeof(int32_t), frame0, frames);
-}
-
-static void sink_copy16(struct sof_sink *dst, int frames, float **src_bufs)
-{
-	float_to_sink(dst, src_bufs, float_to_s16, sizeof(int16_t), frames);
-}
-
-static void sink_copy32(struct sof_sink *dst, int frames, float **src_bufs)
-{
-	float_to_sink(dst, src_bufs, float_to_s32, sizeof(int32_t), frames);
 }
 
 static int google_rtc_audio_processing_reconfigure(struct processing_module *mod)
@@ -722,10 +618,6 @@ static int google_rtc_audio_processing_prepare(struct processing_module *mod,
 	if (ret < 0)
 		return ret;
 
-	cd->mic_copy = mic_fmt == SOF_IPC_FRAME_S16_LE ? source_copy16 : source_copy32;
-	cd->ref_copy = ref_fmt == SOF_IPC_FRAME_S16_LE ? source_copy16 : source_copy32;
-	cd->out_copy = out_fmt == SOF_IPC_FRAME_S16_LE ? sink_copy16 : sink_copy32;
-
 	cd->last_ref_ok = false;
 
 	ret = GoogleRtcAudioProcessingSetStreamFormats(cd->state, mic_rate,
@@ -817,10 +709,10 @@ static int mod_process(struct processing_module *mod, struct sof_source **source
 	for (frames_rem = frames; frames_rem; frames_rem -= n) {
 		n = MIN(frames_rem, cd->num_frames - cd->buffered_frames);
 
-		cd->mic_copy(mic, n, cd->raw_mic_buffers, cd->buffered_frames);
+		source_copy(mic, n, cd->raw_mic_buffers, cd->buffered_frames);
 
 		if (ref_ok)
-			cd->ref_copy(ref, n, cd->refout_buffers, cd->buffered_frames);
+			source_copy(ref, n, cd->refout_buffers, cd->buffered_frames);
 
 		cd->buffered_frames += n;
 
@@ -831,7 +723,7 @@ static int mod_process(struct processing_module *mod, struct sof_source **source
 			}
 
 			execute_aec(cd);
-			cd->out_copy(out, cd->num_frames, cd->refout_buffers);
+			sink_copy(out, cd->num_frames, cd->refout_buffers);
 		}
 	}
 	cd->last_ref_ok = ref_ok;
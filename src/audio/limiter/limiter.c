@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/* Look-ahead peak limiter component. The output is the input delayed by the
+ * look-ahead time and attenuated so that no sample exceeds the threshold.
+ * The gain follows the largest peak of the look-ahead window, and it's
+ * smoothed with a moving average of the window length and an exponential
+ * release. The threshold, look-ahead, and release time are set with a
+ * binary control blob, the new configuration is applied at next prepare().
+ */
+
+#include <sof/audio/module_adapter/module/generic.h>
+#include <sof/audio/component.h>
+#include <sof/audio/data_blob.h>
+#include <sof/audio/format.h>
+#include <sof/audio/ipc-config.h>
+#include <sof/audio/sink_api.h>
+#include <sof/audio/source_api.h>
+#include <sof/common.h>
+#include <sof/lib/uuid.h>
+#include <sof/platform.h>
+#include <sof/trace/trace.h>
+#include <sof/ut.h>
+#include <ipc/control.h>
+#include <ipc/stream.h>
+#include <rtos/alloc.h>
+#include <rtos/init.h>
+#include <user/limiter.h>
+#include <user/trace.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "limiter.h"
+
+LOG_MODULE_REGISTER(limiter, CONFIG_SOF_LOG_LEVEL);
+
+SOF_DEFINE_REG_UUID(limiter);
+
+DECLARE_TR_CTX(limiter_tr, SOF_UUID(limiter_uuid), LOG_LEVEL_INFO);
+
+/* Limiter component private data */
+struct limiter_comp_data {
+	struct limiter_state state;
+	struct comp_data_blob_handler *model_handler;
+};
+
+static int limiter_init(struct processing_module *mod)
+{
+	struct module_data *md = &mod->priv;
+	struct comp_dev *dev = mod->dev;
+	struct module_config *cfg = &md->cfg;
+	struct limiter_comp_data *cd;
+	size_t bs = cfg->size;
+	int ret;
+
+	comp_info(dev, "limiter_init()");
+
+	if (bs > SOF_LIMITER_CONFIG_MAX_SIZE) {
+		comp_err(dev, "limiter_init() error: configuration blob size %zu exceeds %d",
+			 bs, SOF_LIMITER_CONFIG_MAX_SIZE);
+		return -EINVAL;
+	}
+
+	cd = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, sizeof(*cd));
+	if (!cd)
+		return -ENOMEM;
+
+	md->private = cd;
+	cd->model_handler = comp_data_blob_handler_new(dev);
+	if (!cd->model_handler) {
+		comp_err(dev, "limiter_init(): comp_data_blob_handler_new() failed.");
+		ret = -ENOMEM;
+		goto err;
+	}
+
+	ret = comp_init_data_blob(cd->model_handler, bs, cfg->init_data);
+	if (ret < 0) {
+		comp_err(dev, "limiter_init(): comp_init_data_blob() failed.");
+		goto err_init;
+	}
+
+	return 0;
+
+err_init:
+	comp_data_blob_handler_free(cd->model_handler);
+
+err:
+	rfree(cd);
+	return ret;
+}
+
+static int limiter_free(struct processing_module *mod)
+{
+	struct limiter_comp_data *cd = module_get_private_data(mod);
+
+	comp_info(mod->dev, "limiter_free()");
+	comp_data_blob_handler_free(cd->model_handler);
+	limiter_free_buffers(&cd->state);
+	rfree(cd);
+	return 0;
+}
+
+static int limiter_get_config(struct processing_module *mod,
+			      uint32_t config_id, uint32_t *data_offset_size,
+			      uint8_t *fragment, size_t fragment_size)
+{
+	struct sof_ipc_ctrl_data *cdata = (struct sof_ipc_ctrl_data *)fragment;
+	struct limiter_comp_data *cd = module_get_private_data(mod);
+
+	comp_info(mod->dev, "limiter_get_config()");
+
+	return comp_data_blob_get_cmd(cd->model_handler, cdata, fragment_size);
+}
+
+static int limiter_set_config(struct processing_module *mod, uint32_t config_id,
+			      enum module_cfg_fragment_position pos, uint32_t data_offset_size,
+			      const uint8_t *fragment, size_t fragment_size, uint8_t *response,
+			      size_t response_size)
+{
+	struct limiter_comp_data *cd = module_get_private_data(mod);
+
+	comp_info(mod->dev, "limiter_set_config()");
+
+	return comp_data_blob_set(cd->model_handler, pos, data_offset_size,
+				  fragment, fragment_size);
+}
+
+static int limiter_process(struct processing_module *mod,
+			   struct sof_source **sources, int num_of_sources,
+			   struct sof_sink **sinks, int num_of_sinks)
+{
+	struct limiter_comp_data *cd = module_get_private_data(mod);
+	struct sof_source *source = sources[0];
+	struct sof_sink *sink = sinks[0];
+	const void *x;
+	const void *x_start;
+	void *y;
+	void *y_start;
+	size_t source_bytes;
+	size_t sink_bytes;
+	size_t x_size;
+	size_t y_size;
+	int frames;
+	int ret;
+
+	frames = MIN(source_get_data_frames_available(source), sink_get_free_frames(sink));
+	if (!frames)
+		return 0;
+
+	source_bytes = frames * source_get_frame_bytes(source);
+	sink_bytes = frames * sink_get_frame_bytes(sink);
+	ret = source_get_data(source, source_bytes, &x, &x_start, &x_size);
+	if (ret)
+		return ret;
+
+	ret = sink_get_buffer(sink, sink_bytes, &y, &y_start, &y_size);
+	if (ret) {
+		source_release_data(source, 0);
+		return ret;
+	}
+
+	cd->state.func(&cd->state, x, x_start, (const uint8_t *)x_start + x_size,
+		       y, y_start, (uint8_t *)y_start + y_size, frames);
+
+	source_release_data(source, source_bytes);
+	sink_commit_buffer(sink, sink_bytes);
+	return 0;
+}
+
+#if CONFIG_IPC_MAJOR_4
+static int limiter_ipc4_params(struct processing_module *mod, struct sof_source *source,
+			       struct sof_sink *sink)
+{
+	struct sof_ipc_stream_params *params = mod->stream_params;
+	struct comp_dev *dev = mod->dev;
+	int ret;
+
+	ipc4_base_module_cfg_to_stream_params(&mod->priv.cfg.base_cfg, params);
+	component_set_nearest_period_frames(dev, params->rate);
+	ret = source_set_params(source, params, true);
+	if (ret)
+		return ret;
+
+	return sink_set_params(sink, params, true);
+}
+#endif /* CONFIG_IPC_MAJOR_4 */
+
+static int limiter_prepare(struct processing_module *mod,
+			   struct sof_source **sources, int num_of_sources,
+			   struct sof_sink **sinks, int num_of_sinks)
+{
+	struct limiter_comp_data *cd = module_get_private_data(mod);
+	struct sof_source *source = sources[0];
+	struct sof_sink *sink = sinks[0];
+	struct comp_dev *dev = mod->dev;
+	struct sof_limiter_config *config;
+	enum sof_ipc_frame fmt;
+	size_t config_size;
+	int channels;
+	int ret;
+
+	comp_info(dev, "limiter_prepare()");
+
+#if CONFIG_IPC_MAJOR_4
+	ret = limiter_ipc4_params(mod, source, sink);
+	if (ret) {
+		comp_err(dev, "limiter_prepare(): Failed to set source or sink parameters.");
+		return ret;
+	}
+#endif
+
+	fmt = source_get_frm_fmt(source);
+	channels = source_get_channels(source);
+	if (fmt != sink_get_frm_fmt(sink) || channels != sink_get_channels(sink)) {
+		comp_err(dev, "limiter_prepare(): Source and sink format or channels mismatch.");
+		return -EINVAL;
+	}
+
+	config = comp_get_data_blob(cd->model_handler, &config_size, NULL);
+	if (config && config_size != sizeof(struct sof_limiter_config)) {
+		comp_err(dev, "limiter_prepare(): Illegal configuration size %zu", config_size);
+		return -EINVAL;
+	}
+
+	/* Release buffers from previous prepare if not reset in between */
+	limiter_free_buffers(&cd->state);
+	ret = limiter_setup(&cd->state, config, channels, fmt, source_get_rate(source));
+	if (ret)
+		comp_err(dev, "limiter_prepare(): Failed setup for format %d, rate %u, error %d",
+			 fmt, source_get_rate(source), ret);
+
+	return ret;
+}
+
+static int limiter_reset(struct processing_module *mod)
+{
+	struct limiter_comp_data *cd = module_get_private_data(mod);
+
+	comp_info(mod->dev, "limiter_reset()");
+
+	limiter_free_buffers(&cd->state);
+	return 0;
+}
+
+static const struct module_interface limiter_interface = {
+	.init = limiter_init,
+	.free = limiter_free,
+	.set_configuration = limiter_set_config,
+	.get_configuration = limiter_get_config,
+	.process = limiter_process,
+	.prepare = limiter_prepare,
+	.reset = limiter_reset,
+};
+
+DECLARE_MODULE_ADAPTER(limiter_interface, limiter_uuid, limiter_tr);
+SOF_MODULE_INIT(limiter, sys_comp_module_limiter_interface_init);
+
+#if CONFIG_COMP_LIMITER_MODULE
+/* modular: llext dynamic link */
+
+#include <module/module/api_ver.h>
+#include <module/module/llext.h>
+#include <rimage/sof/user/manifest.h>
+
+SOF_LLEXT_MOD_ENTRY(limiter, &limiter_interface);
+
+static const struct sof_man_module_manifest mod_manifest __section(".module") __used =
+	SOF_LLEXT_MODULE_MANIFEST("LIMITER", limiter_llext_entry, 1, SOF_REG_UUID(limiter), 40);
+
+SOF_LLEXT_BUILDINFO;
+
+#endif
@@ -0,0 +1,91 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __SOF_AUDIO_LIMITER_LIMITER_H__
+#define __SOF_AUDIO_LIMITER_LIMITER_H__
+
+#include <ipc/stream.h>
+#include <user/limiter.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define LIMITER_GAIN_SHIFT		30 /* Gains are Q2.30 */
+#define LIMITER_GAIN_UNITY		(1 << LIMITER_GAIN_SHIFT)
+#define LIMITER_BLOCK_FRAMES		32 /* Frames per gain computation pass */
+#define LIMITER_MAX_LOOKAHEAD_FRAMES	4096
+
+#define LIMITER_DEFAULT_THRESHOLD	0x721482c0 /* -1 dBFS */
+#define LIMITER_DEFAULT_LOOKAHEAD_US	1000
+#define LIMITER_DEFAULT_RELEASE_US	50000
+
+struct limiter_state;
+
+typedef void (*limiter_func)(struct limiter_state *state,
+			     const void *x_ptr, const void *x_start, const void *x_end,
+			     void *y_ptr, void *y_start, void *y_end,
+			     int frames);
+
+/*
+ * The gain of a frame is the threshold divided by the largest peak in a
+ * window of lookahead + 1 frames, found with a monotonic deque. The gain is
+ * smoothed by a release filter and a moving average over the same window,
+ * and applied to the input delayed by lookahead frames, so every frame is
+ * attenuated to the threshold before its peak reaches the output.
+ */
+struct limiter_state {
+	void *delay; /**< interleaved delay line of lookahead frames */
+	int32_t *env; /**< moving average delay line of window gains */
+	int32_t *deque_peak; /**< deque of decreasing peaks, Q1.31 */
+	uint32_t *deque_frame; /**< frame counter values of the deque peaks */
+	int64_t env_sum; /**< sum of the moving average delay line */
+	int64_t env_sum_unity; /**< the sum when all gains are unity */
+	uint32_t frame; /**< running frame counter */
+	int32_t threshold; /**< Q1.31 */
+	int32_t release; /**< Q1.31 release filter coefficient */
+	int32_t release_gain; /**< release filter output, Q2.30 */
+	int32_t hold_peak; /**< peak of the last hold gain computation */
+	int32_t hold_gain; /**< gain for hold_peak, Q2.30 */
+	int32_t inv_window; /**< 2^31 / window, floor */
+	int deque_head; /**< index of the largest peak */
+	int deque_count;
+	int env_index;
+	int delay_index; /**< samples */
+	int delay_samples;
+	int window; /**< lookahead + 1 frames */
+	int channels;
+	limiter_func func;
+};
+
+/** \brief Limiter processing functions map item. */
+struct limiter_func_map {
+	enum sof_ipc_frame fmt; /**< source and sink frame format */
+	limiter_func func; /**< processing function */
+};
+
+/** \brief Map of formats with dedicated processing functions. */
+extern const struct limiter_func_map limiter_fm[];
+
+/** \brief Number of processing functions. */
+extern const size_t limiter_fm_count;
+
+/**
+ * \brief Allocates and initializes the limiter state.
+ * \param state Limiter state, the previous buffers must be freed.
+ * \param config Configuration, NULL for the defaults.
+ * \param channels Number of interleaved channels.
+ * \param fmt Source and sink frame format.
+ * \param rate Sample rate in Hz.
+ * \return Zero on success, otherwise error code.
+ */
+int limiter_setup(struct limiter_state *state, const struct sof_limiter_config *config,
+		  int channels, enum sof_ipc_frame fmt, int rate);
+
+/**
+ * \brief Frees the limiter buffers.
+ * \param state Limiter state.
+ */
+void limiter_free_buffers(struct limiter_state *state);
+
+#endif /* __SOF_AUDIO_LIMITER_LIMITER_H__ */
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/audio_stream.h>
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <sof/math/numbers.h>
+#include <ipc/topology.h>
+#include <rtos/alloc.h>
+#include <user/limiter.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "limiter.h"
+
+static limiter_func limiter_find_func(enum sof_ipc_frame fmt)
+{
+	int i;
+
+	for (i = 0; i < limiter_fm_count; i++) {
+		if (limiter_fm[i].fmt == fmt)
+			return limiter_fm[i].func;
+	}
+
+	return NULL;
+}
+
+int limiter_setup(struct limiter_state *state, const struct sof_limiter_config *config,
+		  int channels, enum sof_ipc_frame fmt, int rate)
+{
+	int32_t threshold = LIMITER_DEFAULT_THRESHOLD;
+	int32_t lookahead_us = LIMITER_DEFAULT_LOOKAHEAD_US;
+	int32_t release_us = LIMITER_DEFAULT_RELEASE_US;
+	int64_t release;
+	size_t delay_size;
+	size_t size;
+	int lookahead;
+	int i;
+
+	if (config) {
+		threshold = config->threshold;
+		lookahead_us = config->lookahead_us;
+		release_us = config->release_us;
+	}
+
+	if (threshold <= 0 || lookahead_us < 0 || release_us < 0 || channels < 1 ||
+	    rate <= 0)
+		return -EINVAL;
+
+	state->func = limiter_find_func(fmt);
+	if (!state->func)
+		return -EINVAL;
+
+	/* At least one frame of delay, without it only a zero gain would do */
+	lookahead = ((int64_t)lookahead_us * rate + 500000) / 1000000;
+	lookahead = MAX(lookahead, 1);
+	if (lookahead > LIMITER_MAX_LOOKAHEAD_FRAMES)
+		return -EINVAL;
+
+	/* 1 - exp(-1 / (rate * tau)) approximated with 1 / (rate * tau + 0.5) */
+	release = ((int64_t)1 << 32) * 1000000 / ((int64_t)2 * rate * release_us + 1000000);
+
+	state->threshold = threshold;
+	state->release = MIN(release, INT32_MAX);
+	state->channels = channels;
+	state->window = lookahead + 1;
+	state->delay_samples = lookahead * channels;
+	state->inv_window = ((int64_t)1 << 31) / state->window;
+
+	delay_size = ALIGN_UP(state->delay_samples * get_sample_bytes(fmt), sizeof(int32_t));
+	size = delay_size + state->window * (2 * sizeof(int32_t) + sizeof(uint32_t));
+	state->delay = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, size);
+	if (!state->delay)
+		return -ENOMEM;
+
+	state->env = (int32_t *)((uint8_t *)state->delay + delay_size);
+	state->deque_peak = state->env + state->window;
+	state->deque_frame = (uint32_t *)(state->deque_peak + state->window);
+
+	/* The delay line starts as silence with unity gain */
+	for (i = 0; i < state->window; i++)
+		state->env[i] = LIMITER_GAIN_UNITY;
+
+	state->env_sum_unity = (int64_t)state->window * LIMITER_GAIN_UNITY;
+	state->env_sum = state->env_sum_unity;
+	state->release_gain = LIMITER_GAIN_UNITY;
+	state->hold_peak = 0;
+	state->hold_gain = LIMITER_GAIN_UNITY;
+	state->frame = 0;
+	state->deque_head = 0;
+	state->deque_count = 0;
+	state->env_index = 0;
+	state->delay_index = 0;
+	return 0;
+}
+
+void limiter_free_buffers(struct limiter_state *state)
+{
+	rfree(state->delay);
+	state->delay = NULL;
+}
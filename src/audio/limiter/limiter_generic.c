@@ -0,0 +1,319 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/audio_stream.h>
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <sof/math/numbers.h>
+#include <ipc/stream.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "limiter.h"
+
+/* The processing is done in blocks of frames. The peaks of a block are
+ * found first, then converted to gains with the scalar deque and gain
+ * smoothing, and finally the block is exchanged with the delay line and
+ * multiplied by the gains. Only the gain computation is sequential, the
+ * peak and multiply loops have no dependencies between frames. The
+ * absolute value of a negative sample is taken as s ^ (s >> 31), one less
+ * than the magnitude, which the gain computation compensates. Since the
+ * gain is never above unity and the product is rounded towards minus
+ * infinity, the output can't saturate.
+ */
+
+static inline int limiter_wrap(int i, int n)
+{
+	return i >= n ? i - n : i;
+}
+
+static inline int32_t limiter_gain(struct limiter_state *state, int32_t peak)
+{
+	const uint32_t frame = state->frame++;
+	const int window = state->window;
+	int32_t *peaks = state->deque_peak;
+	uint32_t *frames = state->deque_frame;
+	int32_t gain;
+	int tail;
+
+	/* Remove the largest peak when it leaves the window */
+	if (state->deque_count && frame - frames[state->deque_head] >= (uint32_t)window) {
+		state->deque_head = limiter_wrap(state->deque_head + 1, window);
+		state->deque_count--;
+	}
+
+	/* Remove the peaks that can't become the largest before leaving */
+	while (state->deque_count) {
+		tail = limiter_wrap(state->deque_head + state->deque_count - 1, window);
+		if (peaks[tail] > peak)
+			break;
+
+		state->deque_count--;
+	}
+
+	tail = limiter_wrap(state->deque_head + state->deque_count, window);
+	peaks[tail] = peak;
+	frames[tail] = frame;
+	state->deque_count++;
+
+	/* The division is needed only when the largest peak changes */
+	peak = peaks[state->deque_head];
+	if (peak <= state->threshold) {
+		gain = LIMITER_GAIN_UNITY;
+	} else {
+		if (peak != state->hold_peak) {
+			state->hold_peak = peak;
+			state->hold_gain = ((int64_t)state->threshold << LIMITER_GAIN_SHIFT) /
+					   ((int64_t)peak + 1);
+		}
+		gain = state->hold_gain;
+	}
+
+	/* Instant attack, the release is rounded up to reach the unity gain */
+	if (gain < state->release_gain)
+		state->release_gain = gain;
+	else
+		state->release_gain += ((int64_t)(gain - state->release_gain) *
+					state->release + INT32_MAX) >> 31;
+
+	/* Moving average over the window, rounded down to stay below the gains */
+	state->env_sum += state->release_gain - state->env[state->env_index];
+	state->env[state->env_index] = state->release_gain;
+	state->env_index = limiter_wrap(state->env_index + 1, window);
+	if (state->env_sum == state->env_sum_unity)
+		return LIMITER_GAIN_UNITY;
+
+	return ((state->env_sum >> 10) * state->inv_window) >> 21;
+}
+
+/* Converts the Q1.31 peaks of frames to gains in place, returns true if
+ * all gains are unity.
+ */
+static bool limiter_gains(struct limiter_state *state, int32_t *gain, int frames)
+{
+	bool unity = true;
+	int i;
+
+	for (i = 0; i < frames; i++) {
+		gain[i] = limiter_gain(state, gain[i]);
+		unity = unity && gain[i] == LIMITER_GAIN_UNITY;
+	}
+
+	return unity;
+}
+
+static int limiter_frames_without_wrap(struct limiter_state *state, int frames,
+				       int source_samples, int sink_samples)
+{
+	int n = MIN(frames, LIMITER_BLOCK_FRAMES);
+
+	n = MIN(n, (state->delay_samples - state->delay_index) / state->channels);
+	n = MIN(n, source_samples / state->channels);
+	return MIN(n, sink_samples / state->channels);
+}
+
+static void limiter_advance(struct limiter_state *state, int samples)
+{
+	state->delay_index += samples;
+	if (state->delay_index == state->delay_samples)
+		state->delay_index = 0;
+}
+
+#if CONFIG_FORMAT_S16LE
+static void limiter_s16(struct limiter_state *state,
+			const void *x_ptr, const void *x_start, const void *x_end,
+			void *y_ptr, void *y_start, void *y_end,
+			int frames)
+{
+	int32_t gain[LIMITER_BLOCK_FRAMES];
+	const int16_t *x = x_ptr;
+	int16_t *y = y_ptr;
+	int16_t *d;
+	const int nch = state->channels;
+	int32_t peak;
+	int32_t g;
+	int32_t s;
+	int samples;
+	int ch;
+	int n;
+	int i;
+	int j;
+
+	while (frames) {
+		n = limiter_frames_without_wrap(state, frames, (const int16_t *)x_end - x,
+						(int16_t *)y_end - y);
+		samples = n * nch;
+		for (i = 0, j = 0; i < n; i++) {
+			peak = 0;
+			for (ch = 0; ch < nch; ch++, j++) {
+				s = x[j] << 16;
+				peak = MAX(peak, s ^ (s >> 31));
+			}
+			gain[i] = peak;
+		}
+
+		d = (int16_t *)state->delay + state->delay_index;
+		if (limiter_gains(state, gain, n)) {
+			for (j = 0; j < samples; j++) {
+				s = d[j];
+				d[j] = x[j];
+				y[j] = s;
+			}
+		} else {
+			for (i = 0, j = 0; i < n; i++) {
+				g = gain[i];
+				for (ch = 0; ch < nch; ch++, j++) {
+					s = d[j];
+					d[j] = x[j];
+					y[j] = ((int64_t)s * g) >> LIMITER_GAIN_SHIFT;
+				}
+			}
+		}
+
+		limiter_advance(state, samples);
+		x += samples;
+		y += samples;
+		x = cir_buf_wrap((void *)x, (void *)x_start, (void *)x_end);
+		y = cir_buf_wrap(y, y_start, y_end);
+		frames -= n;
+	}
+}
+#endif /* CONFIG_FORMAT_S16LE */
+
+#if CONFIG_FORMAT_S24LE
+static void limiter_s24(struct limiter_state *state,
+			const void *x_ptr, const void *x_start, const void *x_end,
+			void *y_ptr, void *y_start, void *y_end,
+			int frames)
+{
+	int32_t gain[LIMITER_BLOCK_FRAMES];
+	const int32_t *x = x_ptr;
+	int32_t *y = y_ptr;
+	int32_t *d;
+	const int nch = state->channels;
+	int32_t peak;
+	int32_t g;
+	int32_t s;
+	int samples;
+	int ch;
+	int n;
+	int i;
+	int j;
+
+	while (frames) {
+		n = limiter_frames_without_wrap(state, frames, (const int32_t *)x_end - x,
+						(int32_t *)y_end - y);
+		samples = n * nch;
+		for (i = 0, j = 0; i < n; i++) {
+			peak = 0;
+			for (ch = 0; ch < nch; ch++, j++) {
+				s = x[j] << 8;
+				peak = MAX(peak, s ^ (s >> 31));
+			}
+			gain[i] = peak;
+		}
+
+		d = (int32_t *)state->delay + state->delay_index;
+		if (limiter_gains(state, gain, n)) {
+			for (j = 0; j < samples; j++) {
+				s = d[j];
+				d[j] = x[j];
+				y[j] = s;
+			}
+		} else {
+			for (i = 0, j = 0; i < n; i++) {
+				g = gain[i];
+				for (ch = 0; ch < nch; ch++, j++) {
+					s = sign_extend_s24(d[j]);
+					d[j] = x[j];
+					y[j] = ((int64_t)s * g) >> LIMITER_GAIN_SHIFT;
+				}
+			}
+		}
+
+		limiter_advance(state, samples);
+		x += samples;
+		y += samples;
+		x = cir_buf_wrap((void *)x, (void *)x_start, (void *)x_end);
+		y = cir_buf_wrap(y, y_start, y_end);
+		frames -= n;
+	}
+}
+#endif /* CONFIG_FORMAT_S24LE */
+
+#if CONFIG_FORMAT_S32LE
+static void limiter_s32(struct limiter_state *state,
+			const void *x_ptr, const void *x_start, const void *x_end,
+			void *y_ptr, void *y_start, void *y_end,
+			int frames)
+{
+	int32_t gain[LIMITER_BLOCK_FRAMES];
+	const int32_t *x = x_ptr;
+	int32_t *y = y_ptr;
+	int32_t *d;
+	const int nch = state->channels;
+	int32_t peak;
+	int32_t g;
+	int32_t s;
+	int samples;
+	int ch;
+	int n;
+	int i;
+	int j;
+
+	while (frames) {
+		n = limiter_frames_without_wrap(state, frames, (const int32_t *)x_end - x,
+						(int32_t *)y_end - y);
+		samples = n * nch;
+		for (i = 0, j = 0; i < n; i++) {
+			peak = 0;
+			for (ch = 0; ch < nch; ch++, j++) {
+				s = x[j];
+				peak = MAX(peak, s ^ (s >> 31));
+			}
+			gain[i] = peak;
+		}
+
+		d = (int32_t *)state->delay + state->delay_index;
+		if (limiter_gains(state, gain, n)) {
+			for (j = 0; j < samples; j++) {
+				s = d[j];
+				d[j] = x[j];
+				y[j] = s;
+			}
+		} else {
+			for (i = 0, j = 0; i < n; i++) {
+				g = gain[i];
+				for (ch = 0; ch < nch; ch++, j++) {
+					s = d[j];
+					d[j] = x[j];
+					y[j] = ((int64_t)s * g) >> LIMITER_GAIN_SHIFT;
+				}
+			}
+		}
+
+		limiter_advance(state, samples);
+		x += samples;
+		y += samples;
+		x = cir_buf_wrap((void *)x, (void *)x_start, (void *)x_end);
+		y = cir_buf_wrap(y, y_start, y_end);
+		frames -= n;
+	}
+}
+#endif /* CONFIG_FORMAT_S32LE */
+
+const struct limiter_func_map limiter_fm[] = {
+#if CONFIG_FORMAT_S16LE
+	{SOF_IPC_FRAME_S16_LE, limiter_s16},
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	{SOF_IPC_FRAME_S24_4LE, limiter_s24},
+#endif /* CONFIG_FORMAT_S24LE */
+#if CONFIG_FORMAT_S32LE
+	{SOF_IPC_FRAME_S32_LE, limiter_s32},
+#endif /* CONFIG_FORMAT_S32LE */
+};
+
+const size_t limiter_fm_count = ARRAY_SIZE(limiter_fm);
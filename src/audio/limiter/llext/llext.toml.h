@@ -0,0 +1,6 @@
+#include <tools/rimage/config/platform.toml>
+#define LOAD_TYPE "2"
+#include "../limiter.toml"
+
+[module]
+count = __COUNTER__
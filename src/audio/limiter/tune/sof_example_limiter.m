@@ -0,0 +1,38 @@
+function sof_example_limiter()
+
+% Default blob, -1 dBFS threshold, 1 ms look-ahead, 50 ms release
+prm.threshold_db = -1;
+prm.lookahead_ms = 1;
+prm.release_ms = 50;
+prm.id = "default";
+limiter_blob_calculate(prm);
+
+end
+
+function limiter_blob_calculate(prm)
+
+% Set the parameters here
+sof_tools = '../../../../tools';
+sof_tplg = fullfile(sof_tools, 'topology');
+sof_ctl = fullfile(sof_tools, 'ctl');
+tplg2_fn = sprintf("%s/topology2/include/components/limiter/%s.conf", sof_tplg, prm.id);
+% Use those files with sof-ctl to update the component's configuration
+blob4_fn = sprintf("%s/ipc4/limiter/%s.bin", sof_ctl, prm.id); % Blob binary file
+alsa4_fn = sprintf("%s/ipc4/limiter/%s.txt", sof_ctl, prm.id); % ALSA CSV format file
+
+endian = "little";
+
+sof_limiter_paths(true);
+
+blob8_ipc4 = sof_limiter_build_blob(prm, endian, 4);
+
+% Generate output files
+sof_tplg2_write(tplg2_fn, blob8_ipc4, "limiter_config", ...
+		"Exported with script sof_example_limiter.m" , ...
+		"cd src/audio/limiter/tune; octave sof_example_limiter.m");
+sof_ucm_blob_write(blob4_fn, blob8_ipc4);
+sof_alsactl_write(alsa4_fn, blob8_ipc4);
+
+sof_limiter_paths(false);
+
+end
@@ -0,0 +1,72 @@
+function blob8 = sof_limiter_build_blob(prm, endian, ipc_ver)
+
+% blob8 = sof_limiter_build_blob(prm, endian, ipc_ver)
+%
+% Input
+%	prm.threshold_db - peak level limit in dBFS
+%	prm.lookahead_ms - look-ahead time and delay of the output
+%	prm.release_ms - release time constant
+%	endian - 'little' or 'big', defaults to little
+%	ipc_ver - 3 or 4, defaults to 4
+%
+% Output
+%	blob8 - configuration blob with ABI header
+
+% SPDX-License-Identifier: BSD-3-Clause
+%
+% Copyright (c) 2026, Intel Corporation. All rights reserved.
+
+if nargin < 2
+	endian = 'little';
+end
+
+if nargin < 3
+	ipc_ver = 4;
+end
+
+%% Shift values for little/big endian
+switch lower(endian)
+	case 'little'
+		sh = [0 -8 -16 -24];
+	case 'big'
+		sh = [-24 -16 -8 0];
+	otherwise
+		error('Unknown endiannes');
+end
+
+if prm.threshold_db > 0
+	error('The threshold must not be above 0 dBFS');
+end
+
+%% Convert to struct sof_limiter_config values
+threshold = min(round(10^(prm.threshold_db / 20) * 2^31), 2^31 - 1);
+lookahead_us = round(prm.lookahead_ms * 1000);
+release_us = round(prm.release_ms * 1000);
+
+%% Build blob
+data_size = 9 * 4;
+[abi_bytes, abi_size] = sof_get_abi(data_size, ipc_ver);
+blob_size = data_size + abi_size;
+blob8 = uint8(zeros(1, blob_size));
+
+% Insert ABI header
+blob8(1:abi_size) = abi_bytes;
+j = abi_size + 1;
+
+% Insert size, reserved[4], threshold, lookahead_us, release_us, reserved2
+words = [data_size 0 0 0 0 threshold lookahead_us release_us 0];
+for i = 1:length(words)
+	blob8(j:j+3) = word2byte(words(i), sh);
+	j = j + 4;
+end
+
+end
+
+function bytes = word2byte(word, sh)
+bytes = uint8(zeros(1,4));
+word = int64(word);
+bytes(1) = bitand(bitshift(word, sh(1)), 255);
+bytes(2) = bitand(bitshift(word, sh(2)), 255);
+bytes(3) = bitand(bitshift(word, sh(3)), 255);
+bytes(4) = bitand(bitshift(word, sh(4)), 255);
+end
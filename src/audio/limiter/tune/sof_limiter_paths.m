@@ -0,0 +1,18 @@
+function sof_limiter_paths(enable)
+
+% sof_limiter_paths(enable)
+% enable - set to true to enable needed search path
+%          set to false to disable the search paths
+%
+
+% SPDX-License-Identifier: BSD-3-Clause
+%
+% Copyright (c) 2026, Intel Corporation. All rights reserved.
+
+	common = '../../../../tools/tune/common';
+	if enable
+		addpath(common);
+	else
+		rmpath(common);
+	end
+end
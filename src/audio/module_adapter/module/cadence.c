@@ -279,6 +279,7 @@ static int cadence_codec_init(struct processing_module *mod)
 
 	codec->private = cd;
 	codec->mpd.init_done = 0;
+	mod->raw_data_zero_copy = true;
 
 	/* copy the setup config only for the first init */
 	if (codec->state == MODULE_DISABLED && codec->cfg.avail) {
@@ -356,6 +357,7 @@ static int cadence_codec_init(struct processing_module *mod)
 
 	codec->private = cd;
 	codec->mpd.init_done = 0;
+	mod->raw_data_zero_copy = true;
 
 	/* copy the setup config only for the first init */
 	if (codec->state == MODULE_DISABLED && codec->cfg.avail) {
@@ -765,8 +767,8 @@ cadence_codec_process(struct processing_module *mod,
 	}
 
 	if (!codec->mpd.init_done) {
-		memcpy_s(codec->mpd.in_buff, codec->mpd.in_buff_size, input_buffers[0].data,
-			 codec->mpd.in_buff_size);
+		module_input_read(&input_buffers[0], 0, codec->mpd.in_buff,
+				  codec->mpd.in_buff_size);
 		codec->mpd.avail = codec->mpd.in_buff_size;
 
 		ret = cadence_codec_init_process(mod);
@@ -787,9 +789,8 @@ cadence_codec_process(struct processing_module *mod,
 	if (remaining < codec->mpd.in_buff_size)
 		return -ENODATA;
 
-	memcpy_s(codec->mpd.in_buff, codec->mpd.in_buff_size,
-		 (uint8_t *)input_buffers[0].data + input_buffers[0].consumed,
-		 codec->mpd.in_buff_size);
+	module_input_read(&input_buffers[0], input_buffers[0].consumed, codec->mpd.in_buff,
+			  codec->mpd.in_buff_size);
 	codec->mpd.avail = codec->mpd.in_buff_size;
 
 	comp_dbg(dev, "cadence_codec_process() start");
@@ -830,9 +831,7 @@ cadence_codec_process(struct processing_module *mod,
 	codec->mpd.consumed = input_buffers[0].consumed;
 
 	/* copy the produced samples into the output buffer */
-	memcpy_s(output_buffers[0].data, codec->mpd.produced, codec->mpd.out_buff,
-		 codec->mpd.produced);
-	output_buffers[0].size = codec->mpd.produced;
+	module_output_write(&output_buffers[0], codec->mpd.out_buff, codec->mpd.produced);
 
 	comp_dbg(dev, "cadence_codec_process() done");
 
@@ -17,6 +17,7 @@ DECLARE_TR_CTX(passthrough_tr, SOF_UUID(passthrough_uuid), LOG_LEVEL_INFO);
 static int passthrough_codec_init(struct processing_module *mod)
 {
 	comp_info(mod->dev, "passthrough_codec_init() start");
+	mod->raw_data_zero_copy = true;
 	return 0;
 }
 
@@ -81,8 +82,7 @@ passthrough_codec_process(struct processing_module *mod,
 	if (!codec->mpd.init_done)
 		passthrough_codec_init_process(mod);
 
-	memcpy_s(codec->mpd.in_buff, codec->mpd.in_buff_size,
-		 input_buffers[0].data, codec->mpd.in_buff_size);
+	module_input_read(&input_buffers[0], 0, codec->mpd.in_buff, codec->mpd.in_buff_size);
 
 	comp_dbg(dev, "passthrough_codec_process()");
 
@@ -93,9 +93,7 @@ passthrough_codec_process(struct processing_module *mod,
 	input_buffers[0].consumed = codec->mpd.consumed;
 
 	/* copy the produced samples into the output buffer */
-	memcpy_s(output_buffers[0].data, codec->mpd.produced, codec->mpd.out_buff,
-		 codec->mpd.produced);
-	output_buffers[0].size = codec->mpd.produced;
+	module_output_write(&output_buffers[0], codec->mpd.out_buff, codec->mpd.produced);
 
 	return 0;
 }
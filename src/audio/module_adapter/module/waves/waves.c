@@ -671,6 +671,7 @@ static int waves_codec_init(struct processing_module *mod)
 	} else {
 		memset(waves_codec, 0, sizeof(struct waves_codec_data));
 		codec->private = waves_codec;
+		mod->raw_data_zero_copy = true;
 		ret = waves_effect_allocate(mod);
 		if (ret) {
 			module_free_memory(mod, waves_codec);
@@ -770,8 +771,7 @@ waves_codec_process(struct processing_module *mod,
 	if (!codec->mpd.init_done)
 		waves_codec_init_process(mod);
 
-	memcpy_s(codec->mpd.in_buff, codec->mpd.in_buff_size,
-		 input_buffers[0].data, codec->mpd.in_buff_size);
+	module_input_read(&input_buffers[0], 0, codec->mpd.in_buff, codec->mpd.in_buff_size);
 	codec->mpd.avail = codec->mpd.in_buff_size;
 
 	comp_dbg(dev, "waves_codec_process() start");
@@ -813,9 +813,7 @@ waves_codec_process(struct processing_module *mod,
 		input_buffers[0].consumed = codec->mpd.consumed;
 		ret = 0;
 		/* copy the produced samples into the output buffer */
-		memcpy_s(output_buffers[0].data, codec->mpd.produced, codec->mpd.out_buff,
-			 codec->mpd.produced);
-		output_buffers[0].size = codec->mpd.produced;
+		module_output_write(&output_buffers[0], codec->mpd.out_buff, codec->mpd.produced);
 	}
 
 	if (ret)
@@ -152,6 +152,53 @@ static void module_adapter_calculate_dp_period(struct comp_dev *dev)
 }
 #endif /* CONFIG_ZEPHYR_DP_SCHEDULER */
 
+#if CONFIG_MODULE_ADAPTER_IN_PLACE
+/*
+ * Let the sink buffer of a module processing in place share the memory of its source
+ * buffer. The producer, the module and the consumer must run in the same LL pipeline
+ * so that the whole alias chain is reset together, and the buffers must not allow
+ * xruns as those would overwrite data not yet read downstream.
+ */
+static void module_adapter_alias_buffers(struct processing_module *mod)
+{
+	struct comp_dev *dev = mod->dev;
+	struct comp_buffer *source = comp_dev_get_first_data_producer(dev);
+	struct comp_buffer *sink = comp_dev_get_first_data_consumer(dev);
+	struct audio_stream *src, *snk;
+	struct comp_dev *prev, *next;
+
+	if (!mod->process_in_place || !mod->stream_copy_single_to_single ||
+	    mod->num_of_sources != 1 || mod->num_of_sinks != 1 ||
+	    dev->ipc_config.proc_domain != COMP_PROCESSING_DOMAIN_LL)
+		return;
+
+	if (audio_buffer_is_shared(&source->audio_buffer) ||
+	    audio_buffer_is_shared(&sink->audio_buffer))
+		return;
+
+	prev = comp_buffer_get_source_component(source);
+	next = comp_buffer_get_sink_component(sink);
+	if (!prev || !next || prev->pipeline != dev->pipeline || next->pipeline != dev->pipeline ||
+	    prev->ipc_config.proc_domain != COMP_PROCESSING_DOMAIN_LL ||
+	    next->ipc_config.proc_domain != COMP_PROCESSING_DOMAIN_LL)
+		return;
+
+	src = &source->stream;
+	snk = &sink->stream;
+	if (audio_stream_get_frm_fmt(src) != audio_stream_get_frm_fmt(snk) ||
+	    audio_stream_get_channels(src) != audio_stream_get_channels(snk) ||
+	    audio_stream_get_rate(src) != audio_stream_get_rate(snk))
+		return;
+
+	if (audio_stream_get_underrun(src) || audio_stream_get_overrun(src) ||
+	    audio_stream_get_underrun(snk) || audio_stream_get_overrun(snk))
+		return;
+
+	if (!buffer_alias(source, sink))
+		comp_info(dev, "module_adapter_prepare(): processing in place");
+}
+#endif /* CONFIG_MODULE_ADAPTER_IN_PLACE */
+
 /*
  * \brief Prepare the module
  * \param[in] dev - component device pointer.
@@ -293,8 +340,12 @@ int module_adapter_prepare(struct comp_dev *dev)
 	 * no need to allocate intermediate sink buffers if the module produces only period bytes
 	 * every period and has only 1 input and 1 output buffer
 	 */
-	if (!IS_PROCESSING_MODE_RAW_DATA(mod))
+	if (!IS_PROCESSING_MODE_RAW_DATA(mod)) {
+#if CONFIG_MODULE_ADAPTER_IN_PLACE
+		module_adapter_alias_buffers(mod);
+#endif
 		return 0;
+	}
 
 	/* Module is prepared, now we need to configure processing settings.
 	 * If module internal buffer is not equal to natural multiple of pipeline
@@ -341,29 +392,35 @@ int module_adapter_prepare(struct comp_dev *dev)
 	buff_size = MAX(mod->period_bytes, md->mpd.out_buff_size) * buff_periods;
 	mod->output_buffer_size = buff_size;
 
-	/* allocate memory for input buffer data */
-	list_for_item(blist, &dev->bsource_list) {
-		size_t size = MAX(mod->deep_buff_bytes, mod->period_bytes);
+	/*
+	 * allocate memory for input and output buffer data, zero copy modules get pointers
+	 * into the source and local sink buffers on every copy instead
+	 */
+	if (!mod->raw_data_zero_copy) {
+		list_for_item(blist, &dev->bsource_list) {
+			size_t size = MAX(mod->deep_buff_bytes, mod->period_bytes);
 
-		mod->input_buffers[i].data = rballoc(0, SOF_MEM_CAPS_RAM, size);
-		if (!mod->input_buffers[i].data) {
-			comp_err(mod->dev, "module_adapter_prepare(): Failed to alloc input buffer data");
-			ret = -ENOMEM;
-			goto in_data_free;
+			mod->input_buffers[i].data = rballoc(0, SOF_MEM_CAPS_RAM, size);
+			if (!mod->input_buffers[i].data) {
+				comp_err(mod->dev, "module_adapter_prepare(): Failed to alloc input buffer data");
+				ret = -ENOMEM;
+				goto in_data_free;
+			}
+			i++;
 		}
-		i++;
-	}
 
-	/* allocate memory for output buffer data */
-	i = 0;
-	list_for_item(blist, &dev->bsink_list) {
-		mod->output_buffers[i].data = rballoc(0, SOF_MEM_CAPS_RAM, md->mpd.out_buff_size);
-		if (!mod->output_buffers[i].data) {
-			comp_err(mod->dev, "module_adapter_prepare(): Failed to alloc output buffer data");
-			ret = -ENOMEM;
-			goto out_data_free;
+		i = 0;
+		list_for_item(blist, &dev->bsink_list) {
+			mod->output_buffers[i].data = rballoc(0, SOF_MEM_CAPS_RAM,
+							      md->mpd.out_buff_size);
+			if (!mod->output_buffers[i].data) {
+				comp_err(mod->dev, "module_adapter_prepare(): Failed to alloc output buffer data");
+				ret = -ENOMEM;
+				goto out_data_free;
+			}
+			mod->output_buffers[i].free = md->mpd.out_buff_size;
+			i++;
 		}
-		i++;
 	}
 
 	/* allocate buffer for all sinks */
@@ -535,6 +592,36 @@ ca_copy_from_module_to_sink(const struct audio_stream *sink,
 		       MIN(audio_stream_get_size(sink), tail_size));
 }
 
+/*
+ * Function to point the module input buffer directly to the source buffer data
+ * @input: module input buffer
+ * @source: source audio buffer stream
+ * @bytes: number of bytes available in the source buffer
+ */
+static void module_input_set_direct(struct input_stream_buffer *input,
+				    const struct audio_stream *source, uint32_t bytes)
+{
+	input->data = audio_stream_get_rptr(source);
+	input->size = bytes;
+	input->head_size = audio_stream_bytes_without_wrap(source, input->data);
+	input->wrap_data = bytes > input->head_size ? audio_stream_get_addr(source) : NULL;
+}
+
+/*
+ * Function to point the module output buffer directly to the free space of the sink buffer
+ * @output: module output buffer
+ * @sink: sink audio buffer stream
+ */
+static void module_output_set_direct(struct output_stream_buffer *output,
+				     const struct audio_stream *sink)
+{
+	output->data = audio_stream_get_wptr(sink);
+	output->size = 0;
+	output->free = audio_stream_get_free_bytes(sink);
+	output->head_size = audio_stream_bytes_without_wrap(sink, output->data);
+	output->wrap_data = output->free > output->head_size ? audio_stream_get_addr(sink) : NULL;
+}
+
 /**
  * \brief Generate zero samples of "bytes" size for the sink.
  * \param[in] sink - a pointer to sink buffer.
@@ -612,8 +699,10 @@ static void module_adapter_process_output(struct comp_dev *dev)
 
 			buffer = container_of(blist, struct comp_buffer, buffers_list);
 
-			ca_copy_from_module_to_sink(&buffer->stream, mod->output_buffers[i].data,
-						    mod->output_buffers[i].size);
+			if (!mod->raw_data_zero_copy)
+				ca_copy_from_module_to_sink(&buffer->stream,
+							    mod->output_buffers[i].data,
+							    mod->output_buffers[i].size);
 			audio_stream_produce(&buffer->stream, mod->output_buffers[i].size);
 		}
 		i++;
@@ -1026,11 +1115,24 @@ static int module_adapter_raw_data_type_copy(struct comp_dev *dev)
 		mod->input_buffers[i].size = bytes_to_process;
 		mod->input_buffers[i].consumed = 0;
 
-		ca_copy_from_source_to_module(&source->stream, mod->input_buffers[i].data,
-					      md->mpd.in_buff_size, bytes_to_process);
+		if (mod->raw_data_zero_copy)
+			module_input_set_direct(&mod->input_buffers[i], &source->stream,
+						bytes_to_process);
+		else
+			ca_copy_from_source_to_module(&source->stream, mod->input_buffers[i].data,
+						      md->mpd.in_buff_size, bytes_to_process);
 		i++;
 	}
 
+	if (mod->raw_data_zero_copy) {
+		i = 0;
+		list_for_item(blist, &mod->raw_data_buffers_list) {
+			sink = container_of(blist, struct comp_buffer, buffers_list);
+			module_output_set_direct(&mod->output_buffers[i], &sink->stream);
+			i++;
+		}
+	}
+
 	ret = module_process_legacy(mod, mod->input_buffers, mod->num_of_sources,
 				    mod->output_buffers, mod->num_of_sinks);
 	if (ret) {
@@ -1049,7 +1151,8 @@ static int module_adapter_raw_data_type_copy(struct comp_dev *dev)
 	comp_dev_for_each_producer(dev, source) {
 		comp_update_buffer_consume(source, mod->input_buffers[i].consumed);
 
-		bzero((__sparse_force void *)mod->input_buffers[i].data, size);
+		if (!mod->raw_data_zero_copy)
+			bzero((__sparse_force void *)mod->input_buffers[i].data, size);
 		mod->input_buffers[i].size = 0;
 		mod->input_buffers[i].consumed = 0;
 
@@ -1069,7 +1172,8 @@ out:
 		mod->output_buffers[i].size = 0;
 
 	for (i = 0; i < mod->num_of_sources; i++) {
-		bzero((__sparse_force void *)mod->input_buffers[i].data, size);
+		if (!mod->raw_data_zero_copy)
+			bzero((__sparse_force void *)mod->input_buffers[i].data, size);
 		mod->input_buffers[i].size = 0;
 		mod->input_buffers[i].consumed = 0;
 	}
@@ -1143,13 +1247,20 @@ int module_adapter_reset(struct comp_dev *dev)
 		return ret;
 	}
 
-	if (IS_PROCESSING_MODE_RAW_DATA(mod)) {
+	if (IS_PROCESSING_MODE_RAW_DATA(mod) && !mod->raw_data_zero_copy) {
 		for (i = 0; i < mod->num_of_sinks; i++)
 			rfree((__sparse_force void *)mod->output_buffers[i].data);
 		for (i = 0; i < mod->num_of_sources; i++)
 			rfree((__sparse_force void *)mod->input_buffers[i].data);
 	}
 
+#if CONFIG_MODULE_ADAPTER_IN_PLACE
+	/* on failure the sink keeps sharing the memory of the source buffer */
+	if (IS_PROCESSING_MODE_AUDIO_STREAM(mod) && mod->num_of_sinks == 1 &&
+	    buffer_unalias(comp_dev_get_first_data_consumer(dev)) < 0)
+		comp_err(dev, "module_adapter_reset(): failed to unalias sink buffer");
+#endif
+
 	if (IS_PROCESSING_MODE_RAW_DATA(mod) || IS_PROCESSING_MODE_AUDIO_STREAM(mod)) {
 		rfree(mod->output_buffers);
 		rfree(mod->input_buffers);
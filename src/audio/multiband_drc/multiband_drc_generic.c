@@ -19,190 +19,140 @@ void multiband_drc_default_pass(const struct processing_module *mod,
 	audio_stream_copy(source, 0, sink, 0, audio_stream_get_channels(source) * frames);
 }
 
-static void multiband_drc_process_emp_crossover(struct multiband_drc_state *state,
-						crossover_split split_func,
-						int32_t *buf_src,
-						int32_t *buf_sink,
-						int enable_emp,
-						int nch,
-						int nband)
+/* Run the DRC gain computation for the bands once the pre-delay write index
+ * has reached a division (32 frames) boundary. The write indices of all bands
+ * are multiples of DRC_DIVISION_FRAMES apart so the bands reach the boundary
+ * at the same time.
+ */
+static void multiband_drc_update_drc(struct multiband_drc_state *state,
+				     const struct sof_drc_params *coef,
+				     int nbyte, int nch, int nband, int frames)
 {
-	struct iir_state_df1 *emp_s;
-	struct crossover_state *crossover_s;
-	int32_t *buf_sink_band;
-	int ch, band;
-	int32_t emp_out;
-	int32_t crossover_out[nband];
-
-	for (ch = 0; ch < nch; ch++) {
-		emp_s = &state->emphasis[ch];
-		crossover_s = &state->crossover[ch];
-
-		if (enable_emp)
-			emp_out = iir_df1_4th(emp_s, *buf_src);
-		else
-			emp_out = *buf_src;
+	struct drc_state *drc;
+	int band;
 
-		split_func(emp_out, crossover_out, crossover_s);
-		buf_sink_band = buf_sink;
-		for (band = 0; band < nband; band++) {
-			*buf_sink_band = crossover_out[band];
-			buf_sink_band += PLATFORM_MAX_CHANNELS;
+	for (band = 0; band < nband; band++) {
+		drc = &state->drc[band];
+		drc->pre_delay_write_index = (drc->pre_delay_write_index + frames) &
+					     DRC_MAX_PRE_DELAY_FRAMES_MASK;
+		drc->pre_delay_read_index = (drc->pre_delay_read_index + frames) &
+					    DRC_MAX_PRE_DELAY_FRAMES_MASK;
+
+		if (coef[band].enabled &&
+		    !(drc->pre_delay_write_index & DRC_DIVISION_FRAMES_MASK)) {
+			drc_update_detector_average(drc, &coef[band], nbyte, nch);
+			drc_update_envelope(drc, &coef[band]);
+			drc_compress_output(drc, &coef[band], nbyte, nch);
 		}
-
-		buf_src++;
-		buf_sink++;
 	}
 }
 
-#if CONFIG_FORMAT_S16LE
-static void multiband_drc_s16_process_drc(struct drc_state *state,
-					  const struct sof_drc_params *p,
-					  int32_t *buf_src,
-					  int32_t *buf_sink,
-					  int nch)
+static void multiband_drc_init_drc(struct multiband_drc_state *state,
+				   const struct sof_drc_params *coef,
+				   int nbyte, int nch, int nband)
 {
-	int16_t *pd_write;
-	int16_t *pd_read;
-	int ch;
-	int pd_write_index;
-	int pd_read_index;
-
-	if (p->enabled && !state->processed) {
-		drc_update_envelope(state, p);
-		drc_compress_output(state, p, 2, nch);
-		state->processed = 1;
-	}
-
-	pd_write_index = state->pre_delay_write_index;
-	pd_read_index = state->pre_delay_read_index;
-
-	for (ch = 0; ch < nch; ++ch) {
-		pd_write = (int16_t *)state->pre_delay_buffers[ch] + pd_write_index;
-		pd_read = (int16_t *)state->pre_delay_buffers[ch] + pd_read_index;
-		*pd_write = sat_int16(Q_SHIFT_RND(*buf_src, 31, 15));
-		*buf_sink = *pd_read << 16;
-
-		buf_src++;
-		buf_sink++;
-	}
-
-	pd_write_index = (pd_write_index + 1) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
-	pd_read_index = (pd_read_index + 1) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
-	state->pre_delay_write_index = pd_write_index;
-	state->pre_delay_read_index = pd_read_index;
-
-	/* Only perform delay frames by early return here if not enabled */
-	if (!p->enabled)
-		return;
+	struct drc_state *drc;
+	int band;
 
-	/* Process the input division (32 frames). */
-	if (!(pd_write_index & DRC_DIVISION_FRAMES_MASK)) {
-		drc_update_detector_average(state, p, 2, nch);
-		drc_update_envelope(state, p);
-		drc_compress_output(state, p, 2, nch);
+	for (band = 0; band < nband; band++) {
+		drc = &state->drc[band];
+		if (coef[band].enabled && !drc->processed) {
+			drc_update_envelope(drc, &coef[band]);
+			drc_compress_output(drc, &coef[band], nbyte, nch);
+			drc->processed = 1;
+		}
 	}
 }
-#endif /* CONFIG_FORMAT_S16LE */
 
-#if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-static void multiband_drc_s32_process_drc(struct drc_state *state,
-					  const struct sof_drc_params *p,
-					  int32_t *buf_src,
-					  int32_t *buf_sink,
-					  int nch)
+/* Returns the number of frames that can be processed as one block. A block
+ * ends at the next DRC division boundary where the band gains are updated,
+ * so the pre-delay buffer indices don't wrap within a block, the pre-delay
+ * buffer length is a multiple of the division length. Since the pre-delay is
+ * at least one division the samples written to the pre-delay buffers in a
+ * block are never read in the same block.
+ */
+static int multiband_drc_block_frames(const struct multiband_drc_state *state,
+				      const struct audio_stream *source, const void *x,
+				      const struct audio_stream *sink, const void *y,
+				      int frames)
 {
-	int32_t *pd_write;
-	int32_t *pd_read;
-	int ch;
-	int pd_write_index;
-	int pd_read_index;
-
-	if (p->enabled && !state->processed) {
-		drc_update_envelope(state, p);
-		drc_compress_output(state, p, 4, nch);
-		state->processed = 1;
-	}
+	int n = DRC_DIVISION_FRAMES -
+		(state->drc[0].pre_delay_write_index & DRC_DIVISION_FRAMES_MASK);
 
-	pd_write_index = state->pre_delay_write_index;
-	pd_read_index = state->pre_delay_read_index;
-
-	for (ch = 0; ch < nch; ++ch) {
-		pd_write = (int32_t *)state->pre_delay_buffers[ch] + pd_write_index;
-		pd_read = (int32_t *)state->pre_delay_buffers[ch] + pd_read_index;
-		*pd_write = *buf_src;
-		*buf_sink = *pd_read;
-
-		buf_src++;
-		buf_sink++;
-	}
-
-	pd_write_index = (pd_write_index + 1) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
-	pd_read_index = (pd_read_index + 1) & DRC_MAX_PRE_DELAY_FRAMES_MASK;
-	state->pre_delay_write_index = pd_write_index;
-	state->pre_delay_read_index = pd_read_index;
-
-	/* Only perform delay frames by early return here if not enabled */
-	if (!p->enabled)
-		return;
-
-	/* Process the input division (32 frames). */
-	if (!(pd_write_index & DRC_DIVISION_FRAMES_MASK)) {
-		drc_update_detector_average(state, p, 4, nch);
-		drc_update_envelope(state, p);
-		drc_compress_output(state, p, 4, nch);
-	}
+	n = MIN(n, frames);
+	n = MIN(n, audio_stream_frames_without_wrap(source, x));
+	return MIN(n, audio_stream_frames_without_wrap(sink, y));
 }
-#endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
 
-static void multiband_drc_process_deemp(struct multiband_drc_state *state,
-					int32_t *buf_src,
-					int32_t *buf_sink,
-					int enable_deemp,
-					int nch,
-					int nband)
+ /* This graph illustrates the processing of a 3-band Multiband DRC. The
+  * processing of a block of frames is done per channel in one pass, every
+  * sample is passed from source through the emphasis, crossover, the band DRC
+  * pre-delay buffers, the mixing and the deemphasis to sink without storing
+  * the intermediate signals. The DRC gain is applied in place to the pre-delay
+  * buffers at the division boundaries between the blocks.
+  *
+  *                                        :pd_write[band]  :pd_read[band]
+  *                                        :                :
+  *                                        o-[]-> DRC0 -[]--o
+  *                                        |                |
+  *                              3-WAY     |                |
+  *    source ---> EQ EMP --> CROSSOVER --o-[]-> DRC1 -[]-(+)--> EQ DEEMP ---> sink
+  *                                        |                |
+  *                                        |                |
+  *                                        o-[]-> DRC2 -[]--o
+  */
+#if CONFIG_FORMAT_S16LE
+static void multiband_drc_s16_block(struct multiband_drc_state *state,
+				    crossover_split split_func,
+				    const int16_t *x, int16_t *y,
+				    int enable_emp_deemp, int nch, int nband,
+				    int frames)
 {
+	struct iir_state_df1 *emp_s;
 	struct iir_state_df1 *deemp_s;
-	int32_t *buf_src_band;
-	int ch, band;
-	int32_t mix_out;
+	struct crossover_state *crossover_s;
+	int16_t *pd_write[SOF_MULTIBAND_DRC_MAX_BANDS];
+	int16_t *pd_read[SOF_MULTIBAND_DRC_MAX_BANDS];
+	int32_t band_out[SOF_MULTIBAND_DRC_MAX_BANDS];
+	int32_t sample;
+	int32_t delayed;
+	int band;
+	int ch;
+	int i;
+	int j;
 
 	for (ch = 0; ch < nch; ch++) {
+		emp_s = &state->emphasis[ch];
+		crossover_s = &state->crossover[ch];
 		deemp_s = &state->deemphasis[ch];
-
-		buf_src_band = buf_src;
-		mix_out = 0;
 		for (band = 0; band < nband; band++) {
-			mix_out = sat_int32((int64_t)mix_out + *buf_src_band);
-			buf_src_band += PLATFORM_MAX_CHANNELS;
+			pd_write[band] = (int16_t *)state->drc[band].pre_delay_buffers[ch] +
+					 state->drc[band].pre_delay_write_index;
+			pd_read[band] = (int16_t *)state->drc[band].pre_delay_buffers[ch] +
+					state->drc[band].pre_delay_read_index;
 		}
 
-		if (enable_deemp)
-			*buf_sink = iir_df1_4th(deemp_s, mix_out);
-		else
-			*buf_sink = mix_out;
+		for (i = 0, j = ch; i < frames; i++, j += nch) {
+			sample = (int32_t)x[j] << 16;
+			if (enable_emp_deemp)
+				sample = iir_df1_4th(emp_s, sample);
+
+			split_func(sample, band_out, crossover_s);
+			sample = 0;
+			for (band = 0; band < nband; band++) {
+				delayed = (int32_t)pd_read[band][i] << 16;
+				pd_write[band][i] = sat_int16(Q_SHIFT_RND(band_out[band], 31, 15));
+				sample = sat_int32((int64_t)sample + delayed);
+			}
+
+			if (enable_emp_deemp)
+				sample = iir_df1_4th(deemp_s, sample);
 
-		buf_src++;
-		buf_sink++;
+			y[j] = sat_int16(Q_SHIFT_RND(sample, 31, 15));
+		}
 	}
 }
 
- /* This graph illustrates the buffers declared in the following default functions, as the example
-  * of a 3-band Multiband DRC:
-  *
-  *            :buf_src[nch]                            :buf_drc_sink[nch*nband]
-  *            :                                        :
-  *            :                           o-[]-> DRC0 -[]--o
-  *            :                           | :          :   |
-  *            :                 3-WAY     | :          :   |
-  *    source -[]-> EQ EMP --> CROSSOVER --o-[]-> DRC1 -[]-(+)--> EQ DEEMP -[]-> sink
-  *                                        | :          :   |               :
-  *                                        | :          :   |               :
-  *                                        o-[]-> DRC2 -[]--o               :
-  *                                          :                              :
-  *                                          :buf_drc_src[nch*nband]        :buf_sink[nch]
-  */
-#if CONFIG_FORMAT_S16LE
 static void multiband_drc_s16_default(const struct processing_module *mod,
 				      const struct audio_stream *source,
 				      struct audio_stream *sink,
@@ -210,196 +160,130 @@ static void multiband_drc_s16_default(const struct processing_module *mod,
 {
 	struct multiband_drc_comp_data *cd = module_get_private_data(mod);
 	struct multiband_drc_state *state = &cd->state;
-	int32_t buf_src[PLATFORM_MAX_CHANNELS];
-	int32_t buf_sink[PLATFORM_MAX_CHANNELS];
-	int32_t buf_drc_src[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t buf_drc_sink[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t *band_buf_drc_src;
-	int32_t *band_buf_drc_sink;
+	const struct sof_drc_params *coef = cd->config->drc_coef;
 	int16_t *x = audio_stream_get_rptr(source);
 	int16_t *y = audio_stream_get_wptr(sink);
-	int band;
-	int nbuf;
-	int npcm;
-	int ch;
-	int i;
 	int nch = audio_stream_get_channels(source);
 	int nband = cd->config->num_bands;
 	int enable_emp_deemp = cd->config->enable_emp_deemp;
-	int samples = frames * nch;
-
-	while (samples) {
-		nbuf = audio_stream_samples_without_wrap_s16(source, x);
-		npcm = MIN(samples, nbuf);
-		nbuf = audio_stream_samples_without_wrap_s16(sink, y);
-		npcm = MIN(npcm, nbuf);
-		for (i = 0; i < npcm; i += nch) {
-			for (ch = 0; ch < nch; ch++) {
-				buf_src[ch] = *x << 16;
-				x++;
-			}
-
-			multiband_drc_process_emp_crossover(state, cd->crossover_split,
-							    buf_src, buf_drc_src,
-							    enable_emp_deemp, nch, nband);
-
-			band_buf_drc_src = buf_drc_src;
-			band_buf_drc_sink = buf_drc_sink;
-			for (band = 0; band < nband; ++band) {
-				multiband_drc_s16_process_drc(&state->drc[band],
-							      &cd->config->drc_coef[band],
-							      band_buf_drc_src, band_buf_drc_sink,
-							      nch);
-				band_buf_drc_src += PLATFORM_MAX_CHANNELS;
-				band_buf_drc_sink += PLATFORM_MAX_CHANNELS;
-			}
-
-			multiband_drc_process_deemp(state, buf_drc_sink, buf_sink,
-						    enable_emp_deemp, nch, nband);
-
-			for (ch = 0; ch < nch; ch++) {
-				*y = sat_int16(Q_SHIFT_RND(buf_sink[ch], 31, 15));
-				y++;
-			}
-		}
-		samples -= npcm;
-		x = audio_stream_wrap(source, x);
-		y = audio_stream_wrap(sink, y);
+	int remaining = frames;
+	int n;
+
+	multiband_drc_init_drc(state, coef, sizeof(int16_t), nch, nband);
+	while (remaining) {
+		n = multiband_drc_block_frames(state, source, x, sink, y, remaining);
+		multiband_drc_s16_block(state, cd->crossover_split, x, y,
+					enable_emp_deemp, nch, nband, n);
+		multiband_drc_update_drc(state, coef, sizeof(int16_t), nch, nband, n);
+		x = audio_stream_wrap(source, x + n * nch);
+		y = audio_stream_wrap(sink, y + n * nch);
+		remaining -= n;
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE */
 
-#if CONFIG_FORMAT_S24LE
-static void multiband_drc_s24_default(const struct processing_module *mod,
-				      const struct audio_stream *source,
-				      struct audio_stream *sink,
-				      uint32_t frames)
+#if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
+/* The s24 and s32 formats share the same Q1.31 pre-delay buffers, the shift
+ * argument converts the source samples to Q1.31.
+ */
+static inline void multiband_drc_s32_block(struct multiband_drc_state *state,
+					   crossover_split split_func,
+					   const int32_t *x, int32_t *y,
+					   int enable_emp_deemp, int nch, int nband,
+					   int frames, int shift)
 {
-	struct multiband_drc_comp_data *cd = module_get_private_data(mod);
-	struct multiband_drc_state *state = &cd->state;
-	int32_t buf_src[PLATFORM_MAX_CHANNELS];
-	int32_t buf_sink[PLATFORM_MAX_CHANNELS];
-	int32_t buf_drc_src[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t buf_drc_sink[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t *band_buf_drc_src;
-	int32_t *band_buf_drc_sink;
-	int32_t *x = audio_stream_get_rptr(source);
-	int32_t *y = audio_stream_get_wptr(sink);
+	struct iir_state_df1 *emp_s;
+	struct iir_state_df1 *deemp_s;
+	struct crossover_state *crossover_s;
+	int32_t *pd_write[SOF_MULTIBAND_DRC_MAX_BANDS];
+	int32_t *pd_read[SOF_MULTIBAND_DRC_MAX_BANDS];
+	int32_t band_out[SOF_MULTIBAND_DRC_MAX_BANDS];
+	int32_t sample;
 	int band;
-	int nbuf;
-	int npcm;
 	int ch;
 	int i;
-	int nch = audio_stream_get_channels(source);
-	int nband = cd->config->num_bands;
-	int enable_emp_deemp = cd->config->enable_emp_deemp;
-	int samples = frames * nch;
-
-	while (samples) {
-		nbuf = audio_stream_samples_without_wrap_s24(source, x);
-		npcm = MIN(samples, nbuf);
-		nbuf = audio_stream_samples_without_wrap_s24(sink, y);
-		npcm = MIN(npcm, nbuf);
-		for (i = 0; i < npcm; i += nch) {
-			for (ch = 0; ch < nch; ch++) {
-				buf_src[ch] = *x << 8;
-				x++;
-			}
+	int j;
 
-			multiband_drc_process_emp_crossover(state, cd->crossover_split,
-							    buf_src, buf_drc_src,
-							    enable_emp_deemp, nch, nband);
-
-			band_buf_drc_src = buf_drc_src;
-			band_buf_drc_sink = buf_drc_sink;
-			for (band = 0; band < nband; ++band) {
-				multiband_drc_s32_process_drc(&state->drc[band],
-							      &cd->config->drc_coef[band],
-							      band_buf_drc_src, band_buf_drc_sink,
-							      nch);
-				band_buf_drc_src += PLATFORM_MAX_CHANNELS;
-				band_buf_drc_sink += PLATFORM_MAX_CHANNELS;
-			}
+	for (ch = 0; ch < nch; ch++) {
+		emp_s = &state->emphasis[ch];
+		crossover_s = &state->crossover[ch];
+		deemp_s = &state->deemphasis[ch];
+		for (band = 0; band < nband; band++) {
+			pd_write[band] = (int32_t *)state->drc[band].pre_delay_buffers[ch] +
+					 state->drc[band].pre_delay_write_index;
+			pd_read[band] = (int32_t *)state->drc[band].pre_delay_buffers[ch] +
+					state->drc[band].pre_delay_read_index;
+		}
 
-			multiband_drc_process_deemp(state, buf_drc_sink, buf_sink,
-						    enable_emp_deemp, nch, nband);
+		for (i = 0, j = ch; i < frames; i++, j += nch) {
+			sample = x[j] << shift;
+			if (enable_emp_deemp)
+				sample = iir_df1_4th(emp_s, sample);
 
-			for (ch = 0; ch < nch; ch++) {
-				*y = sat_int24(Q_SHIFT_RND(buf_sink[ch], 31, 23));
-				y++;
+			split_func(sample, band_out, crossover_s);
+			sample = 0;
+			for (band = 0; band < nband; band++) {
+				pd_write[band][i] = band_out[band];
+				sample = sat_int32((int64_t)sample + pd_read[band][i]);
 			}
+
+			if (enable_emp_deemp)
+				sample = iir_df1_4th(deemp_s, sample);
+
+			if (shift)
+				y[j] = sat_int24(Q_SHIFT_RND(sample, 31, 23));
+			else
+				y[j] = sample;
 		}
-		samples -= npcm;
-		x = audio_stream_wrap(source, x);
-		y = audio_stream_wrap(sink, y);
 	}
 }
-#endif /* CONFIG_FORMAT_S24LE */
 
-#if CONFIG_FORMAT_S32LE
-static void multiband_drc_s32_default(const struct processing_module *mod,
+static void multiband_drc_s32_process(const struct processing_module *mod,
 				      const struct audio_stream *source,
 				      struct audio_stream *sink,
-				      uint32_t frames)
+				      uint32_t frames, int shift)
 {
 	struct multiband_drc_comp_data *cd = module_get_private_data(mod);
 	struct multiband_drc_state *state = &cd->state;
-	int32_t buf_src[PLATFORM_MAX_CHANNELS];
-	int32_t buf_sink[PLATFORM_MAX_CHANNELS];
-	int32_t buf_drc_src[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t buf_drc_sink[PLATFORM_MAX_CHANNELS * SOF_MULTIBAND_DRC_MAX_BANDS];
-	int32_t *band_buf_drc_src;
-	int32_t *band_buf_drc_sink;
+	const struct sof_drc_params *coef = cd->config->drc_coef;
 	int32_t *x = audio_stream_get_rptr(source);
 	int32_t *y = audio_stream_get_wptr(sink);
-	int band;
-	int nbuf;
-	int npcm;
-	int ch;
-	int i;
 	int nch = audio_stream_get_channels(source);
 	int nband = cd->config->num_bands;
 	int enable_emp_deemp = cd->config->enable_emp_deemp;
-	int samples = frames * nch;
-
-	while (samples) {
-		nbuf = audio_stream_samples_without_wrap_s32(source, x);
-		npcm = MIN(samples, nbuf);
-		nbuf = audio_stream_samples_without_wrap_s32(sink, y);
-		npcm = MIN(npcm, nbuf);
-		for (i = 0; i < npcm; i += nch) {
-			for (ch = 0; ch < nch; ch++) {
-				buf_src[ch] = *x;
-				x++;
-			}
-
-			multiband_drc_process_emp_crossover(state, cd->crossover_split,
-							    buf_src, buf_drc_src,
-							    enable_emp_deemp, nch, nband);
-
-			band_buf_drc_src = buf_drc_src;
-			band_buf_drc_sink = buf_drc_sink;
-			for (band = 0; band < nband; ++band) {
-				multiband_drc_s32_process_drc(&state->drc[band],
-							      &cd->config->drc_coef[band],
-							      band_buf_drc_src, band_buf_drc_sink,
-							      nch);
-				band_buf_drc_src += PLATFORM_MAX_CHANNELS;
-				band_buf_drc_sink += PLATFORM_MAX_CHANNELS;
-			}
+	int remaining = frames;
+	int n;
+
+	multiband_drc_init_drc(state, coef, sizeof(int32_t), nch, nband);
+	while (remaining) {
+		n = multiband_drc_block_frames(state, source, x, sink, y, remaining);
+		multiband_drc_s32_block(state, cd->crossover_split, x, y,
+					enable_emp_deemp, nch, nband, n, shift);
+		multiband_drc_update_drc(state, coef, sizeof(int32_t), nch, nband, n);
+		x = audio_stream_wrap(source, x + n * nch);
+		y = audio_stream_wrap(sink, y + n * nch);
+		remaining -= n;
+	}
+}
+#endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
 
-			multiband_drc_process_deemp(state, buf_drc_sink, buf_sink,
-						    enable_emp_deemp, nch, nband);
+#if CONFIG_FORMAT_S24LE
+static void multiband_drc_s24_default(const struct processing_module *mod,
+				      const struct audio_stream *source,
+				      struct audio_stream *sink,
+				      uint32_t frames)
+{
+	multiband_drc_s32_process(mod, source, sink, frames, 8);
+}
+#endif /* CONFIG_FORMAT_S24LE */
 
-			for (ch = 0; ch < nch; ch++) {
-				*y = buf_sink[ch];
-				y++;
-			}
-		}
-		samples -= npcm;
-		x = audio_stream_wrap(source, x);
-		y = audio_stream_wrap(sink, y);
-	}
+#if CONFIG_FORMAT_S32LE
+static void multiband_drc_s32_default(const struct processing_module *mod,
+				      const struct audio_stream *source,
+				      struct audio_stream *sink,
+				      uint32_t frames)
+{
+	multiband_drc_s32_process(mod, source, sink, frames, 0);
 }
 #endif /* CONFIG_FORMAT_S32LE */
 
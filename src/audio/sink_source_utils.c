@@ -3,10 +3,12 @@
 // Copyright(c) 2023 Intel Corporation. All rights reserved.
 //
 
+#include <sof/audio/format.h>
 #include <sof/audio/sink_source_utils.h>
 #include <sof/audio/sink_api.h>
 #include <sof/audio/source_api.h>
 #include <sof/common.h>
+#include <ipc/stream.h>
 #include <rtos/panic.h>
 #include <rtos/string.h>
 #include <rtos/symbol.h>
@@ -133,3 +135,274 @@ int source_drop_data(struct sof_source *source, size_t size)
 	return 0;
 }
 EXPORT_SYMBOL(source_drop_data);
+
+/*
+ * Planar conversion kernels. A kernel converts one channel of a contiguous
+ * run of interleaved frames, the stride is the number of interleaved
+ * channels. The loops have no wrap checks or calls, which lets the compiler
+ * vectorize the scaling and saturation.
+ */
+typedef void (*planar_in_kernel)(const void *src, size_t stride, void *dst, size_t frames);
+typedef void (*planar_out_kernel)(const void *src, void *dst, size_t stride, size_t frames);
+
+#define PLANAR_IN_KERNEL(name, in_type, out_type, convert)				\
+static void name(const void *src, size_t stride, void *dst, size_t frames)		\
+{											\
+	const in_type *x = src;								\
+	out_type *y = dst;								\
+	size_t i;									\
+											\
+	for (i = 0; i < frames; i++)							\
+		y[i] = convert(x[i * stride]);						\
+}
+
+#define PLANAR_OUT_KERNEL(name, in_type, out_type, convert)				\
+static void name(const void *src, void *dst, size_t stride, size_t frames)		\
+{											\
+	const in_type *x = src;								\
+	out_type *y = dst;								\
+	size_t i;									\
+											\
+	for (i = 0; i < frames; i++)							\
+		y[i * stride] = convert(x[i]);						\
+}
+
+/* the float range is [-1.0, 1.0), the integer cast truncates */
+#define S16_TO_FLOAT(x)		((x) * (1.0f / 32768.0f))
+#define S24_TO_FLOAT(x)		(((int32_t)((uint32_t)(x) << 8) >> 8) * (1.0f / 8388608.0f))
+#define S32_TO_FLOAT(x)		((x) * (1.0f / 2147483648.0f))
+#define FLOAT_TO_INT(x, scale, max) \
+	((x) * (scale) >= (max) ? (max) : (x) * (scale) <= -(scale) ? -(scale) : (x) * (scale))
+#define FLOAT_TO_S16(x)		((int16_t)FLOAT_TO_INT(x, 32768.0f, 32767.0f))
+#define FLOAT_TO_S24(x)		((int32_t)FLOAT_TO_INT(x, 8388608.0f, 8388607.0f))
+/* 2^31 - 1 isn't a float, the largest float below 2^31 is 2^31 - 128 */
+#define FLOAT_TO_S32(x)		((x) * 2147483648.0f >= 2147483648.0f ? INT32_MAX : \
+				 (int32_t)FLOAT_TO_INT(x, 2147483648.0f, 2147483520.0f))
+
+#define S16_TO_Q31(x)		((int32_t)(x) << 16)
+#define S24_TO_Q31(x)		((int32_t)((uint32_t)(x) << 8))
+#define Q31_TO_S16(x)		sat_int16(Q_SHIFT_RND(x, 31, 15))
+#define Q31_TO_S24(x)		sat_int24(Q_SHIFT_RND(x, 31, 23))
+#define COPY(x)			(x)
+
+PLANAR_IN_KERNEL(s16_to_planar_float, int16_t, float, S16_TO_FLOAT)
+PLANAR_IN_KERNEL(s24_to_planar_float, int32_t, float, S24_TO_FLOAT)
+PLANAR_IN_KERNEL(s32_to_planar_float, int32_t, float, S32_TO_FLOAT)
+PLANAR_OUT_KERNEL(planar_float_to_s16, float, int16_t, FLOAT_TO_S16)
+PLANAR_OUT_KERNEL(planar_float_to_s24, float, int32_t, FLOAT_TO_S24)
+PLANAR_OUT_KERNEL(planar_float_to_s32, float, int32_t, FLOAT_TO_S32)
+
+PLANAR_IN_KERNEL(s16_to_planar_q31, int16_t, int32_t, S16_TO_Q31)
+PLANAR_IN_KERNEL(s24_to_planar_q31, int32_t, int32_t, S24_TO_Q31)
+PLANAR_IN_KERNEL(s32_to_planar_q31, int32_t, int32_t, COPY)
+PLANAR_OUT_KERNEL(planar_q31_to_s16, int32_t, int16_t, Q31_TO_S16)
+PLANAR_OUT_KERNEL(planar_q31_to_s24, int32_t, int32_t, Q31_TO_S24)
+PLANAR_OUT_KERNEL(planar_q31_to_s32, int32_t, int32_t, COPY)
+
+static void planar_silence(void *dst, size_t sample_bytes, size_t stride, size_t frames)
+{
+	uint8_t *y = dst;
+	size_t i;
+
+	for (i = 0; i < frames; i++)
+		memset(y + i * stride * sample_bytes, 0, sample_bytes);
+}
+
+/* planar samples are 32 bit, float or Q1.31 */
+static int source_to_planar(struct sof_source *source, void * const *dst, size_t channels,
+			    size_t frames, planar_in_kernel kernel)
+{
+	size_t frame_bytes = source_get_frame_bytes(source);
+	size_t stride = source_get_channels(source);
+	size_t sample_bytes = frame_bytes / stride;
+	size_t size = frames * frame_bytes;
+	uint8_t const *src_ptr;
+	uint8_t const *src_begin;
+	uint8_t const *src_end;
+	size_t src_size;
+	size_t done = 0;
+	size_t n, c;
+	int ret;
+
+	if (!kernel)
+		return -EINVAL;
+	if (!size)
+		return 0;
+	if (size > source_get_data_available(source))
+		return -EFBIG;
+
+	ret = source_get_data(source, size, (void const **)&src_ptr,
+			      (void const **)&src_begin, &src_size);
+	if (ret)
+		return ret;
+
+	src_end = src_begin + src_size;
+	channels = MIN(channels, stride);
+	while (done < frames) {
+		/* the buffer size must be a multiple of the frame size */
+		n = MIN(frames - done, (size_t)(src_end - src_ptr) / frame_bytes);
+		if (!n) {
+			source_release_data(source, 0);
+			return -EINVAL;
+		}
+
+		for (c = 0; c < channels; c++)
+			kernel(src_ptr + c * sample_bytes, stride,
+			       (uint32_t *)dst[c] + done, n);
+
+		done += n;
+		src_ptr += n * frame_bytes;
+		if (src_ptr >= src_end)
+			src_ptr = src_begin;
+	}
+
+	source_release_data(source, size);
+	return 0;
+}
+
+static int sink_from_planar(struct sof_sink *sink, void * const *src, size_t channels,
+			    size_t frames, planar_out_kernel kernel)
+{
+	size_t frame_bytes = sink_get_frame_bytes(sink);
+	size_t stride = sink_get_channels(sink);
+	size_t sample_bytes = frame_bytes / stride;
+	size_t size = frames * frame_bytes;
+	uint8_t *dst_ptr;
+	uint8_t *dst_begin;
+	uint8_t *dst_end;
+	size_t dst_size;
+	size_t done = 0;
+	size_t n, c;
+	int ret;
+
+	if (!kernel)
+		return -EINVAL;
+	if (!size)
+		return 0;
+	if (size > sink_get_free_size(sink))
+		return -ENOSPC;
+
+	ret = sink_get_buffer(sink, size, (void **)&dst_ptr, (void **)&dst_begin, &dst_size);
+	if (ret)
+		return ret;
+
+	dst_end = dst_begin + dst_size;
+	channels = MIN(channels, stride);
+	while (done < frames) {
+		n = MIN(frames - done, (size_t)(dst_end - dst_ptr) / frame_bytes);
+		if (!n) {
+			sink_commit_buffer(sink, 0);
+			return -EINVAL;
+		}
+
+		for (c = 0; c < channels; c++)
+			kernel((const uint32_t *)src[c] + done, dst_ptr + c * sample_bytes,
+			       stride, n);
+		for (; c < stride; c++)
+			planar_silence(dst_ptr + c * sample_bytes, sample_bytes, stride, n);
+
+		done += n;
+		dst_ptr += n * frame_bytes;
+		if (dst_ptr >= dst_end)
+			dst_ptr = dst_begin;
+	}
+
+	sink_commit_buffer(sink, size);
+	return 0;
+}
+
+int source_to_planar_float(struct sof_source *source, float * const *dst,
+			   size_t channels, size_t frames)
+{
+	planar_in_kernel kernel;
+
+	switch (source_get_frm_fmt(source)) {
+	case SOF_IPC_FRAME_S16_LE:
+		kernel = s16_to_planar_float;
+		break;
+	case SOF_IPC_FRAME_S24_4LE:
+		kernel = s24_to_planar_float;
+		break;
+	case SOF_IPC_FRAME_S32_LE:
+		kernel = s32_to_planar_float;
+		break;
+	default:
+		kernel = NULL;
+		break;
+	}
+
+	return source_to_planar(source, (void * const *)dst, channels, frames, kernel);
+}
+EXPORT_SYMBOL(source_to_planar_float);
+
+int sink_from_planar_float(struct sof_sink *sink, float * const *src,
+			   size_t channels, size_t frames)
+{
+	planar_out_kernel kernel;
+
+	switch (sink_get_frm_fmt(sink)) {
+	case SOF_IPC_FRAME_S16_LE:
+		kernel = planar_float_to_s16;
+		break;
+	case SOF_IPC_FRAME_S24_4LE:
+		kernel = planar_float_to_s24;
+		break;
+	case SOF_IPC_FRAME_S32_LE:
+		kernel = planar_float_to_s32;
+		break;
+	default:
+		kernel = NULL;
+		break;
+	}
+
+	return sink_from_planar(sink, (void * const *)src, channels, frames, kernel);
+}
+EXPORT_SYMBOL(sink_from_planar_float);
+
+int source_to_planar_q31(struct sof_source *source, int32_t * const *dst,
+			 size_t channels, size_t frames)
+{
+	planar_in_kernel kernel;
+
+	switch (source_get_frm_fmt(source)) {
+	case SOF_IPC_FRAME_S16_LE:
+		kernel = s16_to_planar_q31;
+		break;
+	case SOF_IPC_FRAME_S24_4LE:
+		kernel = s24_to_planar_q31;
+		break;
+	case SOF_IPC_FRAME_S32_LE:
+		kernel = s32_to_planar_q31;
+		break;
+	default:
+		kernel = NULL;
+		break;
+	}
+
+	return source_to_planar(source, (void * const *)dst, channels, frames, kernel);
+}
+EXPORT_SYMBOL(source_to_planar_q31);
+
+int sink_from_planar_q31(struct sof_sink *sink, int32_t * const *src,
+			 size_t channels, size_t frames)
+{
+	planar_out_kernel kernel;
+
+	switch (sink_get_frm_fmt(sink)) {
+	case SOF_IPC_FRAME_S16_LE:
+		kernel = planar_q31_to_s16;
+		break;
+	case SOF_IPC_FRAME_S24_4LE:
+		kernel = planar_q31_to_s24;
+		break;
+	case SOF_IPC_FRAME_S32_LE:
+		kernel = planar_q31_to_s32;
+		break;
+	default:
+		kernel = NULL;
+		break;
+	}
+
+	return sink_from_planar(sink, (void * const *)src, channels, frames, kernel);
+}
+EXPORT_SYMBOL(sink_from_planar_q31);
@@ -0,0 +1,647 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#ifndef __SOF_AUDIO_COEFFICIENTS_SRC_SRC_IPC4_INT32_KAISER_H__
+#define __SOF_AUDIO_COEFFICIENTS_SRC_SRC_IPC4_INT32_KAISER_H__
+
+/* SRC conversions, stages without a Kaiser design keep the table */
+#include <stdint.h>
+
+static const struct src_kaiser src_kaiser_int32_1_2_2268_5000 = { 1560699567, 803140094, 1073741824 };
+static const struct src_stage src_int32_1_2_2268_5000 = {
+	1, 0, 1, 36, 36, 2, 1, 0, 1,
+	NULL, &src_kaiser_int32_1_2_2268_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_2_2500_5000 = { 1610612736, 803140097, 1073741824 };
+static const struct src_stage src_int32_1_2_2500_5000 = {
+	1, 0, 1, 40, 40, 2, 1, 0, 1,
+	NULL, &src_kaiser_int32_1_2_2500_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_2_2721_5000 = { 1658091116, 803140098, 1073741825 };
+static const struct src_stage src_int32_1_2_2721_5000 = {
+	1, 0, 1, 44, 44, 2, 1, 0, 1,
+	NULL, &src_kaiser_int32_1_2_2721_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_2_3401_5000 = { 1804178439, 848791185, 1073741824 };
+static const struct src_stage src_int32_1_2_3401_5000 = {
+	1, 0, 1, 60, 60, 2, 1, 0, 1,
+	NULL, &src_kaiser_int32_1_2_3401_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_2_3887_5000 = { 1908526527, 803140096, 1073741824 };
+static const struct src_stage src_int32_1_2_3887_5000 = {
+	1, 0, 1, 84, 84, 2, 1, 0, 1,
+	NULL, &src_kaiser_int32_1_2_3887_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_2_4535_5000 = { 2047657311, 803140093, 1073741824 };
+static const struct src_stage src_int32_1_2_4535_5000 = {
+	1, 0, 1, 192, 192, 2, 1, 0, 1,
+	NULL, &src_kaiser_int32_1_2_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_3_2268_5000 = { 1040466378, 803140094, 1073741824 };
+static const struct src_stage src_int32_1_3_2268_5000 = {
+	1, 0, 1, 52, 52, 3, 1, 0, 2,
+	NULL, &src_kaiser_int32_1_3_2268_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_3_4535_5000 = { 1365104874, 803140101, 1073741826 };
+static const struct src_stage src_int32_1_3_4535_5000 = {
+	1, 0, 1, 260, 260, 3, 1, 0, 1,
+	NULL, &src_kaiser_int32_1_3_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_4_1512_5000 = { 699190160, 803140092, 1073741824 };
+static const struct src_stage src_int32_1_4_1512_5000 = {
+	1, 0, 1, 52, 52, 4, 1, 0, 2,
+	NULL, &src_kaiser_int32_1_4_1512_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_4_2268_5000 = { 780349784, 803140093, 1073741824 };
+static const struct src_stage src_int32_1_4_2268_5000 = {
+	1, 0, 1, 60, 60, 4, 1, 0, 2,
+	NULL, &src_kaiser_int32_1_4_2268_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_4_4535_5000 = { 1023828655, 803140091, 1073741825 };
+static const struct src_stage src_int32_1_4_4535_5000 = {
+	1, 0, 1, 332, 332, 4, 1, 0, 2,
+	NULL, &src_kaiser_int32_1_4_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_1_6_1134_5000 = { 439073565, 803140093, 1073741824 };
+static const struct src_stage src_int32_1_6_1134_5000 = {
+	1, 0, 1, 68, 68, 6, 1, 0, 3,
+	NULL, &src_kaiser_int32_1_6_1134_5000};
+
+static const struct src_kaiser src_kaiser_int32_2_1_2268_5000 = { 1560699567, 1032504411, 1073741824 };
+static const struct src_stage src_int32_2_1_2268_5000 = {
+	0, 1, 2, 24, 48, 1, 2, 0, 0,
+	NULL, &src_kaiser_int32_2_1_2268_5000};
+
+static const struct src_kaiser src_kaiser_int32_2_1_2500_5000 = { 1610612736, 803140097, 1073741824 };
+static const struct src_stage src_int32_2_1_2500_5000 = {
+	0, 1, 2, 20, 40, 1, 2, 0, 0,
+	NULL, &src_kaiser_int32_2_1_2500_5000};
+
+static const struct src_kaiser src_kaiser_int32_2_1_2721_5000 = { 1658091116, 803140095, 1073741824 };
+static const struct src_stage src_int32_2_1_2721_5000 = {
+	0, 1, 2, 24, 48, 1, 2, 0, 0,
+	NULL, &src_kaiser_int32_2_1_2721_5000};
+
+static const struct src_kaiser src_kaiser_int32_2_1_3401_5000 = { 1804178439, 1033622482, 1073741826 };
+static const struct src_stage src_int32_2_1_3401_5000 = {
+	0, 1, 2, 36, 72, 1, 2, 0, 0,
+	NULL, &src_kaiser_int32_2_1_3401_5000};
+
+static const struct src_kaiser src_kaiser_int32_2_1_4535_5000 = { 2047657311, 1052981744, 1073741824 };
+static const struct src_stage src_int32_2_1_4535_5000 = {
+	0, 1, 2, 120, 240, 1, 2, 0, 0,
+	NULL, &src_kaiser_int32_2_1_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_2_3_4535_5000 = { 1365104874, 803140084, 1073741822 };
+static const struct src_stage src_int32_2_3_4535_5000 = {
+	1, 1, 2, 132, 264, 3, 2, 0, 0,
+	NULL, &src_kaiser_int32_2_3_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_3_1_2268_5000 = { 1040466378, 1052981751, 1073741824 };
+static const struct src_stage src_int32_3_1_2268_5000 = {
+	0, 1, 3, 24, 72, 1, 3, 0, 0,
+	NULL, &src_kaiser_int32_3_1_2268_5000};
+
+static const struct src_kaiser src_kaiser_int32_3_1_4535_5000 = { 1365104874, 1076644073, 1073741824 };
+static const struct src_stage src_int32_3_1_4535_5000 = {
+	0, 1, 3, 112, 336, 1, 3, 0, 0,
+	NULL, &src_kaiser_int32_3_1_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_3_2_4535_5000 = { 1365104874, 1007579178, 1073741823 };
+static const struct src_stage src_int32_3_2_4535_5000 = {
+	1, 2, 3, 108, 324, 2, 3, 0, 0,
+	NULL, &src_kaiser_int32_3_2_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_3_4_4535_5000 = { 1023828655, 848772634, 1073741824 };
+static const struct src_stage src_int32_3_4_4535_5000 = {
+	1, 1, 3, 120, 360, 4, 3, 0, 0,
+	NULL, &src_kaiser_int32_3_4_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_4_1_1134_5000 = { 658610348, 1005629528, 1073741824 };
+static const struct src_stage src_int32_4_1_1134_5000 = {
+	0, 1, 4, 16, 64, 1, 4, 0, 0,
+	NULL, &src_kaiser_int32_4_1_1134_5000};
+
+static const struct src_kaiser src_kaiser_int32_4_1_1512_5000 = { 699190160, 1076644070, 1073741825 };
+static const struct src_stage src_int32_4_1_1512_5000 = {
+	0, 1, 4, 16, 64, 1, 4, 0, 0,
+	NULL, &src_kaiser_int32_4_1_1512_5000};
+
+static const struct src_kaiser src_kaiser_int32_4_1_2268_5000 = { 780349784, 1069940690, 1073741825 };
+static const struct src_stage src_int32_4_1_2268_5000 = {
+	0, 1, 4, 20, 80, 1, 4, 0, 0,
+	NULL, &src_kaiser_int32_4_1_2268_5000};
+
+static const struct src_kaiser src_kaiser_int32_4_1_4535_5000 = { 1023828655, 1005629534, 1073741825 };
+static const struct src_stage src_int32_4_1_4535_5000 = {
+	0, 1, 4, 104, 416, 1, 4, 0, 0,
+	NULL, &src_kaiser_int32_4_1_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_4_3_4535_5000 = { 1023828655, 1025196461, 1073741823 };
+static const struct src_stage src_int32_4_3_4535_5000 = {
+	2, 3, 4, 108, 432, 3, 4, 0, 0,
+	NULL, &src_kaiser_int32_4_3_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_4_21_1080_5000 = { 124345377, 803140094, 1073741824 };
+static const struct src_stage src_int32_4_21_1080_5000 = {
+	5, 1, 4, 56, 224, 21, 4, 0, 3,
+	NULL, &src_kaiser_int32_4_21_1080_5000};
+
+static const struct src_kaiser src_kaiser_int32_4_21_3239_5000 = { 168513880, 889099972, 1073741824 };
+static const struct src_stage src_int32_4_21_3239_5000 = {
+	5, 1, 4, 128, 512, 21, 4, 0, 2,
+	NULL, &src_kaiser_int32_4_21_3239_5000};
+
+static const struct src_kaiser src_kaiser_int32_5_7_4535_5000 = { 585044946, 938016446, 1073741822 };
+static const struct src_stage src_int32_5_7_4535_5000 = {
+	4, 3, 5, 136, 680, 7, 5, 0, 0,
+	NULL, &src_kaiser_int32_5_7_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_5_21_1728_5000 = { 137595928, 916290266, 1073741824 };
+static const struct src_stage src_int32_5_21_1728_5000 = {
+	4, 1, 5, 64, 320, 21, 5, 0, 2,
+	NULL, &src_kaiser_int32_5_21_1728_5000};
+
+static const struct src_kaiser src_kaiser_int32_5_21_4535_5000 = { 195014982, 803140093, 1073741823 };
+static const struct src_stage src_int32_5_21_4535_5000 = {
+	4, 1, 5, 348, 1740, 21, 5, 0, 2,
+	NULL, &src_kaiser_int32_5_21_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_6_1_1134_5000 = { 439073565, 1005612466, 1073741824 };
+static const struct src_stage src_int32_6_1_1134_5000 = {
+	0, 1, 6, 16, 96, 1, 6, 0, 0,
+	NULL, &src_kaiser_int32_6_1_1134_5000};
+
+static const struct src_kaiser src_kaiser_int32_7_3_4535_5000 = { 585044946, 1013248927, 1073741824 };
+static const struct src_stage src_int32_7_3_4535_5000 = {
+	2, 5, 7, 104, 728, 3, 7, 0, 0,
+	NULL, &src_kaiser_int32_7_3_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_7_5_4535_5000 = { 585044946, 1121787825, 1073741823 };
+static const struct src_stage src_int32_7_5_4535_5000 = {
+	2, 3, 7, 116, 812, 5, 7, 0, 0,
+	NULL, &src_kaiser_int32_7_5_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_7_8_1361_5000 = { 341479117, 1069596285, 1073741824 };
+static const struct src_stage src_int32_7_8_1361_5000 = {
+	1, 1, 7, 20, 140, 8, 7, 0, 0,
+	NULL, &src_kaiser_int32_7_8_1361_5000};
+
+static const struct src_kaiser src_kaiser_int32_7_8_2468_5000 = { 400940964, 1028651182, 1073741824 };
+static const struct src_stage src_int32_7_8_2468_5000 = {
+	1, 1, 7, 28, 196, 8, 7, 0, 0,
+	NULL, &src_kaiser_int32_7_8_2468_5000};
+
+static const struct src_kaiser src_kaiser_int32_7_8_2721_5000 = { 414522779, 1080040737, 1073741824 };
+static const struct src_stage src_int32_7_8_2721_5000 = {
+	1, 1, 7, 32, 224, 8, 7, 0, 0,
+	NULL, &src_kaiser_int32_7_8_2721_5000};
+
+static const struct src_kaiser src_kaiser_int32_7_8_4535_5000 = { 511914328, 1016435815, 1073741823 };
+static const struct src_stage src_int32_7_8_4535_5000 = {
+	1, 1, 7, 120, 840, 8, 7, 0, 0,
+	NULL, &src_kaiser_int32_7_8_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_8_7_1361_5000 = { 341479118, 1082395848, 1073741824 };
+static const struct src_stage src_int32_8_7_1361_5000 = {
+	6, 7, 8, 20, 160, 7, 8, 0, 0,
+	NULL, &src_kaiser_int32_8_7_1361_5000};
+
+static const struct src_kaiser src_kaiser_int32_8_7_2468_5000 = { 400940964, 1063137514, 1073741824 };
+static const struct src_stage src_int32_8_7_2468_5000 = {
+	6, 7, 8, 24, 192, 7, 8, 0, 0,
+	NULL, &src_kaiser_int32_8_7_2468_5000};
+
+static const struct src_kaiser src_kaiser_int32_8_7_2721_5000 = { 414522779, 1103360208, 1073741824 };
+static const struct src_stage src_int32_8_7_2721_5000 = {
+	6, 7, 8, 24, 192, 7, 8, 0, 0,
+	NULL, &src_kaiser_int32_8_7_2721_5000};
+
+static const struct src_kaiser src_kaiser_int32_8_7_4082_5000 = { 487566440, 1004087648, 1073741825 };
+static const struct src_stage src_int32_8_7_4082_5000 = {
+	6, 7, 8, 60, 480, 7, 8, 0, 0,
+	NULL, &src_kaiser_int32_8_7_4082_5000};
+
+static const struct src_kaiser src_kaiser_int32_8_7_4535_5000 = { 511914328, 1078852895, 1073741823 };
+static const struct src_stage src_int32_8_7_4535_5000 = {
+	6, 7, 8, 112, 896, 7, 8, 0, 0,
+	NULL, &src_kaiser_int32_8_7_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_8_21_2160_5000 = { 146429629, 914214388, 1073741824 };
+static const struct src_stage src_int32_8_21_2160_5000 = {
+	13, 5, 8, 48, 384, 21, 8, 0, 1,
+	NULL, &src_kaiser_int32_8_21_2160_5000};
+
+static const struct src_kaiser src_kaiser_int32_8_21_3239_5000 = { 168513880, 938016452, 1073741824 };
+static const struct src_stage src_int32_8_21_3239_5000 = {
+	13, 5, 8, 68, 544, 21, 8, 0, 1,
+	NULL, &src_kaiser_int32_8_21_3239_5000};
+
+static const struct src_kaiser src_kaiser_int32_8_21_4535_5000 = { 195014982, 916290268, 1073741824 };
+static const struct src_stage src_int32_8_21_4535_5000 = {
+	13, 5, 8, 248, 1984, 21, 8, 0, 1,
+	NULL, &src_kaiser_int32_8_21_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_10_9_4535_5000 = { 409531462, 1044618478, 1073741824 };
+static const struct src_stage src_int32_10_9_4535_5000 = {
+	8, 9, 10, 108, 1080, 9, 10, 0, 0,
+	NULL, &src_kaiser_int32_10_9_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_10_21_2500_5000 = { 153391689, 1031830139, 1073741824 };
+static const struct src_stage src_int32_10_21_2500_5000 = {
+	2, 1, 10, 48, 480, 21, 10, 0, 1,
+	NULL, &src_kaiser_int32_10_21_2500_5000};
+
+static const struct src_kaiser src_kaiser_int32_10_21_3455_5000 = { 172930731, 932264825, 1073741825 };
+static const struct src_stage src_int32_10_21_3455_5000 = {
+	2, 1, 10, 64, 640, 21, 10, 0, 1,
+	NULL, &src_kaiser_int32_10_21_3455_5000};
+
+static const struct src_kaiser src_kaiser_int32_10_21_4535_5000 = { 195014982, 1063137515, 1073741824 };
+static const struct src_stage src_int32_10_21_4535_5000 = {
+	2, 1, 10, 232, 2320, 21, 10, 0, 1,
+	NULL, &src_kaiser_int32_10_21_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_16_7_4082_5000 = { 243783220, 1035402983, 1073741824 };
+static const struct src_stage src_int32_16_7_4082_5000 = {
+	3, 7, 16, 56, 896, 7, 16, 0, 0,
+	NULL, &src_kaiser_int32_16_7_4082_5000};
+
+static const struct src_kaiser src_kaiser_int32_16_21_4319_5000 = { 190598132, 959193523, 1073741825 };
+static const struct src_stage src_int32_16_21_4319_5000 = {
+	17, 13, 16, 92, 1472, 21, 16, 0, 0,
+	NULL, &src_kaiser_int32_16_21_4319_5000};
+
+static const struct src_kaiser src_kaiser_int32_16_21_4535_5000 = { 195014982, 932264818, 1073741823 };
+static const struct src_stage src_int32_16_21_4535_5000 = {
+	17, 13, 16, 128, 2048, 21, 16, 0, 0,
+	NULL, &src_kaiser_int32_16_21_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_20_7_2976_5000 = { 171287386, 1134150208, 1073741824 };
+static const struct src_stage src_int32_20_7_2976_5000 = {
+	1, 3, 20, 28, 560, 7, 20, 0, 0,
+	NULL, &src_kaiser_int32_20_7_2976_5000};
+
+static const struct src_kaiser src_kaiser_int32_20_21_1250_5000 = { 127826408, 1082395847, 1073741824 };
+static const struct src_stage src_int32_20_21_1250_5000 = {
+	1, 1, 20, 16, 320, 21, 20, 0, 0,
+	NULL, &src_kaiser_int32_20_21_1250_5000};
+
+static const struct src_kaiser src_kaiser_int32_20_21_2500_5000 = { 153391689, 1103360209, 1073741824 };
+static const struct src_stage src_int32_20_21_2500_5000 = {
+	1, 1, 20, 28, 560, 21, 20, 0, 0,
+	NULL, &src_kaiser_int32_20_21_2500_5000};
+
+static const struct src_kaiser src_kaiser_int32_20_21_3125_5000 = { 166174330, 1088483990, 1073741824 };
+static const struct src_stage src_int32_20_21_3125_5000 = {
+	1, 1, 20, 32, 640, 21, 20, 0, 0,
+	NULL, &src_kaiser_int32_20_21_3125_5000};
+
+static const struct src_kaiser src_kaiser_int32_20_21_4167_5000 = { 187478731, 972091543, 1073741824 };
+static const struct src_stage src_int32_20_21_4167_5000 = {
+	1, 1, 20, 60, 1200, 21, 20, 0, 0,
+	NULL, &src_kaiser_int32_20_21_4167_5000};
+
+static const struct src_kaiser src_kaiser_int32_20_21_4535_5000 = { 195014982, 959193513, 1073741824 };
+static const struct src_stage src_int32_20_21_4535_5000 = {
+	1, 1, 20, 104, 2080, 21, 20, 0, 0,
+	NULL, &src_kaiser_int32_20_21_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_2_3239_5000 = { 168513880, 1118812025, 1073741824 };
+static const struct src_stage src_int32_21_2_3239_5000 = {
+	1, 11, 21, 32, 672, 2, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_2_3239_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_4_1080_5000 = { 124345377, 1012386176, 1073741824 };
+static const struct src_stage src_int32_21_4_1080_5000 = {
+	3, 16, 21, 16, 336, 4, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_4_1080_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_4_3239_5000 = { 168513880, 1119091559, 1073741824 };
+static const struct src_stage src_int32_21_4_3239_5000 = {
+	3, 16, 21, 32, 672, 4, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_4_3239_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_5_1728_5000 = { 137595928, 1108227645, 1073741824 };
+static const struct src_stage src_int32_21_5_1728_5000 = {
+	4, 17, 21, 20, 420, 5, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_5_1728_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_5_4535_5000 = { 195014982, 1012386181, 1073741825 };
+static const struct src_stage src_int32_21_5_4535_5000 = {
+	4, 17, 21, 104, 2184, 5, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_5_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_8_2160_5000 = { 146429629, 1143643745, 1073741824 };
+static const struct src_stage src_int32_21_8_2160_5000 = {
+	3, 8, 21, 20, 420, 8, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_8_2160_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_8_3239_5000 = { 168513880, 1121787830, 1073741824 };
+static const struct src_stage src_int32_21_8_3239_5000 = {
+	3, 8, 21, 32, 672, 8, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_8_3239_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_8_4535_5000 = { 195014982, 1108227644, 1073741825 };
+static const struct src_stage src_int32_21_8_4535_5000 = {
+	3, 8, 21, 116, 2436, 8, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_8_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_10_2500_5000 = { 153391689, 1069596284, 1073741824 };
+static const struct src_stage src_int32_21_10_2500_5000 = {
+	9, 19, 21, 24, 504, 10, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_10_2500_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_10_3455_5000 = { 172930731, 1122091167, 1073741824 };
+static const struct src_stage src_int32_21_10_3455_5000 = {
+	9, 19, 21, 36, 756, 10, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_10_3455_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_10_4535_5000 = { 195014982, 1143643746, 1073741824 };
+static const struct src_stage src_int32_21_10_4535_5000 = {
+	9, 19, 21, 120, 2520, 10, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_10_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_16_4319_5000 = { 190598132, 1039997695, 1073741824 };
+static const struct src_stage src_int32_21_16_4319_5000 = {
+	3, 4, 21, 76, 1596, 16, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_16_4319_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_16_4535_5000 = { 195014982, 1122091168, 1073741823 };
+static const struct src_stage src_int32_21_16_4535_5000 = {
+	3, 4, 21, 116, 2436, 16, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_16_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_20_1250_5000 = { 127826408, 1092514249, 1073741824 };
+static const struct src_stage src_int32_21_20_1250_5000 = {
+	19, 20, 21, 20, 420, 20, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_20_1250_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_20_2500_5000 = { 153391689, 1062118690, 1073741824 };
+static const struct src_stage src_int32_21_20_2500_5000 = {
+	19, 20, 21, 24, 504, 20, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_20_2500_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_20_3125_5000 = { 166174330, 1103808909, 1073741824 };
+static const struct src_stage src_int32_21_20_3125_5000 = {
+	19, 20, 21, 32, 672, 20, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_20_3125_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_20_4167_5000 = { 187478731, 1016435815, 1073741824 };
+static const struct src_stage src_int32_21_20_4167_5000 = {
+	19, 20, 21, 60, 1260, 20, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_20_4167_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_20_4535_5000 = { 195014982, 1039997693, 1073741824 };
+static const struct src_stage src_int32_21_20_4535_5000 = {
+	19, 20, 21, 108, 2268, 20, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_20_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_32_4535_5000 = { 127978582, 1103808905, 1073741824 };
+static const struct src_stage src_int32_21_32_4535_5000 = {
+	3, 2, 21, 172, 3612, 32, 21, 0, 0,
+	NULL, &src_kaiser_int32_21_32_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_40_2381_5000 = { 79252373, 1080040736, 1073741824 };
+static const struct src_stage src_int32_21_40_2381_5000 = {
+	19, 10, 21, 44, 924, 40, 21, 0, 1,
+	NULL, &src_kaiser_int32_21_40_2381_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_40_3968_5000 = { 96295894, 890795205, 1073741824 };
+static const struct src_stage src_int32_21_40_3968_5000 = {
+	19, 10, 21, 80, 1680, 40, 21, 0, 1,
+	NULL, &src_kaiser_int32_21_40_3968_5000};
+
+static const struct src_kaiser src_kaiser_int32_21_80_3968_5000 = { 48147947, 890052200, 1073741824 };
+static const struct src_stage src_int32_21_80_3968_5000 = {
+	19, 5, 21, 160, 3360, 80, 21, 0, 2,
+	NULL, &src_kaiser_int32_21_80_3968_5000};
+
+static const struct src_kaiser src_kaiser_int32_32_21_4535_5000 = { 127978582, 1139059563, 1073741825 };
+static const struct src_stage src_int32_32_21_4535_5000 = {
+	19, 29, 32, 120, 3840, 21, 32, 0, 0,
+	NULL, &src_kaiser_int32_32_21_4535_5000};
+
+static const struct src_kaiser src_kaiser_int32_40_7_2976_5000 = { 85643693, 1119839480, 1073741824 };
+static const struct src_stage src_int32_40_7_2976_5000 = {
+	4, 23, 40, 28, 1120, 7, 40, 0, 0,
+	NULL, &src_kaiser_int32_40_7_2976_5000};
+
+static const struct src_kaiser src_kaiser_int32_40_21_2381_5000 = { 79252373, 1102619527, 1073741824 };
+static const struct src_stage src_int32_40_21_2381_5000 = {
+	11, 21, 40, 24, 960, 21, 40, 0, 0,
+	NULL, &src_kaiser_int32_40_21_2381_5000};
+
+static const struct src_kaiser src_kaiser_int32_40_21_2976_5000 = { 85643693, 1139059561, 1073741824 };
+static const struct src_stage src_int32_40_21_2976_5000 = {
+	11, 21, 40, 28, 1120, 21, 40, 0, 0,
+	NULL, &src_kaiser_int32_40_21_2976_5000};
+
+static const struct src_kaiser src_kaiser_int32_40_21_3968_5000 = { 96295894, 1078852900, 1073741824 };
+static const struct src_stage src_int32_40_21_3968_5000 = {
+	11, 21, 40, 52, 2080, 21, 40, 0, 0,
+	NULL, &src_kaiser_int32_40_21_3968_5000};
+
+/* SRC table */
+static const int32_t fir_one = 1073741824;
+static const struct src_stage src_int32_1_1_0_0 =  { 0, 0, 1, 1, 1, 1, 1, 0, -1, &fir_one };
+static const struct src_stage src_int32_0_0_0_0 =  { 0, 0, 0, 0, 0, 0, 0, 0,  0, &fir_one };
+static const int src_in_fs[16] = { 8000, 11025, 12000, 16000, 18900, 22050, 24000, 32000,
+	 37800, 44100, 48000, 64000, 88200, 96000, 176400, 192000
+	};
+static const int src_out_fs[10] = { 8000, 16000, 24000, 32000, 44100, 48000, 88200, 96000,
+	 176400, 192000};
+static const struct src_stage * const src_table1[10][16] = {
+	{ &src_int32_1_1_0_0, &src_int32_16_21_4319_5000,
+	 &src_int32_2_3_4535_5000, &src_int32_1_2_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_10_21_3455_5000,
+	 &src_int32_1_3_4535_5000, &src_int32_1_2_2268_5000,
+	 &src_int32_0_0_0_0, &src_int32_8_21_2160_5000,
+	 &src_int32_1_3_2268_5000, &src_int32_1_4_2268_5000,
+	 &src_int32_5_21_1728_5000, &src_int32_1_4_1512_5000,
+	 &src_int32_4_21_1080_5000, &src_int32_1_6_1134_5000
+	},
+	{ &src_int32_2_1_4535_5000, &src_int32_32_21_4535_5000,
+	 &src_int32_4_3_4535_5000, &src_int32_1_1_0_0,
+	 &src_int32_0_0_0_0, &src_int32_16_21_4319_5000,
+	 &src_int32_2_3_4535_5000, &src_int32_1_2_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_10_21_3455_5000,
+	 &src_int32_1_3_4535_5000, &src_int32_1_2_2268_5000,
+	 &src_int32_8_21_2160_5000, &src_int32_1_3_2268_5000,
+	 &src_int32_5_21_1728_5000, &src_int32_1_4_1512_5000
+	},
+	{ &src_int32_3_1_4535_5000, &src_int32_8_7_4535_5000,
+	 &src_int32_2_1_4535_5000, &src_int32_3_2_4535_5000,
+	 &src_int32_10_9_4535_5000, &src_int32_8_7_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_3_4_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_8_7_2468_5000,
+	 &src_int32_1_2_4535_5000, &src_int32_1_2_3401_5000,
+	 &src_int32_8_21_3239_5000, &src_int32_1_2_2268_5000,
+	 &src_int32_4_21_3239_5000, &src_int32_1_4_2268_5000
+	},
+	{ &src_int32_2_1_4535_5000, &src_int32_32_21_4535_5000,
+	 &src_int32_4_3_4535_5000, &src_int32_2_1_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_32_21_4535_5000,
+	 &src_int32_4_3_4535_5000, &src_int32_1_1_0_0,
+	 &src_int32_0_0_0_0, &src_int32_16_21_4319_5000,
+	 &src_int32_2_3_4535_5000, &src_int32_1_2_4535_5000,
+	 &src_int32_10_21_3455_5000, &src_int32_1_3_4535_5000,
+	 &src_int32_8_21_2160_5000, &src_int32_1_3_2268_5000
+	},
+	{ &src_int32_21_10_4535_5000, &src_int32_2_1_4535_5000,
+	 &src_int32_7_5_4535_5000, &src_int32_21_16_4535_5000,
+	 &src_int32_7_3_4535_5000, &src_int32_2_1_4535_5000,
+	 &src_int32_21_10_4535_5000, &src_int32_21_20_4535_5000,
+	 &src_int32_7_3_4535_5000, &src_int32_1_1_0_0,
+	 &src_int32_21_20_4167_5000, &src_int32_21_20_3125_5000,
+	 &src_int32_1_2_4535_5000, &src_int32_21_40_3968_5000,
+	 &src_int32_1_2_2268_5000, &src_int32_21_80_3968_5000
+	},
+	{ &src_int32_2_1_4535_5000, &src_int32_32_21_4535_5000,
+	 &src_int32_2_1_4535_5000, &src_int32_3_1_4535_5000,
+	 &src_int32_10_9_4535_5000, &src_int32_8_7_4535_5000,
+	 &src_int32_2_1_4535_5000, &src_int32_3_2_4535_5000,
+	 &src_int32_10_9_4535_5000, &src_int32_8_7_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_3_4_4535_5000,
+	 &src_int32_8_7_2468_5000, &src_int32_1_2_4535_5000,
+	 &src_int32_8_21_3239_5000, &src_int32_1_2_2268_5000
+	},
+	{ &src_int32_21_8_4535_5000, &src_int32_2_1_4535_5000,
+	 &src_int32_7_5_4535_5000, &src_int32_21_10_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_2_1_4535_5000,
+	 &src_int32_7_5_4535_5000, &src_int32_21_16_4535_5000,
+	 &src_int32_7_3_4535_5000, &src_int32_2_1_4535_5000,
+	 &src_int32_21_10_4535_5000, &src_int32_21_20_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_21_20_2500_5000,
+	 &src_int32_1_2_2721_5000, &src_int32_21_40_2381_5000
+	},
+	{ &src_int32_3_1_4535_5000, &src_int32_32_21_4535_5000,
+	 &src_int32_2_1_4535_5000, &src_int32_2_1_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_32_21_4535_5000,
+	 &src_int32_2_1_4535_5000, &src_int32_3_1_4535_5000,
+	 &src_int32_10_9_4535_5000, &src_int32_8_7_4535_5000,
+	 &src_int32_2_1_4535_5000, &src_int32_3_2_4535_5000,
+	 &src_int32_8_7_2721_5000, &src_int32_1_1_0_0,
+	 &src_int32_8_7_1361_5000, &src_int32_1_2_2500_5000
+	},
+	{ &src_int32_21_5_4535_5000, &src_int32_4_1_4535_5000,
+	 &src_int32_7_5_4535_5000, &src_int32_21_8_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_2_1_4535_5000,
+	 &src_int32_7_5_4535_5000, &src_int32_21_10_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_2_1_4535_5000,
+	 &src_int32_7_5_4535_5000, &src_int32_21_16_4535_5000,
+	 &src_int32_2_1_2721_5000, &src_int32_21_10_2500_5000,
+	 &src_int32_1_1_0_0, &src_int32_21_20_1250_5000
+	},
+	{ &src_int32_4_1_4535_5000, &src_int32_0_0_0_0,
+	 &src_int32_4_1_4535_5000, &src_int32_3_1_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_32_21_4535_5000,
+	 &src_int32_2_1_4535_5000, &src_int32_2_1_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_32_21_4535_5000,
+	 &src_int32_2_1_4535_5000, &src_int32_3_1_4535_5000,
+	 &src_int32_8_7_2721_5000, &src_int32_2_1_2500_5000,
+	 &src_int32_8_7_1361_5000, &src_int32_1_1_0_0
+	}
+};
+
+static const struct src_stage * const src_table2[10][16] = {
+	{ &src_int32_1_1_0_0, &src_int32_20_21_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_0_0_0_0, &src_int32_16_21_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_2_4535_5000,
+	 &src_int32_0_0_0_0, &src_int32_10_21_4535_5000,
+	 &src_int32_1_2_4535_5000, &src_int32_1_2_4535_5000,
+	 &src_int32_8_21_4535_5000, &src_int32_1_3_4535_5000,
+	 &src_int32_5_21_4535_5000, &src_int32_1_4_4535_5000
+	},
+	{ &src_int32_1_1_0_0, &src_int32_20_21_3125_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_0_0_0_0, &src_int32_20_21_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_0_0_0_0, &src_int32_16_21_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_2_4535_5000,
+	 &src_int32_10_21_4535_5000, &src_int32_1_2_4535_5000,
+	 &src_int32_8_21_4535_5000, &src_int32_1_3_4535_5000
+	},
+	{ &src_int32_1_1_0_0, &src_int32_40_21_3968_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_8_7_4082_5000, &src_int32_20_21_4167_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_0_0_0_0, &src_int32_10_21_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_3_4_4535_5000,
+	 &src_int32_5_7_4535_5000, &src_int32_1_2_4535_5000,
+	 &src_int32_5_7_4535_5000, &src_int32_1_2_4535_5000
+	},
+	{ &src_int32_2_1_2268_5000, &src_int32_40_21_2976_5000,
+	 &src_int32_2_1_3401_5000, &src_int32_1_1_0_0,
+	 &src_int32_0_0_0_0, &src_int32_20_21_3125_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_0_0_0_0, &src_int32_20_21_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_16_21_4535_5000, &src_int32_1_1_0_0,
+	 &src_int32_10_21_4535_5000, &src_int32_1_2_4535_5000
+	},
+	{ &src_int32_21_8_2160_5000, &src_int32_2_1_2268_5000,
+	 &src_int32_21_8_3239_5000, &src_int32_21_10_3455_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_7_8_2468_5000, &src_int32_21_16_4319_5000,
+	 &src_int32_1_2_3887_5000, &src_int32_1_1_0_0,
+	 &src_int32_7_8_4535_5000, &src_int32_21_32_4535_5000,
+	 &src_int32_1_1_0_0, &src_int32_7_8_4535_5000,
+	 &src_int32_1_2_4535_5000, &src_int32_7_8_4535_5000
+	},
+	{ &src_int32_3_1_2268_5000, &src_int32_20_7_2976_5000,
+	 &src_int32_2_1_2268_5000, &src_int32_1_1_0_0,
+	 &src_int32_16_7_4082_5000, &src_int32_40_21_3968_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_8_7_4082_5000, &src_int32_20_21_4167_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_10_21_4535_5000, &src_int32_1_1_0_0,
+	 &src_int32_5_7_4535_5000, &src_int32_1_2_4535_5000
+	},
+	{ &src_int32_21_5_1728_5000, &src_int32_4_1_2268_5000,
+	 &src_int32_21_4_3239_5000, &src_int32_21_8_2160_5000,
+	 &src_int32_0_0_0_0, &src_int32_2_1_2268_5000,
+	 &src_int32_21_8_3239_5000, &src_int32_21_10_3455_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_7_8_2468_5000, &src_int32_21_16_4319_5000,
+	 &src_int32_1_1_0_0, &src_int32_7_8_2721_5000,
+	 &src_int32_1_1_0_0, &src_int32_7_8_2721_5000
+	},
+	{ &src_int32_4_1_1512_5000, &src_int32_40_7_2976_5000,
+	 &src_int32_4_1_2268_5000, &src_int32_3_1_2268_5000,
+	 &src_int32_0_0_0_0, &src_int32_20_7_2976_5000,
+	 &src_int32_2_1_2268_5000, &src_int32_1_1_0_0,
+	 &src_int32_16_7_4082_5000, &src_int32_40_21_3968_5000,
+	 &src_int32_1_1_0_0, &src_int32_1_1_0_0,
+	 &src_int32_20_21_2500_5000, &src_int32_1_1_0_0,
+	 &src_int32_10_21_2500_5000, &src_int32_1_1_0_0
+	},
+	{ &src_int32_21_4_1080_5000, &src_int32_4_1_1134_5000,
+	 &src_int32_21_2_3239_5000, &src_int32_21_5_1728_5000,
+	 &src_int32_0_0_0_0, &src_int32_4_1_2268_5000,
+	 &src_int32_21_4_3239_5000, &src_int32_21_8_2160_5000,
+	 &src_int32_0_0_0_0, &src_int32_2_1_2268_5000,
+	 &src_int32_21_8_3239_5000, &src_int32_21_10_3455_5000,
+	 &src_int32_1_1_0_0, &src_int32_7_8_1361_5000,
+	 &src_int32_1_1_0_0, &src_int32_7_8_1361_5000
+	},
+	{ &src_int32_6_1_1134_5000, &src_int32_0_0_0_0,
+	 &src_int32_4_1_1134_5000, &src_int32_4_1_1512_5000,
+	 &src_int32_0_0_0_0, &src_int32_40_7_2976_5000,
+	 &src_int32_4_1_2268_5000, &src_int32_3_1_2268_5000,
+	 &src_int32_0_0_0_0, &src_int32_20_7_2976_5000,
+	 &src_int32_2_1_2268_5000, &src_int32_1_1_0_0,
+	 &src_int32_40_21_2381_5000, &src_int32_1_1_0_0,
+	 &src_int32_20_21_1250_5000, &src_int32_1_1_0_0
+	}
+};
+
+#endif /* __SOF_AUDIO_COEFFICIENTS_SRC_SRC_IPC4_INT32_KAISER_H__ */
+
+/** \endcond */
@@ -0,0 +1,658 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_10_21_3455_5000_fir[640] = {
+	2,
+	8,
+	2,
+	-18,
+	-22,
+	20,
+	58,
+	11,
+	-93,
+	-91,
+	82,
+	206,
+	27,
+	-293,
+	-253,
+	244,
+	541,
+	40,
+	-734,
+	-580,
+	612,
+	1240,
+	30,
+	-1708,
+	-1266,
+	1524,
+	2967,
+	-85,
+	-4826,
+	-3827,
+	6605,
+	20420,
+	26368,
+	19218,
+	5236,
+	-4362,
+	-4484,
+	398,
+	3008,
+	1227,
+	-1448,
+	-1595,
+	218,
+	1255,
+	485,
+	-656,
+	-682,
+	122,
+	544,
+	188,
+	-282,
+	-269,
+	58,
+	205,
+	62,
+	-100,
+	-85,
+	21,
+	57,
+	14,
+	-24,
+	-16,
+	4,
+	7,
+	2,
+	8,
+	1,
+	-20,
+	-20,
+	25,
+	59,
+	1,
+	-101,
+	-80,
+	102,
+	204,
+	-7,
+	-312,
+	-218,
+	297,
+	529,
+	-44,
+	-778,
+	-491,
+	734,
+	1203,
+	-165,
+	-1798,
+	-1056,
+	1807,
+	2875,
+	-590,
+	-5106,
+	-3189,
+	8013,
+	21539,
+	26226,
+	17942,
+	3917,
+	-4792,
+	-4090,
+	853,
+	3000,
+	921,
+	-1601,
+	-1460,
+	397,
+	1250,
+	353,
+	-719,
+	-619,
+	198,
+	538,
+	132,
+	-306,
+	-242,
+	87,
+	201,
+	41,
+	-107,
+	-75,
+	29,
+	55,
+	9,
+	-25,
+	-14,
+	5,
+	7,
+	3,
+	8,
+	-1,
+	-22,
+	-17,
+	31,
+	57,
+	-9,
+	-107,
+	-67,
+	122,
+	197,
+	-41,
+	-327,
+	-179,
+	348,
+	508,
+	-131,
+	-809,
+	-392,
+	848,
+	1146,
+	-364,
+	-1861,
+	-821,
+	2072,
+	2731,
+	-1109,
+	-5318,
+	-2449,
+	9449,
+	22562,
+	25944,
+	16605,
+	2657,
+	-5119,
+	-3652,
+	1275,
+	2944,
+	612,
+	-1723,
+	-1305,
+	563,
+	1225,
+	221,
+	-769,
+	-549,
+	268,
+	524,
+	75,
+	-324,
+	-212,
+	113,
+	194,
+	20,
+	-111,
+	-65,
+	36,
+	53,
+	3,
+	-25,
+	-12,
+	6,
+	6,
+	4,
+	8,
+	-3,
+	-23,
+	-14,
+	35,
+	56,
+	-20,
+	-112,
+	-52,
+	140,
+	187,
+	-75,
+	-338,
+	-134,
+	394,
+	477,
+	-219,
+	-827,
+	-283,
+	951,
+	1068,
+	-564,
+	-1895,
+	-564,
+	2312,
+	2538,
+	-1637,
+	-5455,
+	-1608,
+	10900,
+	23481,
+	25522,
+	15220,
+	1467,
+	-5345,
+	-3179,
+	1658,
+	2844,
+	304,
+	-1814,
+	-1135,
+	716,
+	1181,
+	88,
+	-804,
+	-473,
+	333,
+	502,
+	19,
+	-336,
+	-180,
+	137,
+	184,
+	1,
+	-115,
+	-54,
+	43,
+	49,
+	-1,
+	-25,
+	-10,
+	7,
+	6,
+	4,
+	8,
+	-5,
+	-24,
+	-11,
+	41,
+	52,
+	-31,
+	-114,
+	-37,
+	157,
+	174,
+	-111,
+	-343,
+	-86,
+	436,
+	437,
+	-305,
+	-834,
+	-165,
+	1043,
+	969,
+	-762,
+	-1899,
+	-288,
+	2524,
+	2292,
+	-2163,
+	-5508,
+	-672,
+	12354,
+	24286,
+	24968,
+	13798,
+	355,
+	-5473,
+	-2680,
+	1997,
+	2703,
+	3,
+	-1873,
+	-953,
+	851,
+	1120,
+	-41,
+	-826,
+	-391,
+	389,
+	472,
+	-35,
+	-342,
+	-146,
+	157,
+	171,
+	-18,
+	-116,
+	-42,
+	48,
+	45,
+	-6,
+	-25,
+	-7,
+	7,
+	5,
+	5,
+	7,
+	-7,
+	-25,
+	-6,
+	45,
+	48,
+	-42,
+	-116,
+	-18,
+	171,
+	157,
+	-146,
+	-342,
+	-35,
+	472,
+	389,
+	-391,
+	-826,
+	-41,
+	1120,
+	851,
+	-953,
+	-1873,
+	3,
+	2703,
+	1997,
+	-2680,
+	-5473,
+	355,
+	13798,
+	24968,
+	24286,
+	12354,
+	-672,
+	-5508,
+	-2163,
+	2292,
+	2524,
+	-288,
+	-1899,
+	-762,
+	969,
+	1043,
+	-165,
+	-834,
+	-305,
+	437,
+	436,
+	-86,
+	-343,
+	-111,
+	174,
+	157,
+	-37,
+	-114,
+	-31,
+	52,
+	41,
+	-11,
+	-24,
+	-5,
+	8,
+	4,
+	6,
+	7,
+	-10,
+	-25,
+	-1,
+	49,
+	43,
+	-54,
+	-115,
+	1,
+	184,
+	137,
+	-180,
+	-336,
+	19,
+	502,
+	333,
+	-473,
+	-804,
+	88,
+	1181,
+	716,
+	-1135,
+	-1814,
+	304,
+	2844,
+	1658,
+	-3179,
+	-5345,
+	1467,
+	15220,
+	25522,
+	23481,
+	10900,
+	-1608,
+	-5455,
+	-1637,
+	2538,
+	2312,
+	-564,
+	-1895,
+	-564,
+	1068,
+	951,
+	-283,
+	-827,
+	-219,
+	477,
+	394,
+	-134,
+	-338,
+	-75,
+	187,
+	140,
+	-52,
+	-112,
+	-20,
+	56,
+	35,
+	-14,
+	-23,
+	-3,
+	8,
+	4,
+	6,
+	6,
+	-12,
+	-25,
+	3,
+	53,
+	36,
+	-65,
+	-111,
+	20,
+	194,
+	113,
+	-212,
+	-324,
+	75,
+	524,
+	268,
+	-549,
+	-769,
+	221,
+	1225,
+	563,
+	-1305,
+	-1723,
+	612,
+	2944,
+	1275,
+	-3652,
+	-5119,
+	2657,
+	16605,
+	25944,
+	22562,
+	9449,
+	-2449,
+	-5318,
+	-1109,
+	2731,
+	2072,
+	-821,
+	-1861,
+	-364,
+	1146,
+	848,
+	-392,
+	-809,
+	-131,
+	508,
+	348,
+	-179,
+	-327,
+	-41,
+	197,
+	122,
+	-67,
+	-107,
+	-9,
+	57,
+	31,
+	-17,
+	-22,
+	-1,
+	8,
+	3,
+	7,
+	5,
+	-14,
+	-25,
+	9,
+	55,
+	29,
+	-75,
+	-107,
+	41,
+	201,
+	87,
+	-242,
+	-306,
+	132,
+	538,
+	198,
+	-619,
+	-719,
+	353,
+	1250,
+	397,
+	-1460,
+	-1601,
+	921,
+	3000,
+	853,
+	-4090,
+	-4792,
+	3917,
+	17942,
+	26226,
+	21539,
+	8013,
+	-3189,
+	-5106,
+	-590,
+	2875,
+	1807,
+	-1056,
+	-1798,
+	-165,
+	1203,
+	734,
+	-491,
+	-778,
+	-44,
+	529,
+	297,
+	-218,
+	-312,
+	-7,
+	204,
+	102,
+	-80,
+	-101,
+	1,
+	59,
+	25,
+	-20,
+	-20,
+	1,
+	8,
+	2,
+	7,
+	4,
+	-16,
+	-24,
+	14,
+	57,
+	21,
+	-85,
+	-100,
+	62,
+	205,
+	58,
+	-269,
+	-282,
+	188,
+	544,
+	122,
+	-682,
+	-656,
+	485,
+	1255,
+	218,
+	-1595,
+	-1448,
+	1227,
+	3008,
+	398,
+	-4484,
+	-4362,
+	5236,
+	19218,
+	26368,
+	20420,
+	6605,
+	-3827,
+	-4826,
+	-85,
+	2967,
+	1524,
+	-1266,
+	-1708,
+	30,
+	1240,
+	612,
+	-580,
+	-734,
+	40,
+	541,
+	244,
+	-253,
+	-293,
+	27,
+	206,
+	82,
+	-91,
+	-93,
+	11,
+	58,
+	20,
+	-22,
+	-18,
+	2,
+	8,
+	2
+
+};
+
+static const struct src_stage src_int16_10_21_3455_5000 = {
+	2, 1, 10, 64, 640, 21, 10, 0, 1,
+	src_int16_10_21_3455_5000_fir};
+/** \endcond */
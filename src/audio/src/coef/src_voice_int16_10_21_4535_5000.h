@@ -0,0 +1,2338 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_10_21_4535_5000_fir[2320] = {
+	0,
+	1,
+	-1,
+	-1,
+	1,
+	1,
+	0,
+	-2,
+	0,
+	3,
+	1,
+	-3,
+	-2,
+	3,
+	4,
+	-3,
+	-6,
+	2,
+	7,
+	1,
+	-10,
+	-3,
+	10,
+	7,
+	-9,
+	-12,
+	8,
+	16,
+	-4,
+	-20,
+	-2,
+	24,
+	9,
+	-24,
+	-18,
+	22,
+	28,
+	-17,
+	-38,
+	8,
+	46,
+	5,
+	-51,
+	-21,
+	51,
+	40,
+	-46,
+	-59,
+	34,
+	77,
+	-15,
+	-91,
+	-11,
+	99,
+	42,
+	-97,
+	-77,
+	85,
+	112,
+	-61,
+	-143,
+	25,
+	166,
+	23,
+	-177,
+	-79,
+	172,
+	139,
+	-147,
+	-199,
+	103,
+	250,
+	-38,
+	-287,
+	-45,
+	303,
+	141,
+	-291,
+	-243,
+	247,
+	343,
+	-169,
+	-429,
+	57,
+	490,
+	85,
+	-515,
+	-251,
+	495,
+	428,
+	-420,
+	-604,
+	285,
+	761,
+	-87,
+	-881,
+	-171,
+	944,
+	483,
+	-927,
+	-841,
+	810,
+	1229,
+	-566,
+	-1633,
+	162,
+	2037,
+	454,
+	-2427,
+	-1392,
+	2799,
+	2937,
+	-3177,
+	-6176,
+	3765,
+	21444,
+	29732,
+	19808,
+	2192,
+	-6381,
+	-2485,
+	3264,
+	2437,
+	-1724,
+	-2249,
+	758,
+	1979,
+	-100,
+	-1656,
+	-354,
+	1306,
+	650,
+	-950,
+	-819,
+	609,
+	883,
+	-298,
+	-862,
+	31,
+	776,
+	184,
+	-645,
+	-341,
+	487,
+	440,
+	-319,
+	-485,
+	156,
+	481,
+	-9,
+	-439,
+	-112,
+	368,
+	202,
+	-278,
+	-260,
+	182,
+	285,
+	-86,
+	-283,
+	1,
+	257,
+	69,
+	-214,
+	-121,
+	160,
+	154,
+	-103,
+	-167,
+	47,
+	164,
+	2,
+	-147,
+	-42,
+	121,
+	70,
+	-89,
+	-87,
+	56,
+	93,
+	-24,
+	-90,
+	-2,
+	79,
+	24,
+	-64,
+	-38,
+	46,
+	46,
+	-28,
+	-48,
+	12,
+	45,
+	2,
+	-39,
+	-12,
+	31,
+	18,
+	-21,
+	-22,
+	13,
+	22,
+	-5,
+	-20,
+	-1,
+	17,
+	5,
+	-12,
+	-8,
+	8,
+	9,
+	-5,
+	-8,
+	1,
+	7,
+	1,
+	-6,
+	-2,
+	4,
+	3,
+	-3,
+	-3,
+	2,
+	2,
+	0,
+	-2,
+	0,
+	2,
+	0,
+	-1,
+	0,
+	0,
+	0,
+	1,
+	-1,
+	-1,
+	1,
+	1,
+	-1,
+	-1,
+	0,
+	3,
+	0,
+	-3,
+	-1,
+	3,
+	3,
+	-3,
+	-5,
+	2,
+	8,
+	-1,
+	-9,
+	-2,
+	10,
+	6,
+	-11,
+	-10,
+	9,
+	15,
+	-6,
+	-20,
+	1,
+	24,
+	6,
+	-26,
+	-15,
+	26,
+	25,
+	-22,
+	-35,
+	14,
+	45,
+	-2,
+	-52,
+	-14,
+	56,
+	32,
+	-53,
+	-53,
+	44,
+	73,
+	-27,
+	-90,
+	3,
+	101,
+	28,
+	-105,
+	-64,
+	98,
+	101,
+	-79,
+	-136,
+	47,
+	165,
+	-2,
+	-183,
+	-53,
+	186,
+	116,
+	-172,
+	-179,
+	135,
+	238,
+	-76,
+	-286,
+	-2,
+	314,
+	97,
+	-317,
+	-203,
+	288,
+	310,
+	-223,
+	-410,
+	123,
+	489,
+	12,
+	-537,
+	-176,
+	541,
+	359,
+	-492,
+	-549,
+	381,
+	730,
+	-205,
+	-882,
+	-39,
+	986,
+	346,
+	-1018,
+	-712,
+	956,
+	1125,
+	-770,
+	-1576,
+	426,
+	2054,
+	133,
+	-2559,
+	-1021,
+	3116,
+	2535,
+	-3838,
+	-5827,
+	5427,
+	22979,
+	29530,
+	18089,
+	724,
+	-6447,
+	-1778,
+	3514,
+	2037,
+	-2012,
+	-2031,
+	1041,
+	1882,
+	-354,
+	-1646,
+	-138,
+	1356,
+	480,
+	-1040,
+	-696,
+	721,
+	805,
+	-418,
+	-826,
+	147,
+	776,
+	80,
+	-674,
+	-255,
+	536,
+	376,
+	-381,
+	-444,
+	223,
+	463,
+	-75,
+	-440,
+	-53,
+	385,
+	153,
+	-308,
+	-223,
+	218,
+	262,
+	-126,
+	-272,
+	39,
+	258,
+	35,
+	-224,
+	-93,
+	177,
+	133,
+	-124,
+	-154,
+	70,
+	158,
+	-20,
+	-148,
+	-22,
+	126,
+	55,
+	-99,
+	-76,
+	68,
+	86,
+	-37,
+	-87,
+	9,
+	80,
+	13,
+	-67,
+	-30,
+	51,
+	40,
+	-34,
+	-45,
+	18,
+	44,
+	-4,
+	-39,
+	-7,
+	32,
+	15,
+	-24,
+	-19,
+	15,
+	21,
+	-8,
+	-19,
+	1,
+	17,
+	3,
+	-13,
+	-7,
+	10,
+	8,
+	-6,
+	-8,
+	3,
+	7,
+	0,
+	-6,
+	-1,
+	4,
+	2,
+	-3,
+	-2,
+	2,
+	2,
+	-1,
+	-1,
+	0,
+	1,
+	1,
+	-1,
+	0,
+	0,
+	0,
+	1,
+	-1,
+	-1,
+	1,
+	1,
+	-1,
+	-2,
+	1,
+	2,
+	0,
+	-3,
+	-1,
+	3,
+	3,
+	-4,
+	-5,
+	3,
+	7,
+	-2,
+	-9,
+	-1,
+	11,
+	4,
+	-11,
+	-9,
+	10,
+	15,
+	-9,
+	-20,
+	5,
+	24,
+	2,
+	-27,
+	-11,
+	28,
+	22,
+	-26,
+	-33,
+	20,
+	44,
+	-9,
+	-53,
+	-6,
+	58,
+	25,
+	-59,
+	-46,
+	53,
+	67,
+	-38,
+	-88,
+	17,
+	103,
+	13,
+	-111,
+	-49,
+	110,
+	87,
+	-96,
+	-126,
+	68,
+	160,
+	-27,
+	-186,
+	-26,
+	197,
+	89,
+	-191,
+	-156,
+	164,
+	222,
+	-114,
+	-279,
+	41,
+	320,
+	51,
+	-337,
+	-158,
+	323,
+	272,
+	-275,
+	-382,
+	187,
+	478,
+	-62,
+	-547,
+	-98,
+	577,
+	283,
+	-555,
+	-483,
+	472,
+	683,
+	-320,
+	-865,
+	96,
+	1009,
+	200,
+	-1090,
+	-566,
+	1084,
+	997,
+	-962,
+	-1485,
+	686,
+	2030,
+	-198,
+	-2643,
+	-617,
+	3379,
+	2064,
+	-4455,
+	-5330,
+	7163,
+	24393,
+	29130,
+	16306,
+	-628,
+	-6381,
+	-1070,
+	3684,
+	1610,
+	-2251,
+	-1777,
+	1295,
+	1750,
+	-597,
+	-1602,
+	76,
+	1378,
+	302,
+	-1107,
+	-560,
+	817,
+	711,
+	-528,
+	-773,
+	259,
+	760,
+	-25,
+	-687,
+	-165,
+	573,
+	306,
+	-434,
+	-394,
+	284,
+	435,
+	-138,
+	-432,
+	7,
+	394,
+	102,
+	-330,
+	-183,
+	250,
+	234,
+	-162,
+	-257,
+	77,
+	254,
+	0,
+	-230,
+	-63,
+	191,
+	110,
+	-143,
+	-138,
+	91,
+	150,
+	-42,
+	-146,
+	-2,
+	130,
+	38,
+	-107,
+	-63,
+	79,
+	77,
+	-49,
+	-82,
+	21,
+	79,
+	3,
+	-69,
+	-22,
+	56,
+	34,
+	-40,
+	-40,
+	24,
+	42,
+	-10,
+	-39,
+	-2,
+	33,
+	11,
+	-26,
+	-16,
+	18,
+	19,
+	-10,
+	-19,
+	4,
+	17,
+	1,
+	-14,
+	-5,
+	11,
+	6,
+	-7,
+	-7,
+	3,
+	7,
+	-1,
+	-7,
+	0,
+	5,
+	1,
+	-3,
+	-2,
+	2,
+	2,
+	-1,
+	-2,
+	1,
+	1,
+	0,
+	-1,
+	0,
+	0,
+	1,
+	0,
+	-1,
+	0,
+	1,
+	1,
+	-1,
+	-2,
+	1,
+	3,
+	-1,
+	-3,
+	0,
+	4,
+	2,
+	-4,
+	-4,
+	4,
+	7,
+	-3,
+	-9,
+	1,
+	11,
+	3,
+	-13,
+	-7,
+	13,
+	13,
+	-12,
+	-18,
+	8,
+	24,
+	-2,
+	-28,
+	-7,
+	30,
+	18,
+	-30,
+	-29,
+	25,
+	42,
+	-16,
+	-52,
+	2,
+	60,
+	17,
+	-65,
+	-37,
+	60,
+	61,
+	-50,
+	-83,
+	30,
+	103,
+	-3,
+	-115,
+	-32,
+	119,
+	71,
+	-110,
+	-113,
+	88,
+	152,
+	-51,
+	-185,
+	1,
+	205,
+	60,
+	-208,
+	-129,
+	190,
+	200,
+	-149,
+	-266,
+	84,
+	318,
+	4,
+	-350,
+	-109,
+	352,
+	227,
+	-319,
+	-347,
+	248,
+	457,
+	-135,
+	-546,
+	-17,
+	601,
+	200,
+	-607,
+	-406,
+	553,
+	622,
+	-429,
+	-831,
+	231,
+	1011,
+	48,
+	-1140,
+	-407,
+	1192,
+	845,
+	-1137,
+	-1362,
+	937,
+	1963,
+	-533,
+	-2674,
+	-189,
+	3582,
+	1528,
+	-5012,
+	-4683,
+	8955,
+	25671,
+	28535,
+	14482,
+	-1853,
+	-6194,
+	-372,
+	3773,
+	1165,
+	-2439,
+	-1494,
+	1518,
+	1585,
+	-823,
+	-1528,
+	286,
+	1372,
+	121,
+	-1152,
+	-414,
+	895,
+	605,
+	-626,
+	-706,
+	365,
+	729,
+	-128,
+	-688,
+	-72,
+	599,
+	229,
+	-478,
+	-337,
+	340,
+	398,
+	-198,
+	-416,
+	66,
+	395,
+	49,
+	-346,
+	-139,
+	276,
+	202,
+	-196,
+	-236,
+	112,
+	245,
+	-34,
+	-232,
+	-32,
+	201,
+	84,
+	-159,
+	-119,
+	111,
+	138,
+	-63,
+	-141,
+	18,
+	131,
+	20,
+	-112,
+	-49,
+	87,
+	68,
+	-60,
+	-76,
+	32,
+	77,
+	-8,
+	-70,
+	-12,
+	59,
+	26,
+	-45,
+	-35,
+	30,
+	38,
+	-15,
+	-38,
+	3,
+	34,
+	6,
+	-27,
+	-13,
+	21,
+	16,
+	-13,
+	-17,
+	6,
+	16,
+	-1,
+	-14,
+	-3,
+	11,
+	5,
+	-8,
+	-6,
+	5,
+	6,
+	-2,
+	-5,
+	-1,
+	5,
+	1,
+	-3,
+	-2,
+	2,
+	2,
+	-1,
+	-2,
+	1,
+	1,
+	0,
+	-1,
+	0,
+	0,
+	1,
+	0,
+	-1,
+	0,
+	1,
+	1,
+	-1,
+	-2,
+	2,
+	2,
+	-1,
+	-3,
+	0,
+	4,
+	2,
+	-5,
+	-4,
+	5,
+	6,
+	-4,
+	-9,
+	3,
+	11,
+	1,
+	-13,
+	-5,
+	14,
+	11,
+	-14,
+	-17,
+	11,
+	23,
+	-5,
+	-29,
+	-2,
+	32,
+	13,
+	-33,
+	-25,
+	30,
+	38,
+	-22,
+	-51,
+	10,
+	61,
+	7,
+	-67,
+	-28,
+	67,
+	52,
+	-59,
+	-77,
+	43,
+	99,
+	-18,
+	-117,
+	-15,
+	125,
+	55,
+	-123,
+	-98,
+	107,
+	141,
+	-75,
+	-180,
+	29,
+	208,
+	30,
+	-220,
+	-100,
+	213,
+	174,
+	-182,
+	-247,
+	126,
+	310,
+	-45,
+	-355,
+	-58,
+	374,
+	177,
+	-359,
+	-303,
+	304,
+	427,
+	-207,
+	-534,
+	67,
+	612,
+	112,
+	-647,
+	-320,
+	624,
+	547,
+	-532,
+	-778,
+	362,
+	992,
+	-107,
+	-1167,
+	-237,
+	1277,
+	674,
+	-1292,
+	-1209,
+	1174,
+	1854,
+	-865,
+	-2651,
+	256,
+	3720,
+	938,
+	-5498,
+	-3885,
+	10786,
+	26795,
+	27753,
+	12635,
+	-2940,
+	-5896,
+	301,
+	3784,
+	711,
+	-2572,
+	-1188,
+	1705,
+	1392,
+	-1028,
+	-1424,
+	487,
+	1338,
+	-61,
+	-1171,
+	-262,
+	953,
+	488,
+	-709,
+	-625,
+	461,
+	683,
+	-227,
+	-674,
+	20,
+	612,
+	149,
+	-511,
+	-275,
+	387,
+	355,
+	-254,
+	-391,
+	123,
+	388,
+	-5,
+	-354,
+	-92,
+	296,
+	165,
+	-223,
+	-211,
+	145,
+	231,
+	-68,
+	-228,
+	-1,
+	206,
+	57,
+	-171,
+	-98,
+	127,
+	123,
+	-81,
+	-133,
+	37,
+	129,
+	3,
+	-116,
+	-33,
+	94,
+	56,
+	-69,
+	-68,
+	43,
+	72,
+	-18,
+	-69,
+	-2,
+	60,
+	18,
+	-48,
+	-29,
+	34,
+	35,
+	-21,
+	-35,
+	8,
+	33,
+	2,
+	-28,
+	-9,
+	21,
+	14,
+	-15,
+	-16,
+	9,
+	15,
+	-3,
+	-14,
+	-1,
+	11,
+	4,
+	-8,
+	-6,
+	6,
+	6,
+	-4,
+	-5,
+	1,
+	5,
+	-1,
+	-3,
+	-1,
+	2,
+	1,
+	-1,
+	-2,
+	1,
+	1,
+	0,
+	-1,
+	0,
+	0,
+	0,
+	0,
+	-1,
+	0,
+	1,
+	1,
+	-2,
+	-1,
+	1,
+	2,
+	-1,
+	-3,
+	-1,
+	5,
+	1,
+	-5,
+	-4,
+	6,
+	6,
+	-6,
+	-8,
+	4,
+	11,
+	-1,
+	-14,
+	-3,
+	15,
+	9,
+	-16,
+	-15,
+	14,
+	21,
+	-9,
+	-28,
+	2,
+	33,
+	8,
+	-35,
+	-21,
+	35,
+	34,
+	-29,
+	-48,
+	18,
+	60,
+	-2,
+	-69,
+	-18,
+	72,
+	43,
+	-68,
+	-69,
+	56,
+	94,
+	-33,
+	-116,
+	3,
+	129,
+	37,
+	-133,
+	-81,
+	123,
+	127,
+	-98,
+	-171,
+	57,
+	206,
+	-1,
+	-228,
+	-68,
+	231,
+	145,
+	-211,
+	-223,
+	165,
+	296,
+	-92,
+	-354,
+	-5,
+	388,
+	123,
+	-391,
+	-254,
+	355,
+	387,
+	-275,
+	-511,
+	149,
+	612,
+	20,
+	-674,
+	-227,
+	683,
+	461,
+	-625,
+	-709,
+	488,
+	953,
+	-262,
+	-1171,
+	-61,
+	1338,
+	487,
+	-1424,
+	-1028,
+	1392,
+	1705,
+	-1188,
+	-2572,
+	711,
+	3784,
+	301,
+	-5896,
+	-2940,
+	12635,
+	27753,
+	26795,
+	10786,
+	-3885,
+	-5498,
+	938,
+	3720,
+	256,
+	-2651,
+	-865,
+	1854,
+	1174,
+	-1209,
+	-1292,
+	674,
+	1277,
+	-237,
+	-1167,
+	-107,
+	992,
+	362,
+	-778,
+	-532,
+	547,
+	624,
+	-320,
+	-647,
+	112,
+	612,
+	67,
+	-534,
+	-207,
+	427,
+	304,
+	-303,
+	-359,
+	177,
+	374,
+	-58,
+	-355,
+	-45,
+	310,
+	126,
+	-247,
+	-182,
+	174,
+	213,
+	-100,
+	-220,
+	30,
+	208,
+	29,
+	-180,
+	-75,
+	141,
+	107,
+	-98,
+	-123,
+	55,
+	125,
+	-15,
+	-117,
+	-18,
+	99,
+	43,
+	-77,
+	-59,
+	52,
+	67,
+	-28,
+	-67,
+	7,
+	61,
+	10,
+	-51,
+	-22,
+	38,
+	30,
+	-25,
+	-33,
+	13,
+	32,
+	-2,
+	-29,
+	-5,
+	23,
+	11,
+	-17,
+	-14,
+	11,
+	14,
+	-5,
+	-13,
+	1,
+	11,
+	3,
+	-9,
+	-4,
+	6,
+	5,
+	-4,
+	-5,
+	2,
+	4,
+	0,
+	-3,
+	-1,
+	2,
+	2,
+	-2,
+	-1,
+	1,
+	1,
+	0,
+	-1,
+	0,
+	1,
+	0,
+	0,
+	-1,
+	0,
+	1,
+	1,
+	-2,
+	-1,
+	2,
+	2,
+	-2,
+	-3,
+	1,
+	5,
+	-1,
+	-5,
+	-2,
+	6,
+	5,
+	-6,
+	-8,
+	5,
+	11,
+	-3,
+	-14,
+	-1,
+	16,
+	6,
+	-17,
+	-13,
+	16,
+	21,
+	-13,
+	-27,
+	6,
+	34,
+	3,
+	-38,
+	-15,
+	38,
+	30,
+	-35,
+	-45,
+	26,
+	59,
+	-12,
+	-70,
+	-8,
+	77,
+	32,
+	-76,
+	-60,
+	68,
+	87,
+	-49,
+	-112,
+	20,
+	131,
+	18,
+	-141,
+	-63,
+	138,
+	111,
+	-119,
+	-159,
+	84,
+	201,
+	-32,
+	-232,
+	-34,
+	245,
+	112,
+	-236,
+	-196,
+	202,
+	276,
+	-139,
+	-346,
+	49,
+	395,
+	66,
+	-416,
+	-198,
+	398,
+	340,
+	-337,
+	-478,
+	229,
+	599,
+	-72,
+	-688,
+	-128,
+	729,
+	365,
+	-706,
+	-626,
+	605,
+	895,
+	-414,
+	-1152,
+	121,
+	1372,
+	286,
+	-1528,
+	-823,
+	1585,
+	1518,
+	-1494,
+	-2439,
+	1165,
+	3773,
+	-372,
+	-6194,
+	-1853,
+	14482,
+	28535,
+	25671,
+	8955,
+	-4683,
+	-5012,
+	1528,
+	3582,
+	-189,
+	-2674,
+	-533,
+	1963,
+	937,
+	-1362,
+	-1137,
+	845,
+	1192,
+	-407,
+	-1140,
+	48,
+	1011,
+	231,
+	-831,
+	-429,
+	622,
+	553,
+	-406,
+	-607,
+	200,
+	601,
+	-17,
+	-546,
+	-135,
+	457,
+	248,
+	-347,
+	-319,
+	227,
+	352,
+	-109,
+	-350,
+	4,
+	318,
+	84,
+	-266,
+	-149,
+	200,
+	190,
+	-129,
+	-208,
+	60,
+	205,
+	1,
+	-185,
+	-51,
+	152,
+	88,
+	-113,
+	-110,
+	71,
+	119,
+	-32,
+	-115,
+	-3,
+	103,
+	30,
+	-83,
+	-50,
+	61,
+	60,
+	-37,
+	-65,
+	17,
+	60,
+	2,
+	-52,
+	-16,
+	42,
+	25,
+	-29,
+	-30,
+	18,
+	30,
+	-7,
+	-28,
+	-2,
+	24,
+	8,
+	-18,
+	-12,
+	13,
+	13,
+	-7,
+	-13,
+	3,
+	11,
+	1,
+	-9,
+	-3,
+	7,
+	4,
+	-4,
+	-4,
+	2,
+	4,
+	0,
+	-3,
+	-1,
+	3,
+	1,
+	-2,
+	-1,
+	1,
+	1,
+	0,
+	-1,
+	0,
+	1,
+	0,
+	0,
+	-1,
+	0,
+	1,
+	1,
+	-2,
+	-1,
+	2,
+	2,
+	-2,
+	-3,
+	1,
+	5,
+	0,
+	-7,
+	-1,
+	7,
+	3,
+	-7,
+	-7,
+	6,
+	11,
+	-5,
+	-14,
+	1,
+	17,
+	4,
+	-19,
+	-10,
+	19,
+	18,
+	-16,
+	-26,
+	11,
+	33,
+	-2,
+	-39,
+	-10,
+	42,
+	24,
+	-40,
+	-40,
+	34,
+	56,
+	-22,
+	-69,
+	3,
+	79,
+	21,
+	-82,
+	-49,
+	77,
+	79,
+	-63,
+	-107,
+	38,
+	130,
+	-2,
+	-146,
+	-42,
+	150,
+	91,
+	-138,
+	-143,
+	110,
+	191,
+	-63,
+	-230,
+	0,
+	254,
+	77,
+	-257,
+	-162,
+	234,
+	250,
+	-183,
+	-330,
+	102,
+	394,
+	7,
+	-432,
+	-138,
+	435,
+	284,
+	-394,
+	-434,
+	306,
+	573,
+	-165,
+	-687,
+	-25,
+	760,
+	259,
+	-773,
+	-528,
+	711,
+	817,
+	-560,
+	-1107,
+	302,
+	1378,
+	76,
+	-1602,
+	-597,
+	1750,
+	1295,
+	-1777,
+	-2251,
+	1610,
+	3684,
+	-1070,
+	-6381,
+	-628,
+	16306,
+	29130,
+	24393,
+	7163,
+	-5330,
+	-4455,
+	2064,
+	3379,
+	-617,
+	-2643,
+	-198,
+	2030,
+	686,
+	-1485,
+	-962,
+	997,
+	1084,
+	-566,
+	-1090,
+	200,
+	1009,
+	96,
+	-865,
+	-320,
+	683,
+	472,
+	-483,
+	-555,
+	283,
+	577,
+	-98,
+	-547,
+	-62,
+	478,
+	187,
+	-382,
+	-275,
+	272,
+	323,
+	-158,
+	-337,
+	51,
+	320,
+	41,
+	-279,
+	-114,
+	222,
+	164,
+	-156,
+	-191,
+	89,
+	197,
+	-26,
+	-186,
+	-27,
+	160,
+	68,
+	-126,
+	-96,
+	87,
+	110,
+	-49,
+	-111,
+	13,
+	103,
+	17,
+	-88,
+	-38,
+	67,
+	53,
+	-46,
+	-59,
+	25,
+	58,
+	-6,
+	-53,
+	-9,
+	44,
+	20,
+	-33,
+	-26,
+	22,
+	28,
+	-11,
+	-27,
+	2,
+	24,
+	5,
+	-20,
+	-9,
+	15,
+	10,
+	-9,
+	-11,
+	4,
+	11,
+	-1,
+	-9,
+	-2,
+	7,
+	3,
+	-5,
+	-4,
+	3,
+	3,
+	-1,
+	-3,
+	0,
+	2,
+	1,
+	-2,
+	-1,
+	1,
+	1,
+	-1,
+	-1,
+	1,
+	0,
+	0,
+	0,
+	-1,
+	1,
+	1,
+	0,
+	-1,
+	-1,
+	2,
+	2,
+	-2,
+	-3,
+	2,
+	4,
+	-1,
+	-6,
+	0,
+	7,
+	3,
+	-8,
+	-6,
+	8,
+	10,
+	-7,
+	-13,
+	3,
+	17,
+	1,
+	-19,
+	-8,
+	21,
+	15,
+	-19,
+	-24,
+	15,
+	32,
+	-7,
+	-39,
+	-4,
+	44,
+	18,
+	-45,
+	-34,
+	40,
+	51,
+	-30,
+	-67,
+	13,
+	80,
+	9,
+	-87,
+	-37,
+	86,
+	68,
+	-76,
+	-99,
+	55,
+	126,
+	-22,
+	-148,
+	-20,
+	158,
+	70,
+	-154,
+	-124,
+	133,
+	177,
+	-93,
+	-224,
+	35,
+	258,
+	39,
+	-272,
+	-126,
+	262,
+	218,
+	-223,
+	-308,
+	153,
+	385,
+	-53,
+	-440,
+	-75,
+	463,
+	223,
+	-444,
+	-381,
+	376,
+	536,
+	-255,
+	-674,
+	80,
+	776,
+	147,
+	-826,
+	-418,
+	805,
+	721,
+	-696,
+	-1040,
+	480,
+	1356,
+	-138,
+	-1646,
+	-354,
+	1882,
+	1041,
+	-2031,
+	-2012,
+	2037,
+	3514,
+	-1778,
+	-6447,
+	724,
+	18089,
+	29530,
+	22979,
+	5427,
+	-5827,
+	-3838,
+	2535,
+	3116,
+	-1021,
+	-2559,
+	133,
+	2054,
+	426,
+	-1576,
+	-770,
+	1125,
+	956,
+	-712,
+	-1018,
+	346,
+	986,
+	-39,
+	-882,
+	-205,
+	730,
+	381,
+	-549,
+	-492,
+	359,
+	541,
+	-176,
+	-537,
+	12,
+	489,
+	123,
+	-410,
+	-223,
+	310,
+	288,
+	-203,
+	-317,
+	97,
+	314,
+	-2,
+	-286,
+	-76,
+	238,
+	135,
+	-179,
+	-172,
+	116,
+	186,
+	-53,
+	-183,
+	-2,
+	165,
+	47,
+	-136,
+	-79,
+	101,
+	98,
+	-64,
+	-105,
+	28,
+	101,
+	3,
+	-90,
+	-27,
+	73,
+	44,
+	-53,
+	-53,
+	32,
+	56,
+	-14,
+	-52,
+	-2,
+	45,
+	14,
+	-35,
+	-22,
+	25,
+	26,
+	-15,
+	-26,
+	6,
+	24,
+	1,
+	-20,
+	-6,
+	15,
+	9,
+	-10,
+	-11,
+	6,
+	10,
+	-2,
+	-9,
+	-1,
+	8,
+	2,
+	-5,
+	-3,
+	3,
+	3,
+	-1,
+	-3,
+	0,
+	3,
+	0,
+	-1,
+	-1,
+	1,
+	1,
+	-1,
+	-1,
+	1,
+	0,
+	0,
+	0,
+	-1,
+	0,
+	2,
+	0,
+	-2,
+	0,
+	2,
+	2,
+	-3,
+	-3,
+	3,
+	4,
+	-2,
+	-6,
+	1,
+	7,
+	1,
+	-8,
+	-5,
+	9,
+	8,
+	-8,
+	-12,
+	5,
+	17,
+	-1,
+	-20,
+	-5,
+	22,
+	13,
+	-22,
+	-21,
+	18,
+	31,
+	-12,
+	-39,
+	2,
+	45,
+	12,
+	-48,
+	-28,
+	46,
+	46,
+	-38,
+	-64,
+	24,
+	79,
+	-2,
+	-90,
+	-24,
+	93,
+	56,
+	-87,
+	-89,
+	70,
+	121,
+	-42,
+	-147,
+	2,
+	164,
+	47,
+	-167,
+	-103,
+	154,
+	160,
+	-121,
+	-214,
+	69,
+	257,
+	1,
+	-283,
+	-86,
+	285,
+	182,
+	-260,
+	-278,
+	202,
+	368,
+	-112,
+	-439,
+	-9,
+	481,
+	156,
+	-485,
+	-319,
+	440,
+	487,
+	-341,
+	-645,
+	184,
+	776,
+	31,
+	-862,
+	-298,
+	883,
+	609,
+	-819,
+	-950,
+	650,
+	1306,
+	-354,
+	-1656,
+	-100,
+	1979,
+	758,
+	-2249,
+	-1724,
+	2437,
+	3264,
+	-2485,
+	-6381,
+	2192,
+	19808,
+	29732,
+	21444,
+	3765,
+	-6176,
+	-3177,
+	2937,
+	2799,
+	-1392,
+	-2427,
+	454,
+	2037,
+	162,
+	-1633,
+	-566,
+	1229,
+	810,
+	-841,
+	-927,
+	483,
+	944,
+	-171,
+	-881,
+	-87,
+	761,
+	285,
+	-604,
+	-420,
+	428,
+	495,
+	-251,
+	-515,
+	85,
+	490,
+	57,
+	-429,
+	-169,
+	343,
+	247,
+	-243,
+	-291,
+	141,
+	303,
+	-45,
+	-287,
+	-38,
+	250,
+	103,
+	-199,
+	-147,
+	139,
+	172,
+	-79,
+	-177,
+	23,
+	166,
+	25,
+	-143,
+	-61,
+	112,
+	85,
+	-77,
+	-97,
+	42,
+	99,
+	-11,
+	-91,
+	-15,
+	77,
+	34,
+	-59,
+	-46,
+	40,
+	51,
+	-21,
+	-51,
+	5,
+	46,
+	8,
+	-38,
+	-17,
+	28,
+	22,
+	-18,
+	-24,
+	9,
+	24,
+	-2,
+	-20,
+	-4,
+	16,
+	8,
+	-12,
+	-9,
+	7,
+	10,
+	-3,
+	-10,
+	1,
+	7,
+	2,
+	-6,
+	-3,
+	4,
+	3,
+	-2,
+	-3,
+	1,
+	3,
+	0,
+	-2,
+	0,
+	1,
+	1,
+	-1,
+	-1,
+	1,
+	0
+
+};
+
+static const struct src_stage src_int16_10_21_4535_5000 = {
+	2, 1, 10, 232, 2320, 21, 10, 0, 1,
+	src_int16_10_21_4535_5000_fir};
+/** \endcond */
@@ -0,0 +1,2066 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_16_21_4535_5000_fir[2048] = {
+	1,
+	-1,
+	0,
+	2,
+	-3,
+	2,
+	2,
+	-6,
+	7,
+	-2,
+	-7,
+	13,
+	-10,
+	-2,
+	16,
+	-22,
+	12,
+	11,
+	-31,
+	32,
+	-7,
+	-30,
+	53,
+	-40,
+	-7,
+	59,
+	-77,
+	38,
+	38,
+	-101,
+	98,
+	-19,
+	-91,
+	152,
+	-109,
+	-25,
+	165,
+	-204,
+	94,
+	107,
+	-263,
+	247,
+	-40,
+	-234,
+	379,
+	-262,
+	-76,
+	419,
+	-507,
+	224,
+	287,
+	-683,
+	637,
+	-85,
+	-667,
+	1091,
+	-766,
+	-282,
+	1479,
+	-1938,
+	931,
+	1650,
+	-5156,
+	8629,
+	23785,
+	7164,
+	-5103,
+	2026,
+	568,
+	-1796,
+	1566,
+	-475,
+	-613,
+	1063,
+	-754,
+	38,
+	563,
+	-696,
+	363,
+	144,
+	-475,
+	448,
+	-137,
+	-213,
+	372,
+	-267,
+	6,
+	219,
+	-269,
+	137,
+	63,
+	-192,
+	177,
+	-50,
+	-89,
+	149,
+	-103,
+	-2,
+	88,
+	-104,
+	50,
+	26,
+	-72,
+	64,
+	-16,
+	-33,
+	52,
+	-34,
+	-2,
+	30,
+	-33,
+	15,
+	8,
+	-21,
+	17,
+	-4,
+	-9,
+	13,
+	-8,
+	0,
+	6,
+	-6,
+	3,
+	1,
+	-3,
+	2,
+	0,
+	-1,
+	1,
+	-1,
+	0,
+	2,
+	-4,
+	3,
+	1,
+	-5,
+	7,
+	-3,
+	-6,
+	13,
+	-12,
+	1,
+	14,
+	-23,
+	15,
+	7,
+	-30,
+	35,
+	-14,
+	-24,
+	52,
+	-46,
+	2,
+	53,
+	-79,
+	49,
+	26,
+	-96,
+	106,
+	-37,
+	-75,
+	151,
+	-126,
+	0,
+	149,
+	-212,
+	124,
+	74,
+	-251,
+	269,
+	-86,
+	-195,
+	378,
+	-306,
+	-13,
+	381,
+	-528,
+	300,
+	204,
+	-655,
+	698,
+	-208,
+	-565,
+	1095,
+	-905,
+	-79,
+	1361,
+	-2044,
+	1287,
+	1222,
+	-5103,
+	10108,
+	23624,
+	5731,
+	-4954,
+	2348,
+	205,
+	-1621,
+	1619,
+	-655,
+	-451,
+	1015,
+	-825,
+	158,
+	479,
+	-695,
+	431,
+	63,
+	-435,
+	468,
+	-195,
+	-161,
+	358,
+	-295,
+	51,
+	189,
+	-270,
+	165,
+	31,
+	-177,
+	186,
+	-74,
+	-68,
+	144,
+	-115,
+	17,
+	76,
+	-104,
+	61,
+	14,
+	-67,
+	68,
+	-25,
+	-25,
+	50,
+	-38,
+	4,
+	25,
+	-33,
+	18,
+	5,
+	-19,
+	18,
+	-6,
+	-7,
+	12,
+	-9,
+	1,
+	5,
+	-6,
+	3,
+	1,
+	-3,
+	2,
+	0,
+	-1,
+	1,
+	-1,
+	0,
+	2,
+	-4,
+	3,
+	0,
+	-5,
+	7,
+	-4,
+	-4,
+	12,
+	-13,
+	3,
+	13,
+	-23,
+	18,
+	3,
+	-28,
+	37,
+	-19,
+	-19,
+	51,
+	-51,
+	11,
+	46,
+	-80,
+	59,
+	12,
+	-89,
+	113,
+	-54,
+	-58,
+	147,
+	-141,
+	26,
+	130,
+	-215,
+	152,
+	39,
+	-234,
+	286,
+	-130,
+	-153,
+	370,
+	-345,
+	53,
+	334,
+	-539,
+	371,
+	115,
+	-614,
+	746,
+	-328,
+	-449,
+	1078,
+	-1029,
+	130,
+	1210,
+	-2109,
+	1627,
+	750,
+	-4940,
+	11585,
+	23304,
+	4341,
+	-4714,
+	2609,
+	-151,
+	-1419,
+	1638,
+	-819,
+	-282,
+	947,
+	-878,
+	274,
+	386,
+	-680,
+	490,
+	-20,
+	-385,
+	477,
+	-248,
+	-105,
+	336,
+	-315,
+	94,
+	155,
+	-266,
+	189,
+	-2,
+	-158,
+	191,
+	-96,
+	-46,
+	136,
+	-124,
+	35,
+	62,
+	-102,
+	70,
+	2,
+	-60,
+	70,
+	-34,
+	-17,
+	47,
+	-41,
+	10,
+	21,
+	-32,
+	21,
+	1,
+	-17,
+	19,
+	-9,
+	-4,
+	11,
+	-9,
+	2,
+	4,
+	-6,
+	4,
+	0,
+	-2,
+	2,
+	-1,
+	0,
+	1,
+	-2,
+	1,
+	1,
+	-3,
+	3,
+	0,
+	-5,
+	8,
+	-6,
+	-2,
+	11,
+	-14,
+	6,
+	10,
+	-23,
+	21,
+	-1,
+	-25,
+	38,
+	-25,
+	-12,
+	48,
+	-55,
+	20,
+	38,
+	-80,
+	69,
+	-2,
+	-80,
+	117,
+	-71,
+	-39,
+	140,
+	-153,
+	52,
+	108,
+	-214,
+	176,
+	3,
+	-212,
+	297,
+	-172,
+	-107,
+	354,
+	-376,
+	116,
+	281,
+	-539,
+	435,
+	24,
+	-560,
+	780,
+	-443,
+	-323,
+	1039,
+	-1134,
+	340,
+	1033,
+	-2135,
+	1947,
+	240,
+	-4660,
+	13045,
+	22828,
+	3012,
+	-4397,
+	2810,
+	-494,
+	-1192,
+	1624,
+	-963,
+	-110,
+	861,
+	-913,
+	383,
+	286,
+	-651,
+	537,
+	-100,
+	-329,
+	478,
+	-296,
+	-48,
+	308,
+	-330,
+	135,
+	117,
+	-256,
+	209,
+	-34,
+	-136,
+	192,
+	-115,
+	-24,
+	125,
+	-130,
+	50,
+	49,
+	-100,
+	78,
+	-10,
+	-52,
+	70,
+	-40,
+	-10,
+	44,
+	-44,
+	16,
+	16,
+	-31,
+	23,
+	-2,
+	-15,
+	19,
+	-10,
+	-3,
+	11,
+	-10,
+	3,
+	3,
+	-6,
+	4,
+	0,
+	-2,
+	2,
+	-1,
+	0,
+	1,
+	-2,
+	1,
+	1,
+	-3,
+	4,
+	-1,
+	-4,
+	8,
+	-7,
+	-1,
+	11,
+	-15,
+	9,
+	7,
+	-22,
+	23,
+	-6,
+	-21,
+	38,
+	-29,
+	-5,
+	44,
+	-58,
+	29,
+	29,
+	-77,
+	76,
+	-15,
+	-70,
+	119,
+	-86,
+	-19,
+	130,
+	-162,
+	76,
+	84,
+	-209,
+	198,
+	-34,
+	-185,
+	302,
+	-210,
+	-59,
+	331,
+	-401,
+	179,
+	221,
+	-528,
+	490,
+	-69,
+	-494,
+	798,
+	-551,
+	-188,
+	977,
+	-1216,
+	546,
+	830,
+	-2117,
+	2236,
+	-297,
+	-4264,
+	14471,
+	22203,
+	1753,
+	-4008,
+	2944,
+	-815,
+	-948,
+	1578,
+	-1085,
+	61,
+	759,
+	-929,
+	482,
+	183,
+	-610,
+	574,
+	-178,
+	-267,
+	469,
+	-338,
+	10,
+	274,
+	-338,
+	174,
+	77,
+	-241,
+	224,
+	-65,
+	-111,
+	188,
+	-132,
+	-1,
+	113,
+	-134,
+	66,
+	33,
+	-94,
+	84,
+	-22,
+	-43,
+	69,
+	-46,
+	-2,
+	40,
+	-45,
+	20,
+	12,
+	-30,
+	25,
+	-6,
+	-13,
+	19,
+	-12,
+	-1,
+	10,
+	-10,
+	4,
+	3,
+	-6,
+	5,
+	-1,
+	-2,
+	2,
+	-1,
+	0,
+	1,
+	-2,
+	2,
+	0,
+	-3,
+	4,
+	-2,
+	-3,
+	8,
+	-8,
+	1,
+	9,
+	-15,
+	10,
+	5,
+	-21,
+	25,
+	-10,
+	-17,
+	38,
+	-34,
+	2,
+	40,
+	-60,
+	38,
+	19,
+	-74,
+	83,
+	-30,
+	-57,
+	118,
+	-100,
+	1,
+	117,
+	-168,
+	100,
+	57,
+	-199,
+	215,
+	-70,
+	-154,
+	301,
+	-245,
+	-8,
+	300,
+	-417,
+	238,
+	156,
+	-505,
+	536,
+	-161,
+	-417,
+	800,
+	-649,
+	-48,
+	895,
+	-1276,
+	747,
+	605,
+	-2055,
+	2490,
+	-855,
+	-3745,
+	15846,
+	21436,
+	579,
+	-3563,
+	3016,
+	-1112,
+	-690,
+	1501,
+	-1183,
+	228,
+	643,
+	-926,
+	571,
+	76,
+	-556,
+	598,
+	-251,
+	-200,
+	450,
+	-371,
+	66,
+	235,
+	-338,
+	208,
+	37,
+	-221,
+	234,
+	-94,
+	-85,
+	182,
+	-146,
+	22,
+	97,
+	-134,
+	79,
+	18,
+	-87,
+	89,
+	-34,
+	-33,
+	66,
+	-51,
+	6,
+	34,
+	-45,
+	25,
+	6,
+	-27,
+	26,
+	-9,
+	-10,
+	18,
+	-13,
+	1,
+	8,
+	-10,
+	5,
+	1,
+	-5,
+	4,
+	-1,
+	-1,
+	2,
+	-1,
+	0,
+	1,
+	-2,
+	2,
+	0,
+	-3,
+	5,
+	-3,
+	-2,
+	8,
+	-9,
+	3,
+	8,
+	-16,
+	13,
+	1,
+	-19,
+	26,
+	-14,
+	-13,
+	37,
+	-38,
+	9,
+	34,
+	-60,
+	45,
+	10,
+	-69,
+	88,
+	-43,
+	-44,
+	115,
+	-111,
+	21,
+	103,
+	-172,
+	123,
+	29,
+	-186,
+	229,
+	-106,
+	-120,
+	294,
+	-276,
+	44,
+	263,
+	-425,
+	293,
+	87,
+	-473,
+	572,
+	-252,
+	-330,
+	785,
+	-735,
+	95,
+	793,
+	-1311,
+	936,
+	362,
+	-1948,
+	2701,
+	-1422,
+	-3107,
+	17155,
+	20536,
+	-503,
+	-3069,
+	3025,
+	-1377,
+	-425,
+	1395,
+	-1255,
+	387,
+	517,
+	-904,
+	646,
+	-30,
+	-493,
+	611,
+	-319,
+	-129,
+	422,
+	-398,
+	121,
+	191,
+	-332,
+	238,
+	-4,
+	-197,
+	240,
+	-122,
+	-57,
+	172,
+	-158,
+	45,
+	79,
+	-132,
+	91,
+	2,
+	-78,
+	91,
+	-44,
+	-23,
+	63,
+	-55,
+	14,
+	28,
+	-44,
+	28,
+	2,
+	-25,
+	27,
+	-12,
+	-7,
+	17,
+	-14,
+	3,
+	7,
+	-10,
+	6,
+	1,
+	-5,
+	5,
+	-2,
+	-1,
+	2,
+	-1,
+	0,
+	1,
+	-2,
+	2,
+	0,
+	-3,
+	5,
+	-4,
+	-1,
+	7,
+	-9,
+	4,
+	6,
+	-15,
+	14,
+	-1,
+	-17,
+	27,
+	-18,
+	-8,
+	35,
+	-40,
+	15,
+	28,
+	-60,
+	52,
+	-1,
+	-62,
+	91,
+	-56,
+	-30,
+	110,
+	-121,
+	42,
+	84,
+	-170,
+	141,
+	1,
+	-168,
+	238,
+	-139,
+	-83,
+	281,
+	-301,
+	95,
+	220,
+	-424,
+	343,
+	16,
+	-431,
+	598,
+	-339,
+	-235,
+	754,
+	-807,
+	240,
+	672,
+	-1319,
+	1109,
+	106,
+	-1798,
+	2863,
+	-1987,
+	-2352,
+	18383,
+	19514,
+	-1482,
+	-2540,
+	2973,
+	-1607,
+	-158,
+	1264,
+	-1301,
+	537,
+	381,
+	-864,
+	708,
+	-135,
+	-419,
+	610,
+	-379,
+	-57,
+	386,
+	-415,
+	173,
+	144,
+	-319,
+	262,
+	-44,
+	-169,
+	241,
+	-146,
+	-29,
+	158,
+	-165,
+	65,
+	61,
+	-128,
+	101,
+	-14,
+	-68,
+	92,
+	-54,
+	-12,
+	58,
+	-58,
+	21,
+	22,
+	-43,
+	33,
+	-4,
+	-21,
+	27,
+	-15,
+	-4,
+	16,
+	-15,
+	5,
+	5,
+	-10,
+	7,
+	-1,
+	-3,
+	4,
+	-2,
+	-1,
+	2,
+	-1,
+	0,
+	0,
+	-1,
+	2,
+	-1,
+	-2,
+	4,
+	-3,
+	-1,
+	7,
+	-10,
+	5,
+	5,
+	-15,
+	16,
+	-4,
+	-15,
+	27,
+	-21,
+	-4,
+	33,
+	-43,
+	22,
+	21,
+	-58,
+	58,
+	-12,
+	-54,
+	92,
+	-68,
+	-14,
+	101,
+	-128,
+	61,
+	65,
+	-165,
+	158,
+	-29,
+	-146,
+	241,
+	-169,
+	-44,
+	262,
+	-319,
+	144,
+	173,
+	-415,
+	386,
+	-57,
+	-379,
+	610,
+	-419,
+	-135,
+	708,
+	-864,
+	381,
+	537,
+	-1301,
+	1264,
+	-158,
+	-1607,
+	2973,
+	-2540,
+	-1482,
+	19514,
+	18383,
+	-2352,
+	-1987,
+	2863,
+	-1798,
+	106,
+	1109,
+	-1319,
+	672,
+	240,
+	-807,
+	754,
+	-235,
+	-339,
+	598,
+	-431,
+	16,
+	343,
+	-424,
+	220,
+	95,
+	-301,
+	281,
+	-83,
+	-139,
+	238,
+	-168,
+	1,
+	141,
+	-170,
+	84,
+	42,
+	-121,
+	110,
+	-30,
+	-56,
+	91,
+	-62,
+	-1,
+	52,
+	-60,
+	28,
+	15,
+	-40,
+	35,
+	-8,
+	-18,
+	27,
+	-17,
+	-1,
+	14,
+	-15,
+	6,
+	4,
+	-9,
+	7,
+	-1,
+	-4,
+	5,
+	-3,
+	0,
+	2,
+	-2,
+	1,
+	0,
+	-1,
+	2,
+	-1,
+	-2,
+	5,
+	-5,
+	1,
+	6,
+	-10,
+	7,
+	3,
+	-14,
+	17,
+	-7,
+	-12,
+	27,
+	-25,
+	2,
+	28,
+	-44,
+	28,
+	14,
+	-55,
+	63,
+	-23,
+	-44,
+	91,
+	-78,
+	2,
+	91,
+	-132,
+	79,
+	45,
+	-158,
+	172,
+	-57,
+	-122,
+	240,
+	-197,
+	-4,
+	238,
+	-332,
+	191,
+	121,
+	-398,
+	422,
+	-129,
+	-319,
+	611,
+	-493,
+	-30,
+	646,
+	-904,
+	517,
+	387,
+	-1255,
+	1395,
+	-425,
+	-1377,
+	3025,
+	-3069,
+	-503,
+	20536,
+	17155,
+	-3107,
+	-1422,
+	2701,
+	-1948,
+	362,
+	936,
+	-1311,
+	793,
+	95,
+	-735,
+	785,
+	-330,
+	-252,
+	572,
+	-473,
+	87,
+	293,
+	-425,
+	263,
+	44,
+	-276,
+	294,
+	-120,
+	-106,
+	229,
+	-186,
+	29,
+	123,
+	-172,
+	103,
+	21,
+	-111,
+	115,
+	-44,
+	-43,
+	88,
+	-69,
+	10,
+	45,
+	-60,
+	34,
+	9,
+	-38,
+	37,
+	-13,
+	-14,
+	26,
+	-19,
+	1,
+	13,
+	-16,
+	8,
+	3,
+	-9,
+	8,
+	-2,
+	-3,
+	5,
+	-3,
+	0,
+	2,
+	-2,
+	1,
+	0,
+	-1,
+	2,
+	-1,
+	-1,
+	4,
+	-5,
+	1,
+	5,
+	-10,
+	8,
+	1,
+	-13,
+	18,
+	-10,
+	-9,
+	26,
+	-27,
+	6,
+	25,
+	-45,
+	34,
+	6,
+	-51,
+	66,
+	-33,
+	-34,
+	89,
+	-87,
+	18,
+	79,
+	-134,
+	97,
+	22,
+	-146,
+	182,
+	-85,
+	-94,
+	234,
+	-221,
+	37,
+	208,
+	-338,
+	235,
+	66,
+	-371,
+	450,
+	-200,
+	-251,
+	598,
+	-556,
+	76,
+	571,
+	-926,
+	643,
+	228,
+	-1183,
+	1501,
+	-690,
+	-1112,
+	3016,
+	-3563,
+	579,
+	21436,
+	15846,
+	-3745,
+	-855,
+	2490,
+	-2055,
+	605,
+	747,
+	-1276,
+	895,
+	-48,
+	-649,
+	800,
+	-417,
+	-161,
+	536,
+	-505,
+	156,
+	238,
+	-417,
+	300,
+	-8,
+	-245,
+	301,
+	-154,
+	-70,
+	215,
+	-199,
+	57,
+	100,
+	-168,
+	117,
+	1,
+	-100,
+	118,
+	-57,
+	-30,
+	83,
+	-74,
+	19,
+	38,
+	-60,
+	40,
+	2,
+	-34,
+	38,
+	-17,
+	-10,
+	25,
+	-21,
+	5,
+	10,
+	-15,
+	9,
+	1,
+	-8,
+	8,
+	-3,
+	-2,
+	4,
+	-3,
+	0,
+	2,
+	-2,
+	1,
+	0,
+	-1,
+	2,
+	-2,
+	-1,
+	5,
+	-6,
+	3,
+	4,
+	-10,
+	10,
+	-1,
+	-12,
+	19,
+	-13,
+	-6,
+	25,
+	-30,
+	12,
+	20,
+	-45,
+	40,
+	-2,
+	-46,
+	69,
+	-43,
+	-22,
+	84,
+	-94,
+	33,
+	66,
+	-134,
+	113,
+	-1,
+	-132,
+	188,
+	-111,
+	-65,
+	224,
+	-241,
+	77,
+	174,
+	-338,
+	274,
+	10,
+	-338,
+	469,
+	-267,
+	-178,
+	574,
+	-610,
+	183,
+	482,
+	-929,
+	759,
+	61,
+	-1085,
+	1578,
+	-948,
+	-815,
+	2944,
+	-4008,
+	1753,
+	22203,
+	14471,
+	-4264,
+	-297,
+	2236,
+	-2117,
+	830,
+	546,
+	-1216,
+	977,
+	-188,
+	-551,
+	798,
+	-494,
+	-69,
+	490,
+	-528,
+	221,
+	179,
+	-401,
+	331,
+	-59,
+	-210,
+	302,
+	-185,
+	-34,
+	198,
+	-209,
+	84,
+	76,
+	-162,
+	130,
+	-19,
+	-86,
+	119,
+	-70,
+	-15,
+	76,
+	-77,
+	29,
+	29,
+	-58,
+	44,
+	-5,
+	-29,
+	38,
+	-21,
+	-6,
+	23,
+	-22,
+	7,
+	9,
+	-15,
+	11,
+	-1,
+	-7,
+	8,
+	-4,
+	-1,
+	4,
+	-3,
+	1,
+	1,
+	-2,
+	1,
+	0,
+	-1,
+	2,
+	-2,
+	0,
+	4,
+	-6,
+	3,
+	3,
+	-10,
+	11,
+	-3,
+	-10,
+	19,
+	-15,
+	-2,
+	23,
+	-31,
+	16,
+	16,
+	-44,
+	44,
+	-10,
+	-40,
+	70,
+	-52,
+	-10,
+	78,
+	-100,
+	49,
+	50,
+	-130,
+	125,
+	-24,
+	-115,
+	192,
+	-136,
+	-34,
+	209,
+	-256,
+	117,
+	135,
+	-330,
+	308,
+	-48,
+	-296,
+	478,
+	-329,
+	-100,
+	537,
+	-651,
+	286,
+	383,
+	-913,
+	861,
+	-110,
+	-963,
+	1624,
+	-1192,
+	-494,
+	2810,
+	-4397,
+	3012,
+	22828,
+	13045,
+	-4660,
+	240,
+	1947,
+	-2135,
+	1033,
+	340,
+	-1134,
+	1039,
+	-323,
+	-443,
+	780,
+	-560,
+	24,
+	435,
+	-539,
+	281,
+	116,
+	-376,
+	354,
+	-107,
+	-172,
+	297,
+	-212,
+	3,
+	176,
+	-214,
+	108,
+	52,
+	-153,
+	140,
+	-39,
+	-71,
+	117,
+	-80,
+	-2,
+	69,
+	-80,
+	38,
+	20,
+	-55,
+	48,
+	-12,
+	-25,
+	38,
+	-25,
+	-1,
+	21,
+	-23,
+	10,
+	6,
+	-14,
+	11,
+	-2,
+	-6,
+	8,
+	-5,
+	0,
+	3,
+	-3,
+	1,
+	1,
+	-2,
+	1,
+	0,
+	-1,
+	2,
+	-2,
+	0,
+	4,
+	-6,
+	4,
+	2,
+	-9,
+	11,
+	-4,
+	-9,
+	19,
+	-17,
+	1,
+	21,
+	-32,
+	21,
+	10,
+	-41,
+	47,
+	-17,
+	-34,
+	70,
+	-60,
+	2,
+	70,
+	-102,
+	62,
+	35,
+	-124,
+	136,
+	-46,
+	-96,
+	191,
+	-158,
+	-2,
+	189,
+	-266,
+	155,
+	94,
+	-315,
+	336,
+	-105,
+	-248,
+	477,
+	-385,
+	-20,
+	490,
+	-680,
+	386,
+	274,
+	-878,
+	947,
+	-282,
+	-819,
+	1638,
+	-1419,
+	-151,
+	2609,
+	-4714,
+	4341,
+	23304,
+	11585,
+	-4940,
+	750,
+	1627,
+	-2109,
+	1210,
+	130,
+	-1029,
+	1078,
+	-449,
+	-328,
+	746,
+	-614,
+	115,
+	371,
+	-539,
+	334,
+	53,
+	-345,
+	370,
+	-153,
+	-130,
+	286,
+	-234,
+	39,
+	152,
+	-215,
+	130,
+	26,
+	-141,
+	147,
+	-58,
+	-54,
+	113,
+	-89,
+	12,
+	59,
+	-80,
+	46,
+	11,
+	-51,
+	51,
+	-19,
+	-19,
+	37,
+	-28,
+	3,
+	18,
+	-23,
+	13,
+	3,
+	-13,
+	12,
+	-4,
+	-4,
+	7,
+	-5,
+	0,
+	3,
+	-4,
+	2,
+	0,
+	-1,
+	1,
+	-1,
+	0,
+	2,
+	-3,
+	1,
+	3,
+	-6,
+	5,
+	1,
+	-9,
+	12,
+	-7,
+	-6,
+	18,
+	-19,
+	5,
+	18,
+	-33,
+	25,
+	4,
+	-38,
+	50,
+	-25,
+	-25,
+	68,
+	-67,
+	14,
+	61,
+	-104,
+	76,
+	17,
+	-115,
+	144,
+	-68,
+	-74,
+	186,
+	-177,
+	31,
+	165,
+	-270,
+	189,
+	51,
+	-295,
+	358,
+	-161,
+	-195,
+	468,
+	-435,
+	63,
+	431,
+	-695,
+	479,
+	158,
+	-825,
+	1015,
+	-451,
+	-655,
+	1619,
+	-1621,
+	205,
+	2348,
+	-4954,
+	5731,
+	23624,
+	10108,
+	-5103,
+	1222,
+	1287,
+	-2044,
+	1361,
+	-79,
+	-905,
+	1095,
+	-565,
+	-208,
+	698,
+	-655,
+	204,
+	300,
+	-528,
+	381,
+	-13,
+	-306,
+	378,
+	-195,
+	-86,
+	269,
+	-251,
+	74,
+	124,
+	-212,
+	149,
+	0,
+	-126,
+	151,
+	-75,
+	-37,
+	106,
+	-96,
+	26,
+	49,
+	-79,
+	53,
+	2,
+	-46,
+	52,
+	-24,
+	-14,
+	35,
+	-30,
+	7,
+	15,
+	-23,
+	14,
+	1,
+	-12,
+	13,
+	-6,
+	-3,
+	7,
+	-5,
+	1,
+	3,
+	-4,
+	2,
+	0,
+	-1,
+	1,
+	-1,
+	0,
+	2,
+	-3,
+	1,
+	3,
+	-6,
+	6,
+	0,
+	-8,
+	13,
+	-9,
+	-4,
+	17,
+	-21,
+	8,
+	15,
+	-33,
+	30,
+	-2,
+	-34,
+	52,
+	-33,
+	-16,
+	64,
+	-72,
+	26,
+	50,
+	-104,
+	88,
+	-2,
+	-103,
+	149,
+	-89,
+	-50,
+	177,
+	-192,
+	63,
+	137,
+	-269,
+	219,
+	6,
+	-267,
+	372,
+	-213,
+	-137,
+	448,
+	-475,
+	144,
+	363,
+	-696,
+	563,
+	38,
+	-754,
+	1063,
+	-613,
+	-475,
+	1566,
+	-1796,
+	568,
+	2026,
+	-5103,
+	7164,
+	23785,
+	8629,
+	-5156,
+	1650,
+	931,
+	-1938,
+	1479,
+	-282,
+	-766,
+	1091,
+	-667,
+	-85,
+	637,
+	-683,
+	287,
+	224,
+	-507,
+	419,
+	-76,
+	-262,
+	379,
+	-234,
+	-40,
+	247,
+	-263,
+	107,
+	94,
+	-204,
+	165,
+	-25,
+	-109,
+	152,
+	-91,
+	-19,
+	98,
+	-101,
+	38,
+	38,
+	-77,
+	59,
+	-7,
+	-40,
+	53,
+	-30,
+	-7,
+	32,
+	-31,
+	11,
+	12,
+	-22,
+	16,
+	-2,
+	-10,
+	13,
+	-7,
+	-2,
+	7,
+	-6,
+	2,
+	2,
+	-3,
+	2,
+	0,
+	-1,
+	1
+
+};
+
+static const struct src_stage src_int16_16_21_4535_5000 = {
+	17, 13, 16, 128, 2048, 21, 16, 0, 0,
+	src_int16_16_21_4535_5000_fir};
+/** \endcond */
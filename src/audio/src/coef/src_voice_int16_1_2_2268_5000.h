@@ -0,0 +1,54 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_1_2_2268_5000_fir[36] = {
+	16,
+	-1,
+	-75,
+	-106,
+	65,
+	332,
+	257,
+	-369,
+	-913,
+	-342,
+	1252,
+	1974,
+	-13,
+	-3517,
+	-4026,
+	2239,
+	13498,
+	22497,
+	22497,
+	13498,
+	2239,
+	-4026,
+	-3517,
+	-13,
+	1974,
+	1251,
+	-341,
+	-913,
+	-370,
+	257,
+	332,
+	65,
+	-106,
+	-75,
+	-1,
+	16
+
+};
+
+static const struct src_stage src_int16_1_2_2268_5000 = {
+	1, 0, 1, 36, 36, 2, 1, 0, 1,
+	src_int16_1_2_2268_5000_fir};
+/** \endcond */
@@ -0,0 +1,210 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_1_2_4535_5000_fir[192] = {
+	-3,
+	-1,
+	5,
+	1,
+	-6,
+	-3,
+	7,
+	6,
+	-9,
+	-8,
+	9,
+	12,
+	-10,
+	-16,
+	9,
+	22,
+	-8,
+	-27,
+	6,
+	32,
+	-1,
+	-38,
+	-5,
+	44,
+	13,
+	-49,
+	-23,
+	53,
+	35,
+	-56,
+	-48,
+	56,
+	64,
+	-54,
+	-80,
+	48,
+	99,
+	-39,
+	-118,
+	26,
+	136,
+	-8,
+	-154,
+	-15,
+	170,
+	43,
+	-183,
+	-76,
+	192,
+	114,
+	-196,
+	-157,
+	193,
+	204,
+	-183,
+	-254,
+	163,
+	307,
+	-134,
+	-360,
+	93,
+	413,
+	-39,
+	-464,
+	-27,
+	510,
+	109,
+	-550,
+	-205,
+	580,
+	318,
+	-598,
+	-448,
+	601,
+	597,
+	-585,
+	-766,
+	545,
+	957,
+	-473,
+	-1179,
+	366,
+	1433,
+	-202,
+	-1741,
+	-36,
+	2128,
+	394,
+	-2658,
+	-969,
+	3485,
+	2033,
+	-5124,
+	-4723,
+	10843,
+	28404,
+	28405,
+	10843,
+	-4723,
+	-5124,
+	2033,
+	3485,
+	-969,
+	-2658,
+	394,
+	2128,
+	-36,
+	-1741,
+	-202,
+	1433,
+	365,
+	-1178,
+	-474,
+	958,
+	545,
+	-766,
+	-585,
+	597,
+	602,
+	-449,
+	-598,
+	318,
+	580,
+	-205,
+	-550,
+	109,
+	510,
+	-27,
+	-464,
+	-40,
+	414,
+	93,
+	-361,
+	-134,
+	307,
+	164,
+	-255,
+	-183,
+	205,
+	193,
+	-158,
+	-195,
+	115,
+	191,
+	-76,
+	-183,
+	43,
+	170,
+	-15,
+	-154,
+	-8,
+	136,
+	26,
+	-118,
+	-39,
+	99,
+	48,
+	-80,
+	-54,
+	64,
+	56,
+	-48,
+	-56,
+	35,
+	53,
+	-23,
+	-49,
+	13,
+	44,
+	-5,
+	-38,
+	-1,
+	33,
+	5,
+	-27,
+	-7,
+	21,
+	9,
+	-16,
+	-10,
+	12,
+	9,
+	-8,
+	-9,
+	6,
+	7,
+	-3,
+	-6,
+	1,
+	5,
+	-1,
+	-3
+
+};
+
+static const struct src_stage src_int16_1_2_4535_5000 = {
+	1, 0, 1, 192, 192, 2, 1, 0, 1,
+	src_int16_1_2_4535_5000_fir};
+/** \endcond */
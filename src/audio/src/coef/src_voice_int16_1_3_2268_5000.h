@@ -0,0 +1,70 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_1_3_2268_5000_fir[52] = {
+	13,
+	-9,
+	-63,
+	-117,
+	-105,
+	25,
+	246,
+	426,
+	378,
+	-6,
+	-618,
+	-1103,
+	-1022,
+	-147,
+	1261,
+	2432,
+	2411,
+	665,
+	-2380,
+	-5216,
+	-5770,
+	-2379,
+	5208,
+	15374,
+	25062,
+	30969,
+	30970,
+	25062,
+	15374,
+	5208,
+	-2379,
+	-5770,
+	-5216,
+	-2380,
+	665,
+	2411,
+	2432,
+	1261,
+	-147,
+	-1022,
+	-1103,
+	-618,
+	-6,
+	378,
+	426,
+	246,
+	25,
+	-105,
+	-117,
+	-63,
+	-9,
+	13
+
+};
+
+static const struct src_stage src_int16_1_3_2268_5000 = {
+	1, 0, 1, 52, 52, 3, 1, 0, 2,
+	src_int16_1_3_2268_5000_fir};
+/** \endcond */
@@ -0,0 +1,278 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_1_3_4535_5000_fir[260] = {
+	-1,
+	1,
+	3,
+	2,
+	-1,
+	-4,
+	-4,
+	1,
+	6,
+	6,
+	-1,
+	-7,
+	-8,
+	-1,
+	8,
+	11,
+	3,
+	-9,
+	-14,
+	-6,
+	10,
+	18,
+	9,
+	-9,
+	-21,
+	-15,
+	8,
+	25,
+	20,
+	-5,
+	-29,
+	-27,
+	1,
+	31,
+	35,
+	5,
+	-34,
+	-43,
+	-12,
+	34,
+	52,
+	22,
+	-33,
+	-61,
+	-33,
+	29,
+	70,
+	47,
+	-23,
+	-78,
+	-63,
+	14,
+	84,
+	81,
+	-1,
+	-89,
+	-99,
+	-15,
+	90,
+	119,
+	36,
+	-89,
+	-138,
+	-60,
+	82,
+	157,
+	89,
+	-70,
+	-175,
+	-121,
+	52,
+	190,
+	157,
+	-28,
+	-201,
+	-196,
+	-4,
+	208,
+	237,
+	43,
+	-207,
+	-280,
+	-90,
+	199,
+	322,
+	147,
+	-182,
+	-363,
+	-212,
+	153,
+	401,
+	287,
+	-111,
+	-435,
+	-371,
+	54,
+	463,
+	464,
+	21,
+	-481,
+	-567,
+	-117,
+	488,
+	680,
+	238,
+	-479,
+	-806,
+	-391,
+	449,
+	949,
+	585,
+	-392,
+	-1112,
+	-840,
+	296,
+	1310,
+	1188,
+	-138,
+	-1569,
+	-1702,
+	-132,
+	1955,
+	2574,
+	655,
+	-2684,
+	-4510,
+	-2058,
+	5014,
+	13864,
+	19974,
+	19973,
+	13864,
+	5014,
+	-2058,
+	-4510,
+	-2684,
+	655,
+	2574,
+	1955,
+	-132,
+	-1702,
+	-1569,
+	-138,
+	1188,
+	1310,
+	296,
+	-840,
+	-1112,
+	-392,
+	585,
+	949,
+	449,
+	-390,
+	-807,
+	-479,
+	238,
+	681,
+	488,
+	-117,
+	-567,
+	-481,
+	21,
+	464,
+	463,
+	54,
+	-371,
+	-435,
+	-111,
+	287,
+	401,
+	153,
+	-212,
+	-363,
+	-182,
+	147,
+	322,
+	199,
+	-90,
+	-280,
+	-207,
+	43,
+	237,
+	208,
+	-4,
+	-196,
+	-201,
+	-28,
+	157,
+	189,
+	53,
+	-121,
+	-175,
+	-70,
+	89,
+	157,
+	82,
+	-60,
+	-138,
+	-89,
+	36,
+	119,
+	90,
+	-15,
+	-99,
+	-89,
+	-1,
+	80,
+	84,
+	14,
+	-63,
+	-78,
+	-23,
+	47,
+	70,
+	29,
+	-33,
+	-61,
+	-33,
+	22,
+	52,
+	34,
+	-12,
+	-43,
+	-34,
+	5,
+	35,
+	31,
+	1,
+	-26,
+	-29,
+	-5,
+	20,
+	25,
+	8,
+	-15,
+	-21,
+	-9,
+	9,
+	18,
+	10,
+	-6,
+	-14,
+	-9,
+	3,
+	11,
+	8,
+	-1,
+	-8,
+	-7,
+	-1,
+	6,
+	6,
+	1,
+	-4,
+	-4,
+	-1,
+	2,
+	3,
+	1,
+	-1
+
+};
+
+static const struct src_stage src_int16_1_3_4535_5000 = {
+	1, 0, 1, 260, 260, 3, 1, 0, 1,
+	src_int16_1_3_4535_5000_fir};
+/** \endcond */
@@ -0,0 +1,66 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_2_1_2268_5000_fir[48] = {
+	3,
+	-9,
+	-13,
+	103,
+	-211,
+	123,
+	388,
+	-1179,
+	1453,
+	-14,
+	-4148,
+	13569,
+	22506,
+	2273,
+	-3699,
+	2202,
+	-416,
+	-513,
+	555,
+	-237,
+	-2,
+	58,
+	-29,
+	4,
+	4,
+	-29,
+	58,
+	-2,
+	-237,
+	555,
+	-513,
+	-416,
+	2202,
+	-3699,
+	2273,
+	22506,
+	13569,
+	-4148,
+	-14,
+	1453,
+	-1179,
+	388,
+	123,
+	-211,
+	103,
+	-13,
+	-9,
+	3
+
+};
+
+static const struct src_stage src_int16_2_1_2268_5000 = {
+	0, 1, 2, 24, 48, 1, 2, 0, 0,
+	src_int16_2_1_2268_5000_fir};
+/** \endcond */
@@ -0,0 +1,258 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_2_1_4535_5000_fir[240] = {
+	0,
+	0,
+	0,
+	1,
+	-1,
+	2,
+	-3,
+	4,
+	-6,
+	7,
+	-9,
+	11,
+	-13,
+	15,
+	-17,
+	18,
+	-19,
+	19,
+	-18,
+	16,
+	-13,
+	8,
+	-1,
+	-8,
+	19,
+	-32,
+	47,
+	-64,
+	82,
+	-102,
+	122,
+	-142,
+	162,
+	-180,
+	196,
+	-208,
+	216,
+	-218,
+	212,
+	-199,
+	176,
+	-143,
+	99,
+	-42,
+	-29,
+	113,
+	-213,
+	328,
+	-460,
+	610,
+	-779,
+	971,
+	-1190,
+	1445,
+	-1751,
+	2137,
+	-2665,
+	3490,
+	-5127,
+	10844,
+	28403,
+	-4723,
+	2034,
+	-971,
+	395,
+	-36,
+	-204,
+	368,
+	-480,
+	553,
+	-596,
+	615,
+	-615,
+	599,
+	-570,
+	532,
+	-487,
+	437,
+	-384,
+	330,
+	-276,
+	223,
+	-174,
+	128,
+	-86,
+	49,
+	-18,
+	-9,
+	31,
+	-48,
+	60,
+	-68,
+	73,
+	-74,
+	73,
+	-69,
+	64,
+	-58,
+	51,
+	-44,
+	37,
+	-30,
+	24,
+	-18,
+	13,
+	-9,
+	5,
+	-2,
+	0,
+	1,
+	-2,
+	3,
+	-3,
+	3,
+	-3,
+	2,
+	-2,
+	2,
+	-1,
+	1,
+	1,
+	-1,
+	2,
+	-2,
+	2,
+	-3,
+	3,
+	-3,
+	3,
+	-2,
+	1,
+	0,
+	-2,
+	5,
+	-9,
+	13,
+	-18,
+	24,
+	-30,
+	37,
+	-44,
+	51,
+	-58,
+	64,
+	-69,
+	73,
+	-74,
+	73,
+	-68,
+	60,
+	-48,
+	31,
+	-9,
+	-18,
+	49,
+	-86,
+	128,
+	-174,
+	223,
+	-276,
+	330,
+	-384,
+	437,
+	-487,
+	532,
+	-570,
+	599,
+	-615,
+	615,
+	-596,
+	553,
+	-480,
+	368,
+	-204,
+	-36,
+	395,
+	-971,
+	2034,
+	-4723,
+	28403,
+	10844,
+	-5127,
+	3490,
+	-2665,
+	2137,
+	-1751,
+	1445,
+	-1190,
+	971,
+	-779,
+	610,
+	-460,
+	328,
+	-213,
+	113,
+	-29,
+	-42,
+	99,
+	-143,
+	176,
+	-199,
+	212,
+	-218,
+	216,
+	-208,
+	196,
+	-180,
+	162,
+	-142,
+	122,
+	-102,
+	82,
+	-64,
+	47,
+	-32,
+	19,
+	-8,
+	-1,
+	8,
+	-13,
+	16,
+	-18,
+	19,
+	-19,
+	18,
+	-17,
+	15,
+	-13,
+	11,
+	-9,
+	7,
+	-6,
+	4,
+	-3,
+	2,
+	-1,
+	1,
+	0,
+	0,
+	0
+
+};
+
+static const struct src_stage src_int16_2_1_4535_5000 = {
+	0, 1, 2, 120, 240, 1, 2, 0, 0,
+	src_int16_2_1_4535_5000_fir};
+/** \endcond */
@@ -0,0 +1,282 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_2_3_4535_5000_fir[264] = {
+	-1,
+	-2,
+	4,
+	-2,
+	-4,
+	6,
+	0,
+	-9,
+	9,
+	4,
+	-16,
+	11,
+	10,
+	-23,
+	8,
+	22,
+	-31,
+	1,
+	37,
+	-35,
+	-13,
+	55,
+	-34,
+	-35,
+	73,
+	-24,
+	-65,
+	87,
+	-1,
+	-102,
+	93,
+	37,
+	-142,
+	84,
+	91,
+	-179,
+	54,
+	160,
+	-205,
+	-3,
+	240,
+	-210,
+	-92,
+	326,
+	-184,
+	-214,
+	405,
+	-113,
+	-372,
+	465,
+	21,
+	-569,
+	489,
+	239,
+	-809,
+	450,
+	587,
+	-1114,
+	296,
+	1189,
+	-1570,
+	-132,
+	2575,
+	-2685,
+	-2058,
+	13866,
+	19976,
+	5014,
+	-4511,
+	656,
+	1956,
+	-1703,
+	-138,
+	1311,
+	-841,
+	-393,
+	951,
+	-392,
+	-480,
+	683,
+	-117,
+	-483,
+	466,
+	54,
+	-438,
+	289,
+	154,
+	-366,
+	148,
+	202,
+	-283,
+	43,
+	211,
+	-199,
+	-29,
+	194,
+	-124,
+	-72,
+	161,
+	-62,
+	-91,
+	122,
+	-16,
+	-92,
+	84,
+	14,
+	-81,
+	50,
+	30,
+	-64,
+	23,
+	36,
+	-46,
+	6,
+	33,
+	-29,
+	-5,
+	26,
+	-15,
+	-10,
+	19,
+	-6,
+	-10,
+	12,
+	-1,
+	-8,
+	6,
+	1,
+	-5,
+	2,
+	2,
+	-3,
+	-3,
+	2,
+	2,
+	-5,
+	1,
+	6,
+	-8,
+	-1,
+	12,
+	-10,
+	-6,
+	19,
+	-10,
+	-15,
+	26,
+	-5,
+	-29,
+	33,
+	6,
+	-46,
+	36,
+	23,
+	-64,
+	30,
+	50,
+	-81,
+	14,
+	84,
+	-92,
+	-16,
+	122,
+	-91,
+	-62,
+	161,
+	-72,
+	-124,
+	194,
+	-29,
+	-199,
+	211,
+	43,
+	-283,
+	202,
+	148,
+	-366,
+	154,
+	289,
+	-438,
+	54,
+	466,
+	-483,
+	-117,
+	683,
+	-480,
+	-392,
+	951,
+	-393,
+	-841,
+	1311,
+	-138,
+	-1703,
+	1956,
+	656,
+	-4511,
+	5014,
+	19976,
+	13866,
+	-2058,
+	-2685,
+	2575,
+	-132,
+	-1570,
+	1189,
+	296,
+	-1114,
+	587,
+	450,
+	-809,
+	239,
+	489,
+	-569,
+	21,
+	465,
+	-372,
+	-113,
+	405,
+	-214,
+	-184,
+	326,
+	-92,
+	-210,
+	240,
+	-3,
+	-205,
+	160,
+	54,
+	-179,
+	91,
+	84,
+	-142,
+	37,
+	93,
+	-102,
+	-1,
+	87,
+	-65,
+	-24,
+	73,
+	-35,
+	-34,
+	55,
+	-13,
+	-35,
+	37,
+	1,
+	-31,
+	22,
+	8,
+	-23,
+	10,
+	11,
+	-16,
+	4,
+	9,
+	-9,
+	0,
+	6,
+	-4,
+	-2,
+	4,
+	-2,
+	-1
+
+};
+
+static const struct src_stage src_int16_2_3_4535_5000 = {
+	1, 1, 2, 132, 264, 3, 2, 0, 0,
+	src_int16_2_3_4535_5000_fir};
+/** \endcond */
@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_3_1_2268_5000_fir[72] = {
+	2,
+	-5,
+	-20,
+	103,
+	-179,
+	43,
+	474,
+	-1141,
+	1143,
+	550,
+	-4502,
+	11620,
+	23228,
+	3968,
+	-4138,
+	2047,
+	-138,
+	-676,
+	581,
+	-201,
+	-35,
+	71,
+	-30,
+	3,
+	4,
+	-20,
+	18,
+	72,
+	-266,
+	370,
+	-7,
+	-1006,
+	2128,
+	-1924,
+	-1831,
+	18845,
+	18845,
+	-1831,
+	-1924,
+	2128,
+	-1006,
+	-7,
+	370,
+	-266,
+	72,
+	18,
+	-20,
+	4,
+	3,
+	-30,
+	71,
+	-35,
+	-201,
+	581,
+	-676,
+	-138,
+	2047,
+	-4138,
+	3968,
+	23228,
+	11620,
+	-4502,
+	550,
+	1143,
+	-1141,
+	474,
+	43,
+	-179,
+	103,
+	-20,
+	-5,
+	2
+
+};
+
+static const struct src_stage src_int16_3_1_2268_5000 = {
+	0, 1, 3, 24, 72, 1, 3, 0, 0,
+	src_int16_3_1_2268_5000_fir};
+/** \endcond */
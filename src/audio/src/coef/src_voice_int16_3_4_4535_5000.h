@@ -0,0 +1,378 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_3_4_4535_5000_fir[360] = {
+	1,
+	1,
+	-3,
+	4,
+	-1,
+	-5,
+	9,
+	-7,
+	-3,
+	13,
+	-16,
+	5,
+	14,
+	-26,
+	19,
+	7,
+	-35,
+	40,
+	-13,
+	-33,
+	62,
+	-45,
+	-13,
+	74,
+	-86,
+	28,
+	65,
+	-124,
+	92,
+	23,
+	-141,
+	165,
+	-57,
+	-118,
+	229,
+	-172,
+	-37,
+	253,
+	-300,
+	109,
+	207,
+	-411,
+	315,
+	58,
+	-455,
+	553,
+	-213,
+	-376,
+	781,
+	-624,
+	-99,
+	930,
+	-1202,
+	512,
+	893,
+	-2098,
+	1952,
+	301,
+	-4703,
+	11945,
+	22888,
+	4441,
+	-4738,
+	2414,
+	157,
+	-1617,
+	1575,
+	-535,
+	-581,
+	1046,
+	-708,
+	-38,
+	613,
+	-663,
+	249,
+	265,
+	-511,
+	364,
+	11,
+	-319,
+	357,
+	-141,
+	-140,
+	281,
+	-205,
+	-2,
+	175,
+	-200,
+	82,
+	74,
+	-153,
+	113,
+	-1,
+	-93,
+	107,
+	-45,
+	-37,
+	79,
+	-59,
+	2,
+	45,
+	-52,
+	22,
+	17,
+	-36,
+	27,
+	-1,
+	-19,
+	22,
+	-10,
+	-6,
+	13,
+	-10,
+	1,
+	6,
+	-7,
+	3,
+	1,
+	-3,
+	2,
+	2,
+	-1,
+	-2,
+	5,
+	-5,
+	0,
+	7,
+	-11,
+	7,
+	5,
+	-17,
+	17,
+	-2,
+	-20,
+	32,
+	-19,
+	-13,
+	43,
+	-43,
+	7,
+	44,
+	-70,
+	42,
+	28,
+	-90,
+	91,
+	-16,
+	-88,
+	139,
+	-85,
+	-50,
+	170,
+	-172,
+	33,
+	159,
+	-256,
+	160,
+	85,
+	-305,
+	314,
+	-67,
+	-281,
+	462,
+	-297,
+	-145,
+	555,
+	-588,
+	139,
+	527,
+	-908,
+	616,
+	283,
+	-1208,
+	1385,
+	-385,
+	-1443,
+	2950,
+	-2566,
+	-1572,
+	18803,
+	18802,
+	-1572,
+	-2566,
+	2950,
+	-1443,
+	-385,
+	1385,
+	-1208,
+	283,
+	616,
+	-908,
+	527,
+	139,
+	-588,
+	555,
+	-145,
+	-297,
+	462,
+	-281,
+	-67,
+	314,
+	-305,
+	85,
+	160,
+	-256,
+	159,
+	33,
+	-172,
+	170,
+	-50,
+	-85,
+	139,
+	-88,
+	-16,
+	91,
+	-90,
+	28,
+	42,
+	-70,
+	44,
+	7,
+	-43,
+	43,
+	-13,
+	-19,
+	32,
+	-20,
+	-2,
+	17,
+	-17,
+	5,
+	7,
+	-11,
+	7,
+	0,
+	-5,
+	5,
+	-2,
+	-1,
+	2,
+	2,
+	-3,
+	1,
+	3,
+	-7,
+	6,
+	1,
+	-10,
+	13,
+	-6,
+	-10,
+	22,
+	-19,
+	-1,
+	27,
+	-36,
+	17,
+	22,
+	-52,
+	45,
+	2,
+	-59,
+	79,
+	-37,
+	-45,
+	107,
+	-93,
+	-1,
+	113,
+	-153,
+	74,
+	82,
+	-200,
+	175,
+	-2,
+	-205,
+	281,
+	-140,
+	-141,
+	357,
+	-319,
+	11,
+	364,
+	-511,
+	265,
+	249,
+	-663,
+	613,
+	-38,
+	-708,
+	1046,
+	-581,
+	-535,
+	1575,
+	-1617,
+	157,
+	2414,
+	-4738,
+	4441,
+	22888,
+	11945,
+	-4703,
+	301,
+	1952,
+	-2098,
+	893,
+	512,
+	-1202,
+	930,
+	-99,
+	-624,
+	781,
+	-376,
+	-213,
+	553,
+	-455,
+	58,
+	315,
+	-411,
+	207,
+	109,
+	-300,
+	253,
+	-37,
+	-172,
+	229,
+	-118,
+	-57,
+	165,
+	-141,
+	23,
+	92,
+	-124,
+	65,
+	28,
+	-86,
+	74,
+	-13,
+	-45,
+	62,
+	-33,
+	-13,
+	40,
+	-35,
+	7,
+	19,
+	-26,
+	14,
+	5,
+	-16,
+	13,
+	-3,
+	-7,
+	9,
+	-5,
+	-1,
+	4,
+	-3,
+	1,
+	1
+
+};
+
+static const struct src_stage src_int16_3_4_4535_5000 = {
+	1, 1, 3, 120, 360, 4, 3, 0, 0,
+	src_int16_3_4_4535_5000_fir};
+/** \endcond */
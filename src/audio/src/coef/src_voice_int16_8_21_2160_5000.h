@@ -0,0 +1,402 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_8_21_2160_5000_fir[384] = {
+	6,
+	10,
+	-1,
+	-34,
+	-68,
+	-50,
+	48,
+	187,
+	240,
+	83,
+	-273,
+	-597,
+	-548,
+	51,
+	942,
+	1455,
+	913,
+	-763,
+	-2687,
+	-3272,
+	-1120,
+	3961,
+	10507,
+	15939,
+	17869,
+	15413,
+	9692,
+	3201,
+	-1561,
+	-3328,
+	-2484,
+	-513,
+	1050,
+	1438,
+	835,
+	-50,
+	-583,
+	-571,
+	-223,
+	116,
+	243,
+	171,
+	32,
+	-57,
+	-65,
+	-30,
+	2,
+	10,
+	7,
+	10,
+	-4,
+	-40,
+	-69,
+	-43,
+	65,
+	201,
+	234,
+	47,
+	-322,
+	-618,
+	-502,
+	156,
+	1043,
+	1455,
+	757,
+	-1019,
+	-2868,
+	-3171,
+	-631,
+	4745,
+	11304,
+	16409,
+	17798,
+	14833,
+	8866,
+	2469,
+	-1953,
+	-3341,
+	-2264,
+	-270,
+	1167,
+	1405,
+	724,
+	-146,
+	-610,
+	-538,
+	-174,
+	145,
+	243,
+	154,
+	16,
+	-61,
+	-62,
+	-25,
+	4,
+	10,
+	8,
+	9,
+	-8,
+	-45,
+	-70,
+	-33,
+	83,
+	214,
+	224,
+	7,
+	-370,
+	-632,
+	-449,
+	267,
+	1137,
+	1436,
+	583,
+	-1276,
+	-3025,
+	-3025,
+	-95,
+	5550,
+	12078,
+	16818,
+	17654,
+	14206,
+	8033,
+	1771,
+	-2295,
+	-3315,
+	-2030,
+	-37,
+	1264,
+	1357,
+	610,
+	-233,
+	-628,
+	-501,
+	-126,
+	170,
+	240,
+	137,
+	2,
+	-66,
+	-58,
+	-21,
+	6,
+	10,
+	9,
+	8,
+	-12,
+	-49,
+	-69,
+	-23,
+	101,
+	224,
+	210,
+	-35,
+	-416,
+	-639,
+	-385,
+	380,
+	1221,
+	1400,
+	391,
+	-1533,
+	-3154,
+	-2831,
+	486,
+	6369,
+	12823,
+	17164,
+	17444,
+	13534,
+	7199,
+	1107,
+	-2588,
+	-3251,
+	-1785,
+	184,
+	1342,
+	1295,
+	495,
+	-313,
+	-638,
+	-460,
+	-80,
+	192,
+	233,
+	119,
+	-10,
+	-68,
+	-54,
+	-16,
+	7,
+	9,
+	9,
+	7,
+	-16,
+	-54,
+	-68,
+	-10,
+	119,
+	233,
+	192,
+	-80,
+	-460,
+	-638,
+	-313,
+	495,
+	1295,
+	1342,
+	184,
+	-1785,
+	-3251,
+	-2588,
+	1107,
+	7199,
+	13534,
+	17444,
+	17164,
+	12823,
+	6369,
+	486,
+	-2831,
+	-3154,
+	-1533,
+	391,
+	1400,
+	1221,
+	380,
+	-385,
+	-639,
+	-416,
+	-35,
+	210,
+	224,
+	101,
+	-23,
+	-69,
+	-49,
+	-12,
+	8,
+	9,
+	10,
+	6,
+	-21,
+	-58,
+	-66,
+	2,
+	137,
+	240,
+	170,
+	-126,
+	-501,
+	-628,
+	-233,
+	610,
+	1357,
+	1264,
+	-37,
+	-2030,
+	-3315,
+	-2295,
+	1771,
+	8033,
+	14206,
+	17654,
+	16818,
+	12078,
+	5550,
+	-95,
+	-3025,
+	-3025,
+	-1276,
+	583,
+	1436,
+	1137,
+	267,
+	-449,
+	-632,
+	-370,
+	7,
+	224,
+	214,
+	83,
+	-33,
+	-70,
+	-45,
+	-8,
+	9,
+	8,
+	10,
+	4,
+	-25,
+	-62,
+	-61,
+	16,
+	154,
+	243,
+	145,
+	-174,
+	-538,
+	-610,
+	-146,
+	724,
+	1405,
+	1167,
+	-270,
+	-2264,
+	-3341,
+	-1953,
+	2469,
+	8866,
+	14833,
+	17798,
+	16409,
+	11304,
+	4745,
+	-631,
+	-3171,
+	-2868,
+	-1019,
+	757,
+	1455,
+	1043,
+	156,
+	-502,
+	-618,
+	-322,
+	47,
+	234,
+	201,
+	65,
+	-43,
+	-69,
+	-40,
+	-4,
+	10,
+	7,
+	10,
+	2,
+	-30,
+	-65,
+	-57,
+	32,
+	171,
+	243,
+	116,
+	-223,
+	-571,
+	-583,
+	-50,
+	835,
+	1438,
+	1050,
+	-513,
+	-2484,
+	-3328,
+	-1561,
+	3201,
+	9692,
+	15413,
+	17869,
+	15939,
+	10507,
+	3961,
+	-1120,
+	-3272,
+	-2687,
+	-763,
+	913,
+	1455,
+	942,
+	51,
+	-548,
+	-597,
+	-273,
+	83,
+	240,
+	187,
+	48,
+	-50,
+	-68,
+	-34,
+	-1,
+	10,
+	6
+
+};
+
+static const struct src_stage src_int16_8_21_2160_5000 = {
+	13, 5, 8, 48, 384, 21, 8, 0, 1,
+	src_int16_8_21_2160_5000_fir};
+/** \endcond */
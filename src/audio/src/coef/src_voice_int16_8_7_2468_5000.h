@@ -0,0 +1,210 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#include <stdint.h>
+
+__cold_rodata static const int16_t src_int16_8_7_2468_5000_fir[192] = {
+	1,
+	7,
+	-41,
+	86,
+	-46,
+	-207,
+	648,
+	-907,
+	325,
+	1617,
+	-4813,
+	8795,
+	24381,
+	5759,
+	-4488,
+	2086,
+	-176,
+	-653,
+	618,
+	-270,
+	13,
+	60,
+	-36,
+	8,
+	1,
+	4,
+	-41,
+	107,
+	-111,
+	-112,
+	620,
+	-1108,
+	858,
+	934,
+	-4732,
+	11915,
+	23668,
+	2947,
+	-3841,
+	2327,
+	-606,
+	-372,
+	539,
+	-302,
+	61,
+	35,
+	-31,
+	9,
+	3,
+	-1,
+	-36,
+	121,
+	-176,
+	8,
+	528,
+	-1230,
+	1377,
+	71,
+	-4186,
+	14973,
+	22280,
+	473,
+	-2965,
+	2347,
+	-938,
+	-93,
+	424,
+	-304,
+	97,
+	10,
+	-23,
+	8,
+	4,
+	-7,
+	-26,
+	126,
+	-235,
+	145,
+	373,
+	-1250,
+	1830,
+	-917,
+	-3136,
+	17814,
+	20294,
+	-1574,
+	-1959,
+	2170,
+	-1155,
+	162,
+	288,
+	-279,
+	118,
+	-10,
+	-15,
+	6,
+	6,
+	-15,
+	-10,
+	118,
+	-279,
+	288,
+	162,
+	-1155,
+	2170,
+	-1959,
+	-1574,
+	20294,
+	17814,
+	-3136,
+	-917,
+	1830,
+	-1250,
+	373,
+	145,
+	-235,
+	126,
+	-26,
+	-7,
+	4,
+	8,
+	-23,
+	10,
+	97,
+	-304,
+	424,
+	-93,
+	-938,
+	2347,
+	-2965,
+	473,
+	22280,
+	14973,
+	-4186,
+	71,
+	1377,
+	-1230,
+	528,
+	8,
+	-176,
+	121,
+	-36,
+	-1,
+	3,
+	9,
+	-31,
+	35,
+	61,
+	-302,
+	539,
+	-372,
+	-606,
+	2327,
+	-3841,
+	2947,
+	23668,
+	11915,
+	-4732,
+	934,
+	858,
+	-1108,
+	620,
+	-112,
+	-111,
+	107,
+	-41,
+	4,
+	1,
+	8,
+	-36,
+	60,
+	13,
+	-270,
+	618,
+	-653,
+	-176,
+	2086,
+	-4488,
+	5759,
+	24381,
+	8795,
+	-4813,
+	1617,
+	325,
+	-907,
+	648,
+	-207,
+	-46,
+	86,
+	-41,
+	7,
+	1
+
+};
+
+static const struct src_stage src_int16_8_7_2468_5000 = {
+	6, 7, 8, 24, 192, 7, 8, 0, 0,
+	src_int16_8_7_2468_5000_fir};
+/** \endcond */
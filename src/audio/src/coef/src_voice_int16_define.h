@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#ifndef __SOF_AUDIO_COEFFICIENTS_SRC_SRC_VOICE_INT16_DEFINE_H__
+#define __SOF_AUDIO_COEFFICIENTS_SRC_SRC_VOICE_INT16_DEFINE_H__
+
+/* SRC constants */
+#define MAX_FIR_DELAY_SIZE 404
+#define MAX_OUT_DELAY_SIZE 196
+#define MAX_BLK_IN 21
+#define MAX_BLK_OUT 16
+#define NUM_IN_FS 6
+#define NUM_OUT_FS 5
+#define STAGE1_TIMES_MAX 32
+#define STAGE2_TIMES_MAX 32
+#define STAGE_BUF_SIZE 672
+#define NUM_ALL_COEFFICIENTS 7108
+
+#endif /* __SOF_AUDIO_COEFFICIENTS_SRC_SRC_VOICE_INT16_DEFINE_H__ */
+
+/** \endcond */
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ *
+ */
+
+/** \cond GENERATED_BY_TOOLS_TUNE_SRC */
+
+#ifndef __SOF_AUDIO_COEFFICIENTS_SRC_SRC_VOICE_INT16_TABLE_H__
+#define __SOF_AUDIO_COEFFICIENTS_SRC_SRC_VOICE_INT16_TABLE_H__
+
+/* SRC conversions */
+#include "src_voice_int16_1_2_2268_5000.h"
+#include "src_voice_int16_1_2_4535_5000.h"
+#include "src_voice_int16_1_3_2268_5000.h"
+#include "src_voice_int16_1_3_4535_5000.h"
+#include "src_voice_int16_2_1_2268_5000.h"
+#include "src_voice_int16_2_1_4535_5000.h"
+#include "src_voice_int16_2_3_4535_5000.h"
+#include "src_voice_int16_3_1_2268_5000.h"
+#include "src_voice_int16_3_4_4535_5000.h"
+#include "src_voice_int16_8_7_2468_5000.h"
+#include "src_voice_int16_8_21_2160_5000.h"
+#include "src_voice_int16_10_21_3455_5000.h"
+#include "src_voice_int16_10_21_4535_5000.h"
+#include "src_voice_int16_16_21_4535_5000.h"
+#include <stdint.h>
+
+/* SRC table */
+static const int16_t fir_one = 16384;
+static const struct src_stage src_int16_1_1_0_0 =  { 0, 0, 1, 1, 1, 1, 1, 0, -1, &fir_one };
+static const struct src_stage src_int16_0_0_0_0 =  { 0, 0, 0, 0, 0, 0, 0, 0,  0, &fir_one };
+static const int src_in_fs[6] = { 8000, 16000, 24000, 32000, 44100, 48000};
+static const int src_out_fs[5] = { 8000, 16000, 24000, 32000, 48000};
+static const struct src_stage * const src_table1[5][6] = {
+	{ &src_int16_1_1_0_0, &src_int16_1_2_4535_5000,
+	 &src_int16_1_3_4535_5000, &src_int16_1_2_2268_5000,
+	 &src_int16_8_21_2160_5000, &src_int16_1_3_2268_5000},
+	{ &src_int16_0_0_0_0, &src_int16_1_1_0_0,
+	 &src_int16_2_3_4535_5000, &src_int16_1_2_4535_5000,
+	 &src_int16_10_21_3455_5000, &src_int16_1_3_4535_5000},
+	{ &src_int16_0_0_0_0, &src_int16_0_0_0_0,
+	 &src_int16_1_1_0_0, &src_int16_3_4_4535_5000,
+	 &src_int16_8_7_2468_5000, &src_int16_1_2_4535_5000},
+	{ &src_int16_2_1_4535_5000, &src_int16_0_0_0_0,
+	 &src_int16_0_0_0_0, &src_int16_1_1_0_0,
+	 &src_int16_0_0_0_0, &src_int16_2_3_4535_5000},
+	{ &src_int16_2_1_4535_5000, &src_int16_0_0_0_0,
+	 &src_int16_2_1_4535_5000, &src_int16_0_0_0_0,
+	 &src_int16_0_0_0_0, &src_int16_1_1_0_0}
+};
+
+static const struct src_stage * const src_table2[5][6] = {
+	{ &src_int16_1_1_0_0, &src_int16_1_1_0_0,
+	 &src_int16_1_1_0_0, &src_int16_1_2_4535_5000,
+	 &src_int16_10_21_4535_5000, &src_int16_1_2_4535_5000},
+	{ &src_int16_0_0_0_0, &src_int16_1_1_0_0,
+	 &src_int16_1_1_0_0, &src_int16_1_1_0_0,
+	 &src_int16_16_21_4535_5000, &src_int16_1_1_0_0},
+	{ &src_int16_0_0_0_0, &src_int16_0_0_0_0,
+	 &src_int16_1_1_0_0, &src_int16_1_1_0_0,
+	 &src_int16_10_21_4535_5000, &src_int16_1_1_0_0},
+	{ &src_int16_2_1_2268_5000, &src_int16_0_0_0_0,
+	 &src_int16_0_0_0_0, &src_int16_1_1_0_0,
+	 &src_int16_0_0_0_0, &src_int16_1_1_0_0},
+	{ &src_int16_3_1_2268_5000, &src_int16_0_0_0_0,
+	 &src_int16_1_1_0_0, &src_int16_0_0_0_0,
+	 &src_int16_0_0_0_0, &src_int16_1_1_0_0}
+};
+
+#endif /* __SOF_AUDIO_COEFFICIENTS_SRC_SRC_VOICE_INT16_TABLE_H__ */
+
+/** \endcond */
@@ -27,7 +27,11 @@
 #include "coef/src_std_int32_table.h"
 #elif CONFIG_COMP_SRC_IPC4_FULL_MATRIX
 #include "coef/src_ipc4_int32_define.h"
+#if CONFIG_COMP_SRC_COEF_GENERATE
+#include "coef/src_ipc4_int32_kaiser.h"
+#else
 #include "coef/src_ipc4_int32_table.h"
+#endif
 #else
 #error "No valid configuration selected for SRC"
 #endif
@@ -49,6 +53,13 @@ __cold static int src_prepare(struct processing_module *mod,
 	if (num_of_sources != 1 || num_of_sinks != 1)
 		return -EINVAL;
 
+#if CONFIG_COMP_SRC_SHORT_COEF
+	a->short_coef = cd->ipc_config.coef_bits == 16 &&
+			src_voice_is_supported(mod->dev, cd->source_rate, cd->sink_rate);
+	if (a->short_coef)
+		return src_voice_prepare(mod, sources[0], sinks[0]);
+#endif
+
 	a->in_fs = src_in_fs;
 	a->out_fs = src_out_fs;
 	a->num_in_fs = NUM_IN_FS;
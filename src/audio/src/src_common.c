@@ -604,15 +604,56 @@ __cold int src_param_set(struct comp_dev *dev, struct comp_data *cd)
 	return 0;
 }
 
+#if CONFIG_FAST_GET || CONFIG_COMP_SRC_COEF_GENERATE
+/* Coefficients copied to fast memory or generated from the stage design */
+__cold static const void *src_get_coefs(const struct src_stage *stage, size_t size)
+{
+#if CONFIG_COMP_SRC_COEF_GENERATE
+	if (stage->kaiser) {
+#if CONFIG_FAST_GET
+		return fast_get_generate(stage, size, src_kaiser_generate);
+#else
+		void *coefs = rmalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, size);
+
+		if (coefs && src_kaiser_generate(coefs, size, stage) < 0) {
+			rfree(coefs);
+			coefs = NULL;
+		}
+
+		return coefs;
+#endif
+	}
+#endif
+
+#if CONFIG_FAST_GET
+	return fast_get(stage->coefs, size);
+#else
+	return stage->coefs;
+#endif
+}
+
+__cold static void src_put_coefs(const struct src_stage *stage)
+{
+#if CONFIG_FAST_GET
+	fast_put(stage->coefs);
+#else
+	if (stage->kaiser)
+		rfree((void *)stage->coefs);
+#endif
+}
+#endif
+
 __cold int src_allocate_copy_stages(struct comp_dev *dev, struct src_param *prm,
 				    const struct src_stage *stage_src1,
 				    const struct src_stage *stage_src2)
 {
-#if CONFIG_FAST_GET
+#if CONFIG_FAST_GET || CONFIG_COMP_SRC_COEF_GENERATE
 	struct src_stage *stage_dst;
 	size_t coef_size[2];
 #if SRC_SHORT
 	size_t tap_size = sizeof(int16_t);
+#elif CONFIG_COMP_SRC_SHORT_COEF
+	size_t tap_size = prm->short_coef ? sizeof(int16_t) : sizeof(int32_t);
 #else
 	size_t tap_size = sizeof(int32_t);
 #endif
@@ -633,12 +674,15 @@ __cold int src_allocate_copy_stages(struct comp_dev *dev, struct src_param *prm,
 	coef_size[0] = tap_size * stage_src1->filter_length;
 	coef_size[1] = tap_size * stage_src2->filter_length;
 
-	stage_dst[0].coefs = fast_get(stage_src1->coefs, coef_size[0]);
-	stage_dst[1].coefs = fast_get(stage_src2->coefs, coef_size[1]);
+	stage_dst[0].coefs = src_get_coefs(stage_src1, coef_size[0]);
+	stage_dst[1].coefs = src_get_coefs(stage_src2, coef_size[1]);
 
 	if (!stage_dst[0].coefs || !stage_dst[1].coefs)  {
 		comp_err(dev, "failed to allocate coefficients");
-		fast_put(stage_dst[0].coefs);
+		if (stage_dst[0].coefs)
+			src_put_coefs(&stage_dst[0]);
+		if (stage_dst[1].coefs)
+			src_put_coefs(&stage_dst[1]);
 		rfree(stage_dst);
 		return -ENOMEM;
 	}
@@ -721,10 +765,10 @@ __cold int src_free(struct processing_module *mod)
 
 	/* Free dynamically reserved buffers for SRC algorithm */
 	rfree(cd->delay_lines);
-#if CONFIG_FAST_GET
+#if CONFIG_FAST_GET || CONFIG_COMP_SRC_COEF_GENERATE
 	if (cd->param.stage1) {
-		fast_put(cd->param.stage1->coefs);
-		fast_put(cd->param.stage2->coefs);
+		src_put_coefs(cd->param.stage1);
+		src_put_coefs(cd->param.stage2);
 	}
 	rfree((void *)cd->param.stage1);
 #endif
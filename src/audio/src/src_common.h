@@ -17,6 +17,13 @@
 #include <sof/audio/module_adapter/module/generic.h>
 #include "src_ipc.h"
 
+/* Kaiser window lowpass design of a stage, see src_kaiser_generate() */
+struct src_kaiser {
+	uint32_t cutoff;	/* Q0.32, relative to Nyquist of the interpolated rate */
+	int32_t beta;		/* Q5.27, window shape */
+	int32_t gain;		/* Q2.30, DC gain relative to the interpolation factor */
+};
+
 struct src_stage {
 	int idm;
 	int odm;
@@ -28,6 +35,9 @@ struct src_stage {
 	int halfband;
 	int shift;
 	const void *coefs; /* Can be int16_t or int32_t depending on config */
+#if CONFIG_COMP_SRC_COEF_GENERATE
+	const struct src_kaiser *kaiser; /* Generate int32_t coefs if set */
+#endif
 };
 
 struct src_param {
@@ -49,6 +59,9 @@ struct src_param {
 	int max_fir_delay_size_xnch;
 	int max_out_delay_size_xnch;
 	int nch;
+#if CONFIG_COMP_SRC_SHORT_COEF
+	bool short_coef; /* Stages from the 16 bit coefficients set */
+#endif
 	const struct src_stage *stage1;
 	const struct src_stage *stage2;
 	const int *in_fs;
@@ -139,6 +152,22 @@ void src_polyphase_stage_cir(struct src_stage_prm *s);
 void src_polyphase_stage_cir_s16(struct src_stage_prm *s);
 #endif /* CONFIG_FORMAT_S16LE */
 
+#if CONFIG_COMP_SRC_SHORT_COEF
+/* 16 bit coefficients kernels for the stages of the voice set */
+#if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
+void src_polyphase_stage_cir_c16(struct src_stage_prm *s);
+#endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
+
+#if CONFIG_FORMAT_S16LE
+void src_polyphase_stage_cir_s16_c16(struct src_stage_prm *s);
+#endif /* CONFIG_FORMAT_S16LE */
+
+/* Kernel for the coefficients size of the prepared stages */
+#define SRC_POLYPHASE_FUNC(cd, func) ((cd)->param.short_coef ? func##_c16 : func)
+#else
+#define SRC_POLYPHASE_FUNC(cd, func) (func)
+#endif /* CONFIG_COMP_SRC_SHORT_COEF */
+
 int32_t src_input_rates(void);
 
 int32_t src_output_rates(void);
@@ -215,6 +244,25 @@ static inline int src_fallback(struct comp_data *cd,
 	return 0;
 }
 
+#if CONFIG_COMP_SRC_COEF_GENERATE
+/**
+ * \brief Generates the coefficients of a stage with a Kaiser design.
+ * \param[out] buf Coefficients in polyphase order.
+ * \param[in] size Size of buf, filter_length int32_t coefficients.
+ * \param[in] key The struct src_stage.
+ * \return 0 on success, -EINVAL for an invalid stage.
+ */
+int src_kaiser_generate(void *buf, size_t size, const void *key);
+#endif
+
+#if CONFIG_COMP_SRC_SHORT_COEF
+/* Prepares the instance with the 16 bit coefficients voice set */
+int src_voice_prepare(struct processing_module *mod, struct sof_source *source,
+		      struct sof_sink *sink);
+/* Checks that the 16 bit coefficients voice set has the conversion */
+bool src_voice_is_supported(struct comp_dev *dev, int fs_in, int fs_out);
+#endif
+
 int src_allocate_copy_stages(struct comp_dev *dev, struct src_param *prm,
 			     const struct src_stage *stage_src1,
 			     const struct src_stage *stage_src2);
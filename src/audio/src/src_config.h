@@ -34,4 +34,13 @@
 #endif
 #endif
 
+/* With COMP_SRC_SHORT_COEF the kernels are built a second time in
+ * src_short.c with 16 bit coefficients, those get the _c16 suffix.
+ */
+#if SRC_SHORT && CONFIG_COMP_SRC_SHORT_COEF
+#define SRC_KERNEL(name)	name##_c16
+#else
+#define SRC_KERNEL(name)	name
+#endif
+
 #endif /* __SOF_AUDIO_SRC_SRC_CONFIG_H__ */
@@ -210,7 +210,7 @@ static inline void fir_filter_generic(int32_t *rp, const void *cp, int32_t *wp0,
 #endif /* 32bit coefficients version */
 
 #if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-void src_polyphase_stage_cir(struct src_stage_prm *s)
+void SRC_KERNEL(src_polyphase_stage_cir)(struct src_stage_prm *s)
 {
 	int i;
 	int n;
@@ -308,7 +308,7 @@ void src_polyphase_stage_cir(struct src_stage_prm *s)
 #endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
 
 #if CONFIG_FORMAT_S16LE
-void src_polyphase_stage_cir_s16(struct src_stage_prm *s)
+void SRC_KERNEL(src_polyphase_stage_cir_s16)(struct src_stage_prm *s)
 {
 	int i;
 	int n;
@@ -296,7 +296,7 @@ static inline void fir_filter(ae_q32s *rp, const void *cp, ae_q32s *wp0,
 #endif /* 32bit coefficients version */
 
 #if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-void src_polyphase_stage_cir(struct src_stage_prm *s)
+void SRC_KERNEL(src_polyphase_stage_cir)(struct src_stage_prm *s)
 {
 	/* This function uses
 	 *  1x 56 bit registers Q,
@@ -421,7 +421,7 @@ void src_polyphase_stage_cir(struct src_stage_prm *s)
 #endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
 
 #if CONFIG_FORMAT_S16LE
-void src_polyphase_stage_cir_s16(struct src_stage_prm *s)
+void SRC_KERNEL(src_polyphase_stage_cir_s16)(struct src_stage_prm *s)
 {
 	/* This function uses
 	 *  0x 56 bit registers Q,
@@ -301,7 +301,7 @@ static inline void fir_filter(ae_f32 *rp, const void *cp, ae_f32 *wp0,
 #endif /* 32bit coefficients version */
 
 #if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-void src_polyphase_stage_cir(struct src_stage_prm *s)
+void SRC_KERNEL(src_polyphase_stage_cir)(struct src_stage_prm *s)
 {
 	/* This function uses
 	 *  1x 64 bit registers
@@ -425,7 +425,7 @@ void src_polyphase_stage_cir(struct src_stage_prm *s)
 #endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
 
 #if CONFIG_FORMAT_S16LE
-void src_polyphase_stage_cir_s16(struct src_stage_prm *s)
+void SRC_KERNEL(src_polyphase_stage_cir_s16)(struct src_stage_prm *s)
 {
 	/* This function uses
 	 *  2x 64 bit registers
@@ -8,12 +8,20 @@
 
 #include <sof/audio/ipc-config.h>
 #include <ipc4/base-config.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* src component private data */
 struct ipc4_config_src {
 	struct ipc4_base_module_cfg base;
 	uint32_t sink_rate;
+	/* Optional, 16 selects the 16 bit coefficients set of
+	 * CONFIG_COMP_SRC_SHORT_COEF, 0 or 32 the default set.
+	 */
+	uint32_t coef_bits;
 };
 
+/* Size of the init data without the optional fields */
+#define IPC4_CONFIG_SRC_MIN_SIZE	offsetof(struct ipc4_config_src, coef_bits)
+
 #endif /* __SOF_AUDIO_SRC_SRC_IPC_H__ */
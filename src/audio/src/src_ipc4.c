@@ -157,19 +157,19 @@ __cold int src_prepare_general(struct processing_module *mod,
 #if CONFIG_FORMAT_S16LE
 	case IPC4_DEPTH_16BIT:
 		cd->data_shift = 0;
-		cd->polyphase_func = src_polyphase_stage_cir_s16;
+		cd->polyphase_func = SRC_POLYPHASE_FUNC(cd, src_polyphase_stage_cir_s16);
 		break;
 #endif /* CONFIG_FORMAT_S16LE */
 #if CONFIG_FORMAT_S24LE
 	case IPC4_DEPTH_24BIT:
 		cd->data_shift = 8;
-		cd->polyphase_func = src_polyphase_stage_cir;
+		cd->polyphase_func = SRC_POLYPHASE_FUNC(cd, src_polyphase_stage_cir);
 		break;
 #endif /* CONFIG_FORMAT_S24LE */
 #if CONFIG_FORMAT_S32LE
 	case IPC4_DEPTH_32BIT:
 		cd->data_shift = 0;
-		cd->polyphase_func = src_polyphase_stage_cir;
+		cd->polyphase_func = SRC_POLYPHASE_FUNC(cd, src_polyphase_stage_cir);
 		break;
 #endif /* CONFIG_FORMAT_S32LE */
 	default:
@@ -197,7 +197,8 @@ __cold int src_init(struct processing_module *mod)
 
 	comp_dbg(dev, "src_init()");
 
-	if (!cfg->init_data || cfg->size != sizeof(cd->ipc_config)) {
+	if (!cfg->init_data || (cfg->size != sizeof(cd->ipc_config) &&
+				cfg->size != IPC4_CONFIG_SRC_MIN_SIZE)) {
 		comp_err(dev, "src_init(): Missing or bad size (%u) init data",
 			 cfg->size);
 		return -EINVAL;
@@ -214,7 +215,24 @@ __cold int src_init(struct processing_module *mod)
 		return -ENOMEM;
 
 	md->private = cd;
-	memcpy_s(&cd->ipc_config, sizeof(cd->ipc_config), cfg->init_data, sizeof(cd->ipc_config));
+	memcpy_s(&cd->ipc_config, sizeof(cd->ipc_config), cfg->init_data, cfg->size);
+
+	switch (cd->ipc_config.coef_bits) {
+	case 0:
+	case 32:
+		break;
+	case 16:
+		if (!IS_ENABLED(CONFIG_COMP_SRC_SHORT_COEF)) {
+			comp_warn(dev, "src_init(): no 16 bit coefficients, using the default set");
+			cd->ipc_config.coef_bits = 0;
+		}
+		break;
+	default:
+		comp_err(dev, "src_init(): Illegal coefficients size %u",
+			 cd->ipc_config.coef_bits);
+		rfree(cd);
+		return -EINVAL;
+	}
 
 	cd->delay_lines = NULL;
 	cd->src_func = src_fallback;
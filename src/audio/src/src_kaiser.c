@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/*
+ * Generates the polyphase coefficients of an SRC stage from its Kaiser
+ * window design. The filter is the same as fir1() with a kaiser() window
+ * in tune/src_get.m, normalized and quantized as in src_export_coef.m.
+ * This is run once in prepare, it's written for precision rather than
+ * speed and uses single precision float without the math library.
+ */
+
+#include <sof/common.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "src_common.h"
+
+#define SRC_KAISER_PI		3.14159265358979323846f
+
+/* sin(2 * pi * t) of an angle t in Q0.32 turns */
+static float src_kaiser_sin(uint32_t t)
+{
+	/* nearest quadrant, the remainder is within +/- pi / 4 */
+	int quadrant = ((t + BIT(29)) >> 30) & 3;
+	float x = (int32_t)(t - ((uint32_t)quadrant << 30)) * (2 * SRC_KAISER_PI / 4294967296.0f);
+	float x2 = x * x;
+	float s = x * (1 - x2 / 6 * (1 - x2 / 20 * (1 - x2 / 42 * (1 - x2 / 72))));
+	float c = 1 - x2 / 2 * (1 - x2 / 12 * (1 - x2 / 30 * (1 - x2 / 56 * (1 - x2 / 90))));
+
+	switch (quadrant) {
+	case 0:
+		return s;
+	case 1:
+		return c;
+	case 2:
+		return -s;
+	default:
+		return -c;
+	}
+}
+
+/* Modified Bessel function I0(2 * sqrt(y)) */
+static float src_kaiser_i0(float y)
+{
+	float term = 1.0f;
+	float sum = 1.0f;
+	int k;
+
+	for (k = 1; term > sum * 1e-8f; k++) {
+		term *= y / (k * k);
+		sum += term;
+	}
+
+	return sum;
+}
+
+/*
+ * Prototype filter tap at distance m / 2 from the center of a filter with
+ * last + 1 taps, the window isn't normalized.
+ */
+static float src_kaiser_tap(const struct src_kaiser *kaiser, float beta2, int m, int last)
+{
+	uint32_t t = (uint64_t)kaiser->cutoff * m >> 2;
+	float sinc = m ? src_kaiser_sin(t) / (m * (SRC_KAISER_PI / 2)) :
+		kaiser->cutoff / 4294967296.0f;
+	float w = src_kaiser_i0(beta2 * (float)((last - m) * (last + m)) /
+				(4.0f * last * last));
+
+	return sinc * w;
+}
+
+/* Index of prototype tap n in the polyphase order of the stage */
+static int src_kaiser_index(const struct src_stage *stage, int n)
+{
+	return (n % stage->num_of_subfilters) * stage->subfilter_length +
+		n / stage->num_of_subfilters;
+}
+
+int src_kaiser_generate(void *buf, size_t size, const void *key)
+{
+	const struct src_stage *stage = key;
+	const struct src_kaiser *kaiser = stage->kaiser;
+	int taps = stage->filter_length;
+	int last = taps - 1;
+	int32_t *coefs = buf;
+	float *h = buf;
+	float beta = kaiser->beta / 134217728.0f; /* Q5.27 */
+	float sum = 0.0f;
+	float scale;
+	float x;
+	int m, n;
+
+	if (size != taps * sizeof(int32_t) || taps < 2 ||
+	    stage->num_of_subfilters * stage->subfilter_length != taps ||
+	    stage->shift < -31 || stage->shift > 31)
+		return -EINVAL;
+
+	/* the filter is symmetric, the floats go directly to their final place */
+	for (n = 0; n < (taps + 1) / 2; n++) {
+		m = last - 2 * n;
+		x = src_kaiser_tap(kaiser, beta * beta, m, last);
+		h[src_kaiser_index(stage, n)] = x;
+		h[src_kaiser_index(stage, last - n)] = x;
+		sum += m ? 2 * x : x;
+	}
+
+	/* DC gain is interpolation factor times gain, scaled up by the shift */
+	scale = (float)((int64_t)1 << (31 + stage->shift)) * stage->num_of_subfilters *
+		(kaiser->gain / 1073741824.0f) / sum;
+
+	for (n = 0; n < taps; n++) {
+		x = h[n] * scale;
+		if (x >= 2147483648.0f)
+			coefs[n] = INT32_MAX;
+		else if (x <= -2147483648.0f)
+			coefs[n] = INT32_MIN;
+		else
+			coefs[n] = (int32_t)(x < 0 ? x - 0.5f : x + 0.5f);
+	}
+
+	return 0;
+}
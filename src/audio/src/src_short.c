@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/*
+ * The 16 bit coefficients kernels of CONFIG_COMP_SRC_SHORT_COEF. The
+ * sources of the 32x16 bit versions are built here a second time, their
+ * functions get the _c16 suffix from SRC_KERNEL().
+ */
+
+#define SRC_SHORT	1
+
+#include "src_generic.c"
+#include "src_hifi2ep.c"
+#include "src_hifi3.c"
+#include "src_hifi4.c"
+#include "src_hifi5.c"
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/lib/memory.h>
+
+#include "src_common.h"
+#include "src_config.h"
+
+#include "coef/src_voice_int16_define.h"
+#include "coef/src_voice_int16_table.h"
+
+LOG_MODULE_DECLARE(src, CONFIG_SOF_LOG_LEVEL);
+
+/*
+ * The conversions those did not meet the THD+N floor with the 16 bit
+ * coefficients are left out of the set and use the default set.
+ */
+__cold bool src_voice_is_supported(struct comp_dev *dev, int fs_in, int fs_out)
+{
+	int idx_in = src_find_fs(src_in_fs, NUM_IN_FS, fs_in);
+	int idx_out = src_find_fs(src_out_fs, NUM_OUT_FS, fs_out);
+
+	assert_can_be_cold();
+
+	if (idx_in >= 0 && idx_out >= 0 && src_table1[idx_out][idx_in]->filter_length > 0)
+		return true;
+
+	comp_warn(dev, "src_voice_is_supported(): no 16 bit coefficients for %d -> %d Hz, using the default set",
+		  fs_in, fs_out);
+	return false;
+}
+
+/*
+ * This function is the same as src_prepare() but it's assigning the
+ * coefficients of the 16 bit voice set from the different headers.
+ */
+__cold int src_voice_prepare(struct processing_module *mod, struct sof_source *source,
+			     struct sof_sink *sink)
+{
+	struct comp_data *cd = module_get_private_data(mod);
+	struct src_param *a = &cd->param;
+	int ret;
+
+	assert_can_be_cold();
+
+	comp_info(mod->dev, "src_voice_prepare()");
+
+	a->in_fs = src_in_fs;
+	a->out_fs = src_out_fs;
+	a->num_in_fs = NUM_IN_FS;
+	a->num_out_fs = NUM_OUT_FS;
+	a->max_fir_delay_size_xnch = (PLATFORM_MAX_CHANNELS * MAX_FIR_DELAY_SIZE);
+	a->max_out_delay_size_xnch = (PLATFORM_MAX_CHANNELS * MAX_OUT_DELAY_SIZE);
+
+	src_get_source_sink_params(mod->dev, source, sink);
+
+	ret = src_param_set(mod->dev, cd);
+	if (ret < 0)
+		return ret;
+
+	ret = src_allocate_copy_stages(mod->dev, a,
+				       src_table1[a->idx_out][a->idx_in],
+				       src_table2[a->idx_out][a->idx_in]);
+	if (ret < 0)
+		return ret;
+
+	ret = src_params_general(mod, source, sink);
+	if (ret < 0)
+		return ret;
+
+	return src_prepare_general(mod, source, sink);
+}
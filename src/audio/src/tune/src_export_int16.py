@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+"""Export a 16-bit coefficients subset of an int32 SRC coefficients set.
+
+Picks the conversions between the given input and output rates from the
+int32 set of a profile, quantizes the coefficients to Q1.15 and writes the
+coef/src_<new profile>_int16_*.h headers in the format of the Octave
+exports. The stage parameters, including the shift, stay the same since the
+int32 coefficients are scaled to less than 32767/32768.
+
+Plain rounding makes the passband responses of the subfilters of a stage
+differ, which shows up as images of the input in the output of an
+interpolation. Each subfilter is therefore first rounded and then fine
+tuned to the passband response of its int32 subfilter.
+
+The coefficient quantization noise relative to the DC gain of each stage
+is reported, it's the floor that the 16-bit stage can't attenuate below.
+The THD+N of each conversion is measured by the src_short cmocka test.
+Conversions that don't meet the floor of that test are left out of the
+set with --exclude, the SRC then uses the int32 set for them.
+
+Usage: src_export_int16.py --in-fs 8000,16000 --out-fs 16000,48000 \\
+       [--exclude 8000:16000,...] <coef directory> <profile> <new profile>
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+from src_export_kaiser import parse_stage
+
+HEADER = ['/* SPDX-License-Identifier: BSD-3-Clause',
+          ' *',
+          ' * Copyright(c) 2026 Intel Corporation. All rights reserved.',
+          ' *',
+          ' */',
+          '',
+          '/** \\cond GENERATED_BY_TOOLS_TUNE_SRC */',
+          '']
+
+
+def parse_rates(s, name):
+    return [int(x) for x in re.search(r'%s\[\d+\] = \{(.*?)\};' % name, s, re.S)
+            .group(1).split(',') if x.strip()]
+
+
+def parse_table(s, name, num_in):
+    entries = re.search(r'%s\[\d+\]\[\d+\] = \{(.*?)\n\};' % name, s, re.S).group(1)
+    names = re.findall(r'&(\w+)', entries)
+    return [names[i:i + num_in] for i in range(0, len(names), num_in)]
+
+
+def passband(name):
+    """Passband edge of a stage in radians per input sample"""
+    num, den, fp = [int(x) for x in name.split('_')[2:5]]
+    return 2 * math.pi * fp / 10000 * min(1, num / den)
+
+
+def quantize(coefs, wp):
+    """Rounds a subfilter to Q1.15 and then moves single coefficients by one
+    step while that lowers the squared error of the passband response.
+    """
+    grid = [wp * i / 63 for i in range(64)]
+    rot = [[complex(math.cos(w * k), -math.sin(w * k)) for w in grid]
+           for k in range(len(coefs))]
+    q = [max(-32768, min(32767, (x + 32768) >> 16)) for x in coefs]
+    err = [sum((q[k] - coefs[k] / 65536) * rot[k][i] for k in range(len(q)))
+           for i in range(len(grid))]
+
+    while True:
+        # q[k] + d changes the cost by 2 d Re(sum err conj(rot)) + len(grid)
+        best = (0, 0, 0)
+        for k, r in enumerate(rot):
+            g = sum((e * x.conjugate()).real for e, x in zip(err, r))
+            for d in (-1, 1):
+                delta = 2 * d * g + len(grid)
+                if delta < best[0] and -32768 <= q[k] + d <= 32767:
+                    best = (delta, k, d)
+        if not best[0]:
+            return q
+
+        _, k, d = best
+        q[k] += d
+        err = [e + d * x for e, x in zip(err, rot[k])]
+
+
+def export_stage(fn, out_fn, name):
+    _, prm, coefs = parse_stage(fn)
+    sublen = prm[3]
+    coefs16 = []
+    for i in range(0, len(coefs), sublen):
+        coefs16 += quantize(coefs[i:i + sublen], passband(name))
+    err = [(x << 16) - y for x, y in zip(coefs16, coefs)]
+
+    # noise of the rounding relative to the DC gain of the prototype filter
+    noise = math.sqrt(sum(x * x for x in err) / prm[2])
+    floor = 20 * math.log10(noise / abs(sum(coefs) / prm[2]))
+    print('%-40s quantization noise %.1f dB' % (name, floor), file=sys.stderr)
+
+    out = HEADER + ['#include <stdint.h>',
+                    '',
+                    '__cold_rodata static const int16_t %s_fir[%d] = {' % (name, len(coefs16))]
+    out += ['\t%d,' % x for x in coefs16[:-1]]
+    out += ['\t%d' % coefs16[-1],
+            '',
+            '};',
+            '',
+            'static const struct src_stage %s = {' % name,
+            '\t%s,' % ', '.join(str(x) for x in prm),
+            '\t%s_fir};' % name,
+            '/** \\endcond */']
+
+    with open(out_fn, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+    # delay lines and block sizes as in src_fir_delay_length() and src_out_delay_length()
+    idm, odm, nsub, sublen, flen, blk_in, blk_out = prm[:7]
+    return {'fir_delay': sublen + (nsub - 1) * idm + blk_in,
+            'out_delay': 1 + (nsub - 1) * odm,
+            'blk_in': blk_in, 'blk_out': blk_out, 'length': flen}
+
+
+def table_lines(name, table):
+    out = ['static const struct src_stage * const %s[%d][%d] = {' %
+           (name, len(table), len(table[0]))]
+    for i, row in enumerate(table):
+        refs = ['&%s' % x for x in row]
+        lines = []
+        for j in range(0, len(refs), 2):
+            lines.append('\t %s' % ', '.join(refs[j:j + 2]))
+        lines[0] = '\t{ ' + lines[0][2:]
+        out += [x + ',' for x in lines[:-1]]
+        out.append(lines[-1] + ('},' if i < len(table) - 1 else '}'))
+    out.append('};')
+    return out
+
+
+def rates_line(name, rates):
+    return 'static const int %s[%d] = { %s};' % (name, len(rates),
+                                                 ', '.join(str(x) for x in rates))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--in-fs', required=True, help='comma separated input rates')
+    parser.add_argument('--out-fs', required=True, help='comma separated output rates')
+    parser.add_argument('--exclude', default='',
+                        help='comma separated in:out rates of conversions to leave out')
+    parser.add_argument('coef_dir')
+    parser.add_argument('profile')
+    parser.add_argument('new_profile')
+    args = parser.parse_args()
+
+    with open(os.path.join(args.coef_dir, 'src_%s_int32_table.h' % args.profile)) as f:
+        table = f.read()
+    with open(os.path.join(args.coef_dir, 'src_%s_int32_define.h' % args.profile)) as f:
+        define = f.read()
+
+    in_fs = parse_rates(table, 'src_in_fs')
+    out_fs = parse_rates(table, 'src_out_fs')
+    tables = [parse_table(table, t, len(in_fs)) for t in ('src_table1', 'src_table2')]
+    new_in = [int(x) for x in args.in_fs.split(',')]
+    new_out = [int(x) for x in args.out_fs.split(',')]
+    for fs in new_in:
+        if fs not in in_fs:
+            sys.exit('input rate %d is not in the %s set' % (fs, args.profile))
+    for fs in new_out:
+        if fs not in out_fs:
+            sys.exit('output rate %d is not in the %s set' % (fs, args.profile))
+
+    exclude = [tuple(int(y) for y in x.split(':')) for x in args.exclude.split(',') if x]
+    new_tables = [[['src_int16_0_0_0_0' if (i, o) in exclude else
+                    t[out_fs.index(o)][in_fs.index(i)].replace('int32', 'int16')
+                    for i in new_in] for o in new_out] for t in tables]
+
+    stages = sorted({x for t in new_tables for row in t for x in row} -
+                    {'src_int16_1_1_0_0', 'src_int16_0_0_0_0'},
+                    key=lambda x: [int(y) for y in x.split('_')[2:]])
+
+    prefix = 'src_%s_int16' % args.new_profile
+    defs = []
+    for name in stages:
+        conv = name[len('src_int16_'):]
+        defs.append(export_stage(
+            os.path.join(args.coef_dir, 'src_%s_int32_%s.h' % (args.profile, conv)),
+            os.path.join(args.coef_dir, '%s_%s.h' % (prefix, conv)), name))
+
+    guard = '__SOF_AUDIO_COEFFICIENTS_SRC_%s_DEFINE_H__' % prefix.upper()
+    times = {x: int(re.search(r'#define %s (\d+)' % x, define).group(1))
+             for x in ('STAGE1_TIMES_MAX', 'STAGE2_TIMES_MAX', 'STAGE_BUF_SIZE')}
+    out = HEADER + ['#ifndef %s' % guard,
+                    '#define %s' % guard,
+                    '',
+                    '/* SRC constants */',
+                    '#define MAX_FIR_DELAY_SIZE %d' % max(x['fir_delay'] for x in defs),
+                    '#define MAX_OUT_DELAY_SIZE %d' % max(x['out_delay'] for x in defs),
+                    '#define MAX_BLK_IN %d' % max(x['blk_in'] for x in defs),
+                    '#define MAX_BLK_OUT %d' % max(x['blk_out'] for x in defs),
+                    '#define NUM_IN_FS %d' % len(new_in),
+                    '#define NUM_OUT_FS %d' % len(new_out)]
+    out += ['#define %s %d' % x for x in times.items()]
+    out += ['#define NUM_ALL_COEFFICIENTS %d' % sum(x['length'] for x in defs),
+            '',
+            '#endif /* %s */' % guard,
+            '',
+            '/** \\endcond */']
+    with open(os.path.join(args.coef_dir, '%s_define.h' % prefix), 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+    guard = '__SOF_AUDIO_COEFFICIENTS_SRC_%s_TABLE_H__' % prefix.upper()
+    out = HEADER + ['#ifndef %s' % guard,
+                    '#define %s' % guard,
+                    '',
+                    '/* SRC conversions */']
+    out += ['#include "%s_%s.h"' % (prefix, x[len('src_int16_'):]) for x in stages]
+    out += ['#include <stdint.h>',
+            '',
+            '/* SRC table */',
+            'static const int16_t fir_one = 16384;',
+            'static const struct src_stage src_int16_1_1_0_0 =  '
+            '{ 0, 0, 1, 1, 1, 1, 1, 0, -1, &fir_one };',
+            'static const struct src_stage src_int16_0_0_0_0 =  '
+            '{ 0, 0, 0, 0, 0, 0, 0, 0,  0, &fir_one };',
+            rates_line('src_in_fs', new_in),
+            rates_line('src_out_fs', new_out)]
+    out += table_lines('src_table1', new_tables[0])
+    out += [''] + table_lines('src_table2', new_tables[1])
+    out += ['',
+            '#endif /* %s */' % guard,
+            '',
+            '/** \\endcond */']
+    with open(os.path.join(args.coef_dir, '%s_table.h' % prefix), 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+    print('%d stages, %d coefficients' % (len(stages), sum(x['length'] for x in defs)),
+          file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
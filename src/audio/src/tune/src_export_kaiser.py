@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+"""Export compact Kaiser window descriptions of SRC coefficient tables.
+
+The SRC filters are designed by src_get.m as Kaiser windowed sinc lowpass
+filters, but the design iterates the stop-band attenuation and the final
+window parameters are not exported. This script recovers the cutoff and the
+Kaiser beta of every stage of a coefficients set from its header files and
+writes coef/src_<profile>_int32_kaiser.h, a replacement for the table header
+for CONFIG_COMP_SRC_COEF_GENERATE. The firmware generates the coefficients
+from it in src_kaiser_generate().
+
+A stage that the model can't reproduce within --max-error LSB keeps its
+coefficients table.
+
+Usage: src_export_kaiser.py [--max-error LSB] <coef directory> <profile>
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+
+def parse_stage(fn):
+    """Returns the src_stage initializer values and the coefficients"""
+    with open(fn) as f:
+        s = f.read()
+
+    fir = re.search(r'_fir\[\d+\] = \{(.*?)\};', s, re.S)
+    coefs = [int(x) for x in fir.group(1).split(',') if x.strip()]
+    stage = re.search(r'struct src_stage (\w+) = \{\s*([-\d, ]+),', s)
+    prm = [int(x) for x in stage.group(2).split(',') if x.strip()]
+    return stage.group(1), prm, coefs
+
+
+def prototype(prm, coefs):
+    """Reverts the polyphase order of src_export_coef.m"""
+    nsub, sublen, flen = prm[2], prm[3], prm[4]
+    b = [0] * flen
+    for p in range(nsub):
+        for i in range(sublen):
+            b[i * nsub + p] = coefs[p * sublen + i]
+    return b
+
+
+def i0(y):
+    """Modified Bessel function I0(2 sqrt(y))"""
+    term = 1.0
+    total = 1.0
+    k = 1
+    while term > total * 1e-17:
+        term *= y / (k * k)
+        total += term
+        k += 1
+    return total
+
+
+def design(taps, scale, cutoff, beta):
+    """Same filter as src_kaiser_generate() and fir1() of kaiser()"""
+    last = taps - 1
+    h = []
+    for n in range(taps):
+        m = abs(2 * n - last)
+        s = math.sin(math.pi * cutoff * m / 2) / (math.pi * m / 2) if m else cutoff
+        h.append(s * i0(beta * beta * (last - m) * (last + m) / (4 * last * last)))
+    g = scale / sum(h)
+    return [x * g for x in h]
+
+
+def residual(b, scale, cutoff, beta):
+    return [x - y for x, y in zip(design(len(b), scale, cutoff, beta), b)]
+
+
+def fit(b, scale, cutoff):
+    """Gauss-Newton fit of cutoff and beta, initial cutoff from the stage name"""
+    best = min((max(abs(x) for x in residual(b, scale, cutoff, 0.1102 * (rs - 8.7))),
+                0.1102 * (rs - 8.7)) for rs in range(50, 180, 4))
+    p = [cutoff, best[1]]
+    for _ in range(50):
+        r0 = residual(b, scale, *p)
+        jac = []
+        for k, d in enumerate((1e-9, 1e-6)):
+            q = list(p)
+            q[k] += d
+            jac.append([(x - y) / d for x, y in zip(residual(b, scale, *q), r0)])
+        a11 = sum(x * x for x in jac[0])
+        a12 = sum(x * y for x, y in zip(*jac))
+        a22 = sum(x * x for x in jac[1])
+        g1 = sum(x * y for x, y in zip(jac[0], r0))
+        g2 = sum(x * y for x, y in zip(jac[1], r0))
+        det = a11 * a22 - a12 * a12
+        d1 = (a22 * g1 - a12 * g2) / det
+        d2 = (a11 * g2 - a12 * g1) / det
+        p = [p[0] - d1, p[1] - d2]
+        if abs(d1) < 1e-15 and abs(d2) < 1e-12:
+            break
+    return p
+
+
+def export_stage(fn, max_error):
+    name, prm, coefs = parse_stage(fn)
+    b = prototype(prm, coefs)
+    nsub, flen, blk_in, blk_out, shift = prm[2], prm[4], prm[5], prm[6], prm[8]
+    pb, sb = [int(x) / 1e4 for x in re.search(r'_(\d+)_(\d+)\.h$', fn).groups()]
+
+    # DC gain relative to the interpolation factor, 0 dB for ipc4
+    scale = nsub * 2.0 ** (31 + shift)
+    gain = round(sum(b) / scale * 2 ** 30)
+    scale *= gain / 2 ** 30
+
+    cutoff, beta = fit(b, scale, (pb + sb) / max(blk_in, blk_out))
+    cutoff = round(cutoff * 2 ** 32)
+    beta = round(beta * 2 ** 27)
+    err = max(abs(x) for x in residual(b, scale, cutoff / 2 ** 32, beta / 2 ** 27))
+    if err > max_error:
+        return name, prm, None, err
+
+    return name, prm, (cutoff, beta, gain), err
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--max-error', type=float, default=16.0,
+                        help='largest coefficient error in LSB to accept')
+    parser.add_argument('coef_dir')
+    parser.add_argument('profile')
+    args = parser.parse_args()
+
+    table_fn = os.path.join(args.coef_dir, 'src_%s_int32_table.h' % args.profile)
+    with open(table_fn) as f:
+        table = f.read()
+
+    includes = re.findall(r'#include "(src_%s_int32_\w+\.h)"' % args.profile, table)
+    tables = table[table.index('/* SRC table */'):table.rindex('#endif')]
+
+    guard = '__SOF_AUDIO_COEFFICIENTS_SRC_SRC_%s_INT32_KAISER_H__' % args.profile.upper()
+    out = ['/* SPDX-License-Identifier: BSD-3-Clause',
+           ' *',
+           ' * Copyright(c) 2026 Intel Corporation. All rights reserved.',
+           ' *',
+           ' */',
+           '',
+           '/** \\cond GENERATED_BY_TOOLS_TUNE_SRC */',
+           '',
+           '#ifndef %s' % guard,
+           '#define %s' % guard,
+           '',
+           '/* SRC conversions, stages without a Kaiser design keep the table */',
+           '#include <stdint.h>']
+
+    stages = ['']
+    kept = 0
+    for fn in includes:
+        name, prm, kaiser, err = export_stage(os.path.join(args.coef_dir, fn), args.max_error)
+        print('%-40s max error %.2f LSB%s' % (fn, err, '' if kaiser else ', kept'),
+              file=sys.stderr)
+        if not kaiser:
+            out.append('#include "%s"' % fn)
+            kept += 1
+            continue
+
+        kname = name.replace('src_', 'src_kaiser_', 1)
+        stages.append('static const struct src_kaiser %s = { %d, %d, %d };' % ((kname,) + kaiser))
+        stages.append('static const struct src_stage %s = {' % name)
+        stages.append('\t%s,' % ', '.join(str(x) for x in prm))
+        stages.append('\tNULL, &%s};' % kname)
+        stages.append('')
+
+    out += stages
+    out.append(tables.rstrip('\n'))
+    out.append('')
+    out.append('#endif /* %s */' % guard)
+    out.append('')
+    out.append('/** \\endcond */')
+
+    out_fn = os.path.join(args.coef_dir, 'src_%s_int32_kaiser.h' % args.profile)
+    with open(out_fn, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+    print('%d stages, %d kept as tables' % (len(includes), kept), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
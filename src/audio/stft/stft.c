@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/* STFT pass-through component. The component runs the STFT analysis and
+ * overlap-add synthesis without spectral modification. It is used to verify
+ * the reconstruction of the STFT framework and to measure its cost. The output
+ * is the input delayed by frame length.
+ */
+
+#include <sof/audio/stft/stft.h>
+#include <sof/audio/module_adapter/module/generic.h>
+#include <sof/audio/component.h>
+#include <sof/audio/data_blob.h>
+#include <sof/audio/format.h>
+#include <sof/audio/ipc-config.h>
+#include <sof/audio/sink_api.h>
+#include <sof/audio/source_api.h>
+#include <sof/common.h>
+#include <sof/lib/uuid.h>
+#include <sof/platform.h>
+#include <sof/trace/trace.h>
+#include <sof/ut.h>
+#include <ipc/control.h>
+#include <ipc/stream.h>
+#include <rtos/alloc.h>
+#include <rtos/init.h>
+#include <user/stft.h>
+#include <user/trace.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+LOG_MODULE_REGISTER(stft, CONFIG_SOF_LOG_LEVEL);
+
+SOF_DEFINE_REG_UUID(stft);
+
+DECLARE_TR_CTX(stft_tr, SOF_UUID(stft_uuid), LOG_LEVEL_INFO);
+
+/* STFT component private data */
+struct stft_comp_data {
+	struct stft_state state;
+	struct comp_data_blob_handler *model_handler;
+};
+
+static int stft_init(struct processing_module *mod)
+{
+	struct module_data *md = &mod->priv;
+	struct comp_dev *dev = mod->dev;
+	struct module_config *cfg = &md->cfg;
+	struct stft_comp_data *cd;
+	size_t bs = cfg->size;
+	int ret;
+
+	comp_info(dev, "stft_init()");
+
+	if (bs > SOF_STFT_CONFIG_MAX_SIZE) {
+		comp_err(dev, "stft_init() error: configuration blob size %zu exceeds %d",
+			 bs, SOF_STFT_CONFIG_MAX_SIZE);
+		return -EINVAL;
+	}
+
+	cd = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, sizeof(*cd));
+	if (!cd)
+		return -ENOMEM;
+
+	md->private = cd;
+	cd->model_handler = comp_data_blob_handler_new(dev);
+	if (!cd->model_handler) {
+		comp_err(dev, "stft_init(): comp_data_blob_handler_new() failed.");
+		ret = -ENOMEM;
+		goto err;
+	}
+
+	ret = comp_init_data_blob(cd->model_handler, bs, cfg->init_data);
+	if (ret < 0) {
+		comp_err(dev, "stft_init(): comp_init_data_blob() failed.");
+		goto err_init;
+	}
+
+	return 0;
+
+err_init:
+	comp_data_blob_handler_free(cd->model_handler);
+
+err:
+	rfree(cd);
+	return ret;
+}
+
+static int stft_free(struct processing_module *mod)
+{
+	struct stft_comp_data *cd = module_get_private_data(mod);
+
+	comp_info(mod->dev, "stft_free()");
+	comp_data_blob_handler_free(cd->model_handler);
+	stft_free_buffers(&cd->state);
+	rfree(cd);
+	return 0;
+}
+
+static int stft_get_config(struct processing_module *mod,
+			   uint32_t config_id, uint32_t *data_offset_size,
+			   uint8_t *fragment, size_t fragment_size)
+{
+	struct sof_ipc_ctrl_data *cdata = (struct sof_ipc_ctrl_data *)fragment;
+	struct stft_comp_data *cd = module_get_private_data(mod);
+
+	comp_info(mod->dev, "stft_get_config()");
+
+	return comp_data_blob_get_cmd(cd->model_handler, cdata, fragment_size);
+}
+
+/* The new configuration is applied at next prepare() */
+static int stft_set_config(struct processing_module *mod, uint32_t config_id,
+			   enum module_cfg_fragment_position pos, uint32_t data_offset_size,
+			   const uint8_t *fragment, size_t fragment_size, uint8_t *response,
+			   size_t response_size)
+{
+	struct stft_comp_data *cd = module_get_private_data(mod);
+
+	comp_info(mod->dev, "stft_set_config()");
+
+	return comp_data_blob_set(cd->model_handler, pos, data_offset_size,
+				  fragment, fragment_size);
+}
+
+static int stft_process_frames(struct processing_module *mod,
+			       struct sof_source **sources, int num_of_sources,
+			       struct sof_sink **sinks, int num_of_sinks)
+{
+	struct stft_comp_data *cd = module_get_private_data(mod);
+	struct sof_source *source = sources[0];
+	struct sof_sink *sink = sinks[0];
+	int frames;
+
+	frames = MIN(source_get_data_frames_available(source), sink_get_free_frames(sink));
+	if (!frames)
+		return 0;
+
+	return stft_process(&cd->state, source, sink, frames);
+}
+
+#if CONFIG_IPC_MAJOR_4
+static int stft_ipc4_params(struct processing_module *mod, struct sof_source *source,
+			    struct sof_sink *sink)
+{
+	struct sof_ipc_stream_params *params = mod->stream_params;
+	struct comp_dev *dev = mod->dev;
+	int ret;
+
+	ipc4_base_module_cfg_to_stream_params(&mod->priv.cfg.base_cfg, params);
+	component_set_nearest_period_frames(dev, params->rate);
+	ret = source_set_params(source, params, true);
+	if (ret)
+		return ret;
+
+	return sink_set_params(sink, params, true);
+}
+#endif /* CONFIG_IPC_MAJOR_4 */
+
+static int stft_prepare(struct processing_module *mod,
+			struct sof_source **sources, int num_of_sources,
+			struct sof_sink **sinks, int num_of_sinks)
+{
+	struct stft_comp_data *cd = module_get_private_data(mod);
+	struct sof_source *source = sources[0];
+	struct sof_sink *sink = sinks[0];
+	struct comp_dev *dev = mod->dev;
+	struct sof_stft_config *config;
+	enum sof_ipc_frame fmt;
+	size_t config_size;
+	int channels;
+	int ret;
+
+	comp_info(dev, "stft_prepare()");
+
+#if CONFIG_IPC_MAJOR_4
+	ret = stft_ipc4_params(mod, source, sink);
+	if (ret) {
+		comp_err(dev, "stft_prepare(): Failed to set source or sink parameters.");
+		return ret;
+	}
+#endif
+
+	fmt = source_get_frm_fmt(source);
+	channels = source_get_channels(source);
+	if (fmt != sink_get_frm_fmt(sink) || channels != sink_get_channels(sink)) {
+		comp_err(dev, "stft_prepare(): Source and sink format or channels mismatch.");
+		return -EINVAL;
+	}
+
+	config = comp_get_data_blob(cd->model_handler, &config_size, NULL);
+	if (config && config_size != sizeof(struct sof_stft_config)) {
+		comp_err(dev, "stft_prepare(): Illegal configuration size %zu", config_size);
+		return -EINVAL;
+	}
+
+	/* Release buffers from previous prepare if not reset in between */
+	stft_free_buffers(&cd->state);
+	return stft_setup(mod, &cd->state, config, channels, fmt, NULL, NULL);
+}
+
+static int stft_reset(struct processing_module *mod)
+{
+	struct stft_comp_data *cd = module_get_private_data(mod);
+
+	comp_info(mod->dev, "stft_reset()");
+
+	stft_free_buffers(&cd->state);
+	return 0;
+}
+
+static const struct module_interface stft_interface = {
+	.init = stft_init,
+	.free = stft_free,
+	.set_configuration = stft_set_config,
+	.get_configuration = stft_get_config,
+	.process = stft_process_frames,
+	.prepare = stft_prepare,
+	.reset = stft_reset,
+};
+
+DECLARE_MODULE_ADAPTER(stft_interface, stft_uuid, stft_tr);
+SOF_MODULE_INIT(stft, sys_comp_module_stft_interface_init);
+
+#if CONFIG_COMP_STFT_MODULE
+/* modular: llext dynamic link */
+
+#include <module/module/api_ver.h>
+#include <module/module/llext.h>
+#include <rimage/sof/user/manifest.h>
+
+SOF_LLEXT_MOD_ENTRY(stft, &stft_interface);
+
+static const struct sof_man_module_manifest mod_manifest __section(".module") __used =
+	SOF_LLEXT_MODULE_MANIFEST("STFT", stft_llext_entry, 1, SOF_REG_UUID(stft), 40);
+
+SOF_LLEXT_BUILDINFO;
+
+#endif
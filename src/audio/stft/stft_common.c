@@ -0,0 +1,437 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/stft/stft.h>
+#include <sof/audio/module_adapter/module/generic.h>
+#include <sof/audio/component.h>
+#include <sof/audio/format.h>
+#include <sof/audio/sink_api.h>
+#include <sof/audio/source_api.h>
+#include <sof/math/fft.h>
+#include <sof/math/numbers.h>
+#include <sof/math/window.h>
+#include <rtos/alloc.h>
+#include <rtos/string.h>
+#include <user/stft.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+LOG_MODULE_DECLARE(stft, CONFIG_SOF_LOG_LEVEL);
+
+/* The FFT library leaves the first bit reversed output element untouched so
+ * it is set here from the first input element. For inverse transform the
+ * library conjugates the input, the same is done here for the first element.
+ */
+static void stft_fft_execute(struct stft_state *state, bool ifft)
+{
+	struct icomplex32 *in = state->fft_buf;
+	struct icomplex32 *out = state->fft_out;
+	int len = state->fft_plan->len;
+
+	out[0].real = in[0].real >> len;
+	if (ifft)
+		out[0].imag = SATP_INT32((int64_t)-1 * in[0].imag) >> len;
+	else
+		out[0].imag = in[0].imag >> len;
+
+	fft_execute_32(state->fft_plan, ifft);
+}
+
+/* Window two channels into real and imaginary parts of one complex FFT and
+ * separate the spectra of the two real signals from the FFT output using
+ * the conjugate symmetry, A(k) = (X(k) + X*(N - k)) / 2 and
+ * B(k) = (X(k) - X*(N - k)) / 2j. A single channel is windowed into the real
+ * part only. The frame is normalized before windowing to use the full
+ * word length in the FFT.
+ */
+static void stft_analysis(struct stft_state *state, int ch, bool pair)
+{
+	struct icomplex32 *buf = state->fft_buf;
+	struct icomplex32 *out = state->fft_out;
+	struct icomplex32 *sa = state->spectra[ch];
+	struct icomplex32 *sb;
+	const int16_t *w = state->window;
+	int32_t *xa = state->in_buf[ch];
+	int32_t *xb;
+	int32_t peak = 0;
+	int n = state->fft_size;
+	int shift;
+	int nk;
+	int i;
+
+	for (i = 0; i < n; i++)
+		peak |= xa[i] ^ (xa[i] >> 31);
+
+	if (pair) {
+		xb = state->in_buf[ch + 1];
+		for (i = 0; i < n; i++)
+			peak |= xb[i] ^ (xb[i] >> 31);
+
+		shift = norm_int32(peak);
+		for (i = 0; i < n; i++) {
+			buf[i].real = Q_MULTSR_32X32((int64_t)(xa[i] << shift), w[i], 31, 15, 31);
+			buf[i].imag = Q_MULTSR_32X32((int64_t)(xb[i] << shift), w[i], 31, 15, 31);
+		}
+	} else {
+		shift = norm_int32(peak);
+		for (i = 0; i < n; i++) {
+			buf[i].real = Q_MULTSR_32X32((int64_t)(xa[i] << shift), w[i], 31, 15, 31);
+			buf[i].imag = 0;
+		}
+	}
+
+	state->norm_shift[ch] = shift;
+	stft_fft_execute(state, false);
+
+	if (!pair) {
+		memcpy_s(sa, state->half_fft_size * sizeof(struct icomplex32),
+			 out, state->half_fft_size * sizeof(struct icomplex32));
+		return;
+	}
+
+	sb = state->spectra[ch + 1];
+	state->norm_shift[ch + 1] = shift;
+	for (i = 0; i < state->half_fft_size; i++) {
+		nk = (n - i) & (n - 1);
+		sa[i].real = ((int64_t)out[i].real + out[nk].real) >> 1;
+		sa[i].imag = ((int64_t)out[i].imag - out[nk].imag) >> 1;
+		sb[i].real = ((int64_t)out[i].imag + out[nk].imag) >> 1;
+		sb[i].imag = ((int64_t)out[nk].real - out[i].real) >> 1;
+	}
+}
+
+/* Combine the two half spectra into a full conjugate symmetric spectrum of
+ * Y(k) = A(k) + jB(k) and inverse transform it. The real and imaginary parts
+ * of the result are the two channels. The DC and Nyquist bins of a real
+ * signal are real so their imaginary parts are ignored.
+ */
+static void stft_synthesis(struct stft_state *state, int ch, bool pair)
+{
+	struct icomplex32 *buf = state->fft_buf;
+	struct icomplex32 *out = state->fft_out;
+	struct icomplex32 *sa = state->spectra[ch];
+	struct icomplex32 *sb;
+	const int32_t *w = state->synth_window;
+	int32_t *ya = state->ola_buf[ch];
+	int32_t *yb;
+	int32_t tmp;
+	int qp = 31 - state->norm_shift[ch];
+	int n = state->fft_size;
+	int half = n >> 1;
+	int i;
+
+	if (pair) {
+		sb = state->spectra[ch + 1];
+		buf[0].real = sa[0].real;
+		buf[0].imag = sb[0].real;
+		buf[half].real = sa[half].real;
+		buf[half].imag = sb[half].real;
+		for (i = 1; i < half; i++) {
+			buf[i].real = sat_int32((int64_t)sa[i].real - sb[i].imag);
+			buf[i].imag = sat_int32((int64_t)sa[i].imag + sb[i].real);
+			buf[n - i].real = sat_int32((int64_t)sa[i].real + sb[i].imag);
+			buf[n - i].imag = sat_int32((int64_t)sb[i].real - sa[i].imag);
+		}
+	} else {
+		buf[0].real = sa[0].real;
+		buf[0].imag = 0;
+		buf[half].real = sa[half].real;
+		buf[half].imag = 0;
+		for (i = 1; i < half; i++) {
+			buf[i] = sa[i];
+			buf[n - i].real = sa[i].real;
+			buf[n - i].imag = SATP_INT32((int64_t)-1 * sa[i].imag);
+		}
+	}
+
+	stft_fft_execute(state, true);
+
+	/* Apply synthesis window, remove normalize gain, and overlap-add */
+	for (i = 0; i < n; i++) {
+		tmp = Q_MULTSR_32X32((int64_t)out[i].real, w[i], 31, 28, qp);
+		ya[i] = sat_int32((int64_t)ya[i] + tmp);
+	}
+
+	if (!pair)
+		return;
+
+	/* The library inverse FFT output is the complex conjugate of the
+	 * inverse transform so the second channel is subtracted.
+	 */
+	yb = state->ola_buf[ch + 1];
+	for (i = 0; i < n; i++) {
+		tmp = Q_MULTSR_32X32((int64_t)out[i].imag, w[i], 31, 28, qp);
+		yb[i] = sat_int32((int64_t)yb[i] - tmp);
+	}
+}
+
+void stft_do_frame(struct stft_state *state)
+{
+	size_t keep_bytes = (state->fft_size - state->hop_size) * sizeof(int32_t);
+	size_t hop_bytes = state->hop_size * sizeof(int32_t);
+	int32_t *ola;
+	int32_t *in;
+	bool pair;
+	int ch;
+
+	for (ch = 0; ch < state->channels; ch += 2) {
+		pair = ch + 1 < state->channels;
+		stft_analysis(state, ch, pair);
+	}
+
+	if (state->frame_func)
+		state->frame_func(state, state->frame_arg);
+
+	for (ch = 0; ch < state->channels; ch += 2) {
+		pair = ch + 1 < state->channels;
+		stft_synthesis(state, ch, pair);
+	}
+
+	/* The first hop of overlap-add buffer is complete and is output next,
+	 * then the buffers are shifted by hop for the next frame.
+	 */
+	for (ch = 0; ch < state->channels; ch++) {
+		in = state->in_buf[ch];
+		ola = state->ola_buf[ch];
+		memcpy_s(state->out_buf[ch], hop_bytes, ola, hop_bytes);
+		memmove(ola, ola + state->hop_size, keep_bytes);
+		memset(ola + state->fft_size - state->hop_size, 0, hop_bytes);
+		memmove(in, in + state->hop_size, keep_bytes);
+	}
+
+	state->fill = state->fft_size - state->hop_size;
+}
+
+static int stft_get_window(struct stft_state *state, const struct sof_stft_config *config)
+{
+	int16_t a0;
+
+	switch (config->window) {
+	case STFT_RECTANGULAR_WINDOW:
+		win_rectangular_16b(state->window, state->fft_size);
+		return 0;
+	case STFT_BLACKMAN_WINDOW:
+		a0 = config->blackman_coef ? config->blackman_coef : WIN_BLACKMAN_A0;
+		win_blackman_16b(state->window, state->fft_size, a0);
+		return 0;
+	case STFT_HAMMING_WINDOW:
+		win_hamming_16b(state->window, state->fft_size);
+		return 0;
+	case STFT_HANN_WINDOW:
+		win_hann_16b(state->window, state->fft_size);
+		return 0;
+	case STFT_POVEY_WINDOW:
+		win_povey_16b(state->window, state->fft_size);
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+/* The synthesis window is the analysis window divided by the sum of squared
+ * analysis window values that overlap at the same output sample. Then the
+ * overlap-add of analysis and synthesis windowed frames sums to one for every
+ * output sample, for any window and hop size combination.
+ */
+static int stft_get_synthesis_window(struct stft_state *state)
+{
+	const int16_t *w = state->window;
+	int64_t sum;
+	int n = state->fft_size;
+	int i;
+	int j;
+
+	for (i = 0; i < n; i++) {
+		sum = 0;
+		for (j = i % state->hop_size; j < n; j += state->hop_size)
+			sum += (int32_t)w[j] * w[j]; /* Q2.30 */
+
+		if (sum < STFT_WINDOW_SUM_MIN)
+			return -EINVAL;
+
+		/* Q1.15 / Q2.30 shifted to Q4.28 */
+		state->synth_window[i] = ((int64_t)w[i] << 43) / sum;
+	}
+
+	return 0;
+}
+
+static stft_copy_func stft_find_func(enum sof_ipc_frame fmt)
+{
+	int i;
+
+	for (i = 0; i < stft_fm_count; i++) {
+		if (fmt == stft_fm[i].fmt)
+			return stft_fm[i].func;
+	}
+
+	return NULL;
+}
+
+void stft_reset_state(struct stft_state *state)
+{
+	int ch;
+
+	for (ch = 0; ch < state->channels; ch++) {
+		memset(state->in_buf[ch], 0, state->fft_size * sizeof(int32_t));
+		memset(state->ola_buf[ch], 0, state->fft_size * sizeof(int32_t));
+		memset(state->out_buf[ch], 0, state->hop_size * sizeof(int32_t));
+	}
+
+	state->fill = state->fft_size - state->hop_size;
+}
+
+int stft_setup(struct processing_module *mod, struct stft_state *state,
+	       const struct sof_stft_config *config, int channels,
+	       enum sof_ipc_frame fmt, stft_frame_func func, void *arg)
+{
+	const struct sof_stft_config default_config = {
+		.size = sizeof(struct sof_stft_config),
+		.frame_length = STFT_DEFAULT_FRAME_LENGTH,
+		.frame_shift = STFT_DEFAULT_FRAME_SHIFT,
+		.window = STFT_DEFAULT_WINDOW,
+	};
+	struct comp_dev *dev = mod->dev;
+	uint8_t *p;
+	int n;
+	int ch;
+	int ret;
+
+	if (!config)
+		config = &default_config;
+
+	n = config->frame_length;
+	comp_info(dev, "stft_setup(), frame_length = %d, frame_shift = %d, window = %d, channels = %d",
+		  n, config->frame_shift, config->window, channels);
+
+	if (n < STFT_FRAME_LENGTH_MIN || n > STFT_FRAME_LENGTH_MAX || (n & (n - 1))) {
+		comp_err(dev, "stft_setup(): Illegal frame length %d", n);
+		return -EINVAL;
+	}
+
+	if (config->frame_shift < 1 || config->frame_shift > n) {
+		comp_err(dev, "stft_setup(): Illegal frame shift %d", config->frame_shift);
+		return -EINVAL;
+	}
+
+	if (channels < 1 || channels > PLATFORM_MAX_CHANNELS) {
+		comp_err(dev, "stft_setup(): Illegal channels count %d", channels);
+		return -EINVAL;
+	}
+
+	state->copy_func = stft_find_func(fmt);
+	if (!state->copy_func) {
+		comp_err(dev, "stft_setup(): No processing function for format %d", fmt);
+		return -EINVAL;
+	}
+
+	state->fft_size = n;
+	state->half_fft_size = (n >> 1) + 1;
+	state->hop_size = config->frame_shift;
+	state->channels = channels;
+	state->frame_func = func;
+	state->frame_arg = arg;
+
+	/* Allocate in one chunk the FFT buffers, windows, and per channel spectra,
+	 * input, overlap-add, and output buffers.
+	 */
+	state->buffers_size = 2 * n * sizeof(struct icomplex32) +
+		n * sizeof(int32_t) + ALIGN_UP(n * sizeof(int16_t), sizeof(int32_t)) +
+		channels * (state->half_fft_size * sizeof(struct icomplex32) +
+			    2 * n * sizeof(int32_t) + state->hop_size * sizeof(int32_t));
+
+	state->buffers = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, state->buffers_size);
+	if (!state->buffers) {
+		comp_err(dev, "stft_setup(): Failed buffers allocate");
+		return -ENOMEM;
+	}
+
+	p = state->buffers;
+	state->fft_buf = (struct icomplex32 *)p;
+	p += n * sizeof(struct icomplex32);
+	state->fft_out = (struct icomplex32 *)p;
+	p += n * sizeof(struct icomplex32);
+	state->synth_window = (int32_t *)p;
+	p += n * sizeof(int32_t);
+	state->window = (int16_t *)p;
+	p += ALIGN_UP(n * sizeof(int16_t), sizeof(int32_t));
+	for (ch = 0; ch < channels; ch++) {
+		state->spectra[ch] = (struct icomplex32 *)p;
+		p += state->half_fft_size * sizeof(struct icomplex32);
+		state->in_buf[ch] = (int32_t *)p;
+		p += n * sizeof(int32_t);
+		state->ola_buf[ch] = (int32_t *)p;
+		p += n * sizeof(int32_t);
+		state->out_buf[ch] = (int32_t *)p;
+		p += state->hop_size * sizeof(int32_t);
+	}
+
+	ret = stft_get_window(state, config);
+	if (ret < 0) {
+		comp_err(dev, "stft_setup(): Illegal window %d", config->window);
+		goto free_buffers;
+	}
+
+	ret = stft_get_synthesis_window(state);
+	if (ret < 0) {
+		comp_err(dev, "stft_setup(): Too small window overlap, reduce frame shift");
+		goto free_buffers;
+	}
+
+	state->fft_plan = fft_plan_new(state->fft_buf, state->fft_out, n, 32);
+	if (!state->fft_plan) {
+		comp_err(dev, "stft_setup(): Failed FFT init");
+		ret = -ENOMEM;
+		goto free_buffers;
+	}
+
+	stft_reset_state(state);
+	return 0;
+
+free_buffers:
+	rfree(state->buffers);
+	state->buffers = NULL;
+	return ret;
+}
+
+void stft_free_buffers(struct stft_state *state)
+{
+	fft_plan_free(state->fft_plan);
+	rfree(state->buffers);
+	state->fft_plan = NULL;
+	state->buffers = NULL;
+}
+
+int stft_process(struct stft_state *state, struct sof_source *source,
+		 struct sof_sink *sink, int frames)
+{
+	const void *x;
+	const void *x_start;
+	void *y;
+	void *y_start;
+	size_t source_bytes = frames * source_get_frame_bytes(source);
+	size_t sink_bytes = frames * sink_get_frame_bytes(sink);
+	size_t x_size;
+	size_t y_size;
+	int ret;
+
+	ret = source_get_data(source, source_bytes, &x, &x_start, &x_size);
+	if (ret)
+		return ret;
+
+	ret = sink_get_buffer(sink, sink_bytes, &y, &y_start, &y_size);
+	if (ret) {
+		source_release_data(source, 0);
+		return ret;
+	}
+
+	state->copy_func(state, x, x_start, (const uint8_t *)x_start + x_size,
+			 y, y_start, (uint8_t *)y_start + y_size, frames);
+
+	source_release_data(source, source_bytes);
+	sink_commit_buffer(sink, sink_bytes);
+	return 0;
+}
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/stft/stft.h>
+#include <sof/audio/audio_stream.h>
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <ipc/stream.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* The copy functions de-interleave source samples into the channel input
+ * buffers and interleave the previously synthesized output samples into
+ * sink in lockstep. When an input frame is complete the frame is processed
+ * and a new hop of output samples becomes available. The circular source and
+ * sink buffers are assumed to wrap at frame boundary.
+ */
+
+static int stft_frames_without_wrap(struct stft_state *state, int frames,
+				    int source_samples, int sink_samples)
+{
+	int n = MIN(frames, state->fft_size - state->fill);
+
+	n = MIN(n, source_samples / state->channels);
+	return MIN(n, sink_samples / state->channels);
+}
+
+#if CONFIG_FORMAT_S16LE
+static void stft_copy_s16(struct stft_state *state,
+			  const void *x_ptr, const void *x_start, const void *x_end,
+			  void *y_ptr, void *y_start, void *y_end,
+			  int frames)
+{
+	const int16_t *x = x_ptr;
+	int16_t *y = y_ptr;
+	const int out_offset = state->fft_size - state->hop_size;
+	const int nch = state->channels;
+	int32_t *in;
+	int32_t *out;
+	int ch;
+	int n;
+	int i;
+	int j;
+
+	while (frames) {
+		n = stft_frames_without_wrap(state, frames, (const int16_t *)x_end - x,
+					     (int16_t *)y_end - y);
+		for (ch = 0; ch < nch; ch++) {
+			in = state->in_buf[ch] + state->fill;
+			out = state->out_buf[ch] + state->fill - out_offset;
+			for (i = 0, j = ch; i < n; i++, j += nch) {
+				in[i] = (int32_t)x[j] << 16;
+				y[j] = sat_int16(Q_SHIFT_RND(out[i], 31, 15));
+			}
+		}
+
+		x += n * nch;
+		y += n * nch;
+		x = cir_buf_wrap((void *)x, (void *)x_start, (void *)x_end);
+		y = cir_buf_wrap(y, y_start, y_end);
+		state->fill += n;
+		frames -= n;
+		if (state->fill == state->fft_size)
+			stft_do_frame(state);
+	}
+}
+#endif /* CONFIG_FORMAT_S16LE */
+
+#if CONFIG_FORMAT_S24LE
+static void stft_copy_s24(struct stft_state *state,
+			  const void *x_ptr, const void *x_start, const void *x_end,
+			  void *y_ptr, void *y_start, void *y_end,
+			  int frames)
+{
+	const int32_t *x = x_ptr;
+	int32_t *y = y_ptr;
+	const int out_offset = state->fft_size - state->hop_size;
+	const int nch = state->channels;
+	int32_t *in;
+	int32_t *out;
+	int ch;
+	int n;
+	int i;
+	int j;
+
+	while (frames) {
+		n = stft_frames_without_wrap(state, frames, (const int32_t *)x_end - x,
+					     (int32_t *)y_end - y);
+		for (ch = 0; ch < nch; ch++) {
+			in = state->in_buf[ch] + state->fill;
+			out = state->out_buf[ch] + state->fill - out_offset;
+			for (i = 0, j = ch; i < n; i++, j += nch) {
+				in[i] = x[j] << 8;
+				y[j] = sat_int24(Q_SHIFT_RND(out[i], 31, 23));
+			}
+		}
+
+		x += n * nch;
+		y += n * nch;
+		x = cir_buf_wrap((void *)x, (void *)x_start, (void *)x_end);
+		y = cir_buf_wrap(y, y_start, y_end);
+		state->fill += n;
+		frames -= n;
+		if (state->fill == state->fft_size)
+			stft_do_frame(state);
+	}
+}
+#endif /* CONFIG_FORMAT_S24LE */
+
+#if CONFIG_FORMAT_S32LE
+static void stft_copy_s32(struct stft_state *state,
+			  const void *x_ptr, const void *x_start, const void *x_end,
+			  void *y_ptr, void *y_start, void *y_end,
+			  int frames)
+{
+	const int32_t *x = x_ptr;
+	int32_t *y = y_ptr;
+	const int out_offset = state->fft_size - state->hop_size;
+	const int nch = state->channels;
+	int32_t *in;
+	int32_t *out;
+	int ch;
+	int n;
+	int i;
+	int j;
+
+	while (frames) {
+		n = stft_frames_without_wrap(state, frames, (const int32_t *)x_end - x,
+					     (int32_t *)y_end - y);
+		for (ch = 0; ch < nch; ch++) {
+			in = state->in_buf[ch] + state->fill;
+			out = state->out_buf[ch] + state->fill - out_offset;
+			for (i = 0, j = ch; i < n; i++, j += nch) {
+				in[i] = x[j];
+				y[j] = out[i];
+			}
+		}
+
+		x += n * nch;
+		y += n * nch;
+		x = cir_buf_wrap((void *)x, (void *)x_start, (void *)x_end);
+		y = cir_buf_wrap(y, y_start, y_end);
+		state->fill += n;
+		frames -= n;
+		if (state->fill == state->fft_size)
+			stft_do_frame(state);
+	}
+}
+#endif /* CONFIG_FORMAT_S32LE */
+
+const struct stft_func_map stft_fm[] = {
+#if CONFIG_FORMAT_S16LE
+	{SOF_IPC_FRAME_S16_LE, stft_copy_s16},
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	{SOF_IPC_FRAME_S24_4LE, stft_copy_s24},
+#endif /* CONFIG_FORMAT_S24LE */
+#if CONFIG_FORMAT_S32LE
+	{SOF_IPC_FRAME_S32_LE, stft_copy_s32},
+#endif /* CONFIG_FORMAT_S32LE */
+};
+
+const size_t stft_fm_count = ARRAY_SIZE(stft_fm);
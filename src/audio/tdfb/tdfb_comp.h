@@ -10,6 +10,7 @@
 
 #include <sof/audio/module_adapter/module/generic.h>
 #include <sof/audio/audio_stream.h>
+#include <sof/math/fft.h>
 #include <sof/math/fir_generic.h>
 #include <sof/math/fir_hifi2ep.h>
 #include <sof/math/fir_hifi3.h>
@@ -49,23 +50,35 @@
 
 struct tdfb_direction_data {
 	struct iir_state_df1 emphasis[PLATFORM_MAX_CHANNELS];
-	int32_t timediff[PLATFORM_MAX_CHANNELS];
 	int32_t timediff_iter[PLATFORM_MAX_CHANNELS];
 	int64_t level_ambient;
+	struct fft_plan *fft_plan;
+	struct icomplex32 *fft_buf;	/* fft_size */
+	struct icomplex32 *fft_out;	/* fft_size */
+	struct icomplex32 *ref_spectrum; /* half_fft_size, reference microphone */
+	struct icomplex32 *spectra;	/* 2 * half_fft_size, two other microphones */
+	struct icomplex32 *cross_spectra; /* half_fft_size per pair, PHAT weighted Q2.30 */
 	uint32_t trigger;
 	int32_t level;
 	int32_t unit_delay; /* Q1.31 seconds */
+	int32_t fs;
 	int32_t frame_count_since_control;
 	int32_t *df1_delay;
-	int32_t *r;
+	int32_t *r; /* GCC, 2 * max_lag + 1 per pair */
+	int32_t *coarse_lags; /* Q16.16 lags, num_pairs per coarse angle */
 	int16_t *d;
 	int16_t *d_end;
 	int16_t *wp;
-	int16_t *rp;
-	int16_t step_sign;
+	int16_t *window; /* Q1.15, fft_size */
 	int16_t az_slow;
 	int16_t az;
 	int16_t max_lag;
+	int16_t num_pairs;
+	int16_t num_coarse;
+	int16_t az_coarse_min;
+	int16_t az_coarse_step;
+	int16_t fft_size;
+	int16_t half_fft_size;
 	size_t d_size;
 	size_t r_size;
 	bool line_array; /* Limit scan to -90 to 90 degrees */
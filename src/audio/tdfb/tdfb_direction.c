@@ -9,9 +9,13 @@
 
 #include <ipc/topology.h>
 #include <rtos/alloc.h>
+#include <rtos/string.h>
+#include <sof/math/fft.h>
 #include <sof/math/iir_df1.h>
+#include <sof/math/numbers.h>
 #include <sof/math/trig.h>
 #include <sof/math/sqrt.h>
+#include <sof/math/window.h>
 #include <user/eq.h>
 #include <stdint.h>
 
@@ -30,11 +34,22 @@
 #define FAST_LEVEL_SHIFT	1
 #define POWER_THRESHOLD		Q_CONVERT_FLOAT(15.849, 10)	/* 12 dB, value is 10^(dB/10) */
 
-/* Iteration parameters, smaller step and larger iterations is more accurate but
- * consumes more cycles.
+/* The time differences of arrival are estimated with generalized cross-correlation
+ * with phase transform (GCC-PHAT). The PHAT weighted cross-spectra are smoothed over
+ * periods with y(n) = y(n - 1) + (x(n) - y(n - 1)) * 2^-GCC_SMOOTH_SHIFT. The FFT
+ * size is at least GCC_FFT_SIZE_MIN and covers two periods and four times the max lag.
  */
-#define AZ_STEP			Q_CONVERT_FLOAT(0.6, 12)	/* Radians as Q4.12 (~34 deg) */
-#define AZ_ITERATIONS		8				/* loops in min err search */
+#define GCC_SMOOTH_SHIFT	2
+#define GCC_FFT_SIZE_MIN	64
+
+/* Coarse-to-fine search of source angle. The steered response is first evaluated in
+ * a coarse grid with lags those are computed in initialize. The grid step is about one
+ * sample of max lag change to not miss the narrow GCC-PHAT peak. Then the best angle
+ * is refined by halving the step until it is less than half degree.
+ */
+#define AZ_COARSE_POINTS_MAX	128
+#define AZ_COARSE_STEP_MAX	Q_CONVERT_FLOAT(0.5236, 12)	/* Radians as Q4.12 (30 deg) */
+#define AZ_FINE_STEP_MIN	Q_CONVERT_FLOAT(0.0087, 12)	/* Radians as Q4.12 (0.5 deg) */
 #define SOURCE_DISTANCE		Q_CONVERT_FLOAT(3.0, 12)	/* source distance in m Q4.12 */
 
 /* Sound direction angle filtering */
@@ -176,97 +191,6 @@ static bool line_array_mode_check(struct tdfb_comp_data *cd)
 	return true;
 }
 
-int tdfb_direction_init(struct tdfb_comp_data *cd, int32_t fs, int ch_count)
-{
-	struct sof_eq_iir_header *filt;
-	int32_t *delay;
-	int32_t d_max;
-	int32_t t_max;
-	size_t size;
-	int n;
-	int i;
-
-	/* Select emphasis response per sample rate */
-	switch (fs) {
-	case 16000:
-		filt = (struct sof_eq_iir_header *)iir_emphasis_16k;
-		break;
-	case 48000:
-		filt = (struct sof_eq_iir_header *)iir_emphasis_48k;
-		break;
-	default:
-		return -EINVAL;
-	}
-
-	/* Allocate delay lines for IIR filters and initialize them */
-	size = ch_count * iir_delay_size_df1(filt);
-	delay = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, size);
-	if (!delay)
-		return -ENOMEM;
-
-	cd->direction.df1_delay = delay;
-	for (i = 0; i < ch_count; i++) {
-		iir_init_coef_df1(&cd->direction.emphasis[i], filt);
-		iir_init_delay_df1(&cd->direction.emphasis[i], &delay);
-	}
-
-	/* Unit delay length in Q1.31 seconds */
-	cd->direction.unit_delay = Q_SHIFT_LEFT(1LL, 0, 31) / fs;
-
-	/* Get max possible mic-mic distance, then from max distance to max time t = d_max / v,
-	 * t is Q1.15, d is Q4.12, v is Q9.0
-	 */
-	d_max = max_mic_distance(cd);
-	t_max = Q_SHIFT_LEFT(d_max, 12, 15) / SPEED_OF_SOUND;
-
-	/* Calculate max lag to search and allocate delay line for cross correlation
-	 * compute. Add one to make sure max possible lag is in search window.
-	 */
-	cd->direction.max_lag = Q_MULTSR_32X32((int64_t)fs, t_max, 0, 15, 0) + 1;
-	n = (cd->max_frames + (2 * cd->direction.max_lag + 1)) * ch_count;
-	cd->direction.d_size =  n * sizeof(int16_t);
-	cd->direction.d = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, cd->direction.d_size);
-	if (!cd->direction.d)
-		goto err_free_iir;
-
-	/* Set needed pointers to xcorr delay line, advance write pointer by max_lag to keep read
-	 * always behind write
-	 */
-	cd->direction.d_end = cd->direction.d + n;
-	cd->direction.rp = cd->direction.d;
-	cd->direction.wp = cd->direction.d + ch_count * (cd->direction.max_lag + 1);
-
-	/* xcorr result is temporary but too large for stack so it is allocated here */
-	cd->direction.r_size = (2 * cd->direction.max_lag + 1) * sizeof(int32_t);
-	cd->direction.r = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, cd->direction.r_size);
-	if (!cd->direction.r)
-		goto err_free_all;
-
-	/* Check for line array mode */
-	cd->direction.line_array = line_array_mode_check(cd);
-
-	/* Initialize direction to zero radians, set initial step sign to +1 */
-	cd->direction.az = 0;
-	cd->direction.step_sign = 1;
-	return 0;
-
-err_free_all:
-	rfree(cd->direction.d);
-	cd->direction.d = NULL;
-
-err_free_iir:
-	rfree(cd->direction.df1_delay);
-	cd->direction.df1_delay = NULL;
-	return -ENOMEM;
-}
-
-void tdfb_direction_free(struct tdfb_comp_data *cd)
-{
-	rfree(cd->direction.df1_delay);
-	rfree(cd->direction.d);
-	rfree(cd->direction.r);
-}
-
 /* Measure level of one channel */
 static void level_update(struct tdfb_comp_data *cd, int frames, int ch_count, int channel)
 {
@@ -274,12 +198,13 @@ static void level_update(struct tdfb_comp_data *cd, int frames, int ch_count, in
 	int64_t ambient;
 	int64_t level;
 	int16_t s;
-	int16_t *p = cd->direction.rp + channel;
+	int16_t *p = cd->direction.wp - frames * ch_count + channel;
 	int shift;
 	int thr;
 	int n;
 
-	/* Calculate mean square level */
+	/* Calculate mean square level of the latest frames */
+	tdfb_cdec_s16(&p, cd->direction.d, cd->direction.d_size);
 	for (n = 0; n < frames; n++) {
 		s = *p;
 		tmp += ((int32_t)s * s);
@@ -307,58 +232,194 @@ static void level_update(struct tdfb_comp_data *cd, int frames, int ch_count, in
 		cd->direction.frame_count_since_control = INT32_MAX;
 }
 
-static int find_max_value_index(int32_t *v, int length)
+/* The FFT library leaves the first bit reversed output element untouched so
+ * it is set here from the first input element. For inverse transform the
+ * library conjugates the input, the same is done here for the first element.
+ */
+static void gcc_fft_execute(struct tdfb_direction_data *dir, bool ifft)
 {
-	int idx = 0;
+	struct icomplex32 *in = dir->fft_buf;
+	struct icomplex32 *out = dir->fft_out;
+	int len = dir->fft_plan->len;
+
+	out[0].real = in[0].real >> len;
+	if (ifft)
+		out[0].imag = SATP_INT32((int64_t)-1 * in[0].imag) >> len;
+	else
+		out[0].imag = in[0].imag >> len;
+
+	fft_execute_32(dir->fft_plan, ifft);
+}
+
+/* Window two microphone channels into real and imaginary parts of one complex
+ * FFT and separate the spectra with A(k) = (X(k) + X*(N - k)) / 2 and
+ * B(k) = (X(k) - X*(N - k)) / 2j. The latest fft_size frames are used.
+ */
+static void gcc_analysis(struct tdfb_direction_data *dir, int ch_count, int ch,
+			 bool pair, struct icomplex32 *sa, struct icomplex32 *sb)
+{
+	struct icomplex32 *buf = dir->fft_buf;
+	struct icomplex32 *out = dir->fft_out;
+	int16_t *x = dir->wp - dir->fft_size * ch_count + ch;
+	int n = dir->fft_size;
+	int nk;
 	int i;
 
-	for (i = 1; i < length; i++) {
-		if (v[i] > v[idx])
-			idx = i;
+	tdfb_cdec_s16(&x, dir->d, dir->d_size);
+	for (i = 0; i < n; i++) {
+		buf[i].real = Q_MULTSR_32X32((int64_t)x[0] << 16, dir->window[i], 31, 15, 31);
+		buf[i].imag = pair ?
+			Q_MULTSR_32X32((int64_t)x[1] << 16, dir->window[i], 31, 15, 31) : 0;
+		x += ch_count;
+		tdfb_cinc_s16(&x, dir->d_end, dir->d_size);
+	}
+
+	gcc_fft_execute(dir, false);
+	for (i = 0; i < dir->half_fft_size; i++) {
+		nk = (n - i) & (n - 1);
+		sa[i].real = ((int64_t)out[i].real + out[nk].real) >> 1;
+		sa[i].imag = ((int64_t)out[i].imag - out[nk].imag) >> 1;
+		if (pair) {
+			sb[i].real = ((int64_t)out[i].imag + out[nk].imag) >> 1;
+			sb[i].imag = ((int64_t)out[nk].real - out[i].real) >> 1;
+		}
 	}
+}
+
+/* Approximate magnitude of complex value as max(|re|, |im|) + 3/8 * min(|re|, |im|),
+ * the error is within -3% .. +7%.
+ */
+static int64_t gcc_magnitude(int64_t re, int64_t im)
+{
+	int64_t a = re < 0 ? -re : re;
+	int64_t b = im < 0 ? -im : im;
+
+	if (a < b)
+		return b + (a >> 2) + (a >> 3);
+
+	return a + (b >> 2) + (b >> 3);
+}
+
+/* Update the smoothed PHAT weighted cross-spectrum X(k) * conj(X_ref(k)) / |.| of
+ * one microphone pair. The DC and Nyquist bins are left zero.
+ */
+static void gcc_phat_update(struct tdfb_direction_data *dir, int pair,
+			    const struct icomplex32 *x)
+{
+	const struct icomplex32 *x0 = dir->ref_spectrum;
+	struct icomplex32 *s = dir->cross_spectra + pair * dir->half_fft_size;
+	int64_t re;
+	int64_t im;
+	int64_t mag;
+	int32_t re32;
+	int32_t im32;
+	int32_t m;
+	int32_t inv;
+	int32_t g;
+	int shift;
+	int k;
+
+	for (k = 1; k < dir->half_fft_size - 1; k++) {
+		re = (((int64_t)x[k].real * x0[k].real) >> 1) +
+			(((int64_t)x[k].imag * x0[k].imag) >> 1);
+		im = (((int64_t)x[k].imag * x0[k].real) >> 1) -
+			(((int64_t)x[k].real * x0[k].imag) >> 1);
+		mag = gcc_magnitude(re, im);
+		if (!mag) {
+			re32 = 0;
+			im32 = 0;
+		} else {
+			/* Scale to 32 bits, then normalize magnitude to Q1.15 in 0.5 .. 1.0
+			 * and divide with 32 bit reciprocal. The result is Q2.30.
+			 */
+			shift = MAX(33 - clzll((uint64_t)mag), 0);
+			m = (int32_t)(mag >> shift);
+			re32 = (int32_t)(re >> shift);
+			im32 = (int32_t)(im >> shift);
+			shift = norm_int32(m);
+			inv = INT32_MAX / ((m << shift) >> 15);
+			re32 = ((int64_t)(re32 << shift) * inv) >> 16;
+			im32 = ((int64_t)(im32 << shift) * inv) >> 16;
+		}
 
-	return idx;
+		g = s[k].real;
+		s[k].real = g + ((re32 - g) >> GCC_SMOOTH_SHIFT);
+		g = s[k].imag;
+		s[k].imag = g + ((im32 - g) >> GCC_SMOOTH_SHIFT);
+	}
 }
 
-static void time_differences(struct tdfb_comp_data *cd, int frames, int ch_count)
+/* Inverse transform two cross-spectra A(k) and B(k) as Y(k) = A(k) + jB(k) to get
+ * the two real valued cross-correlations as real and imaginary part of the result.
+ * The library inverse FFT output is the complex conjugate of the inverse transform.
+ */
+static void gcc_correlation(struct tdfb_direction_data *dir, int pair, bool two)
 {
-	int64_t r;
-	int16_t *x;
-	int16_t *y;
-	int r_max_idx;
-	int max_lag = cd->direction.max_lag;
-	int c;
+	struct icomplex32 *buf = dir->fft_buf;
+	struct icomplex32 *out = dir->fft_out;
+	struct icomplex32 *sa = dir->cross_spectra + pair * dir->half_fft_size;
+	struct icomplex32 *sb = sa + dir->half_fft_size;
+	int32_t *ra = dir->r + pair * (2 * dir->max_lag + 1);
+	int32_t *rb = ra + 2 * dir->max_lag + 1;
+	int n = dir->fft_size;
+	int half = n >> 1;
+	int len = dir->fft_plan->len;
 	int k;
 	int i;
-	int32_t maxval = 0;
-
-	/* Calculate xcorr for channel 0 vs. 1 .. (ch_count-1). Scan -maxlag .. +maxlag*/
-	for (c = 1; c < ch_count; c++) {
-		for (k = -max_lag; k <= max_lag; k++) {
-			y = cd->direction.rp; /* First channel */
-			x = y + k * ch_count + c; /* other channel C */
-			tdfb_cinc_s16(&x, cd->direction.d_end, cd->direction.d_size);
-			tdfb_cdec_s16(&x, cd->direction.d, cd->direction.d_size);
-			r = 0;
-			for (i = 0; i < frames; i++) {
-				if (maxval < *y)
-					maxval = *y;
-
-				r += (int32_t)*x * *y;
-				y += ch_count;
-				tdfb_cinc_s16(&y, cd->direction.d_end, cd->direction.d_size);
-				x += ch_count;
-				tdfb_cinc_s16(&x, cd->direction.d_end, cd->direction.d_size);
-			}
-			/* Scale for max. 20 ms 48 kHz frame */
-			cd->direction.r[k + max_lag] = sat_int32(((r >> 8) + 1) >> 1);
+
+	/* The library inverse FFT has no 1 / N scaling, it is done here to
+	 * avoid saturation. The result is the mean of PHAT weighted cross-spectrum
+	 * as Q2.30 with max. value near one.
+	 */
+	memset(buf, 0, n * sizeof(struct icomplex32));
+	for (k = 1; k < half; k++) {
+		if (two) {
+			buf[k].real = ((int64_t)sa[k].real - sb[k].imag) >> len;
+			buf[k].imag = ((int64_t)sa[k].imag + sb[k].real) >> len;
+			buf[n - k].real = ((int64_t)sa[k].real + sb[k].imag) >> len;
+			buf[n - k].imag = ((int64_t)sb[k].real - sa[k].imag) >> len;
+		} else {
+			buf[k].real = sa[k].real >> len;
+			buf[k].imag = sa[k].imag >> len;
+			buf[n - k].real = buf[k].real;
+			buf[n - k].imag = -buf[k].imag;
 		}
-		r_max_idx = find_max_value_index(&cd->direction.r[0], 2 * max_lag + 1);
-		cd->direction.timediff[c - 1] = (int32_t)(r_max_idx - max_lag) *
-			cd->direction.unit_delay;
 	}
-	cd->direction.rp += frames * ch_count;
-	tdfb_cinc_s16(&cd->direction.rp, cd->direction.d_end, cd->direction.d_size);
+
+	gcc_fft_execute(dir, true);
+	for (i = -dir->max_lag; i <= dir->max_lag; i++) {
+		k = i & (n - 1);
+		*ra++ = out[k].real;
+		if (two)
+			*rb++ = SATP_INT32((int64_t)-1 * out[k].imag);
+	}
+}
+
+/* Compute generalized cross-correlation with phase transform for the reference
+ * microphone vs. the others. Channels are transformed two at a time.
+ */
+static void gcc_phat(struct tdfb_comp_data *cd, int ch_count)
+{
+	struct tdfb_direction_data *dir = &cd->direction;
+	struct icomplex32 *sa;
+	struct icomplex32 *sb = dir->spectra + dir->half_fft_size;
+	int num_mics = dir->num_pairs + 1;
+	bool pair;
+	int ch;
+
+	for (ch = 0; ch < num_mics; ch += 2) {
+		pair = ch + 1 < num_mics;
+		sa = ch ? dir->spectra : dir->ref_spectrum;
+		gcc_analysis(dir, ch_count, ch, pair, sa, sb);
+		if (ch)
+			gcc_phat_update(dir, ch - 1, sa);
+
+		if (pair)
+			gcc_phat_update(dir, ch, sb);
+	}
+
+	for (ch = 0; ch < dir->num_pairs; ch += 2)
+		gcc_correlation(dir, ch, ch + 1 < dir->num_pairs);
 }
 
 static int16_t distance_from_source(struct tdfb_comp_data *cd, int mic_n,
@@ -411,18 +472,89 @@ static void theoretical_time_differences(struct tdfb_comp_data *cd, int16_t az)
 	}
 }
 
-static int64_t mean_square_time_difference_err(struct tdfb_comp_data *cd)
+/* Get lags in samples as Q16.16 for the microphone pairs for the angle */
+static void angle_to_lags(struct tdfb_comp_data *cd, int16_t az, int32_t *lags)
 {
-	int64_t err = 0;
-	int32_t delta;
+	struct tdfb_direction_data *dir = &cd->direction;
+	int32_t lag;
+	int max_lag = dir->max_lag;
 	int i;
 
-	for (i = 0; i < cd->config->num_mic_locations - 1; i++) {
-		delta = cd->direction.timediff[i] - cd->direction.timediff_iter[i];
-		err +=  (int64_t)delta * delta;
+	theoretical_time_differences(cd, az);
+	for (i = 0; i < dir->num_pairs; i++) {
+		/* Time difference Q1.31 seconds to lag in samples Q16.16 */
+		lag = Q_MULTSR_32X32((int64_t)dir->timediff_iter[i], dir->fs, 31, 0, 16);
+		lags[i] = MIN(MAX(lag, (1 - max_lag) << 16), (max_lag - 1) << 16);
 	}
+}
+
+/* Sum of GCC values at the lags of microphone pairs. The GCC is interpolated for
+ * fractional lags with a parabola fitted to the nearest and adjacent lags.
+ */
+static int64_t steered_response(struct tdfb_direction_data *dir, const int32_t *lags)
+{
+	int64_t sum = 0;
+	int64_t tmp;
+	int32_t *r = dir->r + dir->max_lag;
+	int32_t frac;
+	int32_t d1;
+	int32_t d2;
+	int idx;
+	int i;
 
-	return err;
+	for (i = 0; i < dir->num_pairs; i++) {
+		/* Nearest lag and fraction -0.5 .. +0.5 as Q1.16 */
+		idx = (lags[i] + (1 << 15)) >> 16;
+		frac = lags[i] - (idx << 16);
+
+		/* y(f) = r(0) + f * (r(1) - r(-1)) / 2 + f^2 * (r(1) - 2 * r(0) + r(-1)) / 2 */
+		d1 = (r[idx + 1] >> 1) - (r[idx - 1] >> 1);
+		d2 = (r[idx + 1] >> 1) - r[idx] + (r[idx - 1] >> 1);
+		tmp = ((int64_t)d2 * frac) >> 16;
+		tmp = ((tmp + d1) * frac) >> 16;
+		sum += r[idx] + tmp;
+		r += 2 * dir->max_lag + 1;
+	}
+
+	return sum;
+}
+
+static int64_t steered_response_angle(struct tdfb_comp_data *cd, int16_t az)
+{
+	int32_t lags[PLATFORM_MAX_CHANNELS];
+
+	angle_to_lags(cd, az, lags);
+	return steered_response(&cd->direction, lags);
+}
+
+/* Compute lags for the coarse angle search grid */
+static void coarse_grid_init(struct tdfb_comp_data *cd)
+{
+	struct tdfb_direction_data *dir = &cd->direction;
+	int range;
+	int step;
+	int i;
+
+	/* Line array azimuth angle is -90 .. +90, otherwise search full circle */
+	if (dir->line_array) {
+		dir->az_coarse_min = -PIDIV2_Q12;
+		range = PI_Q12;
+	} else {
+		dir->az_coarse_min = -PI_Q12;
+		range = PIMUL2_Q12;
+	}
+
+	/* Step in radians for one sample change in max lag is 1 / max_lag */
+	step = MAX(Q_SHIFT_LEFT(1, 0, 12) / dir->max_lag, PIMUL2_Q12 / AZ_COARSE_POINTS_MAX);
+	step = MIN(step, AZ_COARSE_STEP_MAX);
+	dir->az_coarse_step = step;
+	dir->num_coarse = range / step;
+	if (dir->line_array)
+		dir->num_coarse++; /* Include +90 degrees end */
+
+	for (i = 0; i < dir->num_coarse; i++)
+		angle_to_lags(cd, dir->az_coarse_min + i * step,
+			      dir->coarse_lags + i * dir->num_pairs);
 }
 
 static int unwrap_radians(int radians)
@@ -438,38 +570,50 @@ static int unwrap_radians(int radians)
 	return a;
 }
 
-static void iterate_source_angle(struct tdfb_comp_data *cd)
+static void search_source_angle(struct tdfb_comp_data *cd)
 {
-	int64_t err_prev;
-	int64_t err;
+	struct tdfb_direction_data *dir = &cd->direction;
+	int64_t srp_max;
+	int64_t srp;
 	int32_t ds1;
 	int32_t ds2;
 	int az_slow;
+	int az_best;
+	int az_step;
+	int az;
 	int i;
-	int az_step = AZ_STEP * cd->direction.step_sign;
-	int az = cd->direction.az_slow;
 
-	/* Start next iteration opposite direction */
-	cd->direction.step_sign *= -1;
+	/* Coarse search with pre-computed lags */
+	srp_max = steered_response(dir, dir->coarse_lags);
+	az_best = 0;
+	for (i = 1; i < dir->num_coarse; i++) {
+		srp = steered_response(dir, dir->coarse_lags + i * dir->num_pairs);
+		if (srp > srp_max) {
+			srp_max = srp;
+			az_best = i;
+		}
+	}
 
-	/* Get theoretical time differences for previous angle */
-	theoretical_time_differences(cd, az);
-	err_prev = mean_square_time_difference_err(cd);
-
-	for (i = 0; i < AZ_ITERATIONS; i++) {
-		az += az_step;
-		theoretical_time_differences(cd, az);
-		err = mean_square_time_difference_err(cd);
-		if (err > err_prev) {
-			az_step = -(az_step >> 1);
-			if (az_step == 0)
-				break;
+	/* Fine search around the best angle */
+	az_best = dir->az_coarse_min + az_best * dir->az_coarse_step;
+	az_step = dir->az_coarse_step;
+	while (az_step > AZ_FINE_STEP_MIN) {
+		az_step >>= 1;
+		az = az_best;
+		srp = steered_response_angle(cd, az + az_step);
+		if (srp > srp_max) {
+			srp_max = srp;
+			az_best = az + az_step;
 		}
 
-		err_prev = err;
+		srp = steered_response_angle(cd, az - az_step);
+		if (srp > srp_max) {
+			srp_max = srp;
+			az_best = az - az_step;
+		}
 	}
 
-	az = unwrap_radians(az);
+	az = unwrap_radians(az_best);
 	if (cd->direction.line_array) {
 		/* Line array azimuth angle is -90 .. +90 */
 		if (az > PIDIV2_Q12)
@@ -503,10 +647,153 @@ static void iterate_source_angle(struct tdfb_comp_data *cd)
 	cd->direction.az_slow = unwrap_radians(az_slow);
 }
 
-static void updates_when_no_trigger(struct tdfb_comp_data *cd, int frames, int ch_count)
+int tdfb_direction_init(struct tdfb_comp_data *cd, int32_t fs, int ch_count)
+{
+	struct tdfb_direction_data *dir = &cd->direction;
+	struct sof_eq_iir_header *filt;
+	int32_t *delay;
+	int32_t d_max;
+	int32_t t_max;
+	uint8_t *p;
+	size_t size;
+	int fft_size;
+	int half;
+	int n;
+	int i;
+
+	/* Select emphasis response per sample rate */
+	switch (fs) {
+	case 16000:
+		filt = (struct sof_eq_iir_header *)iir_emphasis_16k;
+		break;
+	case 48000:
+		filt = (struct sof_eq_iir_header *)iir_emphasis_48k;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	/* Release buffers from previous prepare if not freed in between */
+	tdfb_direction_free(cd);
+
+	/* Allocate delay lines for IIR filters and initialize them */
+	size = ch_count * iir_delay_size_df1(filt);
+	delay = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, size);
+	if (!delay)
+		return -ENOMEM;
+
+	dir->df1_delay = delay;
+	for (i = 0; i < ch_count; i++) {
+		iir_init_coef_df1(&dir->emphasis[i], filt);
+		iir_init_delay_df1(&dir->emphasis[i], &delay);
+	}
+
+	/* Unit delay length in Q1.31 seconds */
+	dir->unit_delay = Q_SHIFT_LEFT(1LL, 0, 31) / fs;
+	dir->fs = fs;
+
+	/* Get max possible mic-mic distance, then from max distance to max time t = d_max / v,
+	 * t is Q1.15, d is Q4.12, v is Q9.0
+	 */
+	d_max = max_mic_distance(cd);
+	t_max = Q_SHIFT_LEFT(d_max, 12, 15) / SPEED_OF_SOUND;
+
+	/* Calculate max lag to search. Add one to make sure max possible lag is in
+	 * search window.
+	 */
+	dir->max_lag = Q_MULTSR_32X32((int64_t)fs, t_max, 0, 15, 0) + 1;
+
+	/* FFT size is power of two that fits two periods and the lags range */
+	n = MAX(2 * cd->max_frames, 4 * dir->max_lag);
+	fft_size = GCC_FFT_SIZE_MIN;
+	while (fft_size < n && fft_size < FFT_SIZE_MAX)
+		fft_size <<= 1;
+
+	half = (fft_size >> 1) + 1;
+	dir->fft_size = fft_size;
+	dir->half_fft_size = half;
+	dir->max_lag = MIN(dir->max_lag, half - 2);
+
+	/* The delay line contains at least the latest fft_size frames */
+	n = MAX(fft_size, cd->max_frames) * ch_count;
+	dir->d_size =  n * sizeof(int16_t);
+	dir->d = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, dir->d_size);
+	if (!dir->d)
+		goto err_free_iir;
+
+	dir->d_end = dir->d + n;
+	dir->wp = dir->d;
+
+	/* Check for line array mode */
+	dir->line_array = line_array_mode_check(cd);
+
+	/* Initialize direction to zero radians */
+	dir->az = 0;
+
+	/* The GCC is computed for the reference microphone vs. others. Without
+	 * microphone pairs the direction can't be estimated.
+	 */
+	dir->num_pairs = MIN(ch_count, cd->config->num_mic_locations) - 1;
+	if (dir->num_pairs < 1)
+		return 0;
+
+	/* Single allocation for GCC results, FFT buffers, spectra, window, and lags */
+	dir->r_size = ALIGN_UP(dir->num_pairs * (2 * dir->max_lag + 1) * sizeof(int32_t),
+			       sizeof(struct icomplex32));
+	size = dir->r_size + 2 * fft_size * sizeof(struct icomplex32) +
+		(3 + dir->num_pairs) * half * sizeof(struct icomplex32) +
+		fft_size * sizeof(int16_t) +
+		AZ_COARSE_POINTS_MAX * dir->num_pairs * sizeof(int32_t);
+	p = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, size);
+	if (!p)
+		goto err_free_all;
+
+	dir->r = (int32_t *)p;
+	p += dir->r_size;
+	dir->fft_buf = (struct icomplex32 *)p;
+	p += fft_size * sizeof(struct icomplex32);
+	dir->fft_out = (struct icomplex32 *)p;
+	p += fft_size * sizeof(struct icomplex32);
+	dir->ref_spectrum = (struct icomplex32 *)p;
+	p += half * sizeof(struct icomplex32);
+	dir->spectra = (struct icomplex32 *)p;
+	p += 2 * half * sizeof(struct icomplex32);
+	dir->cross_spectra = (struct icomplex32 *)p;
+	p += dir->num_pairs * half * sizeof(struct icomplex32);
+	dir->window = (int16_t *)p;
+	p += fft_size * sizeof(int16_t);
+	dir->coarse_lags = (int32_t *)p;
+	win_hann_16b(dir->window, fft_size);
+	coarse_grid_init(cd);
+
+	dir->fft_plan = fft_plan_new(dir->fft_buf, dir->fft_out, fft_size, 32);
+	if (!dir->fft_plan)
+		goto err_free_all;
+
+	return 0;
+
+err_free_all:
+	rfree(dir->r);
+	dir->r = NULL;
+	rfree(dir->d);
+	dir->d = NULL;
+
+err_free_iir:
+	rfree(dir->df1_delay);
+	dir->df1_delay = NULL;
+	return -ENOMEM;
+}
+
+void tdfb_direction_free(struct tdfb_comp_data *cd)
 {
-	cd->direction.rp += frames * ch_count;
-	tdfb_cinc_s16(&cd->direction.rp, cd->direction.d_end, cd->direction.d_size);
+	fft_plan_free(cd->direction.fft_plan);
+	rfree(cd->direction.df1_delay);
+	rfree(cd->direction.d);
+	rfree(cd->direction.r);
+	cd->direction.fft_plan = NULL;
+	cd->direction.df1_delay = NULL;
+	cd->direction.d = NULL;
+	cd->direction.r = NULL;
 }
 
 static int convert_angle_to_enum(struct tdfb_comp_data *cd)
@@ -530,7 +817,6 @@ static int convert_angle_to_enum(struct tdfb_comp_data *cd)
 	return new_az_value;
 }
 
-/* Placeholder function for sound direction estimate */
 void tdfb_direction_estimate(struct tdfb_comp_data *cd, int frames, int ch_count)
 {
 	int32_t time_since;
@@ -541,16 +827,14 @@ void tdfb_direction_estimate(struct tdfb_comp_data *cd, int frames, int ch_count
 
 	/* Update levels, skip rest of estimation if level does not exceed well ambient */
 	level_update(cd, frames, ch_count, 0);
-	if (!(cd->direction.trigger & 1)) {
-		updates_when_no_trigger(cd, frames, ch_count);
+	if (!(cd->direction.trigger & 1) || !cd->direction.fft_plan)
 		return;
-	}
 
-	/* Compute time differences of ch_count vs. reference channel 1 */
-	time_differences(cd, frames, ch_count);
+	/* Compute cross-correlations of microphones vs. reference microphone */
+	gcc_phat(cd, ch_count);
 
 	/* Determine direction angle */
-	iterate_source_angle(cd);
+	search_source_angle(cd);
 
 	/* Convert radians to enum*/
 	new_az_value = convert_angle_to_enum(cd);
@@ -107,6 +107,7 @@ static int set_downmix_coefficients(struct processing_module *mod,
 	return 0;
 }
 
+#if defined(__XCC__) && XCHAL_HAVE_HIFI3
 static up_down_mixer_routine select_mix_out_stereo(struct comp_dev *dev,
 						   const struct ipc4_audio_format *format)
 {
@@ -257,6 +258,34 @@ static up_down_mixer_routine select_mix_out_5_1(struct comp_dev *dev,
 	}
 }
 
+static up_down_mixer_routine select_mix_routine(struct comp_dev *dev,
+						const struct ipc4_audio_format *format,
+						enum ipc4_channel_config out_channel_config)
+{
+	switch (out_channel_config) {
+	case IPC4_CHANNEL_CONFIG_MONO:
+		return select_mix_out_mono(dev, format);
+	case IPC4_CHANNEL_CONFIG_STEREO:
+		return select_mix_out_stereo(dev, format);
+	case IPC4_CHANNEL_CONFIG_5_POINT_1:
+		return select_mix_out_5_1(dev, format);
+	default:
+		return upmix32bit_2_0_to_7_1;
+	}
+}
+
+#else
+
+static bool downmix_coefficients_q15(const downmix_coefficients coefficients)
+{
+	return coefficients == k_lo_ro_downmix16bit ||
+	       coefficients == k_scaled_lo_ro_downmix16bit ||
+	       coefficients == k_half_scaled_lo_ro_downmix16bit ||
+	       coefficients == k_quatro_mono_scaled_lo_ro_downmix16bit;
+}
+
+#endif
+
 static int init_mix(struct processing_module *mod,
 		    const struct ipc4_audio_format *format,
 		    enum ipc4_channel_config out_channel_config,
@@ -264,14 +293,12 @@ static int init_mix(struct processing_module *mod,
 {
 	struct up_down_mixer_data *cd = module_get_private_data(mod);
 	struct comp_dev *dev = mod->dev;
+	int ret;
 
 	if (!format)
 		return -EINVAL;
 
 	if (out_channel_config == IPC4_CHANNEL_CONFIG_MONO) {
-		/* Select dowm mixing routine. */
-		cd->mix_routine = select_mix_out_mono(dev, format);
-
 		/* Update audio format. */
 		cd->out_fmt[0].channels_count = 1;
 		cd->out_fmt[0].ch_cfg = IPC4_CHANNEL_CONFIG_MONO;
@@ -283,18 +310,12 @@ static int init_mix(struct processing_module *mod,
 		    format->depth == IPC4_DEPTH_8BIT)
 			return -EINVAL;
 
-		/* Select dowm mixing routine. */
-		cd->mix_routine = select_mix_out_stereo(dev, format);
-
 		/* Update audio format. */
 		cd->out_fmt[0].channels_count = 2;
 		cd->out_fmt[0].ch_cfg = IPC4_CHANNEL_CONFIG_STEREO;
 		cd->out_fmt[0].ch_map = create_channel_map(IPC4_CHANNEL_CONFIG_STEREO);
 
 	} else if (out_channel_config == IPC4_CHANNEL_CONFIG_5_POINT_1) {
-		/* Select dowm mixing routine. */
-		cd->mix_routine = select_mix_out_5_1(dev, format);
-
 		/* Update audio format. */
 		cd->out_fmt[0].channels_count = 6;
 		cd->out_fmt[0].ch_cfg = IPC4_CHANNEL_CONFIG_5_POINT_1;
@@ -302,9 +323,6 @@ static int init_mix(struct processing_module *mod,
 
 	} else if (out_channel_config == IPC4_CHANNEL_CONFIG_7_POINT_1 &&
 		   format->ch_cfg == IPC4_CHANNEL_CONFIG_STEREO) {
-		/* Select up mixing routine. */
-		cd->mix_routine = upmix32bit_2_0_to_7_1;
-
 		if (format->depth == IPC4_DEPTH_16BIT)
 			return -EINVAL;
 	} else {
@@ -319,7 +337,25 @@ static int init_mix(struct processing_module *mod,
 	cd->in_channel_map = format->ch_map;
 	cd->in_channel_config = format->ch_cfg;
 
-	return set_downmix_coefficients(mod, format, out_channel_config, downmix_coefficients);
+	ret = set_downmix_coefficients(mod, format, out_channel_config, downmix_coefficients);
+	if (ret < 0)
+		return ret;
+
+	/* Select up/down mixing routine. */
+#if defined(__XCC__) && XCHAL_HAVE_HIFI3
+	cd->mix_routine = select_mix_routine(dev, format, out_channel_config);
+	if (!cd->mix_routine)
+		return -EINVAL;
+#else
+	ret = up_down_mixer_generic_init(cd, format->depth,
+					 downmix_coefficients_q15(cd->downmix_coefficients));
+	if (ret < 0) {
+		comp_err(dev, "init_mix(): unsupported conversion.");
+		return ret;
+	}
+#endif
+
+	return 0;
 }
 
 static int up_down_mixer_free(struct processing_module *mod)
@@ -14,11 +14,15 @@
 #include <ipc/stream.h>
 #include <ipc4/module.h>
 #include <ipc4/base-config.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include "up_down_mixer_ipc4.h"
 
+/** Channels handled by the generic mix engine. */
+#define UP_DOWN_MIX_CHANNELS_MAX	8
+
 /** This type is introduced for better readability. */
 typedef const int32_t *downmix_coefficients;
 
@@ -142,8 +146,29 @@ struct up_down_mixer_data {
 	/** In/out internal buffers */
 	int32_t *buf_in;
 	int32_t *buf_out;
+
+	/** Number of channels in the output buffer, generic engine only. */
+	size_t out_channel_no;
+
+	/** Q4.28 gains of the generic engine, indexed by output and input channel. */
+	int32_t mix_matrix[UP_DOWN_MIX_CHANNELS_MAX][UP_DOWN_MIX_CHANNELS_MAX];
 };
 
+/**
+ * \brief Sets up the generic up/down-mix engine.
+ *
+ * Builds the mix matrix from the channel maps and the downmix coefficients
+ * and selects the mix routine specialized for the channel counts. The input
+ * channel parameters, the output map and the coefficients need to be set.
+ *
+ * \param[in,out] cd                    Component private data.
+ * \param[in]     depth                 Input sample container size, 16 or 32 bit.
+ * \param[in]     q15_coefficients      Downmix coefficients are Q1.15, Q1.31 otherwise.
+ * \return 0 on success, -EINVAL for an unsupported format.
+ */
+int up_down_mixer_generic_init(struct up_down_mixer_data *cd, const enum ipc4_bit_depth depth,
+			       const bool q15_coefficients);
+
 /**
  * \brief 32 bit upmixer (mono -> 5_1).
  *
@@ -0,0 +1,329 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <rtos/string.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "up_down_mixer.h"
+
+/*
+ * Generic up/down-mix engine. Every conversion is a gain matrix applied to
+ * each frame, out[o] = sum(in[i] * mix_matrix[o][i]). The matrix is built
+ * from the channel maps and the downmix coefficients at init, so the same
+ * loop serves all layouts and is a reference for the HiFi3 routines.
+ *
+ * Gains are Q4.28, the 64 bit accumulator then can't overflow with all the
+ * eight inputs at full scale. The output is always 32 bit.
+ */
+
+#define MIX_GAIN_Q	28
+#define MIX_GAIN_ONE	(1 << MIX_GAIN_Q)
+
+/*
+ * The inner loops of a specialized routine have compile time trip counts,
+ * the compiler unrolls them and keeps the gains in registers.
+ */
+#define UP_DOWN_MIX_FUNC(name, type, in_ch, out_ch, shift)				\
+static void name(struct up_down_mixer_data *cd, const uint8_t * const in_data,	\
+		 const uint32_t in_size, uint8_t * const out_data)			\
+{											\
+	const type *x = (const type *)in_data;						\
+	int32_t *y = (int32_t *)out_data;						\
+	const uint32_t frames = in_size / ((in_ch) * sizeof(type));			\
+	int32_t gain[UP_DOWN_MIX_CHANNELS_MAX][UP_DOWN_MIX_CHANNELS_MAX];		\
+	int64_t acc;									\
+	uint32_t frame;									\
+	int i, o;									\
+											\
+	for (o = 0; o < (out_ch); o++)							\
+		for (i = 0; i < (in_ch); i++)						\
+			gain[o][i] = cd->mix_matrix[o][i];				\
+											\
+	for (frame = 0; frame < frames; frame++) {					\
+		for (o = 0; o < (out_ch); o++) {					\
+			acc = 0;							\
+			for (i = 0; i < (in_ch); i++)					\
+				acc += (int64_t)x[i] * gain[o][i];			\
+			y[o] = sat_int32((acc + ((int64_t)1 << ((shift) - 1))) >> (shift)); \
+		}									\
+		x += (in_ch);								\
+		y += (out_ch);								\
+	}										\
+}
+
+/* 16 bit samples are scaled to the 32 bit output by the final shift */
+#define UP_DOWN_MIX_S16(in_ch, out_ch) \
+	UP_DOWN_MIX_FUNC(mix_s16_##in_ch##_##out_ch, int16_t, in_ch, out_ch, MIX_GAIN_Q - 16)
+#define UP_DOWN_MIX_S32(in_ch, out_ch) \
+	UP_DOWN_MIX_FUNC(mix_s32_##in_ch##_##out_ch, int32_t, in_ch, out_ch, MIX_GAIN_Q)
+
+/* Layouts of the conversions handled by the component, input x output */
+#define UP_DOWN_MIX_LAYOUTS(X)	\
+	X(1, 1) X(1, 2) X(1, 6)	\
+	X(2, 1) X(2, 2) X(2, 6) X(2, 8) \
+	X(3, 1) X(3, 2)		\
+	X(4, 1) X(4, 2) X(4, 6)	\
+	X(5, 1) X(5, 2)		\
+	X(6, 1) X(6, 2)		\
+	X(8, 1) X(8, 2) X(8, 6)
+
+UP_DOWN_MIX_LAYOUTS(UP_DOWN_MIX_S16)
+UP_DOWN_MIX_LAYOUTS(UP_DOWN_MIX_S32)
+
+/* Fallback for other layouts, e.g. custom channel maps */
+UP_DOWN_MIX_FUNC(mix_s16_any, int16_t, cd->in_channel_no, cd->out_channel_no, MIX_GAIN_Q - 16)
+UP_DOWN_MIX_FUNC(mix_s32_any, int32_t, cd->in_channel_no, cd->out_channel_no, MIX_GAIN_Q)
+
+struct mix_layout {
+	uint8_t in_ch;
+	uint8_t out_ch;
+	up_down_mixer_routine mix_s16;
+	up_down_mixer_routine mix_s32;
+};
+
+#define UP_DOWN_MIX_LAYOUT(in_ch, out_ch) \
+	{ in_ch, out_ch, mix_s16_##in_ch##_##out_ch, mix_s32_##in_ch##_##out_ch },
+
+static const struct mix_layout mix_layouts[] = {
+	UP_DOWN_MIX_LAYOUTS(UP_DOWN_MIX_LAYOUT)
+};
+
+static bool has_channel(const channel_map map, const enum ipc4_channel_index channel)
+{
+	return get_channel_location(map, channel) != CHANNEL_INVALID;
+}
+
+static int32_t mix_gain(struct up_down_mixer_data *cd, const enum ipc4_channel_index channel,
+			const bool q15_coefficients)
+{
+	int32_t coef = cd->downmix_coefficients[channel];
+
+	return q15_coefficients ? coef * (1 << (MIX_GAIN_Q - 15)) : coef >> (31 - MIX_GAIN_Q);
+}
+
+static int mix_channels(const channel_map map)
+{
+	int n = 0;
+
+	while (n < UP_DOWN_MIX_CHANNELS_MAX && get_channel_index(map, n) != CHANNEL_INVALID)
+		n++;
+
+	return n;
+}
+
+/* Every input channel is folded into the single output with its coefficient. */
+static void init_matrix_mono(struct up_down_mixer_data *cd, const bool q15_coefficients)
+{
+	enum ipc4_channel_index type;
+	int i;
+
+	for (i = 0; i < cd->in_channel_no; i++) {
+		type = get_channel_index(cd->in_channel_map, i);
+
+		switch (cd->in_channel_config) {
+		case IPC4_CHANNEL_CONFIG_MONO:
+			cd->mix_matrix[0][i] = MIX_GAIN_ONE;
+			break;
+		case IPC4_CHANNEL_CONFIG_STEREO:
+		case IPC4_CHANNEL_CONFIG_DUAL_MONO:
+			cd->mix_matrix[0][i] = MIX_GAIN_ONE / 2;
+			break;
+		default:
+			if (type != CHANNEL_INVALID)
+				cd->mix_matrix[0][i] = mix_gain(cd, type, q15_coefficients);
+			break;
+		}
+	}
+}
+
+/*
+ * Left channels are folded into the left output, right ones into the right
+ * output and center, LFE and the 4.0 center surround into both.
+ */
+static int init_matrix_stereo(struct up_down_mixer_data *cd, const bool q15_coefficients)
+{
+	const int left = get_channel_location(cd->out_channel_map, CHANNEL_LEFT);
+	const int right = get_channel_location(cd->out_channel_map, CHANNEL_RIGHT);
+	enum ipc4_channel_index type;
+	int32_t gain;
+	int i;
+
+	if (left == CHANNEL_INVALID || right == CHANNEL_INVALID)
+		return -EINVAL;
+
+	for (i = 0; i < cd->in_channel_no; i++) {
+		type = get_channel_index(cd->in_channel_map, i);
+
+		switch (cd->in_channel_config) {
+		case IPC4_CHANNEL_CONFIG_MONO:
+			cd->mix_matrix[left][i] = MIX_GAIN_ONE;
+			cd->mix_matrix[right][i] = MIX_GAIN_ONE;
+			continue;
+		case IPC4_CHANNEL_CONFIG_STEREO:
+		case IPC4_CHANNEL_CONFIG_DUAL_MONO:
+			cd->mix_matrix[i ? right : left][i] = MIX_GAIN_ONE;
+			continue;
+		default:
+			break;
+		}
+
+		if (type == CHANNEL_INVALID)
+			continue;
+
+		gain = mix_gain(cd, type, q15_coefficients);
+
+		switch (type) {
+		case CHANNEL_LEFT:
+		case CHANNEL_LEFT_SIDE:
+			cd->mix_matrix[left][i] = gain;
+			break;
+		case CHANNEL_RIGHT:
+		case CHANNEL_RIGHT_SURROUND:
+		case CHANNEL_RIGHT_SIDE:
+			cd->mix_matrix[right][i] = gain;
+			break;
+		case CHANNEL_LEFT_SURROUND:
+			cd->mix_matrix[left][i] = gain;
+			if (cd->in_channel_config == IPC4_CHANNEL_CONFIG_4_POINT_0)
+				cd->mix_matrix[right][i] = gain;
+			break;
+		default:
+			cd->mix_matrix[left][i] = gain;
+			cd->mix_matrix[right][i] = gain;
+			break;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Input channels present in the output are copied. The surround outputs take
+ * the input surrounds, side channels with no output of their own and the 4.0
+ * center surround are folded into them with their coefficients. Surrounds
+ * which are still silent repeat the fronts, a mono input feeds all four of
+ * them and leaves the center silent.
+ */
+static void init_matrix_multichannel(struct up_down_mixer_data *cd,
+				     const bool q15_coefficients)
+{
+	const bool four_point_zero = cd->in_channel_config == IPC4_CHANNEL_CONFIG_4_POINT_0;
+	const bool mono = cd->in_channel_config == IPC4_CHANNEL_CONFIG_MONO;
+	channel_map out_map = cd->out_channel_map;
+	enum ipc4_channel_index type;
+	bool ls_fed = false;
+	bool rs_fed = false;
+	int ls, rs, o;
+	int i;
+
+	/* 5.1 with side channels, those take the role of the surrounds */
+	if (!has_channel(out_map, CHANNEL_LEFT_SURROUND) &&
+	    !has_channel(out_map, CHANNEL_RIGHT_SURROUND)) {
+		ls = get_channel_location(out_map, CHANNEL_LEFT_SIDE);
+		rs = get_channel_location(out_map, CHANNEL_RIGHT_SIDE);
+	} else {
+		ls = get_channel_location(out_map, CHANNEL_LEFT_SURROUND);
+		rs = get_channel_location(out_map, CHANNEL_RIGHT_SURROUND);
+	}
+
+	for (i = 0; i < cd->in_channel_no && !mono; i++) {
+		type = get_channel_index(cd->in_channel_map, i);
+		if (type == CHANNEL_INVALID)
+			continue;
+
+		o = get_channel_location(out_map, type);
+
+		if (four_point_zero && type == CHANNEL_CENTER_SURROUND) {
+			if (ls != CHANNEL_INVALID)
+				cd->mix_matrix[ls][i] = mix_gain(cd, CHANNEL_LEFT_SURROUND,
+								 q15_coefficients);
+			if (rs != CHANNEL_INVALID)
+				cd->mix_matrix[rs][i] = mix_gain(cd, CHANNEL_RIGHT_SURROUND,
+								 q15_coefficients);
+			ls_fed = true;
+			rs_fed = true;
+		} else if (o != CHANNEL_INVALID && o != ls && o != rs) {
+			cd->mix_matrix[o][i] = MIX_GAIN_ONE;
+		} else if (ls != CHANNEL_INVALID &&
+			   (type == CHANNEL_LEFT_SURROUND || type == CHANNEL_LEFT_SIDE)) {
+			/* the side channel is folded only next to a surround */
+			cd->mix_matrix[ls][i] = type == CHANNEL_LEFT_SIDE &&
+				has_channel(cd->in_channel_map, CHANNEL_LEFT_SURROUND) ?
+				mix_gain(cd, type, q15_coefficients) : MIX_GAIN_ONE;
+			ls_fed = true;
+		} else if (rs != CHANNEL_INVALID &&
+			   (type == CHANNEL_RIGHT_SURROUND || type == CHANNEL_RIGHT_SIDE)) {
+			cd->mix_matrix[rs][i] = type == CHANNEL_RIGHT_SIDE &&
+				has_channel(cd->in_channel_map, CHANNEL_RIGHT_SURROUND) ?
+				mix_gain(cd, type, q15_coefficients) : MIX_GAIN_ONE;
+			rs_fed = true;
+		}
+	}
+
+	for (i = 0; i < cd->in_channel_no; i++) {
+		type = get_channel_index(cd->in_channel_map, i);
+
+		if (mono || type == CHANNEL_LEFT) {
+			o = get_channel_location(out_map, CHANNEL_LEFT);
+			if (mono && o != CHANNEL_INVALID)
+				cd->mix_matrix[o][i] = MIX_GAIN_ONE;
+			if (ls != CHANNEL_INVALID && !ls_fed)
+				cd->mix_matrix[ls][i] = MIX_GAIN_ONE;
+		}
+
+		if (mono || type == CHANNEL_RIGHT) {
+			o = get_channel_location(out_map, CHANNEL_RIGHT);
+			if (mono && o != CHANNEL_INVALID)
+				cd->mix_matrix[o][i] = MIX_GAIN_ONE;
+			if (rs != CHANNEL_INVALID && !rs_fed)
+				cd->mix_matrix[rs][i] = MIX_GAIN_ONE;
+		}
+	}
+}
+
+int up_down_mixer_generic_init(struct up_down_mixer_data *cd, const enum ipc4_bit_depth depth,
+			       const bool q15_coefficients)
+{
+	int out_channel_no = mix_channels(cd->out_channel_map);
+	int ret = 0;
+	int i;
+
+	if (!cd->in_channel_no || cd->in_channel_no > UP_DOWN_MIX_CHANNELS_MAX ||
+	    !out_channel_no)
+		return -EINVAL;
+
+	if (depth != IPC4_DEPTH_16BIT && depth != IPC4_DEPTH_32BIT)
+		return -EINVAL;
+
+	cd->out_channel_no = out_channel_no;
+	memset(cd->mix_matrix, 0, sizeof(cd->mix_matrix));
+
+	if (out_channel_no == 1)
+		init_matrix_mono(cd, q15_coefficients);
+	else if (out_channel_no == 2)
+		ret = init_matrix_stereo(cd, q15_coefficients);
+	else
+		init_matrix_multichannel(cd, q15_coefficients);
+
+	if (ret < 0)
+		return ret;
+
+	for (i = 0; i < ARRAY_SIZE(mix_layouts); i++) {
+		if (mix_layouts[i].in_ch == cd->in_channel_no &&
+		    mix_layouts[i].out_ch == out_channel_no) {
+			cd->mix_routine = depth == IPC4_DEPTH_16BIT ? mix_layouts[i].mix_s16 :
+				mix_layouts[i].mix_s32;
+			return 0;
+		}
+	}
+
+	cd->mix_routine = depth == IPC4_DEPTH_16BIT ? mix_s16_any : mix_s32_any;
+
+	return 0;
+}
@@ -97,6 +97,7 @@ int volume_init(struct processing_module *mod)
 	}
 
 	md->private = cd;
+	mod->process_in_place = true;
 	cd->is_passthrough = false;
 
 	/* Set the default volumes. If IPC sets min_value or max_value to
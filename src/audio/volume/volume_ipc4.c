@@ -147,6 +147,7 @@ int volume_init(struct processing_module *mod)
 	}
 
 	md->private = cd;
+	mod->process_in_place = true;
 
 	for (channel = 0; channel < channels_count; channel++) {
 		if (vol->config[0].channel_id == IPC4_ALL_CHANNELS_MASK)
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation.
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <rtos/task.h>
+#include <sof/debug/task_trace.h>
+#include <sof/lib/uuid.h>
+#include <stdio.h>
+
+#include <user/debug_stream_slot.h>
+#include <user/debug_stream_task_trace.h>
+
+LOG_MODULE_REGISTER(task_trace);
+
+#define TASK_TRACE_EVENTS CONFIG_SOF_DEBUG_STREAM_TASK_TRACE_EVENTS
+
+/*
+ * Events per record. The record has to stay well below the size of
+ * the per core debug stream circular buffer, so that the host has a
+ * chance to read it before it is overwritten.
+ */
+#define TASK_TRACE_RECORD_EVENTS 16
+
+/*
+ * Per core ring of task trace events. The events are written by the
+ * schedulers of the core with interrupts disabled and read by the
+ * flush thread of the same core. When the ring is full the new events
+ * are dropped and only counted, so the reader never sees a partly
+ * overwritten event.
+ */
+static struct task_trace_ring {
+	struct task_trace_event events[TASK_TRACE_EVENTS];
+	uint32_t w_count;	/* Events written, wraps */
+	uint32_t r_count;	/* Events read, wraps */
+	uint32_t lost;		/* Events dropped since the last record */
+} __aligned(CONFIG_DCACHE_LINE_SIZE) rings[CONFIG_MP_MAX_NUM_CPUS];
+
+/*
+ * Per core record buffer, built and sent by the flush thread of the
+ * core. Aligned like the rings, so that the cores don't share cache
+ * lines.
+ */
+static struct task_trace_record {
+	struct task_trace_record_hdr hdr;
+	struct task_trace_event events[TASK_TRACE_RECORD_EVENTS];
+} __packed __aligned(CONFIG_DCACHE_LINE_SIZE) records[CONFIG_MP_MAX_NUM_CPUS];
+
+void task_trace_event(const struct task *task, uint32_t id, uint32_t type,
+		      uint32_t start, uint32_t end)
+{
+	unsigned int key = arch_irq_lock();
+	struct task_trace_ring *ring = &rings[arch_proc_id()];
+	struct task_trace_event *event;
+
+	if (ring->w_count - ring->r_count >= TASK_TRACE_EVENTS) {
+		ring->lost++;
+		arch_irq_unlock(key);
+		return;
+	}
+
+	event = &ring->events[ring->w_count % TASK_TRACE_EVENTS];
+	event->start = start;
+	event->end = end;
+	event->id = id;
+	event->uuid = task && task->uid ? task->uid->id.a : 0;
+	event->type = type;
+	ring->w_count++;
+
+	arch_irq_unlock(key);
+}
+
+/* Moves up to TASK_TRACE_RECORD_EVENTS events from the ring to the record */
+static int task_trace_fill(struct task_trace_ring *ring, struct task_trace_record *rec)
+{
+	unsigned int key = arch_irq_lock();
+	uint32_t count = MIN(ring->w_count - ring->r_count, TASK_TRACE_RECORD_EVENTS);
+	uint32_t i;
+
+	for (i = 0; i < count; i++)
+		rec->events[i] = ring->events[(ring->r_count + i) % TASK_TRACE_EVENTS];
+
+	ring->r_count += count;
+	rec->hdr.lost = ring->lost;
+	ring->lost = 0;
+	arch_irq_unlock(key);
+
+	rec->hdr.event_count = count;
+	return count;
+}
+
+static void task_trace_run(void *cnum, void *a, void *b)
+{
+	int core = (int)cnum;
+	struct task_trace_ring *ring = &rings[core];
+	struct task_trace_record *rec = &records[core];
+	size_t size;
+	int count;
+
+	rec->hdr.hdr.id = DEBUG_STREAM_RECORD_ID_TASK_TRACE;
+	rec->hdr.core = core;
+	rec->hdr.clock_hz = sys_clock_hw_cycles_per_sec();
+
+	for (;;) {
+		k_sleep(K_MSEC(CONFIG_SOF_DEBUG_STREAM_TASK_TRACE_INTERVAL));
+
+		/* Send at least the lost count if nothing else */
+		do {
+			count = task_trace_fill(ring, rec);
+			if (!count && !rec->hdr.lost)
+				break;
+
+			size = sizeof(rec->hdr) + count * sizeof(rec->events[0]);
+			rec->hdr.hdr.size_words = size / sizeof(rec->hdr.hdr.data[0]);
+			debug_stream_slot_send_record(&rec->hdr.hdr);
+		} while (count == TASK_TRACE_RECORD_EVENTS);
+	}
+}
+
+#define TASK_TRACE_STACK_SIZE (1024)
+static K_THREAD_STACK_ARRAY_DEFINE(task_trace_stacks, CONFIG_MP_MAX_NUM_CPUS,
+				   TASK_TRACE_STACK_SIZE);
+static struct k_thread task_trace_thread[CONFIG_MP_MAX_NUM_CPUS];
+
+static int task_trace_start(void)
+{
+	uint32_t i;
+
+	for (i = 0; i < ARRAY_SIZE(task_trace_thread); i++) {
+		char name[24];
+		k_tid_t tid;
+		int ret;
+
+		tid = k_thread_create(&task_trace_thread[i], task_trace_stacks[i],
+				      TASK_TRACE_STACK_SIZE, task_trace_run,
+				      (void *)i, NULL, NULL,
+				      K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+				      K_FOREVER);
+		if (!tid) {
+			LOG_ERR("k_thread_create() failed for core %u", i);
+			continue;
+		}
+		ret = k_thread_cpu_pin(tid, i);
+		if (ret < 0) {
+			LOG_ERR("Pinning thread to core %u", i);
+			k_thread_abort(tid);
+			continue;
+		}
+		snprintf(name, sizeof(name), "%u task trace", i);
+		ret = k_thread_name_set(tid, name);
+		if (ret < 0)
+			LOG_INF("k_thread_name_set failed: %d for %u", ret, i);
+
+		k_thread_start(tid);
+		LOG_DBG("Thread %p for core %u started", tid, i);
+	}
+
+	return 0;
+}
+
+SYS_INIT(task_trace_start, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
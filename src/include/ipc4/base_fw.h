@@ -294,6 +294,13 @@ enum ipc4_basefw_params {
 
 	/* Set policy mask for mic privacy in FW managed mode */
 	IPC4_SET_MIC_PRIVACY_FW_MANAGED_POLICY_MASK = 36,
+
+	/* Use LARGE_CONFIG_GET to read heap zone usage, allocation latency and
+	 * per call site allocation statistics as struct heap_telemetry_data.
+	 * Only XTOS builds with CONFIG_DEBUG_HEAP_TELEMETRY and the testbench
+	 * collect them, Zephyr builds return IPC4_UNAVAILABLE.
+	 */
+	IPC4_HEAP_TELEMETRY_GET = 37,
 };
 
 enum ipc4_fw_config_params {
@@ -87,7 +87,9 @@ enum ipc4_message_type {
 	SOF_IPC4_GLB_INTERNAL_MESSAGE = 26,
 	/**< Notification (FW to SW driver) */
 	SOF_IPC4_GLB_NOTIFICATION = 27,
-	/* GAP HERE- DO NOT USE - size 3 (28 .. 30)  */
+	/**< Create pipelines, modules and bindings in one message */
+	SOF_IPC4_GLB_PIPELINE_BATCH = 28,
+	/* GAP HERE- DO NOT USE - size 2 (29 .. 30)  */
 
 	/**< Maximum message number */
 	SOF_IPC4_GLB_MAX_IXC_MESSAGE_TYPE = 31
@@ -417,4 +417,62 @@ struct ipc4_chain_dma {
 	} extension;
 } __attribute__((packed, aligned(4)));
 
+/*!
+ * Host SW sends this message to construct a pipeline subgraph with a single
+ * IPC instead of one IPC per pipeline, module, binding and configuration.
+ *
+ * The payload is a sequence of count struct ipc4_pipeline_batch_entry, each
+ * carrying the header and payload of one of the following messages:
+ * Global::CREATE_PIPELINE, ModuleMsg::INIT_INSTANCE, ModuleMsg::BIND and
+ * single block ModuleMsg::LARGE_CONFIG_SET. Entries are processed in order
+ * so a module can only be referred to by the entries following its creation.
+ *
+ * All entries are validated before any of them is executed. If an entry
+ * fails to execute, the entries preceding it are undone in reverse order and
+ * the reply extension carries the index of the failed entry.
+ *
+ * \remark hide_methods
+ */
+struct ipc4_pipeline_batch {
+	union {
+		uint32_t dat;
+
+		struct {
+			/**< number of entries in payload */
+			uint32_t count          : 16;
+			uint32_t rsvd0          : 8;
+			/**< Global::PIPELINE_BATCH */
+			uint32_t type           : 5;
+			/**< Msg::MSG_REQUEST */
+			uint32_t rsp            : 1;
+			/**< Msg::FW_GEN_MSG */
+			uint32_t msg_tgt        : 1;
+			uint32_t _reserved_0    : 1;
+		} r;
+	} primary;
+
+	union {
+		uint32_t dat;
+
+		struct {
+			/**< payload size in bytes */
+			uint32_t data_size      : 20;
+			uint32_t rsvd1          : 10;
+			uint32_t _reserved_2    : 2;
+		} r;
+	} extension;
+} __attribute__((packed, aligned(4)));
+
+/**< Single message in ipc4_pipeline_batch payload */
+struct ipc4_pipeline_batch_entry {
+	/**< primary header of the message */
+	uint32_t primary;
+	/**< extension header of the message */
+	uint32_t extension;
+	/**< size of the message payload in bytes, multiple of 4 */
+	uint32_t size;
+	/**< message payload */
+	uint32_t data[];
+} __attribute__((packed, aligned(4)));
+
 #endif
@@ -64,6 +64,7 @@
 /* SRC */
 #define SOF_TKN_SRC_RATE_IN			300
 #define SOF_TKN_SRC_RATE_OUT			301
+#define SOF_TKN_SRC_COEF_BITS			302
 
 /* ASRC */
 #define SOF_TKN_ASRC_RATE_IN			320
@@ -36,7 +36,17 @@ struct crossover_state {
 typedef void (*crossover_split)(int32_t in, int32_t out[],
 				struct crossover_state *state);
 
+/**
+ * Splits a block of n samples of one channel into planar band buffers
+ * out[0] to out[num_sinks - 1]. The output is the same as with
+ * crossover_split for each sample. The input block is used as scratch and
+ * is overwritten.
+ */
+typedef void (*crossover_split_block)(int32_t *in, int32_t *out[], int n,
+				      struct crossover_state *state);
+
 extern const crossover_split crossover_split_fnmap[];
+extern const crossover_split_block crossover_split_block_fnmap[];
 
 /* crossover init function */
 int crossover_init_coef_ch(struct sof_eq_iir_biquad *coef,
@@ -81,4 +91,16 @@ static inline crossover_split crossover_find_split_func(int32_t num_sinks)
 	return crossover_split_fnmap[num_sinks - CROSSOVER_2WAY_NUM_SINKS];
 }
 
+/**
+ * \brief Returns Crossover block split function.
+ */
+static inline crossover_split_block crossover_find_split_block_func(int32_t num_sinks)
+{
+	if (num_sinks < CROSSOVER_2WAY_NUM_SINKS ||
+	    num_sinks > CROSSOVER_4WAY_NUM_SINKS)
+		return NULL;
+
+	return crossover_split_block_fnmap[num_sinks - CROSSOVER_2WAY_NUM_SINKS];
+}
+
 #endif /* __SOF_CROSSOVER_COMMON_H__ */
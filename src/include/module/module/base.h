@@ -168,6 +168,20 @@ struct processing_module {
 	 */
 	bool stream_copy_single_to_single;
 
+	/*
+	 * flag to indicate that the module with one source and one sink of the same format
+	 * produces exactly the frames it consumes and reads each sample before writing the
+	 * same position. The sink buffer can then share the memory of the source buffer.
+	 */
+	bool process_in_place;
+
+	/*
+	 * flag to indicate that the raw data module accesses its input and output buffers
+	 * with module_input_read() and module_output_write() only. The buffers then point
+	 * directly into the source buffer and the local sink buffer and may wrap.
+	 */
+	bool raw_data_zero_copy;
+
 	/* total processed data after stream started */
 	uint64_t total_data_consumed;
 	uint64_t total_data_produced;
@@ -51,6 +51,10 @@ struct input_stream_buffer {
 
 	/* Indicates end of stream condition has occurred on the input stream */
 	bool end_of_stream;
+
+	/* Continuation of the data after a circular buffer wrap, NULL if data is linear */
+	void *wrap_data;
+	uint32_t head_size; /* number of bytes at data before the wrap */
 };
 
 /**
@@ -60,6 +64,11 @@ struct input_stream_buffer {
 struct output_stream_buffer {
 	void *data; /* data stream buffer */
 	uint32_t size; /* size of data in the buffer */
+
+	/* Continuation of the buffer after a circular buffer wrap, NULL if buffer is linear */
+	void *wrap_data;
+	uint32_t head_size; /* number of bytes at data before the wrap */
+	uint32_t free; /* number of bytes the module can write */
 };
 
 struct processing_module;
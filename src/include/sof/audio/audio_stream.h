@@ -60,6 +60,9 @@ struct audio_stream {
 	uint8_t byte_align_req;
 	uint8_t frame_align_req;
 
+	/* in-place processing, the streams of a chain share the head's memory */
+	struct audio_stream *alias_source;	/**< Stream whose memory is used */
+	struct audio_stream *alias_sink;	/**< Stream using this memory */
 
 	/* runtime stream params */
 	struct sof_audio_stream_params runtime_stream_params;
@@ -67,6 +70,14 @@ struct audio_stream {
 
 void audio_stream_recalc_align(struct audio_stream *stream);
 
+/**
+ * Recalculates free bytes of the streams sharing memory with the stream.
+ * Data not yet read from a stream or from any stream downstream of it in
+ * the alias chain must not be overwritten by the producer of the stream.
+ * @param stream Any stream of the alias chain.
+ */
+void audio_stream_alias_update(struct audio_stream *stream);
+
 static inline void *audio_stream_get_rptr(const struct audio_stream *buf)
 {
 	return buf->r_ptr;
@@ -636,6 +647,9 @@ static inline void audio_stream_produce(struct audio_stream *buffer, uint32_t by
 
 	/* calculate free bytes */
 	buffer->free = buffer->size - buffer->avail;
+
+	if (buffer->alias_source || buffer->alias_sink)
+		audio_stream_alias_update(buffer);
 }
 
 /**
@@ -659,6 +673,9 @@ static inline void audio_stream_consume(struct audio_stream *buffer, uint32_t by
 
 	/* calculate free bytes */
 	buffer->free = buffer->size - buffer->avail;
+
+	if (buffer->alias_source || buffer->alias_sink)
+		audio_stream_alias_update(buffer);
 }
 
 /**
@@ -676,6 +693,9 @@ static inline void audio_stream_reset(struct audio_stream *buffer)
 
 	/* there are no avail samples at reset */
 	buffer->avail = 0;
+
+	if (buffer->alias_source || buffer->alias_sink)
+		audio_stream_alias_update(buffer);
 }
 
 /**
@@ -16,6 +16,7 @@
 #include <rtos/panic.h>
 #include <rtos/alloc.h>
 #include <rtos/cache.h>
+#include <sof/lib/notifier.h>
 #include <sof/lib/uuid.h>
 #include <sof/list.h>
 #include <sof/coherent.h>
@@ -132,8 +133,13 @@ struct comp_buffer {
 	/* configuration */
 	uint32_t caps;
 	uint32_t core;
+	uint32_t alias_size;		/* own size while stream memory is aliased */
+	bool no_alias;			/* reset or zeroed while streaming, never aliased */
 	struct tr_ctx tctx;			/* trace settings */
 
+	/* produce and consume listeners, NULL while nobody listens */
+	struct buffer_notify *notify;
+
 	/* connected components */
 	struct comp_dev *source;	/* source component */
 	struct comp_dev *sink;		/* sink component */
@@ -195,6 +201,26 @@ struct buffer_cb_free {
 	struct comp_buffer *buffer;
 };
 
+/* listener of the produce or consume notifications of one buffer */
+struct buffer_listener {
+	void *receiver;
+	enum notify_id type;
+	notifier_callback_t cb;
+	struct list_item list;
+};
+
+/*
+ * Produce and consume notifications of one buffer. Consecutive transactions
+ * of the same type are coalesced and delivered in one callback when the
+ * component that made them has finished its copy.
+ */
+struct buffer_notify {
+	struct list_item listeners;		/* list of struct buffer_listener */
+	uint32_t types;				/* BIT(notify_id) of all listeners */
+	enum notify_id pending_type;		/* type of the pending transaction */
+	struct buffer_cb_transact pending;	/* coalesced, not yet delivered */
+};
+
 #define buffer_from_list(ptr, dir) \
 	((dir) == PPL_DIR_DOWNSTREAM ? \
 	 container_of(ptr, struct comp_buffer, source_list) : \
@@ -218,6 +244,11 @@ int buffer_set_size(struct comp_buffer *buffer, uint32_t size, uint32_t alignmen
 int buffer_set_size_range(struct comp_buffer *buffer, size_t preferred_size, size_t minimum_size,
 			  uint32_t alignment);
 
+/* let sink share the memory of source for in-place processing */
+int buffer_alias(struct comp_buffer *source, struct comp_buffer *sink);
+/* give an aliased buffer its own memory again */
+int buffer_unalias(struct comp_buffer *buffer);
+
 /* legacy wrappers, to be removed. Don't use them if possible */
 static inline struct comp_buffer *comp_buffer_get_from_source(struct sof_source *source)
 {
@@ -245,6 +276,32 @@ void buffer_zero(struct comp_buffer *buffer);
 /* called by a component after producing data into this buffer */
 void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes);
 
+/**
+ * Register a callback for NOTIFIER_ID_BUFFER_PRODUCE or
+ * NOTIFIER_ID_BUFFER_CONSUME of a buffer. The callback gets a
+ * struct buffer_cb_transact covering all the transactions of one copy and
+ * must not unregister listeners of the buffer.
+ * @param buffer The buffer to listen to.
+ * @param receiver Private data passed to the callback.
+ * @param type Notification type.
+ * @param cb Callback function.
+ * @return 0 on success, -ENOMEM if no memory for the listener.
+ */
+int buffer_listener_register(struct comp_buffer *buffer, void *receiver, enum notify_id type,
+			     notifier_callback_t cb);
+
+/**
+ * Unregister the matching callbacks of a buffer, NULL receiver acts as a wildcard.
+ * @param buffer The buffer listened to.
+ * @param receiver Private data given at registration or NULL.
+ * @param type Notification type.
+ */
+void buffer_listener_unregister(struct comp_buffer *buffer, void *receiver,
+				enum notify_id type);
+
+/* deliver the coalesced notification of a buffer */
+void buffer_notify_flush(struct comp_buffer *buffer);
+
 /* called by a component after consuming data from this buffer */
 void comp_update_buffer_consume(struct comp_buffer *buffer, uint32_t bytes);
 
@@ -534,6 +534,7 @@ struct comp_driver {
 struct comp_driver_info {
 	const struct comp_driver *drv;	/**< pointer to component driver */
 	struct list_item list;		/**< list of component drivers */
+	struct list_item hash_list;	/**< list in UUID hash bucket */
 };
 
 #define COMP_PROCESSING_DOMAIN_LL 0
@@ -859,6 +860,7 @@ void sys_comp_module_gain_interface_init(void);
 void sys_comp_module_google_rtc_audio_processing_interface_init(void);
 void sys_comp_module_google_ctc_audio_processing_interface_init(void);
 void sys_comp_module_igo_nr_interface_init(void);
+void sys_comp_module_limiter_interface_init(void);
 void sys_comp_module_mfcc_interface_init(void);
 void sys_comp_module_mixer_interface_init(void);
 void sys_comp_module_mixin_interface_init(void);
@@ -869,6 +871,7 @@ void sys_comp_module_asrc_interface_init(void);
 void sys_comp_module_rtnr_interface_init(void);
 void sys_comp_module_selector_interface_init(void);
 void sys_comp_module_src_interface_init(void);
+void sys_comp_module_stft_interface_init(void);
 void sys_comp_module_tdfb_interface_init(void);
 void sys_comp_module_volume_interface_init(void);
 void sys_comp_module_tester_interface_init(void);
@@ -902,6 +905,14 @@ int comp_register(struct comp_driver_info *drv);
  */
 void comp_unregister(struct comp_driver_info *drv);
 
+/**
+ * Finds a registered component driver by UUID. The caller must hold the
+ * driver list lock or have the local interrupts disabled.
+ * @param uuid UUID of the driver, doesn't need to be aligned.
+ * @return Component driver or NULL if not found.
+ */
+const struct comp_driver *comp_driver_find_by_uuid(const void *uuid);
+
 /** @}*/
 
 /**
@@ -23,9 +23,14 @@
  *  @{
  */
 
+/** \brief Number of hash buckets for driver lookup by UUID. */
+#define COMP_DRIVER_HASH_BITS	5
+#define COMP_DRIVER_HASH_SIZE	BIT(COMP_DRIVER_HASH_BITS)
+
 /** \brief Holds list of registered components' drivers */
 struct comp_driver_list {
 	struct list_item list;	/**< list of component drivers */
+	struct list_item hash[COMP_DRIVER_HASH_SIZE]; /**< drivers by UUID */
 	struct k_spinlock lock;	/**< list lock */
 };
 
@@ -39,6 +44,9 @@ struct comp_driver_list {
 struct comp_dev *comp_new(struct sof_ipc_comp *comp);
 #elif CONFIG_IPC_MAJOR_4
 struct comp_dev *comp_new_ipc4(struct ipc4_module_init_instance *module_init);
+/** Creates the component with init data at data instead of the host mailbox */
+struct comp_dev *comp_new_ipc4_data(struct ipc4_module_init_instance *module_init,
+				    const char *data);
 #endif
 
 /** See comp_ops::free */
@@ -197,6 +197,64 @@ int module_process_legacy(struct processing_module *mod,
 			  struct input_stream_buffer *input_buffers, int num_input_buffers,
 			  struct output_stream_buffer *output_buffers,
 			  int num_output_buffers);
+
+/**
+ * \brief Read data from the input buffer of a raw data module.
+ * \param[in] input - module input buffer, linear or wrapping
+ * \param[in] offset - offset of the data to read in bytes
+ * \param[out] dst - destination of the data
+ * \param[in] bytes - number of bytes to read
+ */
+static inline void module_input_read(const struct input_stream_buffer *input, uint32_t offset,
+				     void *dst, uint32_t bytes)
+{
+	const uint8_t *src = (const uint8_t *)input->data + offset;
+	uint32_t head = bytes;
+
+	if (input->wrap_data) {
+		if (offset >= input->head_size)
+			src = (const uint8_t *)input->wrap_data + offset - input->head_size;
+		else
+			head = MIN(bytes, input->head_size - offset);
+	}
+
+	memcpy(dst, src, head);
+	if (head < bytes)
+		memcpy((uint8_t *)dst + head, input->wrap_data, bytes - head);
+}
+
+/**
+ * \brief Append data to the output buffer of a raw data module.
+ * \param[in,out] output - module output buffer, linear or wrapping
+ * \param[in] src - data to write
+ * \param[in] bytes - number of bytes to write
+ *
+ * \return number of bytes written, limited by the free space of the output
+ */
+static inline uint32_t module_output_write(struct output_stream_buffer *output,
+					   const void *src, uint32_t bytes)
+{
+	uint8_t *dst = (uint8_t *)output->data + output->size;
+	uint32_t head;
+
+	bytes = MIN(bytes, output->free - output->size);
+	head = bytes;
+
+	if (output->wrap_data) {
+		if (output->size >= output->head_size)
+			dst = (uint8_t *)output->wrap_data + output->size - output->head_size;
+		else
+			head = MIN(bytes, output->head_size - output->size);
+	}
+
+	memcpy(dst, src, head);
+	if (head < bytes)
+		memcpy(output->wrap_data, (const uint8_t *)src + head, bytes - head);
+
+	output->size += bytes;
+	return bytes;
+}
+
 int module_reset(struct processing_module *mod);
 int module_free(struct processing_module *mod);
 int module_set_configuration(struct processing_module *mod,
@@ -38,4 +38,49 @@ int sink_fill_with_silence(struct sof_sink *sink, size_t size);
  */
 int source_drop_data(struct sof_source *source, size_t size);
 
+/**
+ * convert interleaved source frames to planar float samples in [-1.0, 1.0)
+ *
+ * S16_LE, S24_4LE and S32_LE sources are supported. Source channels above
+ * the requested number are skipped. The data is freed from the source.
+ *
+ * @param source the data source
+ * @param dst planar buffers, one per channel
+ * @param channels number of planar buffers, up to the source channels
+ * @param frames number of frames to be converted
+ */
+int source_to_planar_float(struct sof_source *source, float * const *dst,
+			   size_t channels, size_t frames);
+
+/**
+ * convert planar float samples to interleaved sink frames, with saturation
+ *
+ * S16_LE, S24_4LE and S32_LE sinks are supported. Sink channels above the
+ * provided number are filled with silence.
+ *
+ * @param sink the data target
+ * @param src planar buffers, one per channel
+ * @param channels number of planar buffers, up to the sink channels
+ * @param frames number of frames to be converted
+ */
+int sink_from_planar_float(struct sof_sink *sink, float * const *src,
+			   size_t channels, size_t frames);
+
+/**
+ * convert interleaved source frames to planar Q1.31 samples
+ *
+ * @see source_to_planar_float()
+ */
+int source_to_planar_q31(struct sof_source *source, int32_t * const *dst,
+			 size_t channels, size_t frames);
+
+/**
+ * convert planar Q1.31 samples to interleaved sink frames, with rounding
+ * and saturation
+ *
+ * @see sink_from_planar_float()
+ */
+int sink_from_planar_q31(struct sof_sink *sink, int32_t * const *src,
+			 size_t channels, size_t frames);
+
 #endif /* SINK_SOURCE_UTILS_H */
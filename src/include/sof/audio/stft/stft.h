@@ -0,0 +1,142 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+/* Short-time Fourier transform (STFT) analysis and overlap-add synthesis
+ * framework for spectral processing components.
+ *
+ * The framework buffers the interleaved source stream into frames of
+ * frame_length samples advanced by frame_shift samples, applies the analysis
+ * window and a real FFT, and then calls the component's frame callback with
+ * the half spectra (frame_length / 2 + 1 bins) of every channel. After the
+ * callback the spectra are inverse transformed, weighted with the synthesis
+ * window and overlap-added to the sink. The synthesis window is normalized
+ * so that with an unmodified spectrum the output is the input delayed by
+ * frame_length samples.
+ */
+
+#ifndef __SOF_AUDIO_STFT_STFT_H__
+#define __SOF_AUDIO_STFT_STFT_H__
+
+#include <sof/audio/module_adapter/module/generic.h>
+#include <sof/math/fft.h>
+#include <sof/platform.h>
+#include <ipc/stream.h>
+#include <user/stft.h>
+#include <stdint.h>
+
+#define STFT_FRAME_LENGTH_MIN		16
+#define STFT_FRAME_LENGTH_MAX		FFT_SIZE_MAX
+
+/* The default when no configuration blob is set, Hann window with 75%
+ * overlap, 256 samples is 5.3 ms at 48 kHz.
+ */
+#define STFT_DEFAULT_FRAME_LENGTH	256
+#define STFT_DEFAULT_FRAME_SHIFT	64
+#define STFT_DEFAULT_WINDOW		STFT_HANN_WINDOW
+
+/* Minimum sum of squared overlapping window values, Q2.30. A smaller sum
+ * would need a synthesis window gain above 8 that can't be represented.
+ */
+#define STFT_WINDOW_SUM_MIN		Q_CONVERT_FLOAT(0.125, 30)
+
+struct stft_state;
+
+/**
+ * \brief Type definition for per frame spectral processing callback.
+ *
+ * The callback can read and modify in place the channel spectra in
+ * state->spectra[ch][bin], bin 0 is DC and bin half_fft_size - 1 is Nyquist.
+ * The spectra are scaled by 1 / frame_length and by 2^state->norm_shift[ch]
+ * versus the time domain input level.
+ */
+typedef void (*stft_frame_func)(struct stft_state *state, void *arg);
+
+/** \brief Type definition for format specific interleaved stream copy. */
+typedef void (*stft_copy_func)(struct stft_state *state,
+			       const void *x, const void *x_start, const void *x_end,
+			       void *y, void *y_start, void *y_end,
+			       int frames);
+
+/** \brief STFT format specific functions map item. */
+struct stft_func_map {
+	enum sof_ipc_frame fmt;		/**< source and sink frame format */
+	stft_copy_func func;		/**< copy function */
+};
+
+struct stft_state {
+	struct fft_plan *fft_plan;
+	struct icomplex32 *fft_buf; /**< fft_size */
+	struct icomplex32 *fft_out; /**< fft_size */
+	struct icomplex32 *spectra[PLATFORM_MAX_CHANNELS]; /**< half_fft_size per channel */
+	int32_t *in_buf[PLATFORM_MAX_CHANNELS]; /**< fft_size per channel */
+	int32_t *ola_buf[PLATFORM_MAX_CHANNELS]; /**< fft_size per channel */
+	int32_t *out_buf[PLATFORM_MAX_CHANNELS]; /**< hop_size per channel */
+	int16_t *window; /**< Q1.15 analysis window, fft_size */
+	int32_t *synth_window; /**< Q4.28 normalized synthesis window, fft_size */
+	void *buffers; /**< Single allocation for all of the above buffers */
+	stft_frame_func frame_func;
+	void *frame_arg;
+	stft_copy_func copy_func;
+	int norm_shift[PLATFORM_MAX_CHANNELS];
+	int channels;
+	int fft_size;
+	int half_fft_size;
+	int hop_size;
+	int fill; /**< Position in in_buf for next input sample */
+	size_t buffers_size; /**< bytes */
+};
+
+/**
+ * \brief Allocate and initialize STFT state.
+ * \param[in] mod  Processing module that owns the state.
+ * \param[out] state  STFT state to initialize.
+ * \param[in] config  Frame length, frame shift and window, defaults are used if NULL.
+ * \param[in] channels  Number of interleaved channels in source and sink.
+ * \param[in] fmt  Frame format of source and sink.
+ * \param[in] func  Per frame spectral processing callback, NULL for pass-through.
+ * \param[in] arg  Argument passed to the callback.
+ * \return Zero on success, otherwise error code.
+ */
+int stft_setup(struct processing_module *mod, struct stft_state *state,
+	       const struct sof_stft_config *config, int channels,
+	       enum sof_ipc_frame fmt, stft_frame_func func, void *arg);
+
+/**
+ * \brief Free buffers allocated by stft_setup().
+ * \param[in,out] state  STFT state.
+ */
+void stft_free_buffers(struct stft_state *state);
+
+/**
+ * \brief Clear the sample history, the next output is silence for
+ * frame_length samples.
+ * \param[in,out] state  STFT state.
+ */
+void stft_reset_state(struct stft_state *state);
+
+/**
+ * \brief Process frames from source to sink. The same number of frames
+ * is consumed from source and produced to sink.
+ * \param[in,out] state  STFT state.
+ * \param[in] source  Source with interleaved samples.
+ * \param[in] sink  Sink for interleaved samples.
+ * \param[in] frames  Number of frames to process.
+ * \return Zero on success, otherwise error code.
+ */
+int stft_process(struct stft_state *state, struct sof_source *source,
+		 struct sof_sink *sink, int frames);
+
+/**
+ * \brief Analyze the buffered frame, call the frame callback and add the
+ * synthesized frame into the overlap-add buffer. The format specific copy
+ * functions call this when fill reaches fft_size.
+ * \param[in,out] state  STFT state.
+ */
+void stft_do_frame(struct stft_state *state);
+
+extern const struct stft_func_map stft_fm[];
+extern const size_t stft_fm_count;
+
+#endif /* __SOF_AUDIO_STFT_STFT_H__ */
@@ -0,0 +1,52 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation.
+ */
+
+#ifndef __SOF_DEBUG_TASK_TRACE_H__
+#define __SOF_DEBUG_TASK_TRACE_H__
+
+#include <sof/compiler_attributes.h>
+#include <user/debug_stream_task_trace.h>
+#include <stdint.h>
+
+struct task;
+
+#if CONFIG_SOF_DEBUG_STREAM_TASK_TRACE
+
+#include <zephyr/kernel.h>
+
+/**
+ * \brief Returns the current task trace timestamp.
+ */
+static inline uint32_t task_trace_timestamp(void)
+{
+	return k_cycle_get_32();
+}
+
+/**
+ * \brief Adds a task run to the task trace of the current core.
+ * \param task Task that was run, NULL for a scheduler tick.
+ * \param id Component ID for DP tasks, task address for LL tasks, zero for a tick.
+ * \param type TASK_TRACE_TYPE_ event type.
+ * \param start Timestamp when the run started.
+ * \param end Timestamp when the run ended.
+ *
+ * The event is dropped and counted as lost if the trace ring is full.
+ */
+void task_trace_event(const struct task *task, uint32_t id, uint32_t type,
+		      uint32_t start, uint32_t end);
+
+#else
+
+static inline uint32_t task_trace_timestamp(void)
+{
+	return 0;
+}
+
+static inline void task_trace_event(const struct task *task, uint32_t id, uint32_t type,
+				    uint32_t start, uint32_t end) { }
+
+#endif /* CONFIG_SOF_DEBUG_STREAM_TASK_TRACE */
+
+#endif /* __SOF_DEBUG_TASK_TRACE_H__ */
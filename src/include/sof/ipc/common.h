@@ -48,6 +48,10 @@ extern struct tr_ctx ipc_tr;
 #define ipc_get_ppl_sink_comp(ipc, ppl_id) \
 	ipc_get_ppl_comp(ipc, ppl_id, PPL_DIR_DOWNSTREAM)
 
+/* Number of hash buckets for component lookup by component and pipeline ID */
+#define IPC_COMP_HASH_BITS	6
+#define IPC_COMP_HASH_SIZE	BIT(IPC_COMP_HASH_BITS)
+
 #define IPC_TASK_INLINE		BIT(0)
 #define IPC_TASK_IN_THREAD	BIT(1)
 #define IPC_TASK_SECONDARY_CORE	BIT(2)
@@ -66,6 +70,8 @@ struct ipc {
 	unsigned int core;		/* core, processing the IPC */
 
 	struct list_item comp_list;	/* list of component devices */
+	struct list_item comp_id_hash[IPC_COMP_HASH_SIZE];	/* devices by ID */
+	struct list_item comp_ppl_hash[IPC_COMP_HASH_SIZE];	/* devices by pipeline ID */
 
 	/* processing task */
 #if CONFIG_TWB_IPC_TASK
@@ -87,6 +93,17 @@ struct ipc {
 	void *private;
 };
 
+/**
+ * \brief Get the hash bucket of a component or pipeline ID.
+ *
+ * Multiplicative hashing spreads both the module ID in the low and the
+ * instance ID in the high half of IPC4 component IDs over the buckets.
+ */
+static inline uint32_t ipc_comp_hash(uint32_t id)
+{
+	return (id * 0x9e3779b1u) >> (32 - IPC_COMP_HASH_BITS);
+}
+
 #define ipc_set_drvdata(ipc, data) \
 	((ipc)->private = data)
 #define ipc_get_drvdata(ipc) \
@@ -97,8 +97,24 @@ struct ipc_comp_dev {
 
 	/* lists */
 	struct list_item list;		/* list in components */
+	struct list_item id_list;	/* list in component ID hash bucket */
+	struct list_item ppl_list;	/* list in pipeline ID hash bucket */
 };
 
+/**
+ * \brief Add component device to the IPC component list and lookup indices.
+ * @param ipc The global IPC context.
+ * @param icd The component device, the ID, type and the pipeline ID
+ *	      must be set.
+ */
+void ipc_comp_dev_add(struct ipc *ipc, struct ipc_comp_dev *icd);
+
+/**
+ * \brief Remove component device from the IPC component list and lookup indices.
+ * @param icd The component device.
+ */
+void ipc_comp_dev_del(struct ipc_comp_dev *icd);
+
 /**
  * \brief Create a new IPC component.
  * @param ipc The global IPC context.
@@ -13,4 +13,26 @@
 const void *fast_get(const void * const dram_ptr, size_t size);
 void fast_put(const void *sram_ptr);
 
+/**
+ * \brief Fills a fast_get_generate() buffer.
+ * \param[out] buf Buffer to fill.
+ * \param[in] size Size of the buffer.
+ * \param[in] key Key passed to fast_get_generate().
+ * \return 0 on success, negative error code otherwise.
+ */
+typedef int (*fast_get_generator_t)(void *buf, size_t size, const void *key);
+
+/**
+ * \brief Like fast_get(), but the data is computed instead of copied.
+ *
+ * The first user of a key calls the generator, later users share the
+ * result until the last fast_put(). The generator is called without locks
+ * held, so it can be slow.
+ * \param[in] key Constant object identifying the data, e.g. its description.
+ * \param[in] size Size of the data.
+ * \param[in] generate Function computing the data.
+ * \return Pointer to the data, NULL on failure.
+ */
+const void *fast_get_generate(const void *key, size_t size, fast_get_generator_t generate);
+
 #endif /* __SOF_LIB_FAST_GET_H__ */
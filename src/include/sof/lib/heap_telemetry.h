@@ -0,0 +1,124 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __SOF_LIB_HEAP_TELEMETRY_H__
+#define __SOF_LIB_HEAP_TELEMETRY_H__
+
+#include <rtos/alloc.h>
+#include <sof/compiler_attributes.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define HEAP_TELEMETRY_ZONES		8	/**< zone entries, covers enum mem_zone */
+#define HEAP_TELEMETRY_ZONE_ALL		0xffffffff	/**< all zones share one heap */
+#define HEAP_TELEMETRY_BINS		32	/**< log2 histogram bins */
+#define HEAP_TELEMETRY_CALLERS		32	/**< tracked allocation call sites */
+
+/** \brief Heap state of a zone */
+struct heap_telemetry_zone {
+	uint32_t zone;		/**< enum mem_zone or HEAP_TELEMETRY_ZONE_ALL */
+	uint32_t size;		/**< bytes managed by the zone */
+	uint32_t used;		/**< bytes allocated */
+	uint32_t free;		/**< bytes available */
+	uint32_t largest_free;	/**< largest allocation that can succeed, 0 if unknown */
+} __packed;
+
+/** \brief Allocations made from one call site */
+struct heap_telemetry_caller {
+	uint64_t caller;	/**< return address of the allocation call */
+	uint32_t allocs;
+	uint32_t failures;
+	uint32_t bytes;		/**< requested bytes in total */
+	uint32_t max_bytes;	/**< largest single request */
+} __packed;
+
+/** \brief Latency distribution in timer ticks, percentiles are bin upper bounds */
+struct heap_telemetry_latency {
+	uint32_t count;
+	uint32_t p50;
+	uint32_t p90;
+	uint32_t p99;
+	uint32_t max;
+} __packed;
+
+/**
+ * \brief Heap telemetry snapshot, also the IPC4_HEAP_TELEMETRY_GET payload.
+ *
+ * Callers are sorted by the number of allocations, the ones which didn't fit
+ * in the call site table are only counted in caller_overflow.
+ */
+struct heap_telemetry_data {
+	uint32_t ticks_per_ms;		/**< converts latencies to time */
+	uint32_t frees;
+	uint32_t allocs[HEAP_TELEMETRY_ZONES];		/**< by requested zone */
+	uint32_t failures[HEAP_TELEMETRY_ZONES];	/**< by requested zone */
+	uint32_t size_hist[HEAP_TELEMETRY_BINS];	/**< requests by log2 of size */
+	struct heap_telemetry_latency alloc_latency;
+	struct heap_telemetry_latency free_latency;
+	uint32_t caller_overflow;
+	uint32_t num_zones;
+	uint32_t num_callers;
+	struct heap_telemetry_zone zones[HEAP_TELEMETRY_ZONES];
+	struct heap_telemetry_caller callers[];
+} __packed;
+
+#if CONFIG_DEBUG_HEAP_TELEMETRY
+
+#define HEAP_TELEMETRY_CALLER() __builtin_return_address(0)
+
+/** \brief Time stamp to pass to heap_telemetry_alloc() and heap_telemetry_free() */
+uint64_t heap_telemetry_time(void);
+
+/**
+ * \brief Accounts an allocation, called by the allocator.
+ * \param[in] zone Requested zone.
+ * \param[in] bytes Requested size.
+ * \param[in] ptr Allocated memory, NULL on failure.
+ * \param[in] caller Call site, see HEAP_TELEMETRY_CALLER().
+ * \param[in] start heap_telemetry_time() at the beginning of the allocation.
+ */
+void heap_telemetry_alloc(enum mem_zone zone, size_t bytes, const void *ptr,
+			  const void *caller, uint64_t start);
+
+/** \brief Accounts freeing of a non-NULL pointer, started at the start time stamp */
+void heap_telemetry_free(uint64_t start);
+
+/**
+ * \brief Takes a telemetry snapshot.
+ * \param[out] data Snapshot, as many callers as fit in size are returned.
+ * \param[in] size Bytes available at data.
+ * \return Snapshot size in bytes, 0 if the buffer is too small.
+ */
+size_t heap_telemetry_get(struct heap_telemetry_data *data, size_t size);
+
+/**
+ * \brief Reports the state of the heap zones, implemented by the allocator.
+ * \param[out] zones Zone entries.
+ * \param[in] max Number of zone entries.
+ * \return Number of reported zones.
+ */
+unsigned int heap_telemetry_zones(struct heap_telemetry_zone *zones, unsigned int max);
+
+#else
+
+#define HEAP_TELEMETRY_CALLER() NULL
+
+static inline uint64_t heap_telemetry_time(void)
+{
+	return 0;
+}
+
+static inline void heap_telemetry_alloc(enum mem_zone zone, size_t bytes, const void *ptr,
+					const void *caller, uint64_t start)
+{
+}
+
+static inline void heap_telemetry_free(uint64_t start)
+{
+}
+
+#endif
+
+#endif /* __SOF_LIB_HEAP_TELEMETRY_H__ */
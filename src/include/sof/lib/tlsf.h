@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __SOF_LIB_TLSF_H__
+#define __SOF_LIB_TLSF_H__
+
+#include <stddef.h>
+
+/**
+ * \brief Two-level segregated fit allocator.
+ *
+ * Free blocks are kept in lists indexed by the power of two of their size
+ * (first level) and by a linear subdivision of that power (second level).
+ * Bitmaps of non-empty lists make allocation and free O(1), independent of
+ * the number and layout of allocations. Free blocks are coalesced with
+ * their physical neighbours immediately.
+ *
+ * The allocator isn't locked, the caller serializes access to an instance.
+ */
+struct tlsf;
+
+/**
+ * \brief Creates an allocator managing a memory region.
+ * \param[in] mem Memory region, it also holds the allocator state.
+ * \param[in] bytes Size of the region.
+ * \return Allocator, NULL if the region is too small or too large.
+ */
+struct tlsf *tlsf_init(void *mem, size_t bytes);
+
+/**
+ * \brief Allocates memory aligned to the pointer size.
+ * \return Allocated memory, NULL on failure.
+ */
+void *tlsf_malloc(struct tlsf *tlsf, size_t bytes);
+
+/**
+ * \brief Allocates aligned memory.
+ * \param[in] tlsf Allocator.
+ * \param[in] align Alignment, a power of 2.
+ * \param[in] bytes Requested size.
+ * \return Allocated memory, NULL on failure.
+ */
+void *tlsf_memalign(struct tlsf *tlsf, size_t align, size_t bytes);
+
+/** \brief Frees memory returned by tlsf_malloc() or tlsf_memalign() */
+void tlsf_free(struct tlsf *tlsf, void *ptr);
+
+/** \brief Usable size of an allocation, at least the requested size */
+size_t tlsf_block_size(const void *ptr);
+
+/** \brief Size of the largest free block */
+size_t tlsf_largest_free(const struct tlsf *tlsf);
+
+/**
+ * \brief Validates the block layout and the free lists.
+ * \param[in] tlsf Allocator.
+ * \param[out] free_bytes Sum of free block sizes, can be NULL.
+ * \return 0 when consistent, -EINVAL otherwise.
+ */
+int tlsf_check(const struct tlsf *tlsf, size_t *free_bytes);
+
+#endif /* __SOF_LIB_TLSF_H__ */
@@ -26,7 +26,7 @@ struct sof_eq_fir_coef_data;
 struct fir_state_32x16 {
 	int rwi; /* Circular read and write index */
 	int taps; /* Number of FIR taps */
-	int length; /* Number of FIR taps plus input length (even) */
+	int length; /* Circular buffer length, the delay line is twice this */
 	int out_shift; /* Amount of right shifts at output */
 	int16_t *coef; /* Pointer to FIR coefficients */
 	int32_t *delay; /* Pointer to FIR delay line */
@@ -45,5 +45,19 @@ int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x);
 
 void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1, int32_t *y0, int32_t *y1);
 
+/**
+ * \brief Filters a block of samples of one channel.
+ *
+ * The output can be written in place of the input. Only the generic C
+ * version exists, the HiFi builds keep the sample pair kernels of
+ * fir_hifi2ep.c, fir_hifi3.c and fir_hifi5.c and their single delay line.
+ *
+ * \param[in,out] fir Filter state.
+ * \param[in] x Input samples in Q1.31.
+ * \param[out] y Output samples in Q1.31.
+ * \param[in] n Number of samples.
+ */
+void fir_32x16_block(struct fir_state_32x16 *fir, const int32_t *x, int32_t *y, int n);
+
 #endif
 #endif /* __SOF_MATH_FIR_GENERIC_H__ */
@@ -53,6 +53,16 @@ int32_t iir_df1(struct iir_state_df1 *iir, int32_t x);
  */
 int32_t iir_df1_4th(struct iir_state_df1 *iir, int32_t x);
 
+/**
+ * Calculate 4th order IIR filter as iir_df1_4th() for a block of samples.
+ * The output can be written in place of the input.
+ * @param iir	IIR state with configured biquad coefficients and delay lines data
+ * @param x	Input samples in s32 Q1.31 format
+ * @param y	Output samples in s32 Q1.31 format
+ * @param n	Number of samples
+ */
+void iir_df1_4th_block(struct iir_state_df1 *iir, const int32_t *x, int32_t *y, int n);
+
 /* Inline functions */
 #if SOF_USE_MIN_HIFI(3, FILTER)
 #include "iir_df1_hifi3.h"
@@ -41,6 +41,15 @@ void win_blackman_16b(int16_t win[], int length, int16_t a0);
  */
 void win_hamming_16b(int16_t win[], int length);
 
+/**
+ * \brief Calculate Hann window function, reference
+ * https://en.wikipedia.org/wiki/Window_function#Hann_and_Hamming_windows
+ *
+ * \param[in,out]  win     Output vector with coefficients
+ * \param[in]      length  Length of coefficients vector
+ */
+void win_hann_16b(int16_t win[], int length);
+
 /**
  * \brief Calculate Povey window function. It's a window function
  * from Pytorch.
@@ -48,5 +48,6 @@ struct debug_stream_record {
 /* Debug Stream record identifiers */
 #define DEBUG_STREAM_RECORD_ID_UNINITIALIZED	0 /* invalid record marker */
 #define DEBUG_STREAM_RECORD_ID_THREAD_INFO	1 /* Thread info record */
+#define DEBUG_STREAM_RECORD_ID_TASK_TRACE	2 /* LL and DP task timeline record */
 
 #endif /* __SOC_DEBUG_STREAM_H__ */
@@ -0,0 +1,43 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation.
+ */
+
+#ifndef __SOC_DEBUG_STREAM_TASK_TRACE_H__
+#define __SOC_DEBUG_STREAM_TASK_TRACE_H__
+
+#include <stdint.h>
+#include <user/debug_stream.h>
+
+/* Task trace event types */
+#define TASK_TRACE_TYPE_LL_TICK	0 /* Whole LL scheduler tick */
+#define TASK_TRACE_TYPE_LL	1 /* LL task run */
+#define TASK_TRACE_TYPE_DP	2 /* DP task run, includes the time it was preempted */
+
+/*
+ * Debug Stream Task Trace record header. Immediately after the header
+ * follows event_count task trace events of the core, in the order they
+ * ended. The timestamps are free running 32-bit counter values of a clock
+ * common to all cores, the clock rate is in clock_hz.
+ */
+struct task_trace_record_hdr {
+	struct debug_stream_record hdr;
+	uint32_t core;		/* Core that ran the tasks */
+	uint32_t clock_hz;	/* Timestamp clock rate */
+	uint32_t lost;		/* Events dropped before this record, the trace ring was full */
+	uint32_t event_count;
+} __packed;
+
+/*
+ * Debug Stream Task Trace event for one run of a task.
+ */
+struct task_trace_event {
+	uint32_t start;		/* Timestamp when the task run started */
+	uint32_t end;		/* Timestamp when the task run ended */
+	uint32_t id;		/* Component ID for DP, task address for LL, zero for a tick */
+	uint32_t uuid;		/* First 32 bits of the task UUID, zero for a tick */
+	uint8_t type;		/* TASK_TRACE_TYPE_ */
+	uint8_t reserved[3];
+} __packed;
+
+#endif /*  __SOC_DEBUG_STREAM_TASK_TRACE_H__ */
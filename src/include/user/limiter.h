@@ -0,0 +1,25 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __USER_LIMITER_H__
+#define __USER_LIMITER_H__
+
+#include <stdint.h>
+
+#define SOF_LIMITER_CONFIG_MAX_SIZE	256	/* Max size for configuration data in bytes */
+
+/*
+ * Configuration blob
+ */
+struct sof_limiter_config {
+	uint32_t size; /**< Size of this struct in bytes */
+	uint32_t reserved[4];
+	int32_t threshold; /**< Q1.31, linear peak level, e.g. 0x721482c0 for -1 dBFS */
+	int32_t lookahead_us; /**< microseconds, look-ahead time and output delay */
+	int32_t release_us; /**< microseconds, release time constant */
+	int32_t reserved2;
+} __attribute__((packed));
+
+#endif /* __USER_LIMITER_H__ */
@@ -0,0 +1,33 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __USER_STFT_H__
+#define __USER_STFT_H__
+
+#include <stdint.h>
+
+#define SOF_STFT_CONFIG_MAX_SIZE	256	/* Max size for configuration data in bytes */
+
+enum sof_stft_window_type {
+	STFT_RECTANGULAR_WINDOW = 0,
+	STFT_BLACKMAN_WINDOW = 1,
+	STFT_HAMMING_WINDOW = 2,
+	STFT_HANN_WINDOW = 3,
+	STFT_POVEY_WINDOW = 4,
+};
+
+/*
+ * Configuration blob
+ */
+struct sof_stft_config {
+	uint32_t size; /**< Size of this struct in bytes */
+	uint32_t reserved[4];
+	int16_t frame_length; /**< samples, power of two, e.g. 256 */
+	int16_t frame_shift; /**< samples, hop between frames, e.g. 64 */
+	int16_t window; /**< Use enum sof_stft_window_type */
+	int16_t blackman_coef; /**< Q1.15, typically set to 0.42 for BLACKMAN_WINDOW */
+} __attribute__((packed));
+
+#endif /* __USER_STFT_H__ */
@@ -102,6 +102,16 @@ static inline const struct ipc4_pipeline_set_state_data *ipc4_get_pipeline_data(
 
 	return ppl_data;
 }
+
+#define IPC4_PIPELINE_BATCH_MAX_SIZE \
+	(SOF_IPC_MSG_MAX_SIZE - sizeof(struct ipc4_pipeline_batch))
+
+static inline const char *ipc4_get_pipeline_batch_data(void)
+{
+	struct ipc *ipc = ipc_get();
+
+	return (const char *)ipc->comp_data + sizeof(struct ipc4_pipeline_batch);
+}
 #else
 static inline struct ipc4_message_request *ipc4_get_message_request(void)
 {
@@ -127,6 +137,16 @@ static inline const struct ipc4_pipeline_set_state_data *ipc4_get_pipeline_data(
 
 	return ppl_data;
 }
+
+#define IPC4_PIPELINE_BATCH_MAX_SIZE	MAILBOX_HOSTBOX_SIZE
+
+static inline const char *ipc4_get_pipeline_batch_data(void)
+{
+	dcache_invalidate_region((__sparse_force void __sparse_cache *)MAILBOX_HOSTBOX_BASE,
+				 MAILBOX_HOSTBOX_SIZE);
+
+	return (const char *)MAILBOX_HOSTBOX_BASE;
+}
 #endif
 /*
  * Global IPC Operations.
@@ -763,7 +783,7 @@ static int ipc4_process_chain_dma(struct ipc4_message_request *ipc4)
 		return IPC4_INVALID_CHAIN_STATE_TRANSITION;
 
 	if (!cdma.primary.r.allocate && !cdma.primary.r.enable)
-		list_item_del(&cdma_comp->list);
+		ipc_comp_dev_del(cdma_comp);
 
 	return IPC4_SUCCESS;
 #else
@@ -795,6 +815,8 @@ static int ipc4_process_ipcgtw_cmd(struct ipc4_message_request *ipc4)
 #endif
 }
 
+static int ipc4_process_pipeline_batch(struct ipc4_message_request *ipc4);
+
 static int ipc4_process_glb_message(struct ipc4_message_request *ipc4)
 {
 	uint32_t type;
@@ -826,6 +848,9 @@ static int ipc4_process_glb_message(struct ipc4_message_request *ipc4)
 	case SOF_IPC4_GLB_SET_PIPELINE_STATE:
 		ret = ipc4_set_pipeline_state(ipc4);
 		break;
+	case SOF_IPC4_GLB_PIPELINE_BATCH:
+		ret = ipc4_process_pipeline_batch(ipc4);
+		break;
 
 	case SOF_IPC4_GLB_GET_PIPELINE_STATE:
 	case SOF_IPC4_GLB_GET_PIPELINE_CONTEXT_SIZE:
@@ -1256,6 +1281,379 @@ static int ipc4_set_large_config_module_instance(struct ipc4_message_request *ip
 	return ret;
 }
 
+/*
+ * Pipeline batch <-------> create pipeline, init module, bind modules and
+ * module set_large_config messages processed in one pass
+ */
+
+static void ipc4_batch_get_msg(const struct ipc4_pipeline_batch_entry *entry,
+			       struct ipc4_message_request *msg)
+{
+	msg->primary.dat = entry->primary;
+	msg->extension.dat = entry->extension;
+}
+
+static const struct ipc4_pipeline_batch_entry *
+ipc4_batch_next(const struct ipc4_pipeline_batch_entry *entry)
+{
+	return (const struct ipc4_pipeline_batch_entry *)((const char *)entry->data +
+							   entry->size);
+}
+
+static const struct ipc4_pipeline_batch_entry *ipc4_batch_get_entry(const char *data,
+								     uint32_t index)
+{
+	const struct ipc4_pipeline_batch_entry *entry =
+		(const struct ipc4_pipeline_batch_entry *)data;
+
+	while (index--)
+		entry = ipc4_batch_next(entry);
+
+	return entry;
+}
+
+/* Checks if one of the first n entries creates the pipeline or module id */
+static bool ipc4_batch_creates(const char *data, uint32_t n, uint32_t msg_tgt,
+			       uint32_t type, uint32_t id)
+{
+	const struct ipc4_pipeline_batch_entry *entry =
+		(const struct ipc4_pipeline_batch_entry *)data;
+	struct ipc4_module_init_instance *init;
+	struct ipc4_pipeline_create *pipe;
+	struct ipc4_message_request msg;
+	uint32_t i;
+
+	for (i = 0; i < n; i++, entry = ipc4_batch_next(entry)) {
+		ipc4_batch_get_msg(entry, &msg);
+		if (msg.primary.r.msg_tgt != msg_tgt || msg.primary.r.type != type)
+			continue;
+
+		if (msg_tgt == SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG) {
+			pipe = (struct ipc4_pipeline_create *)&msg;
+			if (pipe->primary.r.instance_id == id)
+				return true;
+		} else {
+			init = (struct ipc4_module_init_instance *)&msg;
+			if (IPC4_COMP_ID(init->primary.r.module_id,
+					 init->primary.r.instance_id) == id)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+/* The module must exist or be created by one of the first n entries */
+static int ipc4_batch_find_module(const char *data, uint32_t n, uint32_t comp_id, bool *local)
+{
+	struct comp_dev *dev = ipc4_get_comp_dev(comp_id);
+
+	if (dev) {
+		*local = cpu_is_me(dev->ipc_config.core);
+		return 0;
+	}
+
+	/* all modules created by the batch are local */
+	*local = true;
+	if (ipc4_batch_creates(data, n, SOF_IPC4_MESSAGE_TARGET_MODULE_MSG,
+			       SOF_IPC4_MOD_INIT_INSTANCE, comp_id))
+		return 0;
+
+	return IPC4_MOD_INVALID_ID;
+}
+
+static int ipc4_batch_validate_pipeline(const char *data, uint32_t index,
+					struct ipc4_message_request *msg)
+{
+	struct ipc4_pipeline_create *pipe = (struct ipc4_pipeline_create *)msg;
+	uint32_t id = pipe->primary.r.instance_id;
+
+	/* the batch is not forwarded to other cores */
+	if (!cpu_is_me(pipe->extension.r.core_id))
+		return IPC4_INVALID_CORE_ID;
+
+	if (ipc_get_pipeline_by_id(ipc_get(), id) ||
+	    ipc4_batch_creates(data, index, SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG,
+			       SOF_IPC4_GLB_CREATE_PIPELINE, id))
+		return IPC4_RESOURCE_ID_EXISTS;
+
+	return 0;
+}
+
+static int ipc4_batch_validate_init(const char *data, uint32_t index,
+				    const struct ipc4_pipeline_batch_entry *entry,
+				    struct ipc4_message_request *msg)
+{
+	struct ipc4_module_init_instance *init = (struct ipc4_module_init_instance *)msg;
+	uint32_t ppl_id = init->extension.r.ppl_instance_id;
+	uint32_t size = init->extension.r.param_block_size * sizeof(uint32_t);
+	uint32_t comp_id = IPC4_COMP_ID(init->primary.r.module_id, init->primary.r.instance_id);
+	const struct comp_driver *drv;
+	bool local;
+
+	/* the batch is not forwarded to other cores */
+	if (!cpu_is_me(init->extension.r.core_id))
+		return IPC4_INVALID_CORE_ID;
+
+	if (!ipc4_batch_find_module(data, index, comp_id, &local))
+		return IPC4_MOD_INSTANCE_EXISTS;
+
+	if (size > entry->size)
+		return IPC4_INVALID_CONFIG_DATA_LEN;
+
+	if (!ipc_get_pipeline_by_id(ipc_get(), ppl_id) &&
+	    !ipc4_batch_creates(data, index, SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG,
+				SOF_IPC4_GLB_CREATE_PIPELINE, ppl_id))
+		return IPC4_INVALID_RESOURCE_ID;
+
+#if CONFIG_LIBRARY
+	if (size < sizeof(struct sof_uuid))
+		return IPC4_INVALID_CONFIG_DATA_LEN;
+
+	drv = ipc4_get_drv((const char *)entry->data + size - sizeof(struct sof_uuid));
+#else
+	drv = ipc4_get_comp_drv(init->primary.r.module_id);
+#endif
+	if (!drv)
+		return IPC4_MOD_INVALID_ID;
+
+	return 0;
+}
+
+static int ipc4_batch_validate_bind(const char *data, uint32_t index,
+				    struct ipc4_message_request *msg)
+{
+	struct ipc4_module_bind_unbind *bu = (struct ipc4_module_bind_unbind *)msg;
+	bool src_local;
+	bool sink_local;
+	int ret;
+
+	ret = ipc4_batch_find_module(data, index,
+				     IPC4_COMP_ID(bu->primary.r.module_id,
+						  bu->primary.r.instance_id), &src_local);
+	if (ret)
+		return ret;
+
+	ret = ipc4_batch_find_module(data, index,
+				     IPC4_COMP_ID(bu->extension.r.dst_module_id,
+						  bu->extension.r.dst_instance_id), &sink_local);
+	if (ret)
+		return ret;
+
+	/* binding of two remote modules would be forwarded to their core */
+	if (!src_local && !sink_local)
+		return IPC4_INVALID_CORE_ID;
+
+	return 0;
+}
+
+static int ipc4_batch_validate_config(const char *data, uint32_t index,
+				      const struct ipc4_pipeline_batch_entry *entry,
+				      struct ipc4_message_request *msg)
+{
+	struct ipc4_module_large_config *config = (struct ipc4_module_large_config *)msg;
+	bool local;
+	int ret;
+
+	/* only single block configuration of a module instance */
+	if (!config->primary.r.module_id || !config->extension.r.init_block ||
+	    !config->extension.r.final_block)
+		return IPC4_INVALID_REQUEST;
+
+	if (config->extension.r.data_off_size > entry->size)
+		return IPC4_INVALID_CONFIG_DATA_LEN;
+
+	ret = ipc4_batch_find_module(data, index,
+				     IPC4_COMP_ID(config->primary.r.module_id,
+						  config->primary.r.instance_id), &local);
+	if (ret)
+		return ret;
+
+	return local ? 0 : IPC4_INVALID_CORE_ID;
+}
+
+/* Checks all entries without changing any state */
+static int ipc4_batch_validate(const char *data, uint32_t data_size, uint32_t count,
+			       uint32_t *failed)
+{
+	const struct ipc4_pipeline_batch_entry *entry =
+		(const struct ipc4_pipeline_batch_entry *)data;
+	struct ipc4_message_request msg;
+	uint32_t avail = data_size;
+	uint32_t i;
+	int ret;
+
+	for (i = 0; i < count; i++, entry = ipc4_batch_next(entry)) {
+		*failed = i;
+		if (avail < sizeof(*entry) || entry->size > avail - sizeof(*entry) ||
+		    entry->size % sizeof(uint32_t))
+			return IPC4_INVALID_CONFIG_DATA_LEN;
+
+		avail -= sizeof(*entry) + entry->size;
+		ipc4_batch_get_msg(entry, &msg);
+
+		if (msg.primary.r.msg_tgt == SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG &&
+		    msg.primary.r.type == SOF_IPC4_GLB_CREATE_PIPELINE) {
+			ret = ipc4_batch_validate_pipeline(data, i, &msg);
+		} else if (msg.primary.r.msg_tgt == SOF_IPC4_MESSAGE_TARGET_MODULE_MSG) {
+			switch (msg.primary.r.type) {
+			case SOF_IPC4_MOD_INIT_INSTANCE:
+				ret = ipc4_batch_validate_init(data, i, entry, &msg);
+				break;
+			case SOF_IPC4_MOD_BIND:
+				ret = ipc4_batch_validate_bind(data, i, &msg);
+				break;
+			case SOF_IPC4_MOD_LARGE_CONFIG_SET:
+				ret = ipc4_batch_validate_config(data, i, entry, &msg);
+				break;
+			default:
+				ret = IPC4_INVALID_REQUEST;
+				break;
+			}
+		} else {
+			ret = IPC4_INVALID_REQUEST;
+		}
+
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+static int ipc4_batch_set_large_config(const struct ipc4_pipeline_batch_entry *entry,
+				       struct ipc4_message_request *msg)
+{
+	struct ipc4_module_large_config *config = (struct ipc4_module_large_config *)msg;
+	const char *data = (const char *)entry->data;
+	struct comp_dev *dev;
+	int ret;
+
+	dev = ipc4_get_comp_dev(IPC4_COMP_ID(config->primary.r.module_id,
+					     config->primary.r.instance_id));
+	if (!dev)
+		return IPC4_MOD_INVALID_ID;
+
+	if (!dev->drv->ops.set_large_config)
+		return IPC4_INVALID_REQUEST;
+
+	if (config->extension.r.large_param_id == VENDOR_CONFIG_PARAM)
+		return ipc4_set_vendor_config_module_instance(dev, dev->drv,
+							      config->primary.r.module_id,
+							      config->primary.r.instance_id,
+							      true, true,
+							      config->extension.r.data_off_size,
+							      data);
+
+	ret = dev->drv->ops.set_large_config(dev, config->extension.r.large_param_id, true, true,
+					     config->extension.r.data_off_size, data);
+
+	return ret < 0 ? IPC4_INVALID_RESOURCE_ID : 0;
+}
+
+static int ipc4_batch_exec(const struct ipc4_pipeline_batch_entry *entry)
+{
+	struct ipc4_message_request msg;
+
+	ipc4_batch_get_msg(entry, &msg);
+
+	if (msg.primary.r.msg_tgt == SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG)
+		return ipc4_new_pipeline(&msg);
+
+	switch (msg.primary.r.type) {
+	case SOF_IPC4_MOD_INIT_INSTANCE:
+		if (!comp_new_ipc4_data((struct ipc4_module_init_instance *)&msg,
+					(const char *)entry->data))
+			return IPC4_MOD_NOT_INITIALIZED;
+		return 0;
+	case SOF_IPC4_MOD_BIND:
+		return ipc4_bind_module_instance(&msg);
+	default:
+		return ipc4_batch_set_large_config(entry, &msg);
+	}
+}
+
+/* Undoes the first n entries in reverse order */
+static void ipc4_batch_undo(const char *data, uint32_t n)
+{
+	const struct ipc4_pipeline_batch_entry *entry;
+	struct ipc4_module_init_instance *init;
+	struct ipc4_pipeline_create *pipe;
+	struct ipc4_message_request msg;
+	struct ipc *ipc = ipc_get();
+
+	while (n--) {
+		entry = ipc4_batch_get_entry(data, n);
+		ipc4_batch_get_msg(entry, &msg);
+
+		if (msg.primary.r.msg_tgt == SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG) {
+			pipe = (struct ipc4_pipeline_create *)&msg;
+			ipc_pipeline_free(ipc, pipe->primary.r.instance_id);
+			continue;
+		}
+
+		switch (msg.primary.r.type) {
+		case SOF_IPC4_MOD_INIT_INSTANCE:
+			init = (struct ipc4_module_init_instance *)&msg;
+			ipc_comp_free(ipc, IPC4_COMP_ID(init->primary.r.module_id,
+							init->primary.r.instance_id));
+			break;
+		case SOF_IPC4_MOD_BIND:
+			ipc4_unbind_module_instance(&msg);
+			break;
+		default:
+			/* configuration is released with the module */
+			break;
+		}
+	}
+}
+
+__cold static int ipc4_process_pipeline_batch(struct ipc4_message_request *ipc4)
+{
+	const struct ipc4_pipeline_batch_entry *entry;
+	struct ipc4_pipeline_batch batch;
+	uint32_t failed = 0;
+	const char *data;
+	uint32_t i;
+	int ret = memcpy_s(&batch, sizeof(batch), ipc4, sizeof(*ipc4));
+
+	if (ret < 0)
+		return IPC4_FAILURE;
+
+	assert_can_be_cold();
+
+	tr_dbg(&ipc_tr, "ipc4_process_pipeline_batch %u entries %u bytes",
+	       (uint32_t)batch.primary.r.count, (uint32_t)batch.extension.r.data_size);
+
+	if (batch.extension.r.data_size > IPC4_PIPELINE_BATCH_MAX_SIZE)
+		return IPC4_INVALID_CONFIG_DATA_LEN;
+
+	data = ipc4_get_pipeline_batch_data();
+
+	/* nothing is created unless the whole batch is consistent */
+	ret = ipc4_batch_validate(data, batch.extension.r.data_size, batch.primary.r.count,
+				  &failed);
+	if (!ret) {
+		entry = (const struct ipc4_pipeline_batch_entry *)data;
+		for (i = 0; i < batch.primary.r.count; i++, entry = ipc4_batch_next(entry)) {
+			ret = ipc4_batch_exec(entry);
+			if (ret) {
+				failed = i;
+				ipc4_batch_undo(data, i);
+				break;
+			}
+		}
+	}
+
+	if (ret) {
+		ipc_cmd_err(&ipc_tr, "ipc4: pipeline batch entry %u failed with %d", failed, ret);
+		msg_reply.extension = failed;
+		return ret < 0 ? IPC4_FAILURE : ret;
+	}
+
+	return IPC4_SUCCESS;
+}
+
 static int ipc4_delete_module_instance(struct ipc4_message_request *ipc4)
 {
 	struct ipc4_module_delete_instance module;
@@ -91,7 +91,7 @@ static inline char *ipc4_get_comp_new_data(void)
 	return data;
 }
 
-static const struct comp_driver *ipc4_library_get_comp_drv(char *data)
+static const struct comp_driver *ipc4_library_get_comp_drv(const char *data)
 {
 	return ipc4_get_drv(data);
 }
@@ -103,12 +103,22 @@ static inline char *ipc4_get_comp_new_data(void)
 #endif
 
 __cold struct comp_dev *comp_new_ipc4(struct ipc4_module_init_instance *module_init)
+{
+	assert_can_be_cold();
+
+	dcache_invalidate_region((__sparse_force void __sparse_cache *)MAILBOX_HOSTBOX_BASE,
+				 MAILBOX_HOSTBOX_SIZE);
+
+	return comp_new_ipc4_data(module_init, ipc4_get_comp_new_data());
+}
+
+__cold struct comp_dev *comp_new_ipc4_data(struct ipc4_module_init_instance *module_init,
+					   const char *data)
 {
 	struct comp_ipc_config ipc_config;
 	const struct comp_driver *drv;
 	struct comp_dev *dev;
 	uint32_t comp_id;
-	char *data;
 
 	assert_can_be_cold();
 
@@ -131,11 +141,6 @@ __cold struct comp_dev *comp_new_ipc4(struct ipc4_module_init_instance *module_i
 	ipc_config.core = module_init->extension.r.core_id;
 	ipc_config.ipc_config_size = module_init->extension.r.param_block_size * sizeof(uint32_t);
 
-	dcache_invalidate_region((__sparse_force void __sparse_cache *)MAILBOX_HOSTBOX_BASE,
-				 MAILBOX_HOSTBOX_SIZE);
-
-	data = ipc4_get_comp_new_data();
-
 #if CONFIG_LIBRARY
 	ipc_config.ipc_config_size -= sizeof(struct sof_uuid);
 	drv = ipc4_library_get_comp_drv(data + ipc_config.ipc_config_size);
@@ -199,8 +204,8 @@ struct ipc_comp_dev *ipc_get_comp_by_ppl_id(struct ipc *ipc, uint16_t type,
 	struct ipc_comp_dev *icd;
 	struct list_item *clist;
 
-	list_for_item(clist, &ipc->comp_list) {
-		icd = container_of(clist, struct ipc_comp_dev, list);
+	list_for_item(clist, &ipc->comp_ppl_hash[ipc_comp_hash(ppl_id)]) {
+		icd = container_of(clist, struct ipc_comp_dev, ppl_list);
 		if (icd->type != type)
 			continue;
 
@@ -264,7 +269,7 @@ static int ipc4_create_pipeline(struct ipc4_pipeline_create *pipe_desc)
 	ipc_pipe->pipeline->attributes = pipe_desc->extension.r.attributes;
 
 	/* add new pipeline to the list */
-	list_item_append(&ipc_pipe->list, &ipc->comp_list);
+	ipc_comp_dev_add(ipc, ipc_pipe);
 
 	return IPC4_SUCCESS;
 }
@@ -362,7 +367,7 @@ int ipc_pipeline_free(struct ipc *ipc, uint32_t comp_id)
 	}
 
 	ipc_pipe->pipeline = NULL;
-	list_item_del(&ipc_pipe->list);
+	ipc_comp_dev_del(ipc_pipe);
 	rfree(ipc_pipe);
 
 	return IPC4_SUCCESS;
@@ -789,7 +794,6 @@ int ipc4_chain_dma_state(struct comp_dev *dev, struct ipc4_chain_dma *cdma)
 	const bool enable = cdma->primary.r.enable;
 	struct ipc *ipc = ipc_get();
 	struct ipc_comp_dev *icd;
-	struct list_item *clist, *_tmp;
 	int ret;
 
 	if (!dev)
@@ -809,13 +813,10 @@ int ipc4_chain_dma_state(struct comp_dev *dev, struct ipc4_chain_dma *cdma)
 		if (ret < 0)
 			return ret;
 
-		list_for_item_safe(clist, _tmp, &ipc->comp_list) {
-			icd = container_of(clist, struct ipc_comp_dev, list);
-			if (icd->cd != dev)
-				continue;
-			list_item_del(&icd->list);
+		icd = ipc_get_comp_by_id(ipc, dev->ipc_config.id);
+		if (icd && icd->cd == dev) {
+			ipc_comp_dev_del(icd);
 			rfree(icd);
-			break;
 		}
 		comp_free(dev);
 	}
@@ -829,8 +830,8 @@ static int ipc4_update_comps_direction(struct ipc *ipc, uint32_t ppl_id)
 	struct list_item *clist;
 	struct comp_buffer *src_buf;
 
-	list_for_item(clist, &ipc->comp_list) {
-		icd = container_of(clist, struct ipc_comp_dev, list);
+	list_for_item(clist, &ipc->comp_ppl_hash[ipc_comp_hash(ppl_id)]) {
+		icd = container_of(clist, struct ipc_comp_dev, ppl_list);
 		if (icd->type != COMP_TYPE_COMPONENT)
 			continue;
 
@@ -907,26 +908,16 @@ int ipc4_process_on_core(uint32_t core, bool blocking)
 const struct comp_driver *ipc4_get_drv(const void *uuid)
 {
 	const struct sof_uuid *const sof_uuid = (const struct sof_uuid *)uuid;
-	struct comp_driver_list *drivers = comp_drivers_get();
-	struct list_item *clist;
-	const struct comp_driver *drv = NULL;
-	struct comp_driver_info *info;
+	const struct comp_driver *drv;
 	uint32_t flags;
 
 	irq_local_disable(flags);
 
-	/* search driver list with UUID */
-	list_for_item(clist, &drivers->list) {
-		info = container_of(clist, struct comp_driver_info,
-				    list);
-		if (!memcmp(info->drv->uid, uuid, UUID_SIZE)) {
-			tr_dbg(&comp_tr,
-			       "found type %d, uuid %pU",
-			       info->drv->type,
-			       info->drv->tctx->uuid_p);
-			drv = info->drv;
-			goto out;
-		}
+	/* search driver index with UUID */
+	drv = comp_driver_find_by_uuid(uuid);
+	if (drv) {
+		tr_dbg(&comp_tr, "found type %d, uuid %pU", drv->type, drv->tctx->uuid_p);
+		goto out;
 	}
 
 	tr_warn(&comp_tr,
@@ -1040,7 +1031,7 @@ int ipc4_add_comp_dev(struct comp_dev *dev)
 
 	tr_dbg(&ipc_tr, "ipc4_add_comp_dev add comp 0x%x", icd->id);
 	/* add new component to the list */
-	list_item_append(&icd->list, &ipc->comp_list);
+	ipc_comp_dev_add(ipc, icd);
 
 	return IPC4_SUCCESS;
 };
@@ -10,8 +10,10 @@
 #include <rtos/cache.h>
 #include <sof/lib/cpu.h>
 #include <sof/lib/dma.h>
+#include <sof/lib/heap_telemetry.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/mm_heap.h>
+#include <sof/lib/tlsf.h>
 #include <sof/lib/uuid.h>
 #include <sof/math/numbers.h>
 #include <rtos/spinlock.h>
@@ -319,6 +321,63 @@ out:
 	return ptr;
 }
 
+#if CONFIG_XTOS_HEAP_TLSF
+/*
+ * TLSF keeps its state and block headers in the heap memory. It's accessed
+ * through the uncached alias, like the block map headers, so that all cores
+ * see the same state. Allocations are rounded to cache lines, no header
+ * shares a line with user data.
+ */
+static void *tlsf_heap_base(const struct mm_heap *heap)
+{
+	return cache_to_uncache((void *)heap->heap);
+}
+
+static void init_heap_tlsf(struct mm_heap *heap, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++, heap++) {
+		heap->tlsf = tlsf_init(tlsf_heap_base(heap), heap->size);
+		if (!heap->tlsf)
+			sof_panic(SOF_IPC_PANIC_MEM);
+
+		heap->info.free = tlsf_largest_free(heap->tlsf);
+		heap->info.used = heap->size - heap->info.free;
+	}
+}
+
+static void *alloc_tlsf(struct mm_heap *heap, size_t bytes, uint32_t alignment)
+{
+	char *ptr;
+
+	ptr = tlsf_memalign(heap->tlsf, MAX(alignment, PLATFORM_DCACHE_ALIGN),
+			    ALIGN_UP(bytes, PLATFORM_DCACHE_ALIGN));
+	if (!ptr)
+		return NULL;
+
+	heap->info.used += tlsf_block_size(ptr);
+	heap->info.free -= tlsf_block_size(ptr);
+
+	/* return the same alias as the block maps do */
+	return (char *)heap->heap + (ptr - (char *)tlsf_heap_base(heap));
+}
+
+static void free_tlsf(struct mm_heap *heap, void *free_ptr)
+{
+	char *ptr = (char *)tlsf_heap_base(heap) + ((char *)free_ptr - (char *)heap->heap);
+	size_t size = tlsf_block_size(ptr);
+
+	/* dirty lines must not be evicted over the reused memory, see free_block() */
+	dcache_writeback_invalidate_region(uncache_to_cache(free_ptr), size);
+
+	heap->info.used -= size;
+	heap->info.free += size;
+
+	tlsf_free(heap->tlsf, ptr);
+}
+#endif
+
 static inline struct mm_heap *find_in_heap_arr(struct mm_heap *heap_arr, int arr_len, void *ptr)
 {
 	struct mm_heap *heap;
@@ -391,6 +450,11 @@ static void *get_ptr_from_heap(struct mm_heap *heap, uint32_t flags,
 	if ((alignment & (alignment - 1)) != 0)
 		sof_panic(SOF_IPC_PANIC_MEM);
 
+#if CONFIG_XTOS_HEAP_TLSF
+	if (heap->tlsf)
+		return alloc_tlsf(heap, bytes, alignment);
+#endif
+
 	for (i = 0; i < heap->blocks; i++) {
 		map = &heap->map[i];
 
@@ -454,6 +518,13 @@ static void free_block(void *ptr)
 		free_ptr = cached_ptr;
 	}
 
+#if CONFIG_XTOS_HEAP_TLSF
+	if (heap->tlsf) {
+		free_tlsf(heap, free_ptr);
+		return;
+	}
+#endif
+
 	/* find block that ptr belongs to */
 	for (i = 0; i < heap->blocks; i++) {
 		block_map = &heap->map[i];
@@ -547,6 +618,15 @@ void heap_trace(struct mm_heap *heap, int size)
 		tr_info(&mem_tr, "  (In Bytes) used %d free %d", heap->info.used,
 			heap->info.free);
 
+#if CONFIG_XTOS_HEAP_TLSF
+		if (heap->tlsf) {
+			tr_info(&mem_tr, "  TLSF largest free %d",
+				tlsf_largest_free(heap->tlsf));
+			heap++;
+			continue;
+		}
+#endif
+
 		/* map[j]'s base is calculated based on map[j-1] */
 		for (j = 0; j < heap->blocks; j++) {
 			current_map = &heap->map[j];
@@ -727,9 +807,11 @@ static void *_malloc_unlocked(enum mem_zone zone, uint32_t flags, uint32_t caps,
 	return ptr;
 }
 
-void *rmalloc(enum mem_zone zone, uint32_t flags, uint32_t caps, size_t bytes)
+static void *_rmalloc(enum mem_zone zone, uint32_t flags, uint32_t caps, size_t bytes,
+		      const void *caller)
 {
 	struct mm *memmap = memmap_get();
+	uint64_t start = heap_telemetry_time();
 	k_spinlock_key_t key;
 	void *ptr = NULL;
 
@@ -737,18 +819,25 @@ void *rmalloc(enum mem_zone zone, uint32_t flags, uint32_t caps, size_t bytes)
 
 	ptr = _malloc_unlocked(zone, flags, caps, bytes);
 
+	heap_telemetry_alloc(zone, bytes, ptr, caller, start);
+
 	k_spin_unlock(&memmap->lock, key);
 
 	DEBUG_TRACE_PTR(ptr, bytes, zone, caps, flags);
 	return ptr;
 }
 
+void *rmalloc(enum mem_zone zone, uint32_t flags, uint32_t caps, size_t bytes)
+{
+	return _rmalloc(zone, flags, caps, bytes, HEAP_TELEMETRY_CALLER());
+}
+
 /* allocates and clears memory - not for direct use, clients use rzalloc() */
 void *rzalloc(enum mem_zone zone, uint32_t flags, uint32_t caps, size_t bytes)
 {
 	void *ptr;
 
-	ptr = rmalloc(zone, flags, caps, bytes);
+	ptr = _rmalloc(zone, flags, caps, bytes, HEAP_TELEMETRY_CALLER());
 	if (ptr)
 		bzero(ptr, bytes);
 
@@ -787,6 +876,11 @@ static void *alloc_heap_buffer(struct mm_heap *heap, uint32_t flags,
 	if ((alignment & (alignment - 1)) != 0)
 		sof_panic(SOF_IPC_PANIC_MEM);
 
+#if CONFIG_XTOS_HEAP_TLSF
+	if (heap->tlsf)
+		return alloc_tlsf(heap, bytes, alignment);
+#endif
+
 	/*
 	 * There are several cases when a memory allocation request can be
 	 * satisfied with one buffer:
@@ -922,6 +1016,7 @@ void *rballoc_align(uint32_t flags, uint32_t caps, size_t bytes,
 		    uint32_t alignment)
 {
 	struct mm *memmap = memmap_get();
+	uint64_t start = heap_telemetry_time();
 	void *ptr = NULL;
 	k_spinlock_key_t key;
 
@@ -929,6 +1024,8 @@ void *rballoc_align(uint32_t flags, uint32_t caps, size_t bytes,
 
 	ptr = _balloc_unlocked(flags, caps, bytes, alignment);
 
+	heap_telemetry_alloc(SOF_MEM_ZONE_BUFFER, bytes, ptr, HEAP_TELEMETRY_CALLER(), start);
+
 	k_spin_unlock(&memmap->lock, key);
 
 	DEBUG_TRACE_PTR(ptr, bytes, SOF_MEM_ZONE_BUFFER, caps, flags);
@@ -974,10 +1071,13 @@ static void _rfree_unlocked(void *ptr)
 void rfree(void *ptr)
 {
 	struct mm *memmap = memmap_get();
+	uint64_t start = heap_telemetry_time();
 	k_spinlock_key_t key;
 
 	key = k_spin_lock(&memmap->lock);
 	_rfree_unlocked(ptr);
+	if (ptr)
+		heap_telemetry_free(start);
 	k_spin_unlock(&memmap->lock, key);
 }
 
@@ -985,6 +1085,7 @@ void *rbrealloc_align(void *ptr, uint32_t flags, uint32_t caps, size_t bytes,
 		      size_t old_bytes, uint32_t alignment)
 {
 	struct mm *memmap = memmap_get();
+	uint64_t start = heap_telemetry_time();
 	void *new_ptr = NULL;
 	k_spinlock_key_t key;
 	size_t copy_bytes = MIN(bytes, old_bytes);
@@ -996,6 +1097,9 @@ void *rbrealloc_align(void *ptr, uint32_t flags, uint32_t caps, size_t bytes,
 
 	new_ptr = _balloc_unlocked(flags, caps, bytes, alignment);
 
+	/* accounted as an allocation, the old buffer isn't counted as freed */
+	heap_telemetry_alloc(SOF_MEM_ZONE_BUFFER, bytes, new_ptr, HEAP_TELEMETRY_CALLER(), start);
+
 	if (new_ptr && ptr && !(flags & SOF_MEM_FLAG_NO_COPY))
 		memcpy_s(new_ptr, copy_bytes, ptr, copy_bytes);
 
@@ -1064,6 +1168,14 @@ void init_heap(struct sof *sof)
 		      DEBUG_BLOCK_FREE_VALUE_8BIT);
 #endif
 
+#if CONFIG_XTOS_HEAP_TLSF
+	init_heap_tlsf(memmap->runtime, PLATFORM_HEAP_RUNTIME);
+#if CONFIG_CORE_COUNT > 1
+	init_heap_tlsf(memmap->runtime_shared, PLATFORM_HEAP_RUNTIME_SHARED);
+#endif
+	init_heap_tlsf(memmap->buffer, PLATFORM_HEAP_BUFFER);
+#endif
+
 	k_spinlock_init(&memmap->lock);
 }
 
@@ -1124,3 +1236,81 @@ error:
 	return -EINVAL;
 }
 #endif
+
+#if CONFIG_DEBUG_HEAP_TELEMETRY
+/* Largest allocation a block mapped heap can satisfy, block spans stay in a map */
+static uint32_t heap_largest_free(const struct mm_heap *heap)
+{
+	const struct block_map *map;
+	uint32_t largest = 0;
+	unsigned int i, j, run;
+
+#if CONFIG_XTOS_HEAP_TLSF
+	if (heap->tlsf)
+		return tlsf_largest_free(heap->tlsf);
+#endif
+
+	/* system heaps have no maps, they just grow */
+	if (!heap->blocks)
+		return heap->info.free;
+
+	for (i = 0, map = heap->map; i < heap->blocks; i++, map++)
+		for (j = map->first_free, run = 0; j < map->count; j++) {
+			run = map->block[j].used ? 0 : run + 1;
+			largest = MAX(largest, run * map->block_size);
+		}
+
+	return largest;
+}
+
+static void heap_zone_info(struct heap_telemetry_zone *info, enum mem_zone zone,
+			   const struct mm_heap *heap, int count)
+{
+	int i;
+
+	info->zone = zone;
+	info->size = 0;
+	info->used = 0;
+	info->free = 0;
+	info->largest_free = 0;
+
+	for (i = 0; i < count; i++, heap++) {
+		info->size += heap->size;
+		info->used += heap->info.used;
+		info->free += heap->info.free;
+		info->largest_free = MAX(info->largest_free, heap_largest_free(heap));
+	}
+}
+
+unsigned int heap_telemetry_zones(struct heap_telemetry_zone *zones, unsigned int max)
+{
+	struct mm *memmap = memmap_get();
+	const struct {
+		enum mem_zone zone;
+		const struct mm_heap *heap;
+		int count;
+	} zone_heaps[] = {
+		{ SOF_MEM_ZONE_SYS, memmap->system, PLATFORM_HEAP_SYSTEM },
+		{ SOF_MEM_ZONE_SYS_RUNTIME, memmap->system_runtime, PLATFORM_HEAP_SYSTEM_RUNTIME },
+		{ SOF_MEM_ZONE_RUNTIME, memmap->runtime, PLATFORM_HEAP_RUNTIME },
+		{ SOF_MEM_ZONE_BUFFER, memmap->buffer, PLATFORM_HEAP_BUFFER },
+#if CONFIG_CORE_COUNT > 1
+		{ SOF_MEM_ZONE_RUNTIME_SHARED, memmap->runtime_shared,
+		  PLATFORM_HEAP_RUNTIME_SHARED },
+		{ SOF_MEM_ZONE_SYS_SHARED, memmap->system_shared, PLATFORM_HEAP_SYSTEM_SHARED },
+#endif
+	};
+	k_spinlock_key_t key;
+	unsigned int i;
+
+	key = k_spin_lock(&memmap->lock);
+
+	for (i = 0; i < ARRAY_SIZE(zone_heaps) && i < max; i++)
+		heap_zone_info(zones + i, zone_heaps[i].zone, zone_heaps[i].heap,
+			       zone_heaps[i].count);
+
+	k_spin_unlock(&memmap->lock, key);
+
+	return i;
+}
+#endif
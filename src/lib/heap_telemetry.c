@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <rtos/alloc.h>
+#include <rtos/clk.h>
+#include <rtos/spinlock.h>
+#include <rtos/string.h>
+#include <rtos/timer.h>
+#include <sof/lib/heap_telemetry.h>
+#include <sof/math/numbers.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#if CONFIG_LIBRARY
+#include <time.h>
+#endif
+
+struct heap_telemetry_hist {
+	uint32_t count;
+	uint32_t max;
+	uint32_t bins[HEAP_TELEMETRY_BINS];
+};
+
+static struct heap_telemetry {
+	struct k_spinlock lock;
+	uint32_t frees;
+	uint32_t allocs[HEAP_TELEMETRY_ZONES];
+	uint32_t failures[HEAP_TELEMETRY_ZONES];
+	uint32_t size_hist[HEAP_TELEMETRY_BINS];
+	struct heap_telemetry_hist alloc_latency;
+	struct heap_telemetry_hist free_latency;
+	uint32_t caller_overflow;
+	struct heap_telemetry_caller callers[HEAP_TELEMETRY_CALLERS];
+} telemetry;
+
+/* bin 0 holds 0, bin i holds [2^(i - 1), 2^i - 1], the last bin everything above */
+static unsigned int heap_telemetry_bin(uint64_t value)
+{
+	unsigned int bin = 0;
+
+	while (value && bin < HEAP_TELEMETRY_BINS - 1) {
+		value >>= 1;
+		bin++;
+	}
+
+	return bin;
+}
+
+static void heap_telemetry_hist_add(struct heap_telemetry_hist *hist, uint64_t start)
+{
+	uint64_t delta = heap_telemetry_time() - start;
+	uint32_t value = MIN(delta, UINT32_MAX);
+
+	hist->count++;
+	hist->max = MAX(hist->max, value);
+	hist->bins[heap_telemetry_bin(value)]++;
+}
+
+static uint32_t heap_telemetry_percentile(const struct heap_telemetry_hist *hist,
+					  unsigned int percent)
+{
+	uint32_t target = ((uint64_t)hist->count * percent + 99) / 100;
+	uint32_t sum = 0;
+	unsigned int i;
+
+	for (i = 0; i < HEAP_TELEMETRY_BINS - 1; i++) {
+		sum += hist->bins[i];
+		if (sum >= target)
+			return MIN((1ULL << i) - 1, hist->max);
+	}
+
+	return hist->max;
+}
+
+static void heap_telemetry_latency(struct heap_telemetry_latency *latency,
+				   const struct heap_telemetry_hist *hist)
+{
+	latency->count = hist->count;
+	latency->max = hist->max;
+	latency->p50 = hist->count ? heap_telemetry_percentile(hist, 50) : 0;
+	latency->p90 = hist->count ? heap_telemetry_percentile(hist, 90) : 0;
+	latency->p99 = hist->count ? heap_telemetry_percentile(hist, 99) : 0;
+}
+
+/* open addressing on the call site address, NULL when the table is full */
+static struct heap_telemetry_caller *heap_telemetry_caller(const void *caller)
+{
+	uint64_t addr = (uintptr_t)caller;
+	unsigned int slot = (uint32_t)(addr >> 2) * 2654435761U % HEAP_TELEMETRY_CALLERS;
+	unsigned int i;
+
+	for (i = 0; i < HEAP_TELEMETRY_CALLERS; i++) {
+		struct heap_telemetry_caller *entry = telemetry.callers + slot;
+
+		if (entry->caller == addr)
+			return entry;
+
+		if (!entry->caller) {
+			entry->caller = addr;
+			return entry;
+		}
+
+		slot = (slot + 1) % HEAP_TELEMETRY_CALLERS;
+	}
+
+	return NULL;
+}
+
+uint64_t heap_telemetry_time(void)
+{
+#if CONFIG_LIBRARY
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+	return sof_cycle_get_64();
+#endif
+}
+
+void heap_telemetry_alloc(enum mem_zone zone, size_t bytes, const void *ptr,
+			  const void *caller, uint64_t start)
+{
+	struct heap_telemetry_caller *entry;
+	unsigned int z = MIN((unsigned int)zone, HEAP_TELEMETRY_ZONES - 1);
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&telemetry.lock);
+
+	heap_telemetry_hist_add(&telemetry.alloc_latency, start);
+	telemetry.size_hist[heap_telemetry_bin(bytes)]++;
+	telemetry.allocs[z]++;
+	if (!ptr)
+		telemetry.failures[z]++;
+
+	entry = heap_telemetry_caller(caller);
+	if (entry) {
+		entry->allocs++;
+		entry->bytes += bytes;
+		entry->max_bytes = MAX(entry->max_bytes, bytes);
+		if (!ptr)
+			entry->failures++;
+	} else {
+		telemetry.caller_overflow++;
+	}
+
+	k_spin_unlock(&telemetry.lock, key);
+}
+
+void heap_telemetry_free(uint64_t start)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&telemetry.lock);
+
+	heap_telemetry_hist_add(&telemetry.free_latency, start);
+	telemetry.frees++;
+
+	k_spin_unlock(&telemetry.lock, key);
+}
+
+size_t heap_telemetry_get(struct heap_telemetry_data *data, size_t size)
+{
+	struct heap_telemetry_caller *callers = data->callers;
+	struct heap_telemetry_caller tmp;
+	k_spinlock_key_t key;
+	unsigned int max_callers;
+	unsigned int i, j, n;
+
+	if (size < sizeof(*data))
+		return 0;
+
+	max_callers = MIN((size - sizeof(*data)) / sizeof(*callers), HEAP_TELEMETRY_CALLERS);
+
+	memset(data, 0, sizeof(*data));
+
+	/* the allocator takes its own lock, don't nest it in ours */
+	data->num_zones = heap_telemetry_zones(data->zones, HEAP_TELEMETRY_ZONES);
+
+#if CONFIG_LIBRARY
+	data->ticks_per_ms = 1000000;
+#else
+	data->ticks_per_ms = clock_ms_to_ticks(PLATFORM_DEFAULT_CLOCK, 1);
+#endif
+
+	key = k_spin_lock(&telemetry.lock);
+
+	data->frees = telemetry.frees;
+	memcpy_s(data->allocs, sizeof(data->allocs), telemetry.allocs, sizeof(telemetry.allocs));
+	memcpy_s(data->failures, sizeof(data->failures),
+		 telemetry.failures, sizeof(telemetry.failures));
+	memcpy_s(data->size_hist, sizeof(data->size_hist),
+		 telemetry.size_hist, sizeof(telemetry.size_hist));
+	heap_telemetry_latency(&data->alloc_latency, &telemetry.alloc_latency);
+	heap_telemetry_latency(&data->free_latency, &telemetry.free_latency);
+	data->caller_overflow = telemetry.caller_overflow;
+
+	/* insertion sort of the busiest call sites, dropping the rest */
+	for (i = 0, n = 0; i < HEAP_TELEMETRY_CALLERS; i++) {
+		if (!telemetry.callers[i].caller)
+			continue;
+
+		tmp = telemetry.callers[i];
+		for (j = n; j && callers[j - 1].allocs < tmp.allocs; j--)
+			if (j < max_callers)
+				callers[j] = callers[j - 1];
+
+		if (j < max_callers) {
+			callers[j] = tmp;
+			n = MIN(n + 1, max_callers);
+		}
+	}
+
+	k_spin_unlock(&telemetry.lock, key);
+
+	data->num_callers = n;
+
+	return sizeof(*data) + n * sizeof(*callers);
+}
@@ -0,0 +1,533 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/common.h>
+#include <sof/lib/tlsf.h>
+#include <rtos/string.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* block sizes are multiples of the header word, which keeps payloads aligned */
+#if UINTPTR_MAX > 0xffffffff
+#define TLSF_ALIGN_LOG2		3
+#else
+#define TLSF_ALIGN_LOG2		2
+#endif
+#define TLSF_ALIGN		(1 << TLSF_ALIGN_LOG2)
+
+/* 16 second level lists per power of two, sizes below 2^FL_SHIFT map linearly */
+#define TLSF_SL_LOG2		4
+#define TLSF_SL_COUNT		(1 << TLSF_SL_LOG2)
+#define TLSF_FL_SHIFT		(TLSF_SL_LOG2 + TLSF_ALIGN_LOG2)
+#define TLSF_FL_MAX		24
+#define TLSF_FL_COUNT		(TLSF_FL_MAX - TLSF_FL_SHIFT + 1)
+#define TLSF_SMALL_BLOCK	(1 << TLSF_FL_SHIFT)
+
+#define TLSF_BLOCK_FREE		0x1
+#define TLSF_BLOCK_PREV_FREE	0x2
+#define TLSF_BLOCK_FLAGS	(TLSF_BLOCK_FREE | TLSF_BLOCK_PREV_FREE)
+
+/*
+ * Block header. The payload starts at next_free, only free blocks use the
+ * free list links. prev_phys is the last word of the previous block payload,
+ * so it is only valid when the previous block is free.
+ */
+struct tlsf_block {
+	struct tlsf_block *prev_phys;
+	size_t size;		/* payload bytes with the flags in the low bits */
+	struct tlsf_block *next_free;
+	struct tlsf_block *prev_free;
+};
+
+#define TLSF_BLOCK_OVERHEAD	sizeof(size_t)
+#define TLSF_PAYLOAD_OFFSET	offsetof(struct tlsf_block, next_free)
+#define TLSF_BLOCK_SIZE_MIN	(sizeof(struct tlsf_block) - sizeof(struct tlsf_block *))
+#define TLSF_BLOCK_SIZE_MAX	((size_t)1 << TLSF_FL_MAX)
+
+struct tlsf {
+	uint32_t fl_bitmap;
+	uint32_t sl_bitmap[TLSF_FL_COUNT];
+	struct tlsf_block *blocks[TLSF_FL_COUNT][TLSF_SL_COUNT];
+	struct tlsf_block *first;	/* first block of the pool */
+};
+
+static inline unsigned int tlsf_fls(uint32_t x)
+{
+	return 31 - __builtin_clz(x);
+}
+
+static inline unsigned int tlsf_ffs(uint32_t x)
+{
+	return __builtin_ctz(x);
+}
+
+static inline size_t block_size(const struct tlsf_block *block)
+{
+	return block->size & ~(size_t)TLSF_BLOCK_FLAGS;
+}
+
+static inline void block_set_size(struct tlsf_block *block, size_t size)
+{
+	block->size = size | (block->size & TLSF_BLOCK_FLAGS);
+}
+
+static inline bool block_is_last(const struct tlsf_block *block)
+{
+	return !block_size(block);
+}
+
+static inline bool block_is_free(const struct tlsf_block *block)
+{
+	return block->size & TLSF_BLOCK_FREE;
+}
+
+static inline bool block_is_prev_free(const struct tlsf_block *block)
+{
+	return block->size & TLSF_BLOCK_PREV_FREE;
+}
+
+static inline void block_set_prev_free(struct tlsf_block *block)
+{
+	block->size |= TLSF_BLOCK_PREV_FREE;
+}
+
+static inline void *block_to_ptr(const struct tlsf_block *block)
+{
+	return (char *)block + TLSF_PAYLOAD_OFFSET;
+}
+
+static inline struct tlsf_block *block_from_ptr(const void *ptr)
+{
+	return (struct tlsf_block *)((char *)ptr - TLSF_PAYLOAD_OFFSET);
+}
+
+static inline struct tlsf_block *block_next(const struct tlsf_block *block)
+{
+	return (struct tlsf_block *)((char *)block_to_ptr(block) + block_size(block) -
+				     TLSF_BLOCK_OVERHEAD);
+}
+
+static inline struct tlsf_block *block_link_next(struct tlsf_block *block)
+{
+	struct tlsf_block *next = block_next(block);
+
+	next->prev_phys = block;
+
+	return next;
+}
+
+static void block_mark_as_free(struct tlsf_block *block)
+{
+	struct tlsf_block *next = block_link_next(block);
+
+	next->size |= TLSF_BLOCK_PREV_FREE;
+	block->size |= TLSF_BLOCK_FREE;
+}
+
+static void block_mark_as_used(struct tlsf_block *block)
+{
+	struct tlsf_block *next = block_next(block);
+
+	next->size &= ~(size_t)TLSF_BLOCK_PREV_FREE;
+	block->size &= ~(size_t)TLSF_BLOCK_FREE;
+}
+
+/* list holding blocks of the given size */
+static void mapping_insert(size_t size, unsigned int *fl, unsigned int *sl)
+{
+	unsigned int f, s;
+
+	if (size < TLSF_SMALL_BLOCK) {
+		f = 0;
+		s = size / (TLSF_SMALL_BLOCK / TLSF_SL_COUNT);
+	} else {
+		f = tlsf_fls(size);
+		s = (size >> (f - TLSF_SL_LOG2)) ^ TLSF_SL_COUNT;
+		f -= TLSF_FL_SHIFT - 1;
+	}
+
+	*fl = f;
+	*sl = s;
+}
+
+/* first list where every block satisfies the request */
+static void mapping_search(size_t size, unsigned int *fl, unsigned int *sl)
+{
+	if (size >= TLSF_SMALL_BLOCK)
+		size += ((size_t)1 << (tlsf_fls(size) - TLSF_SL_LOG2)) - 1;
+
+	mapping_insert(size, fl, sl);
+}
+
+static struct tlsf_block *search_suitable_block(struct tlsf *tlsf, unsigned int *fl,
+						unsigned int *sl)
+{
+	unsigned int f = *fl;
+	uint32_t sl_map = tlsf->sl_bitmap[f] & (~0U << *sl);
+	uint32_t fl_map;
+
+	if (!sl_map) {
+		/* no block in this power of two, take the next non-empty one */
+		fl_map = tlsf->fl_bitmap & (~0U << (f + 1));
+		if (!fl_map)
+			return NULL;
+
+		f = tlsf_ffs(fl_map);
+		sl_map = tlsf->sl_bitmap[f];
+	}
+
+	*fl = f;
+	*sl = tlsf_ffs(sl_map);
+
+	return tlsf->blocks[f][*sl];
+}
+
+static void remove_free_block(struct tlsf *tlsf, struct tlsf_block *block,
+			      unsigned int fl, unsigned int sl)
+{
+	struct tlsf_block *prev = block->prev_free;
+	struct tlsf_block *next = block->next_free;
+
+	if (next)
+		next->prev_free = prev;
+
+	if (prev) {
+		prev->next_free = next;
+		return;
+	}
+
+	tlsf->blocks[fl][sl] = next;
+	if (!next) {
+		tlsf->sl_bitmap[fl] &= ~(1U << sl);
+		if (!tlsf->sl_bitmap[fl])
+			tlsf->fl_bitmap &= ~(1U << fl);
+	}
+}
+
+static void insert_free_block(struct tlsf *tlsf, struct tlsf_block *block,
+			      unsigned int fl, unsigned int sl)
+{
+	struct tlsf_block *head = tlsf->blocks[fl][sl];
+
+	block->next_free = head;
+	block->prev_free = NULL;
+	if (head)
+		head->prev_free = block;
+
+	tlsf->blocks[fl][sl] = block;
+	tlsf->fl_bitmap |= 1U << fl;
+	tlsf->sl_bitmap[fl] |= 1U << sl;
+}
+
+static void block_remove(struct tlsf *tlsf, struct tlsf_block *block)
+{
+	unsigned int fl, sl;
+
+	mapping_insert(block_size(block), &fl, &sl);
+	remove_free_block(tlsf, block, fl, sl);
+}
+
+static void block_insert(struct tlsf *tlsf, struct tlsf_block *block)
+{
+	unsigned int fl, sl;
+
+	mapping_insert(block_size(block), &fl, &sl);
+	insert_free_block(tlsf, block, fl, sl);
+}
+
+static inline bool block_can_split(const struct tlsf_block *block, size_t size)
+{
+	return block_size(block) >= sizeof(struct tlsf_block) + size;
+}
+
+/* cuts the block to size, the free remainder still needs to be linked */
+static struct tlsf_block *block_split(struct tlsf_block *block, size_t size)
+{
+	struct tlsf_block *remaining = (struct tlsf_block *)((char *)block_to_ptr(block) +
+							     size - TLSF_BLOCK_OVERHEAD);
+
+	remaining->size = block_size(block) - (size + TLSF_BLOCK_OVERHEAD);
+	block_set_size(block, size);
+	block_mark_as_free(remaining);
+
+	return remaining;
+}
+
+static struct tlsf_block *block_absorb(struct tlsf_block *prev, struct tlsf_block *block)
+{
+	prev->size += block_size(block) + TLSF_BLOCK_OVERHEAD;
+	block_link_next(prev);
+
+	return prev;
+}
+
+static struct tlsf_block *block_merge_prev(struct tlsf *tlsf, struct tlsf_block *block)
+{
+	struct tlsf_block *prev;
+
+	if (!block_is_prev_free(block))
+		return block;
+
+	prev = block->prev_phys;
+	block_remove(tlsf, prev);
+
+	return block_absorb(prev, block);
+}
+
+static struct tlsf_block *block_merge_next(struct tlsf *tlsf, struct tlsf_block *block)
+{
+	struct tlsf_block *next = block_next(block);
+
+	if (!block_is_free(next))
+		return block;
+
+	block_remove(tlsf, next);
+
+	return block_absorb(block, next);
+}
+
+/* returns the tail of a free block beyond size to the free lists */
+static void block_trim_free(struct tlsf *tlsf, struct tlsf_block *block, size_t size)
+{
+	struct tlsf_block *remaining;
+
+	if (!block_can_split(block, size))
+		return;
+
+	remaining = block_split(block, size);
+	block_link_next(block);
+	block_set_prev_free(remaining);
+	block_insert(tlsf, remaining);
+}
+
+/* returns the head of a free block before an aligned payload to the free lists */
+static struct tlsf_block *block_trim_free_leading(struct tlsf *tlsf, struct tlsf_block *block,
+						  size_t size)
+{
+	struct tlsf_block *remaining;
+
+	if (!block_can_split(block, size))
+		return block;
+
+	remaining = block_split(block, size - TLSF_BLOCK_OVERHEAD);
+	block_set_prev_free(remaining);
+	block_link_next(block);
+	block_insert(tlsf, block);
+
+	return remaining;
+}
+
+static struct tlsf_block *block_locate_free(struct tlsf *tlsf, size_t size)
+{
+	struct tlsf_block *block = NULL;
+	unsigned int fl, sl;
+
+	if (!size)
+		return NULL;
+
+	mapping_search(size, &fl, &sl);
+	if (fl < TLSF_FL_COUNT)
+		block = search_suitable_block(tlsf, &fl, &sl);
+
+	if (block)
+		remove_free_block(tlsf, block, fl, sl);
+
+	return block;
+}
+
+static void *block_prepare_used(struct tlsf *tlsf, struct tlsf_block *block, size_t size)
+{
+	if (!block)
+		return NULL;
+
+	block_trim_free(tlsf, block, size);
+	block_mark_as_used(block);
+
+	return block_to_ptr(block);
+}
+
+static size_t adjust_request_size(size_t size)
+{
+	size_t aligned;
+
+	if (!size || size >= TLSF_BLOCK_SIZE_MAX)
+		return 0;
+
+	aligned = ALIGN_UP_INTERNAL(size, TLSF_ALIGN);
+
+	return aligned > TLSF_BLOCK_SIZE_MIN ? aligned : TLSF_BLOCK_SIZE_MIN;
+}
+
+struct tlsf *tlsf_init(void *mem, size_t bytes)
+{
+	uintptr_t start = ALIGN_UP_INTERNAL((uintptr_t)mem, TLSF_ALIGN);
+	uintptr_t pool = ALIGN_UP_INTERNAL(start + sizeof(struct tlsf), TLSF_ALIGN);
+	uintptr_t end = ((uintptr_t)mem + bytes) & ~(uintptr_t)(TLSF_ALIGN - 1);
+	struct tlsf *tlsf = (struct tlsf *)start;
+	struct tlsf_block *block;
+	struct tlsf_block *last;
+	size_t pool_bytes;
+
+	/* the pool holds one free block and the zero sized last block header */
+	if (end < pool + 2 * TLSF_BLOCK_OVERHEAD + TLSF_BLOCK_SIZE_MIN)
+		return NULL;
+
+	pool_bytes = end - pool - 2 * TLSF_BLOCK_OVERHEAD;
+	if (pool_bytes >= TLSF_BLOCK_SIZE_MAX)
+		return NULL;
+
+	memset(tlsf, 0, sizeof(*tlsf));
+
+	/* prev_phys of the first block is never used, it overlaps the state */
+	block = (struct tlsf_block *)(pool - TLSF_BLOCK_OVERHEAD);
+	block->size = pool_bytes | TLSF_BLOCK_FREE;
+	block_insert(tlsf, block);
+	tlsf->first = block;
+
+	last = block_link_next(block);
+	last->size = TLSF_BLOCK_PREV_FREE;
+
+	return tlsf;
+}
+
+void *tlsf_malloc(struct tlsf *tlsf, size_t bytes)
+{
+	size_t size = adjust_request_size(bytes);
+
+	return block_prepare_used(tlsf, block_locate_free(tlsf, size), size);
+}
+
+void *tlsf_memalign(struct tlsf *tlsf, size_t align, size_t bytes)
+{
+	const size_t gap_min = sizeof(struct tlsf_block);
+	size_t size = adjust_request_size(bytes);
+	struct tlsf_block *block;
+	uintptr_t ptr, aligned;
+
+	if (align <= TLSF_ALIGN)
+		return tlsf_malloc(tlsf, bytes);
+
+	if (!size)
+		return NULL;
+
+	/* any block this large has an aligned payload with room for a free head */
+	block = block_locate_free(tlsf, adjust_request_size(size + align + gap_min));
+	if (!block)
+		return NULL;
+
+	ptr = (uintptr_t)block_to_ptr(block);
+	aligned = ALIGN_UP_INTERNAL(ptr, align);
+
+	/* a head too small to be a free block moves the payload one alignment further */
+	if (aligned != ptr && aligned - ptr < gap_min)
+		aligned = ALIGN_UP_INTERNAL(ptr + gap_min, align);
+
+	if (aligned != ptr)
+		block = block_trim_free_leading(tlsf, block, aligned - ptr);
+
+	return block_prepare_used(tlsf, block, size);
+}
+
+void tlsf_free(struct tlsf *tlsf, void *ptr)
+{
+	struct tlsf_block *block;
+
+	if (!ptr)
+		return;
+
+	block = block_from_ptr(ptr);
+	block_mark_as_free(block);
+	block = block_merge_prev(tlsf, block);
+	block = block_merge_next(tlsf, block);
+	block_insert(tlsf, block);
+}
+
+size_t tlsf_block_size(const void *ptr)
+{
+	return block_size(block_from_ptr(ptr));
+}
+
+size_t tlsf_largest_free(const struct tlsf *tlsf)
+{
+	const struct tlsf_block *block;
+	size_t largest = 0;
+	unsigned int fl, sl;
+
+	if (!tlsf->fl_bitmap)
+		return 0;
+
+	/* the largest blocks are in the highest non-empty list, which isn't sorted */
+	fl = tlsf_fls(tlsf->fl_bitmap);
+	sl = tlsf_fls(tlsf->sl_bitmap[fl]);
+	for (block = tlsf->blocks[fl][sl]; block; block = block->next_free)
+		if (block_size(block) > largest)
+			largest = block_size(block);
+
+	return largest;
+}
+
+int tlsf_check(const struct tlsf *tlsf, size_t *free_bytes)
+{
+	const struct tlsf_block *block;
+	const struct tlsf_block *prev = NULL;
+	unsigned int free_blocks = 0;
+	unsigned int listed = 0;
+	unsigned int fl, sl, f, s;
+	bool prev_free = false;
+	size_t total = 0;
+
+	/* the physical chain: flags mirror the neighbours, free blocks are coalesced */
+	for (block = tlsf->first; !block_is_last(block); block = block_next(block)) {
+		if (block_is_prev_free(block) != prev_free ||
+		    (prev_free && block->prev_phys != prev) ||
+		    block_size(block) < TLSF_BLOCK_SIZE_MIN)
+			return -EINVAL;
+
+		if (block_is_free(block)) {
+			if (prev_free)
+				return -EINVAL;
+
+			total += block_size(block);
+			free_blocks++;
+		}
+
+		prev_free = block_is_free(block);
+		prev = block;
+	}
+
+	if (block_is_prev_free(block) != prev_free)
+		return -EINVAL;
+
+	/* the free lists: bitmaps match, each free block is listed once in its list */
+	for (fl = 0; fl < TLSF_FL_COUNT; fl++) {
+		if (!(tlsf->fl_bitmap & (1U << fl)) != !tlsf->sl_bitmap[fl])
+			return -EINVAL;
+
+		for (sl = 0; sl < TLSF_SL_COUNT; sl++) {
+			if (!(tlsf->sl_bitmap[fl] & (1U << sl)) != !tlsf->blocks[fl][sl])
+				return -EINVAL;
+
+			for (block = tlsf->blocks[fl][sl], prev = NULL; block;
+			     prev = block, block = block->next_free) {
+				mapping_insert(block_size(block), &f, &s);
+				if (!block_is_free(block) || block->prev_free != prev ||
+				    f != fl || s != sl)
+					return -EINVAL;
+
+				listed++;
+			}
+		}
+	}
+
+	if (listed != free_blocks)
+		return -EINVAL;
+
+	if (free_bytes)
+		*free_bytes = total;
+
+	return 0;
+}
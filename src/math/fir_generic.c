@@ -15,6 +15,7 @@
 #include <sof/audio/format.h>
 #include <sof/math/fir_generic.h>
 #include <user/fir.h>
+#include <rtos/string.h>
 #include <rtos/symbol.h>
 #include <errno.h>
 #include <stddef.h>
@@ -46,10 +47,16 @@ int fir_delay_size(struct sof_fir_coef_data *config)
 	if (config->length & 0x3)
 		return -EINVAL;
 
-	/* The dual sample version needs one more delay entry. To preserve
-	 * align for 64 bits need to add two.
+	/* The four samples block version needs three more delay entries
+	 * than taps, the circular buffer is rounded up to multiple of four.
+	 * Every sample is written twice, to index and to index plus
+	 * length, so the delay line is double length. This costs
+	 * (taps + 4) * 4 bytes more per filter than a single delay line,
+	 * 1040 bytes for the 256 taps maximum. E.g. TDFB with 16 such
+	 * filters needs 33280 bytes instead of 16640, and EQ FIR 8320
+	 * bytes more for eight channels.
 	 */
-	return (config->length + 4) * sizeof(int32_t);
+	return 2 * (config->length + 4) * sizeof(int32_t);
 }
 EXPORT_SYMBOL(fir_delay_size);
 
@@ -58,7 +65,7 @@ int fir_init_coef(struct fir_state_32x16 *fir,
 {
 	fir->rwi = 0;
 	fir->taps = (int)config->length;
-	fir->length = (int)fir->taps + 2;
+	fir->length = (int)fir->taps + 4;
 	fir->out_shift = (int)config->out_shift;
 	fir->coef = ASSUME_ALIGNED(&config->coef[0], 4);
 	return 0;
@@ -68,19 +75,33 @@ EXPORT_SYMBOL(fir_init_coef);
 void fir_init_delay(struct fir_state_32x16 *fir, int32_t **data)
 {
 	fir->delay = *data;
-	*data += fir->length; /* Point to next delay line start */
+	*data += 2 * fir->length; /* Point to next delay line start */
 }
 EXPORT_SYMBOL(fir_init_delay);
 
+/*
+ * Writes a sample to the mirrored delay line and returns pointer to it in
+ * the upper half. The taps + 3 previous samples are below it without a
+ * circular wrap.
+ */
+static inline int32_t *fir_write_delay(struct fir_state_32x16 *fir, int32_t x)
+{
+	int32_t *data = &fir->delay[fir->rwi];
+
+	data[0] = x;
+	data[fir->length] = x;
+	if (++fir->rwi == fir->length)
+		fir->rwi = 0;
+
+	return data + fir->length;
+}
+
 int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x)
 {
 	int64_t y = 0;
-	int32_t *data = &fir->delay[fir->rwi];
+	int32_t *data;
 	int16_t *coef = &fir->coef[0];
-	int n1;
-	int n2;
 	int n;
-	const int length = fir->length;
 	const int taps = fir->taps;
 	const int shift = 15 + fir->out_shift;
 
@@ -88,28 +109,8 @@ int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x)
 	if (!fir->length)
 		return x;
 
-	/* Write sample to delay */
-	*data = x;
-
-	/* Advance write pointer and calculate into n1 max. number of taps
-	 * to process before circular wrap.
-	 */
-	n1 = ++fir->rwi;
-	if (fir->rwi == length)
-		fir->rwi = 0;
-
-	/* Part 1, loop n1 times */
-	n1 = MIN(n1, taps);
-	for (n = 0; n < n1; n++) {
-		y += (int64_t)(*coef) * (*data);
-		coef++;
-		data--;
-	}
-
-	/* Part 2, un-wrap data, continue n2 times */
-	n2 = taps - n1;
-	data = &fir->delay[length - 1];
-	for (n = 0; n < n2; n++) {
+	data = fir_write_delay(fir, x);
+	for (n = 0; n < taps; n++) {
 		y += (int64_t)(*coef) * (*data);
 		coef++;
 		data--;
@@ -127,12 +128,9 @@ void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1, int32_t *
 	int32_t sample0;
 	int32_t sample1;
 	int16_t tap;
-	int32_t *data = &fir->delay[fir->rwi];
+	int32_t *data;
 	int16_t *coef = &fir->coef[0];
-	int n1;
-	int n2;
 	int i;
-	const int length = fir->length;
 	const int taps = fir->taps;
 	const int shift = 15 + fir->out_shift;
 
@@ -144,34 +142,11 @@ void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1, int32_t *
 	}
 
 	/* Write samples to delay */
-	*data = x0;
-	*(data + 1) = x1;
+	fir_write_delay(fir, x0);
+	data = fir_write_delay(fir, x1) - 1;
 
-	/* Advance write pointer and calculate into n1 max. number of taps
-	 * to process before circular wrap.
-	 */
-	n1 = fir->rwi + 1;
-	fir->rwi += 2;
-	if (fir->rwi >= length)
-		fir->rwi -= length;
-
-	/* Part 1, loop n1 times */
 	sample1 = x1;
-	n1 = MIN(n1, taps);
-	for (i = 0; i < n1; i++) {
-		tap = *coef;
-		coef++;
-		sample0 = *data;
-		data--;
-		a1 += (int64_t)tap * sample1;
-		a0 += (int64_t)tap * sample0;
-		sample1 = sample0;
-	}
-
-	/* Part 2, un-wrap data, continue n2 times */
-	n2 = taps - n1;
-	data = &fir->delay[length - 1];
-	for (i = 0; i < n2; i++) {
+	for (i = 0; i < taps; i++) {
 		tap = *coef;
 		coef++;
 		sample0 = *data;
@@ -187,4 +162,65 @@ void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1, int32_t *
 }
 EXPORT_SYMBOL(fir_32x16_2x);
 
+void fir_32x16_block(struct fir_state_32x16 *fir, const int32_t *x, int32_t *y, int n)
+{
+	int64_t a0, a1, a2, a3;
+	int32_t sample0, sample1, sample2, sample3;
+	int16_t tap;
+	int32_t *data;
+	int16_t *coef;
+	int i, j;
+	const int taps = fir->taps;
+	const int shift = 15 + fir->out_shift;
+
+	/* Bypass is set with length set to zero. */
+	if (!fir->length) {
+		if (y != x)
+			memcpy_s(y, n * sizeof(int32_t), x, n * sizeof(int32_t));
+		return;
+	}
+
+	/* Four output samples per pass, every coefficient and delay line
+	 * sample is loaded once per pass.
+	 */
+	for (j = 0; j + 3 < n; j += 4) {
+		fir_write_delay(fir, x[j]);
+		fir_write_delay(fir, x[j + 1]);
+		fir_write_delay(fir, x[j + 2]);
+		data = fir_write_delay(fir, x[j + 3]);
+		coef = &fir->coef[0];
+		sample3 = data[0];
+		sample2 = data[-1];
+		sample1 = data[-2];
+		data -= 3;
+		a0 = 0;
+		a1 = 0;
+		a2 = 0;
+		a3 = 0;
+		for (i = 0; i < taps; i++) {
+			tap = *coef;
+			coef++;
+			sample0 = *data;
+			data--;
+			a3 += (int64_t)tap * sample3;
+			a2 += (int64_t)tap * sample2;
+			a1 += (int64_t)tap * sample1;
+			a0 += (int64_t)tap * sample0;
+			sample3 = sample2;
+			sample2 = sample1;
+			sample1 = sample0;
+		}
+
+		/* Q2.46 -> Q2.31, saturate to Q1.31 */
+		y[j] = sat_int32(a0 >> shift);
+		y[j + 1] = sat_int32(a1 >> shift);
+		y[j + 2] = sat_int32(a2 >> shift);
+		y[j + 3] = sat_int32(a3 >> shift);
+	}
+
+	for (; j < n; j++)
+		y[j] = fir_32x16(fir, x[j]);
+}
+EXPORT_SYMBOL(fir_32x16_block);
+
 #endif
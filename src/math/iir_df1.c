@@ -56,3 +56,15 @@ void iir_reset_df1(struct iir_state_df1 *iir)
 	 */
 }
 EXPORT_SYMBOL(iir_reset_df1);
+
+#if !SOF_USE_HIFI(NONE, FILTER)
+/* The HiFi versions keep the state in registers within iir_df1_4th() */
+void iir_df1_4th_block(struct iir_state_df1 *iir, const int32_t *x, int32_t *y, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		y[i] = iir_df1_4th(iir, x[i]);
+}
+EXPORT_SYMBOL(iir_df1_4th_block);
+#endif
@@ -163,4 +163,59 @@ int32_t iir_df1_4th(struct iir_state_df1 *iir, int32_t x)
 }
 EXPORT_SYMBOL(iir_df1_4th);
 
+/*
+ * Same as iir_df1_4th() for a block of samples. The coefficients and the
+ * delay lines of both biquads are kept in local variables through the
+ * block.
+ */
+static inline int32_t iir_df1_biquad(const int32_t *coef, int32_t *d, int32_t x)
+{
+	int64_t acc;
+	int32_t y;
+
+	acc = ((int64_t)coef[0]) * d[0]; /* a2 * y(n - 2) */
+	acc += ((int64_t)coef[1]) * d[1]; /* a1 * y(n - 1) */
+	acc += ((int64_t)coef[2]) * d[2]; /* b2 * x(n - 2) */
+	acc += ((int64_t)coef[3]) * d[3]; /* b1 * x(n - 1) */
+	acc += ((int64_t)coef[4]) * x; /* b0 * x */
+	y = (int32_t)sat_int32(Q_SHIFT_RND(acc, 61, 31));
+
+	d[0] = d[1];
+	d[1] = y;
+	d[2] = d[3];
+	d[3] = x;
+
+	/* Gain, output shift and Q3.45 to Q1.31 */
+	acc = ((int64_t)coef[6]) * y;
+	return sat_int32(Q_SHIFT_RND(acc, 45 + coef[5], 31));
+}
+
+void iir_df1_4th_block(struct iir_state_df1 *iir, const int32_t *x, int32_t *y, int n)
+{
+	int32_t c0[SOF_EQ_IIR_NBIQUAD];
+	int32_t c1[SOF_EQ_IIR_NBIQUAD];
+	int32_t d0[IIR_DF1_NUM_STATE];
+	int32_t d1[IIR_DF1_NUM_STATE];
+	int i;
+
+	for (i = 0; i < SOF_EQ_IIR_NBIQUAD; i++) {
+		c0[i] = iir->coef[i];
+		c1[i] = iir->coef[SOF_EQ_IIR_NBIQUAD + i];
+	}
+
+	for (i = 0; i < IIR_DF1_NUM_STATE; i++) {
+		d0[i] = iir->delay[i];
+		d1[i] = iir->delay[IIR_DF1_NUM_STATE + i];
+	}
+
+	for (i = 0; i < n; i++)
+		y[i] = iir_df1_biquad(c1, d1, iir_df1_biquad(c0, d0, x[i]));
+
+	for (i = 0; i < IIR_DF1_NUM_STATE; i++) {
+		iir->delay[i] = d0[i];
+		iir->delay[IIR_DF1_NUM_STATE + i] = d1[i];
+	}
+}
+EXPORT_SYMBOL(iir_df1_4th_block);
+
 #endif
@@ -95,6 +95,23 @@ void win_hamming_16b(int16_t win[], int length)
 	}
 }
 
+void win_hann_16b(int16_t win[], int length)
+{
+	int32_t val;
+	int32_t a;
+	int n;
+
+	a = WIN_TWO_PI_Q28 / (length - 1); /* Q4.28 */
+	for (n = 0; n < length; n++) {
+		/* Calculate 0.5 - 0.5 * cos(a * n) */
+		val = cos_fixed_32b(a * n); /* Q4.28 -> Q1.31 */
+		val = WIN_05_Q31 - (val >> 1); /* Q1.31 */
+
+		/* Convert to Q1.15 */
+		win[n] = sat_int16(Q_SHIFT_RND(val, 31, 15));
+	}
+}
+
 void win_povey_16b(int16_t win[], int length)
 {
 	int32_t cos_an;
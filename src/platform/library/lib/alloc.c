@@ -12,35 +12,58 @@
 #include <stdio.h>
 #include <malloc.h>
 #include <rtos/alloc.h>
+#include <sof/lib/heap_telemetry.h>
 #include <sof/lib/mm_heap.h>
 
 /* testbench mem alloc definition */
 
 void *rmalloc(enum mem_zone zone, uint32_t flags, uint32_t caps, size_t bytes)
 {
-	return malloc(bytes);
+	uint64_t start = heap_telemetry_time();
+	void *ptr = malloc(bytes);
+
+	heap_telemetry_alloc(zone, bytes, ptr, HEAP_TELEMETRY_CALLER(), start);
+	return ptr;
 }
 
 void *rzalloc(enum mem_zone zone, uint32_t flags, uint32_t caps, size_t bytes)
 {
-	return calloc(bytes, 1);
+	uint64_t start = heap_telemetry_time();
+	void *ptr = calloc(bytes, 1);
+
+	heap_telemetry_alloc(zone, bytes, ptr, HEAP_TELEMETRY_CALLER(), start);
+	return ptr;
 }
 
 void rfree(void *ptr)
 {
+	uint64_t start = heap_telemetry_time();
+
+	if (!ptr)
+		return;
+
 	free(ptr);
+	heap_telemetry_free(start);
 }
 
 void *rballoc_align(uint32_t flags, uint32_t caps, size_t bytes,
 		    uint32_t alignment)
 {
-	return malloc(bytes);
+	uint64_t start = heap_telemetry_time();
+	void *ptr = malloc(bytes);
+
+	heap_telemetry_alloc(SOF_MEM_ZONE_BUFFER, bytes, ptr, HEAP_TELEMETRY_CALLER(), start);
+	return ptr;
 }
 
 void *rbrealloc_align(void *ptr, uint32_t flags, uint32_t caps, size_t bytes,
 		      size_t old_bytes, uint32_t alignment)
 {
-	return realloc(ptr, bytes);
+	uint64_t start = heap_telemetry_time();
+	void *new_ptr = realloc(ptr, bytes);
+
+	heap_telemetry_alloc(SOF_MEM_ZONE_BUFFER, bytes, new_ptr, HEAP_TELEMETRY_CALLER(), start);
+	return new_ptr;
 }
 
 void heap_trace(struct mm_heap *heap, int size)
@@ -54,3 +77,22 @@ void heap_trace_all(int force)
 {
 	heap_trace(NULL, 0);
 }
+
+#if CONFIG_DEBUG_HEAP_TELEMETRY
+/* all zones come from the C library heap, which doesn't report its largest free block */
+unsigned int heap_telemetry_zones(struct heap_telemetry_zone *zones, unsigned int max)
+{
+	struct mallinfo2 info = mallinfo2();
+
+	if (!max)
+		return 0;
+
+	zones->zone = HEAP_TELEMETRY_ZONE_ALL;
+	zones->size = info.arena + info.hblkhd;
+	zones->used = info.uordblks + info.hblkhd;
+	zones->free = info.fordblks;
+	zones->largest_free = 0;
+
+	return 1;
+}
+#endif
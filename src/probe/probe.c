@@ -1279,13 +1279,13 @@ int probe_point_add(uint32_t count, const struct probe_point *probe)
 			probe_point_id_t *new_buf_id = &_probe->probe_points[first_free].buffer_id;
 
 #if CONFIG_IPC_MAJOR_4
-			notifier_register(&new_buf_id->full_id, buf, NOTIFIER_ID_BUFFER_PRODUCE,
-					  &probe_cb_produce, 0);
+			buffer_listener_register(buf, &new_buf_id->full_id,
+						 NOTIFIER_ID_BUFFER_PRODUCE, &probe_cb_produce);
 			notifier_register(&new_buf_id->full_id, buf, NOTIFIER_ID_BUFFER_FREE,
 					  &probe_cb_free, 0);
 #else
-			notifier_register(&new_buf_id->full_id, dev->cb, NOTIFIER_ID_BUFFER_PRODUCE,
-					  &probe_cb_produce, 0);
+			buffer_listener_register(dev->cb, &new_buf_id->full_id,
+						 NOTIFIER_ID_BUFFER_PRODUCE, &probe_cb_produce);
 			notifier_register(&new_buf_id->full_id, dev->cb, NOTIFIER_ID_BUFFER_FREE,
 					  &probe_cb_free, 0);
 #endif
@@ -1404,8 +1404,8 @@ int probe_point_remove(uint32_t count, const uint32_t *buffer_id)
 				if (dev) {
 					buf = ipc4_get_buffer(dev, *buf_id);
 					if (buf) {
-						notifier_unregister(NULL, buf,
-								    NOTIFIER_ID_BUFFER_PRODUCE);
+						buffer_listener_unregister(buf, NULL,
+							NOTIFIER_ID_BUFFER_PRODUCE);
 						notifier_unregister(NULL, buf,
 								    NOTIFIER_ID_BUFFER_FREE);
 					}
@@ -1413,8 +1413,8 @@ int probe_point_remove(uint32_t count, const uint32_t *buffer_id)
 #else
 				dev = ipc_get_comp_by_id(ipc_get(), buffer_id[i]);
 				if (dev) {
-					notifier_unregister(&buf_id->full_id, dev->cb,
-							    NOTIFIER_ID_BUFFER_PRODUCE);
+					buffer_listener_unregister(dev->cb, &buf_id->full_id,
+								   NOTIFIER_ID_BUFFER_PRODUCE);
 					notifier_unregister(&buf_id->full_id, dev->cb,
 							    NOTIFIER_ID_BUFFER_FREE);
 				}
@@ -19,6 +19,7 @@
 #include <zephyr/sys_clock.h>
 #include <sof/lib/notifier.h>
 #include <ipc4/base_fw.h>
+#include <sof/debug/task_trace.h>
 
 #include <zephyr/kernel/thread.h>
 
@@ -322,6 +323,7 @@ static void dp_thread_fn(void *p1, void *p2, void *p3)
 	struct task_dp_pdata *task_pdata = task->priv_data;
 	unsigned int lock_key;
 	enum task_state state;
+	uint32_t trace_start;
 
 	while (1) {
 		/*
@@ -330,10 +332,14 @@ static void dp_thread_fn(void *p1, void *p2, void *p3)
 		 */
 		k_sem_take(&task_pdata->sem, K_FOREVER);
 
-		if (task->state == SOF_TASK_STATE_RUNNING)
+		if (task->state == SOF_TASK_STATE_RUNNING) {
+			trace_start = task_trace_timestamp();
 			state = task_run(task);
-		else
+			task_trace_event(task, dev_comp_id(task_pdata->mod->dev),
+					 TASK_TRACE_TYPE_DP, trace_start, task_trace_timestamp());
+		} else {
 			state = task->state;	/* to avoid undefined variable warning */
+		}
 
 		lock_key = scheduler_dp_lock();
 		/*
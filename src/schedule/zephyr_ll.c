@@ -17,6 +17,7 @@
 #include <zephyr/kernel.h>
 #include <ipc4/base_fw.h>
 #include <sof/debug/telemetry/telemetry.h>
+#include <sof/debug/task_trace.h>
 
 LOG_MODULE_REGISTER(ll_schedule, CONFIG_SOF_LOG_LEVEL);
 
@@ -133,6 +134,7 @@ static void zephyr_ll_task_insert_after_unlocked(struct task *task, struct task
 
 static inline enum task_state do_task_run(struct task *task)
 {
+	const uint32_t trace_start = task_trace_timestamp();
 	enum task_state state;
 
 #if CONFIG_PERFORMANCE_COUNTERS_LL_TASKS
@@ -141,6 +143,9 @@ static inline enum task_state do_task_run(struct task *task)
 
 	state = task_run(task);
 
+	task_trace_event(task, (uint32_t)(uintptr_t)task, TASK_TRACE_TYPE_LL,
+			 trace_start, task_trace_timestamp());
+
 #if CONFIG_PERFORMANCE_COUNTERS_LL_TASKS
 	perf_cnt_stamp(&task->pcd, perf_trace_null, NULL);
 	task_perf_cnt_avg(&task->pcd, task_perf_avg_info, &ll_tr, task);
@@ -254,10 +259,12 @@ static void zephyr_ll_run(void *data)
 
 static void schedule_ll_callback(void *data)
 {
+	const uint32_t trace_start = task_trace_timestamp();
 #ifdef CONFIG_SOF_TELEMETRY
 	const uint32_t begin_stamp = (uint32_t)telemetry_timestamp();
 #endif
 	zephyr_ll_run(data);
+	task_trace_event(NULL, 0, TASK_TRACE_TYPE_LL_TICK, trace_start, task_trace_timestamp());
 #ifdef CONFIG_SOF_TELEMETRY
 	const uint32_t current_stamp = (uint32_t)telemetry_timestamp();
 
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <cmocka.h>
+
+#include <asrc/asrc_drift.h>
+
+/* Synthetic DAI with 1 ms period at 48 kHz and 19.2 MHz wall clock */
+#define TEST_FS			48000
+#define TEST_WALCLK		19200000
+#define TEST_PERIOD		48
+#define TEST_UPDATES		6000
+
+/* Timestamp jitter, peak +/- samples */
+#define TEST_JITTER		0.5
+
+/* Mean skew error allowed after lock, and max. buffer level deviation */
+#define TEST_SKEW_ERROR_PPM	5.0
+#define TEST_PHASE_MAX		2.0
+
+struct drift_clock {
+	double time;		/* Wall clock ticks */
+	double skew;		/* True rate skew */
+	double skew_ramp;	/* Change of skew per period */
+	uint32_t seed;
+	int32_t ts_prev;
+	int32_t sample_prev;
+	int32_t sample;
+};
+
+/* Deterministic uniform random value in range -1.0 .. +1.0 */
+static double clock_rand(struct drift_clock *clk)
+{
+	clk->seed = clk->seed * 1664525 + 1013904223;
+	return (double)(int32_t)clk->seed / 2147483648.0;
+}
+
+/* Advance the synthetic clock by one period and return the jittered
+ * timestamp deltas as the DAI would report them.
+ */
+static void clock_step(struct drift_clock *clk, int32_t *delta_ts,
+		       int32_t *delta_sample, double jitter_samples)
+{
+	double ticks_per_sample = (double)TEST_WALCLK / TEST_FS;
+	int32_t ts;
+
+	clk->skew += clk->skew_ramp;
+	clk->time += TEST_PERIOD * clk->skew * ticks_per_sample;
+	clk->sample += TEST_PERIOD;
+	ts = (int32_t)(int64_t)round(clk->time + jitter_samples * ticks_per_sample *
+				     clock_rand(clk));
+	*delta_ts = ts - clk->ts_prev;
+	*delta_sample = clk->sample - clk->sample_prev;
+	clk->ts_prev = ts;
+	clk->sample_prev = clk->sample;
+}
+
+/* Run the estimator against the synthetic clock. The phase is the
+ * buffer level deviation in samples caused by the skew estimation error.
+ */
+static void drift_run(double skew, double skew_ramp, double *mean_error_ppm,
+		      double *phase_max)
+{
+	struct drift_clock clk = { .skew = skew, .skew_ramp = skew_ramp, .seed = 1 };
+	struct asrc_drift drift;
+	double error_sum = 0;
+	double phase = 0;
+	double error;
+	int32_t delta_ts;
+	int32_t delta_sample;
+	int ret;
+	int i;
+
+	asrc_drift_init(&drift, Q_CONVERT_FLOAT(1.0, 30));
+	clock_step(&clk, &delta_ts, &delta_sample, TEST_JITTER);
+	*phase_max = 0;
+	for (i = 0; i < TEST_UPDATES; i++) {
+		clock_step(&clk, &delta_ts, &delta_sample, TEST_JITTER);
+		ret = asrc_drift_update(&drift, delta_ts, delta_sample, TEST_FS, TEST_WALCLK);
+		assert_int_equal(ret, 0);
+
+		error = clk.skew - (double)asrc_drift_get_skew(&drift) / (1 << 30);
+		phase += error * TEST_PERIOD;
+		if (i >= TEST_UPDATES / 2) {
+			error_sum += error;
+			*phase_max = fmax(*phase_max, fabs(phase));
+		}
+	}
+
+	*mean_error_ppm = 1e6 * error_sum / (TEST_UPDATES - TEST_UPDATES / 2);
+	printf("%s: skew %f ramp %g, mean error %.2f ppm, max phase %.2f samples\n",
+	       __func__, skew, skew_ramp, *mean_error_ppm, *phase_max);
+}
+
+static void test_asrc_drift_constant(void **state)
+{
+	double mean_error_ppm;
+	double phase_max;
+
+	(void)state;
+
+	drift_run(1.0002, 0, &mean_error_ppm, &phase_max);
+	assert_true(fabs(mean_error_ppm) < TEST_SKEW_ERROR_PPM);
+	assert_true(phase_max < TEST_PHASE_MAX);
+
+	drift_run(0.9995, 0, &mean_error_ppm, &phase_max);
+	assert_true(fabs(mean_error_ppm) < TEST_SKEW_ERROR_PPM);
+	assert_true(phase_max < TEST_PHASE_MAX);
+}
+
+static void test_asrc_drift_ramp(void **state)
+{
+	double mean_error_ppm;
+	double phase_max;
+
+	(void)state;
+
+	/* Skew drifts 100 ppm per second with 1 ms period */
+	drift_run(1.0, 1e-7, &mean_error_ppm, &phase_max);
+	assert_true(fabs(mean_error_ppm) < TEST_SKEW_ERROR_PPM);
+	assert_true(phase_max < TEST_PHASE_MAX);
+}
+
+static void test_asrc_drift_glitch(void **state)
+{
+	struct drift_clock clk = { .skew = 1.0001, .seed = 1 };
+	struct asrc_drift drift;
+	int32_t delta_ts;
+	int32_t delta_sample;
+	int32_t skew;
+	int32_t glitch = 10 * TEST_WALCLK / TEST_FS;
+	int i;
+
+	(void)state;
+
+	asrc_drift_init(&drift, Q_CONVERT_FLOAT(1.0, 30));
+	clock_step(&clk, &delta_ts, &delta_sample, 0);
+	for (i = 0; i < TEST_UPDATES; i++) {
+		clock_step(&clk, &delta_ts, &delta_sample, 0);
+		assert_int_equal(asrc_drift_update(&drift, delta_ts, delta_sample,
+						   TEST_FS, TEST_WALCLK), 0);
+	}
+
+	/* A timestamp delayed by 10 samples is seen as two opposite
+	 * phase jumps, both need to be rejected without change to skew.
+	 */
+	skew = asrc_drift_get_skew(&drift);
+	clock_step(&clk, &delta_ts, &delta_sample, 0);
+	assert_int_equal(asrc_drift_update(&drift, delta_ts + glitch, delta_sample,
+					   TEST_FS, TEST_WALCLK), -ERANGE);
+	clock_step(&clk, &delta_ts, &delta_sample, 0);
+	assert_int_equal(asrc_drift_update(&drift, delta_ts - glitch, delta_sample,
+					   TEST_FS, TEST_WALCLK), -ERANGE);
+	assert_int_equal(asrc_drift_get_skew(&drift), skew);
+	assert_int_equal(drift.glitch_count, 2);
+	assert_true(fabs((double)skew / (1 << 30) - clk.skew) < 1e-6);
+}
+
+static void test_asrc_drift_invalid(void **state)
+{
+	struct asrc_drift drift;
+
+	(void)state;
+
+	asrc_drift_init(&drift, Q_CONVERT_FLOAT(1.0, 30));
+	assert_int_equal(asrc_drift_update(&drift, 400, 0, TEST_FS, TEST_WALCLK), -EINVAL);
+	assert_int_equal(asrc_drift_update(&drift, 0, 48, TEST_FS, TEST_WALCLK), -EINVAL);
+	assert_int_equal(asrc_drift_update(&drift, 400, 48, TEST_FS, 0), -EINVAL);
+	assert_int_equal(asrc_drift_get_skew(&drift), Q_CONVERT_FLOAT(1.0, 30));
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_asrc_drift_constant),
+		cmocka_unit_test(test_asrc_drift_ramp),
+		cmocka_unit_test(test_asrc_drift_glitch),
+		cmocka_unit_test(test_asrc_drift_invalid),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
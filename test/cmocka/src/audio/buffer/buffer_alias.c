@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+#include <sof/ipc/driver.h>
+#include <sof/ipc/msg.h>
+#include <sof/ipc/topology.h>
+#include <sof/ipc/schedule.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+static struct comp_buffer *new_buffer(uint32_t size)
+{
+	struct sof_ipc_buffer desc = {
+		.size = size
+	};
+
+	return buffer_new(&desc, false);
+}
+
+/* move bytes from source to sink in place as a 1:1 module would */
+static void process_in_place(struct comp_buffer *source, struct comp_buffer *sink,
+			     uint32_t bytes)
+{
+	uint8_t *ptr;
+	int i;
+
+	assert_ptr_equal(source->stream.r_ptr, sink->stream.w_ptr);
+
+	for (i = 0; i < bytes; i++) {
+		ptr = audio_stream_read_frag(&source->stream, i, sizeof(uint8_t));
+		*ptr += 100;
+	}
+
+	comp_update_buffer_consume(source, bytes);
+	comp_update_buffer_produce(sink, bytes);
+}
+
+static void test_audio_buffer_alias_chain(void **state)
+{
+	struct comp_buffer *head = new_buffer(16);
+	struct comp_buffer *mid = new_buffer(16);
+	struct comp_buffer *tail = new_buffer(8);
+	uint8_t *ptr;
+	int i;
+
+	(void)state;
+
+	assert_non_null(head);
+	assert_non_null(mid);
+	assert_non_null(tail);
+
+	/* source must hold what the sink holds */
+	assert_int_equal(buffer_alias(tail, mid), -EINVAL);
+
+	assert_int_equal(buffer_alias(head, mid), 0);
+	assert_int_equal(buffer_alias(mid, tail), 0);
+	assert_int_equal(buffer_alias(head, mid), -EBUSY);
+
+	assert_ptr_equal(mid->stream.addr, head->stream.addr);
+	assert_ptr_equal(tail->stream.addr, head->stream.addr);
+	assert_int_equal(audio_stream_get_size(&tail->stream), 16);
+
+	for (i = 0; i < 12; i++) {
+		ptr = audio_stream_write_frag(&head->stream, i, sizeof(uint8_t));
+		*ptr = i;
+	}
+	comp_update_buffer_produce(head, 12);
+	assert_int_equal(audio_stream_get_free_bytes(&head->stream), 4);
+
+	process_in_place(head, mid, 8);
+	process_in_place(mid, tail, 4);
+
+	/* data of the whole chain is protected from the head producer */
+	assert_int_equal(audio_stream_get_avail_bytes(&head->stream), 4);
+	assert_int_equal(audio_stream_get_avail_bytes(&mid->stream), 4);
+	assert_int_equal(audio_stream_get_avail_bytes(&tail->stream), 4);
+	assert_int_equal(audio_stream_get_free_bytes(&head->stream), 4);
+	assert_int_equal(audio_stream_get_free_bytes(&mid->stream), 8);
+	assert_int_equal(audio_stream_get_free_bytes(&tail->stream), 12);
+
+	for (i = 0; i < 4; i++) {
+		ptr = audio_stream_read_frag(&tail->stream, i, sizeof(uint8_t));
+		assert_int_equal(*ptr, i + 200);
+		ptr = audio_stream_read_frag(&mid->stream, i, sizeof(uint8_t));
+		assert_int_equal(*ptr, i + 104);
+	}
+
+	comp_update_buffer_consume(tail, 4);
+	assert_int_equal(audio_stream_get_free_bytes(&head->stream), 8);
+
+	/* the tail follows mid to its own memory */
+	assert_int_equal(buffer_unalias(mid), 0);
+	assert_null(mid->stream.alias_source);
+	assert_null(head->stream.alias_sink);
+	assert_ptr_not_equal(mid->stream.addr, head->stream.addr);
+	assert_ptr_equal(tail->stream.addr, mid->stream.addr);
+	assert_int_equal(audio_stream_get_free_bytes(&head->stream), 12);
+	assert_int_equal(audio_stream_get_free_bytes(&mid->stream), 16);
+
+	assert_int_equal(buffer_unalias(tail), 0);
+	assert_int_equal(audio_stream_get_size(&tail->stream), 8);
+	assert_int_equal(audio_stream_get_free_bytes(&tail->stream), 8);
+	assert_ptr_not_equal(tail->stream.addr, mid->stream.addr);
+
+	buffer_free(head);
+	buffer_free(mid);
+	buffer_free(tail);
+}
+
+static void test_audio_buffer_alias_free_head(void **state)
+{
+	struct comp_buffer *head = new_buffer(16);
+	struct comp_buffer *sink = new_buffer(16);
+	void *addr;
+
+	(void)state;
+
+	assert_int_equal(buffer_alias(head, sink), 0);
+	addr = head->stream.addr;
+
+	/* the sink takes over the memory of a freed head */
+	buffer_free(head);
+	assert_null(sink->stream.alias_source);
+	assert_ptr_equal(sink->stream.addr, addr);
+	assert_int_equal(buffer_unalias(sink), 0);
+	assert_ptr_equal(sink->stream.addr, addr);
+
+	buffer_free(sink);
+}
+
+static void test_audio_buffer_alias_refused(void **state)
+{
+	struct comp_buffer *source = new_buffer(16);
+	struct comp_buffer *sink = new_buffer(16);
+	void *addr = sink->stream.addr;
+
+	(void)state;
+
+	/* neither end of an alias may be reset or zeroed while streaming */
+	source->no_alias = true;
+	assert_int_equal(buffer_alias(source, sink), -EPERM);
+	source->no_alias = false;
+	sink->no_alias = true;
+	assert_int_equal(buffer_alias(source, sink), -EPERM);
+
+	assert_null(source->stream.alias_sink);
+	assert_null(sink->stream.alias_source);
+	assert_ptr_equal(sink->stream.addr, addr);
+
+	buffer_free(source);
+	buffer_free(sink);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_buffer_alias_chain),
+		cmocka_unit_test(test_audio_buffer_alias_free_head),
+		cmocka_unit_test(test_audio_buffer_alias_refused),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/* Tests the coalescing of buffer produce and consume notifications */
+
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+#include <sof/lib/notifier.h>
+#include <sof/ipc/topology.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+struct notify_log {
+	int count;
+	enum notify_id type;
+	struct buffer_cb_transact transact;
+};
+
+static void log_cb(void *arg, enum notify_id type, void *data)
+{
+	struct notify_log *log = arg;
+	struct buffer_cb_transact *transact = data;
+
+	log->count++;
+	log->type = type;
+	log->transact = *transact;
+}
+
+static struct comp_buffer *new_buffer(uint32_t size)
+{
+	struct sof_ipc_buffer desc = {
+		.size = size
+	};
+
+	return buffer_new(&desc, false);
+}
+
+static void test_buffer_notify_coalesce(void **state)
+{
+	struct comp_buffer *buffer = new_buffer(16);
+	struct notify_log log = { 0 };
+	void *wptr;
+
+	(void)state;
+
+	assert_non_null(buffer);
+	assert_null(buffer->notify);
+
+	assert_int_equal(buffer_listener_register(buffer, &log, NOTIFIER_ID_BUFFER_PRODUCE,
+						  log_cb), 0);
+	assert_non_null(buffer->notify);
+
+	/* consume is not listened to */
+	wptr = audio_stream_get_wptr(&buffer->stream);
+	comp_update_buffer_produce(buffer, 4);
+	comp_update_buffer_produce(buffer, 4);
+	comp_update_buffer_consume(buffer, 8);
+	comp_update_buffer_produce(buffer, 4);
+	assert_int_equal(log.count, 0);
+
+	buffer_notify_flush(buffer);
+	assert_int_equal(log.count, 1);
+	assert_int_equal(log.type, NOTIFIER_ID_BUFFER_PRODUCE);
+	assert_ptr_equal(log.transact.buffer, buffer);
+	assert_ptr_equal(log.transact.transaction_begin_address, wptr);
+	assert_int_equal(log.transact.transaction_amount, 12);
+
+	/* nothing pending */
+	buffer_notify_flush(buffer);
+	assert_int_equal(log.count, 1);
+
+	/* the pending transaction never covers more than the buffer */
+	comp_update_buffer_consume(buffer, 4);
+	comp_update_buffer_produce(buffer, 12);
+	comp_update_buffer_consume(buffer, 12);
+	comp_update_buffer_produce(buffer, 8);
+	assert_int_equal(log.count, 2);
+	assert_int_equal(log.transact.transaction_amount, 12);
+	buffer_notify_flush(buffer);
+	assert_int_equal(log.count, 3);
+	assert_int_equal(log.transact.transaction_amount, 8);
+
+	/* reset drops the pending transaction */
+	comp_update_buffer_produce(buffer, 4);
+	audio_buffer_reset(&buffer->audio_buffer);
+	buffer_notify_flush(buffer);
+	assert_int_equal(log.count, 3);
+
+	buffer_listener_unregister(buffer, NULL, NOTIFIER_ID_BUFFER_PRODUCE);
+	assert_null(buffer->notify);
+
+	buffer_free(buffer);
+}
+
+static void test_buffer_notify_order(void **state)
+{
+	struct comp_buffer *buffer = new_buffer(64);
+	struct notify_log produce = { 0 };
+	struct notify_log consume = { 0 };
+
+	(void)state;
+
+	assert_non_null(buffer);
+	assert_int_equal(buffer_listener_register(buffer, &produce, NOTIFIER_ID_BUFFER_PRODUCE,
+						  log_cb), 0);
+	assert_int_equal(buffer_listener_register(buffer, &consume, NOTIFIER_ID_BUFFER_CONSUME,
+						  log_cb), 0);
+
+	/* produce is delivered before a consume is coalesced */
+	comp_update_buffer_produce(buffer, 16);
+	comp_update_buffer_consume(buffer, 8);
+	assert_int_equal(produce.count, 1);
+	assert_int_equal(produce.transact.transaction_amount, 16);
+	assert_int_equal(consume.count, 0);
+
+	comp_update_buffer_consume(buffer, 8);
+	comp_update_buffer_produce(buffer, 4);
+	assert_int_equal(consume.count, 1);
+	assert_int_equal(consume.transact.transaction_amount, 16);
+	assert_int_equal(consume.type, NOTIFIER_ID_BUFFER_CONSUME);
+
+	/* the pending produce is dropped with its last listener */
+	buffer_listener_unregister(buffer, &produce, NOTIFIER_ID_BUFFER_PRODUCE);
+	assert_non_null(buffer->notify);
+	buffer_notify_flush(buffer);
+	assert_int_equal(produce.count, 1);
+
+	/* pending transactions are delivered before the buffer is freed */
+	comp_update_buffer_consume(buffer, 4);
+	buffer_free(buffer);
+	assert_int_equal(consume.count, 2);
+	assert_int_equal(consume.transact.transaction_amount, 4);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_buffer_notify_coalesce),
+		cmocka_unit_test(test_buffer_notify_order),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
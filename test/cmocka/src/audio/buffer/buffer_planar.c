@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+#include <sof/audio/sink_source_utils.h>
+#include <sof/ipc/driver.h>
+#include <sof/ipc/msg.h>
+#include <sof/ipc/topology.h>
+#include <sof/ipc/schedule.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <math.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#define TEST_FRAMES	8
+
+/* buffer of TEST_FRAMES frames with the read and write pointers 5 frames in */
+static struct comp_buffer *test_buffer(enum sof_ipc_frame fmt, uint32_t channels)
+{
+	struct sof_ipc_buffer desc = { 0 };
+	struct comp_buffer *buf;
+	size_t frame_bytes = get_frame_bytes(fmt, channels);
+
+	desc.size = TEST_FRAMES * frame_bytes;
+	buf = buffer_new(&desc, false);
+	assert_non_null(buf);
+
+	audio_stream_set_frm_fmt(&buf->stream, fmt);
+	audio_stream_set_valid_fmt(&buf->stream, fmt);
+	audio_stream_set_channels(&buf->stream, channels);
+
+	comp_update_buffer_produce(buf, 5 * frame_bytes);
+	comp_update_buffer_consume(buf, 5 * frame_bytes);
+
+	return buf;
+}
+
+static struct sof_source *test_source(struct comp_buffer *buf)
+{
+	return audio_buffer_get_source(&buf->audio_buffer);
+}
+
+static struct sof_sink *test_sink(struct comp_buffer *buf)
+{
+	return audio_buffer_get_sink(&buf->audio_buffer);
+}
+
+static void test_planar_q31_s32_wrap(void **state)
+{
+	struct comp_buffer *buf = test_buffer(SOF_IPC_FRAME_S32_LE, 2);
+	int32_t in[2][6], out[2][6];
+	int32_t *in_ptrs[2] = { in[0], in[1] };
+	int32_t *out_ptrs[2] = { out[0], out[1] };
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < 6; i++) {
+		in[0][i] = INT32_MIN + i;
+		in[1][i] = INT32_MAX - i;
+	}
+
+	/* six frames from frame 5 of 8 wrap around the end of the buffer */
+	assert_int_equal(sink_from_planar_q31(test_sink(buf), in_ptrs, 2, 6), 0);
+	assert_int_equal(audio_stream_get_avail_frames(&buf->stream), 6);
+	assert_int_equal(sink_from_planar_q31(test_sink(buf), in_ptrs, 2, 6), -ENOSPC);
+
+	assert_int_equal(source_to_planar_q31(test_source(buf), out_ptrs, 2, 6), 0);
+	assert_int_equal(audio_stream_get_avail_frames(&buf->stream), 0);
+	assert_int_equal(source_to_planar_q31(test_source(buf), out_ptrs, 2, 1), -EFBIG);
+
+	assert_memory_equal(in, out, sizeof(in));
+
+	buffer_free(buf);
+}
+
+static void test_planar_q31_s16(void **state)
+{
+	struct comp_buffer *buf = test_buffer(SOF_IPC_FRAME_S16_LE, 1);
+	int32_t in[4] = { INT32_MAX, INT32_MIN, 0x12348000, -0x12348000 };
+	int32_t ref[4] = { 0x7fff0000, INT32_MIN, 0x12350000, -0x12340000 };
+	int32_t out[4];
+	int32_t *in_ptr = in;
+	int32_t *out_ptr = out;
+
+	(void)state;
+
+	/* rounds and saturates to 16 bits */
+	assert_int_equal(sink_from_planar_q31(test_sink(buf), &in_ptr, 1, 4), 0);
+	assert_int_equal(source_to_planar_q31(test_source(buf), &out_ptr, 1, 4), 0);
+	assert_memory_equal(out, ref, sizeof(ref));
+
+	buffer_free(buf);
+}
+
+static void test_planar_float_s24(void **state)
+{
+	struct comp_buffer *buf = test_buffer(SOF_IPC_FRAME_S24_4LE, 1);
+	float in[5] = { 2.0f, -2.0f, 0.5f, -0.25f, 1.0f / 8388608.0f };
+	float ref[5] = { 8388607.0f / 8388608.0f, -1.0f, 0.5f, -0.25f, 1.0f / 8388608.0f };
+	float out[5];
+	float *in_ptr = in;
+	float *out_ptr = out;
+	int32_t *sample;
+	int i;
+
+	(void)state;
+
+	assert_int_equal(sink_from_planar_float(test_sink(buf), &in_ptr, 1, 5), 0);
+
+	/* the reader sign extends from bit 23, the upper byte is ignored */
+	sample = audio_stream_read_frag_s32(&buf->stream, 1);
+	assert_int_equal(*sample, -8388608);
+	*sample &= 0xffffff;
+
+	assert_int_equal(source_to_planar_float(test_source(buf), &out_ptr, 1, 5), 0);
+	for (i = 0; i < 5; i++)
+		assert_true(out[i] == ref[i]);
+
+	buffer_free(buf);
+}
+
+static void test_planar_float_s16_s32(void **state)
+{
+	struct comp_buffer *buf16 = test_buffer(SOF_IPC_FRAME_S16_LE, 1);
+	struct comp_buffer *buf32 = test_buffer(SOF_IPC_FRAME_S32_LE, 1);
+	float in[4] = { 1.0f, -1.5f, 0.5f, -0.5f };
+	float ref16[4] = { 32767.0f / 32768.0f, -1.0f, 0.5f, -0.5f };
+	float ref32[4] = { 1.0f, -1.0f, 0.5f, -0.5f };
+	float out[4];
+	float *in_ptr = in;
+	float *out_ptr = out;
+	int32_t *sample;
+	int i;
+
+	(void)state;
+
+	assert_int_equal(sink_from_planar_float(test_sink(buf16), &in_ptr, 1, 4), 0);
+	assert_int_equal(source_to_planar_float(test_source(buf16), &out_ptr, 1, 4), 0);
+	for (i = 0; i < 4; i++)
+		assert_true(out[i] == ref16[i]);
+
+	/* full scale saturates to INT32_MAX, which reads back rounded to 1.0 */
+	assert_int_equal(sink_from_planar_float(test_sink(buf32), &in_ptr, 1, 4), 0);
+	sample = audio_stream_read_frag_s32(&buf32->stream, 0);
+	assert_int_equal(*sample, INT32_MAX);
+	assert_int_equal(source_to_planar_float(test_source(buf32), &out_ptr, 1, 4), 0);
+	for (i = 0; i < 4; i++)
+		assert_true(out[i] == ref32[i]);
+
+	buffer_free(buf16);
+	buffer_free(buf32);
+}
+
+static void test_planar_channel_mismatch(void **state)
+{
+	struct comp_buffer *buf = test_buffer(SOF_IPC_FRAME_S32_LE, 3);
+	int32_t in[2][4], out[3][4];
+	int32_t *in_ptrs[2] = { in[0], in[1] };
+	int32_t *out_ptrs[3] = { out[0], out[1], out[2] };
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < 4; i++) {
+		in[0][i] = i + 1;
+		in[1][i] = -i - 1;
+	}
+
+	/* the third sink channel is silent */
+	assert_int_equal(sink_from_planar_q31(test_sink(buf), in_ptrs, 2, 4), 0);
+	memset(out, 0x5a, sizeof(out));
+	assert_int_equal(source_to_planar_q31(test_source(buf), out_ptrs, 3, 2), 0);
+	assert_memory_equal(out[0], in[0], 2 * sizeof(int32_t));
+	assert_memory_equal(out[1], in[1], 2 * sizeof(int32_t));
+	assert_int_equal(out[2][0], 0);
+	assert_int_equal(out[2][1], 0);
+
+	/* the skipped source channel is still consumed */
+	out[2][2] = 0x5a5a5a5a;
+	assert_int_equal(source_to_planar_q31(test_source(buf), out_ptrs, 1, 2), 0);
+	assert_int_equal(out[0][0], 3);
+	assert_int_equal(out[0][1], 4);
+	assert_int_equal(out[2][2], 0x5a5a5a5a);
+	assert_int_equal(audio_stream_get_avail_frames(&buf->stream), 0);
+
+	buffer_free(buf);
+}
+
+static void test_planar_partial_frame(void **state)
+{
+	struct sof_ipc_buffer desc = { 0 };
+	struct comp_buffer *buf;
+	int32_t data[2][2] = { { 0 } };
+	int32_t *ptrs[2] = { data[0], data[1] };
+	size_t frame_bytes = get_frame_bytes(SOF_IPC_FRAME_S32_LE, 2);
+
+	(void)state;
+
+	/* a frame would wrap in the middle at the end of the buffer */
+	desc.size = TEST_FRAMES * frame_bytes + sizeof(int32_t);
+	buf = buffer_new(&desc, false);
+	assert_non_null(buf);
+	audio_stream_set_frm_fmt(&buf->stream, SOF_IPC_FRAME_S32_LE);
+	audio_stream_set_valid_fmt(&buf->stream, SOF_IPC_FRAME_S32_LE);
+	audio_stream_set_channels(&buf->stream, 2);
+	comp_update_buffer_produce(buf, TEST_FRAMES * frame_bytes);
+	comp_update_buffer_consume(buf, TEST_FRAMES * frame_bytes);
+
+	/* the sink and the source are released after the error */
+	assert_int_equal(sink_from_planar_q31(test_sink(buf), ptrs, 2, 2), -EINVAL);
+	assert_int_equal(sink_from_planar_q31(test_sink(buf), ptrs, 2, 2), -EINVAL);
+	assert_int_equal(audio_stream_get_avail_frames(&buf->stream), 0);
+
+	comp_update_buffer_produce(buf, 2 * frame_bytes);
+	assert_int_equal(source_to_planar_q31(test_source(buf), ptrs, 2, 2), -EINVAL);
+	assert_int_equal(source_to_planar_q31(test_source(buf), ptrs, 2, 2), -EINVAL);
+	assert_int_equal(audio_stream_get_avail_frames(&buf->stream), 2);
+
+	buffer_free(buf);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_planar_q31_s32_wrap),
+		cmocka_unit_test(test_planar_q31_s16),
+		cmocka_unit_test(test_planar_float_s24),
+		cmocka_unit_test(test_planar_float_s16_s32),
+		cmocka_unit_test(test_planar_channel_mismatch),
+		cmocka_unit_test(test_planar_partial_frame),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/buffer.h>
+#include <sof/audio/pcm_converter.h>
+#include <sof/common.h>
+#include <rtos/string.h>
+#include <ipc/stream.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#include <copier/copier_gain.h>
+
+#define TEST_MAX_CHANNELS	4
+#define TEST_PERIOD_FRAMES	48
+#define TEST_PERIODS		40
+#define TEST_SOURCE_FRAMES	(3 * TEST_PERIOD_FRAMES)
+#define TEST_SINK_FRAMES	(2 * TEST_PERIOD_FRAMES + 11)
+#define TEST_BACKLOG_FRAMES	13
+
+/* The gain sequence of a test run, the lengths are in frames */
+struct test_gain {
+	int16_t coeffs[MAX_GAIN_COEFFS_CNT];
+	uint32_t silence_length;
+	uint32_t fade_length;
+	uint32_t states;	/* bit mask of the gain states the run goes through */
+};
+
+static const struct test_gain test_gains[] = {
+	/* attenuation and boost that saturates */
+	{ { 0x0123, 0x0400 + 0x155, 0x1000, 0x7fff }, 0, 0, BIT(STATIC_GAIN) },
+	/* mute, fade in and then static gain as set up for a DMIC */
+	{ { 0x0200, 0x0300, 0x0500, 0x0700 }, 200, 600, BIT(MUTE) | BIT(TRANS_GAIN) |
+	  BIT(STATIC_GAIN) },
+};
+
+static uint32_t test_seed;
+
+/* Used by copier_update_params() of copier_generic.c, not tested here */
+void ipc4_update_buffer_format(struct comp_buffer *buf_c,
+			       const struct ipc4_audio_format *fmt)
+{
+}
+
+static int32_t test_rand(void)
+{
+	test_seed = test_seed * 1664525 + 1013904223;
+	return test_seed;
+}
+
+static struct comp_buffer *test_buffer(enum sof_ipc_frame fmt, int nch, int frames)
+{
+	struct sof_ipc_buffer desc = {
+		.size = frames * nch * (fmt == SOF_IPC_FRAME_S16_LE ? 2 : 4),
+	};
+	struct comp_buffer *buffer = buffer_new(&desc, false);
+
+	assert_non_null(buffer);
+	audio_stream_set_frm_fmt(&buffer->stream, fmt);
+	audio_stream_set_channels(&buffer->stream, nch);
+	return buffer;
+}
+
+/* Writes full scale noise to the buffer, the seed makes both runs equal */
+static void test_fill(struct comp_buffer *buffer, int frames, uint32_t seed)
+{
+	int bytes = frames * audio_stream_frame_bytes(&buffer->stream);
+	int i;
+
+	test_seed = seed;
+	for (i = 0; i < bytes; i += sizeof(int16_t))
+		*(int16_t *)audio_stream_write_frag(&buffer->stream, i, sizeof(int16_t)) =
+			test_rand() >> 16;
+
+	audio_stream_produce(&buffer->stream, bytes);
+}
+
+static void test_gain_params(struct copier_gain_params *params, const struct test_gain *gain,
+			     int nch)
+{
+	struct ipc4_base_module_cfg cfg = {
+		.audio_fmt.sampling_frequency = 48000,
+		.audio_fmt.channels_count = nch,
+	};
+	int i;
+
+	memset(params, 0, sizeof(*params));
+	copier_gain_set_basic_params(NULL, params, &cfg);
+	for (i = 0; i < MAX_GAIN_COEFFS_CNT; i++)
+		params->gain_coeffs[i] = gain->coeffs[i];
+
+	params->unity_gain = copier_is_unity_gain(params);
+	params->silence_sg_length = gain->silence_length;
+	if (gain->fade_length)
+		copier_gain_set_fade_params(NULL, params, &cfg, gain->fade_length, 1);
+	else
+		copier_gain_set_fade_params(NULL, params, &cfg, GAIN_ZERO_TRANS_MS, 1);
+}
+
+/*
+ * The two pass processing of dai_copy_with_gain(): the DMA converter and then
+ * the gain on the frames just copied, the sink can hold older frames.
+ */
+static void test_two_pass(struct comp_buffer *source, struct comp_buffer *sink,
+			  enum copier_gain_state state, struct copier_gain_params *params,
+			  int frames)
+{
+	enum sof_ipc_frame sink_fmt = audio_stream_get_frm_fmt(&sink->stream);
+	pcm_converter_func convert =
+		pcm_get_conversion_function(audio_stream_get_frm_fmt(&source->stream), sink_fmt);
+	const int nch = audio_stream_get_channels(&sink->stream);
+	void *rptr = audio_stream_get_rptr(&sink->stream);
+
+	assert_non_null(convert);
+	convert(&source->stream, 0, &sink->stream, 0, frames * nch, DUMMY_CHMAP);
+
+	audio_stream_set_rptr(&sink->stream, audio_stream_get_wptr(&sink->stream));
+	if (sink_fmt == SOF_IPC_FRAME_S16_LE)
+		assert_int_equal(copier_gain_input16(sink, state, GAIN_ADD, params, frames), 0);
+	else
+		assert_int_equal(copier_gain_input32(sink, state, GAIN_ADD, params, frames), 0);
+
+	audio_stream_set_rptr(&sink->stream, rptr);
+	audio_stream_produce(&sink->stream, frames * audio_stream_frame_bytes(&sink->stream));
+	audio_stream_consume(&source->stream, frames * audio_stream_frame_bytes(&source->stream));
+}
+
+/* Checks that only the frames written from wptr were changed in the sink */
+static void test_check_untouched(struct comp_buffer *sink, const uint8_t *before,
+				 uint8_t *wptr, int frames)
+{
+	uint8_t *addr = audio_stream_get_addr(&sink->stream);
+	int size = audio_stream_get_size(&sink->stream);
+	int start = wptr - addr;
+	int end = start + frames * audio_stream_frame_bytes(&sink->stream);
+	int i;
+
+	for (i = 0; i < size; i++) {
+		if ((i >= start && i < end) || i + size < end)
+			continue;
+
+		assert_int_equal(addr[i], before[i]);
+	}
+}
+
+static void test_gain_convert(enum sof_ipc_frame source_fmt, enum sof_ipc_frame sink_fmt,
+			      int nch, const struct test_gain *gain)
+{
+	uint8_t before[TEST_SINK_FRAMES * TEST_MAX_CHANNELS * sizeof(int32_t)];
+	struct copier_gain_params fused_params, params;
+	struct comp_buffer *fused_source = test_buffer(source_fmt, nch, TEST_SOURCE_FRAMES);
+	struct comp_buffer *fused_sink = test_buffer(sink_fmt, nch, TEST_SINK_FRAMES);
+	struct comp_buffer *source = test_buffer(source_fmt, nch, TEST_SOURCE_FRAMES);
+	struct comp_buffer *sink = test_buffer(sink_fmt, nch, TEST_SINK_FRAMES);
+	int source_frame_bytes = audio_stream_frame_bytes(&source->stream);
+	int sink_frame_bytes = audio_stream_frame_bytes(&sink->stream);
+	enum copier_gain_state state;
+	uint32_t states = 0;
+	uint8_t *wptr;
+	int frames;
+	int i;
+
+	test_gain_params(&fused_params, gain, nch);
+	test_gain_params(&params, gain, nch);
+
+	/* older frames that the sink component hasn't consumed yet */
+	test_fill(fused_sink, TEST_BACKLOG_FRAMES, 1);
+	test_fill(sink, TEST_BACKLOG_FRAMES, 1);
+
+	for (i = 0; i < TEST_PERIODS; i++) {
+		/* varying copy sizes wrap the buffers at different frames */
+		frames = (i * 7) % TEST_PERIOD_FRAMES + 1;
+		test_fill(fused_source, frames, i + 2);
+		test_fill(source, frames, i + 2);
+
+		state = copier_gain_eval_state(&params);
+		assert_int_equal(copier_gain_eval_state(&fused_params), state);
+		states |= BIT(state);
+
+		wptr = audio_stream_get_wptr(&fused_sink->stream);
+		memcpy_s(before, sizeof(before), audio_stream_get_addr(&fused_sink->stream),
+			 audio_stream_get_size(&fused_sink->stream));
+		assert_int_equal(copier_gain_convert(fused_source, fused_sink, state, GAIN_ADD,
+						     &fused_params, frames), 0);
+		audio_stream_produce(&fused_sink->stream, frames * sink_frame_bytes);
+		audio_stream_consume(&fused_source->stream, frames * source_frame_bytes);
+		test_check_untouched(fused_sink, before, wptr, frames);
+
+		test_two_pass(source, sink, state, &params, frames);
+
+		assert_memory_equal(audio_stream_get_addr(&fused_sink->stream),
+				    audio_stream_get_addr(&sink->stream),
+				    audio_stream_get_size(&sink->stream));
+		assert_int_equal(fused_params.silence_sg_count, params.silence_sg_count);
+		assert_int_equal(fused_params.fade_in_sg_count, params.fade_in_sg_count);
+		assert_true(fused_params.gain_env == params.gain_env);
+
+		/* the sink component leaves the older frames unconsumed */
+		frames = audio_stream_get_avail_frames(&sink->stream) - TEST_BACKLOG_FRAMES;
+		audio_stream_consume(&fused_sink->stream, frames * sink_frame_bytes);
+		audio_stream_consume(&sink->stream, frames * sink_frame_bytes);
+	}
+
+	assert_int_equal(states, gain->states);
+
+	buffer_free(fused_source);
+	buffer_free(fused_sink);
+	buffer_free(source);
+	buffer_free(sink);
+}
+
+static void test_gain_convert_formats(enum sof_ipc_frame source_fmt,
+				      enum sof_ipc_frame sink_fmt)
+{
+	int nch;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(test_gains); i++)
+		for (nch = 1; nch <= TEST_MAX_CHANNELS; nch++)
+			test_gain_convert(source_fmt, sink_fmt, nch, &test_gains[i]);
+}
+
+static void test_gain_convert_s16_s16(void **state)
+{
+	(void)state;
+
+	test_gain_convert_formats(SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S16_LE);
+}
+
+static void test_gain_convert_s16_s32(void **state)
+{
+	(void)state;
+
+	test_gain_convert_formats(SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S32_LE);
+}
+
+static void test_gain_convert_s32_s16(void **state)
+{
+	(void)state;
+
+	test_gain_convert_formats(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S16_LE);
+}
+
+static void test_gain_convert_s32_s32(void **state)
+{
+	(void)state;
+
+	test_gain_convert_formats(SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S32_LE);
+}
+
+static void test_gain_convert_unsupported(void **state)
+{
+	struct copier_gain_params params;
+	struct comp_buffer *source = test_buffer(SOF_IPC_FRAME_S32_LE, 2, TEST_SOURCE_FRAMES);
+	struct comp_buffer *sink = test_buffer(SOF_IPC_FRAME_S24_4LE, 2, TEST_SINK_FRAMES);
+
+	(void)state;
+
+	test_gain_params(&params, &test_gains[0], 2);
+	assert_int_equal(copier_gain_convert(source, sink, STATIC_GAIN, GAIN_ADD, &params, 8),
+			 -ENOTSUP);
+
+	/* a channel remap needs the two passes too */
+	audio_stream_set_frm_fmt(&sink->stream, SOF_IPC_FRAME_S32_LE);
+	audio_stream_set_channels(&sink->stream, 1);
+	assert_int_equal(copier_gain_convert(source, sink, STATIC_GAIN, GAIN_ADD, &params, 8),
+			 -ENOTSUP);
+
+	buffer_free(source);
+	buffer_free(sink);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_gain_convert_s16_s16),
+		cmocka_unit_test(test_gain_convert_s16_s32),
+		cmocka_unit_test(test_gain_convert_s32_s16),
+		cmocka_unit_test(test_gain_convert_s32_s32),
+		cmocka_unit_test(test_gain_convert_unsupported),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <cmocka.h>
+#include <sof/audio/audio_stream.h>
+#include <sof/audio/format.h>
+#include <rtos/alloc.h>
+#include <module/crossover/crossover_common.h>
+#include <sof/math/iir_df1.h>
+#include <sof/math/numbers.h>
+#include <rtos/string.h>
+#include <user/eq.h>
+
+#define TEST_FRAMES		300
+
+/* LR4 butterworth halves at 1 kHz for 48 kHz, a2 a1 b2 b1 b0 shift gain */
+static const int32_t test_lowpass[SOF_EQ_IIR_NBIQUAD] = {
+	-878423827, 1890997497, 1069518, 2139036, 1069518, 0, 16384
+};
+
+static const int32_t test_highpass[SOF_EQ_IIR_NBIQUAD] = {
+	-878423827, 1890997497, 504363443, -1008726886, 504363443, 0, 16384
+};
+
+/* the pass-through processing isn't tested */
+int audio_stream_copy(const struct audio_stream *source, uint32_t ioffset,
+		      struct audio_stream *sink, uint32_t ooffset, uint32_t samples)
+{
+	return -EINVAL;
+}
+
+struct test_lr4 {
+	int32_t coef[2 * SOF_EQ_IIR_NBIQUAD];
+	int32_t delay[CROSSOVER_NUM_DELAYS_LR4 * 2];
+};
+
+struct test_crossover {
+	struct crossover_state state;
+	struct test_lr4 lowpass[CROSSOVER_MAX_LR4];
+	struct test_lr4 highpass[CROSSOVER_MAX_LR4];
+};
+
+static void test_lr4_init(struct iir_state_df1 *iir, struct test_lr4 *lr4,
+			  const int32_t *coef, int32_t b0_scale)
+{
+	int i;
+
+	/* vary the gain of each filter to get different band signals */
+	for (i = 0; i < 2; i++) {
+		memcpy_s(&lr4->coef[i * SOF_EQ_IIR_NBIQUAD], sizeof(test_lowpass),
+			 coef, sizeof(test_lowpass));
+		lr4->coef[i * SOF_EQ_IIR_NBIQUAD + 6] -= b0_scale;
+	}
+
+	memset(lr4->delay, 0, sizeof(lr4->delay));
+	iir->coef = lr4->coef;
+	iir->delay = lr4->delay;
+	iir->biquads = 2;
+	iir->biquads_in_series = 2;
+}
+
+static void test_crossover_init(struct test_crossover *xo)
+{
+	int i;
+
+	for (i = 0; i < CROSSOVER_MAX_LR4; i++) {
+		test_lr4_init(&xo->state.lowpass[i], &xo->lowpass[i], test_lowpass, 100 * i);
+		test_lr4_init(&xo->state.highpass[i], &xo->highpass[i], test_highpass, 50 * i);
+	}
+}
+
+static void test_split_block(int num_sinks)
+{
+	static struct test_crossover ref, block;
+	int32_t bands[SOF_CROSSOVER_MAX_STREAMS][TEST_FRAMES];
+	int32_t *out[SOF_CROSSOVER_MAX_STREAMS];
+	int32_t x[TEST_FRAMES];
+	int32_t in[TEST_FRAMES];
+	int32_t y[SOF_CROSSOVER_MAX_STREAMS];
+	crossover_split split = crossover_find_split_func(num_sinks);
+	crossover_split_block split_block = crossover_find_split_block_func(num_sinks);
+	int i, j, n;
+
+	assert_non_null(split);
+	assert_non_null(split_block);
+
+	test_crossover_init(&ref);
+	test_crossover_init(&block);
+
+	/* full scale noise to exercise the saturation too */
+	for (i = 0; i < TEST_FRAMES; i++)
+		x[i] = (int32_t)((uint32_t)rand() << 16 ^ (uint32_t)rand());
+
+	for (j = 0; j < SOF_CROSSOVER_MAX_STREAMS; j++)
+		out[j] = bands[j];
+
+	/* blocks of varying size with the outputs at their place */
+	for (i = 0, n = 1; i < TEST_FRAMES; i += n, n = n % 23 + 1) {
+		n = MIN(n, TEST_FRAMES - i);
+		memcpy_s(in, sizeof(in), &x[i], n * sizeof(int32_t));
+		split_block(in, out, n, &block.state);
+		for (j = 0; j < num_sinks; j++)
+			out[j] += n;
+	}
+
+	for (i = 0; i < TEST_FRAMES; i++) {
+		split(x[i], y, &ref.state);
+		for (j = 0; j < num_sinks; j++)
+			assert_int_equal(bands[j][i], y[j]);
+	}
+}
+
+static void test_crossover_2way(void **state)
+{
+	(void)state;
+
+	test_split_block(CROSSOVER_2WAY_NUM_SINKS);
+}
+
+static void test_crossover_3way(void **state)
+{
+	(void)state;
+
+	test_split_block(CROSSOVER_3WAY_NUM_SINKS);
+}
+
+static void test_crossover_4way(void **state)
+{
+	(void)state;
+
+	test_split_block(CROSSOVER_4WAY_NUM_SINKS);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_crossover_2way),
+		cmocka_unit_test(test_crossover_3way),
+		cmocka_unit_test(test_crossover_4way),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include <sof/math/fir_generic.h>
+#include <rtos/string.h>
+#include <user/fir.h>
+
+#define TEST_MAX_TAPS		64
+#define TEST_SAMPLES		1000
+
+struct test_filter {
+	struct sof_fir_coef_data config;
+	int16_t coef[TEST_MAX_TAPS];
+};
+
+static struct test_filter test_filter;
+static int32_t test_delay[2 * (TEST_MAX_TAPS + 4)];
+static int32_t test_x[TEST_SAMPLES];
+
+static void test_init(struct fir_state_32x16 *fir, int taps, int out_shift, int16_t amplitude)
+{
+	int32_t *delay = test_delay;
+	int i;
+
+	test_filter.config.length = taps;
+	test_filter.config.out_shift = out_shift;
+	for (i = 0; i < taps; i++)
+		test_filter.coef[i] = (rand() % (2 * amplitude + 1)) - amplitude;
+
+	memset(test_delay, 0, sizeof(test_delay));
+	assert_int_equal(fir_delay_size(&test_filter.config), 2 * (taps + 4) * sizeof(int32_t));
+	fir_init_coef(fir, &test_filter.config);
+	fir_init_delay(fir, &delay);
+
+	for (i = 0; i < TEST_SAMPLES; i++)
+		test_x[i] = (int32_t)((uint32_t)rand() << 16 ^ (uint32_t)rand());
+}
+
+/* Direct form convolution with the rounding and saturation of the FIR core */
+static int32_t test_ref(int n, int taps, int out_shift)
+{
+	int64_t y = 0;
+	int i;
+
+	for (i = 0; i < taps && i <= n; i++)
+		y += (int64_t)test_filter.coef[i] * test_x[n - i];
+
+	y >>= 15 + out_shift;
+	if (y > INT32_MAX)
+		return INT32_MAX;
+	if (y < INT32_MIN)
+		return INT32_MIN;
+
+	return y;
+}
+
+static void test_block_sizes(int taps, int out_shift, int16_t amplitude)
+{
+	struct fir_state_32x16 fir;
+	int32_t y[TEST_SAMPLES];
+	int i, n, m;
+
+	test_init(&fir, taps, out_shift, amplitude);
+
+	/* block sizes with all tail lengths, the delay line wraps many times */
+	for (i = 0, m = 1; i < TEST_SAMPLES; i += n, m = m % 13 + 1) {
+		n = MIN(m, TEST_SAMPLES - i);
+		fir_32x16_block(&fir, &test_x[i], &y[i], n);
+	}
+
+	for (i = 0; i < TEST_SAMPLES; i++)
+		assert_int_equal(y[i], test_ref(i, taps, out_shift));
+}
+
+static void test_fir_block(void **state)
+{
+	(void)state;
+
+	test_block_sizes(4, 0, 32767);
+	test_block_sizes(16, 2, 32767);
+	test_block_sizes(TEST_MAX_TAPS, 0, 4000);
+}
+
+static void test_fir_block_saturate(void **state)
+{
+	(void)state;
+
+	/* large coefficients with no output shift saturate often */
+	test_block_sizes(8, 0, 32767);
+}
+
+static void test_fir_block_in_place(void **state)
+{
+	struct fir_state_32x16 fir;
+	int32_t y[TEST_SAMPLES];
+	int i;
+
+	(void)state;
+
+	test_init(&fir, 20, 1, 16000);
+	memcpy_s(y, sizeof(y), test_x, sizeof(test_x));
+	fir_32x16_block(&fir, y, y, 333);
+	fir_32x16_block(&fir, &y[333], &y[333], TEST_SAMPLES - 333);
+	for (i = 0; i < TEST_SAMPLES; i++)
+		assert_int_equal(y[i], test_ref(i, 20, 1));
+}
+
+static void test_fir_block_mixed(void **state)
+{
+	struct fir_state_32x16 fir;
+	int32_t y[TEST_SAMPLES];
+	int i;
+
+	(void)state;
+
+	/* the single and dual sample versions share the delay line */
+	test_init(&fir, 12, 0, 8000);
+	for (i = 0; i + 7 <= TEST_SAMPLES; i += 7) {
+		y[i] = fir_32x16(&fir, test_x[i]);
+		fir_32x16_2x(&fir, test_x[i + 1], test_x[i + 2], &y[i + 1], &y[i + 2]);
+		fir_32x16_block(&fir, &test_x[i + 3], &y[i + 3], 4);
+	}
+
+	for (i = 0; i + 7 <= TEST_SAMPLES; i++)
+		assert_int_equal(y[i], test_ref(i, 12, 0));
+}
+
+static void test_fir_block_bypass(void **state)
+{
+	struct fir_state_32x16 fir;
+	int32_t y[TEST_SAMPLES];
+
+	(void)state;
+
+	test_init(&fir, 4, 0, 100);
+	fir_reset(&fir);
+	fir_32x16_block(&fir, test_x, y, TEST_SAMPLES);
+	assert_memory_equal(y, test_x, sizeof(y));
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_fir_block),
+		cmocka_unit_test(test_fir_block_saturate),
+		cmocka_unit_test(test_fir_block_in_place),
+		cmocka_unit_test(test_fir_block_mixed),
+		cmocka_unit_test(test_fir_block_bypass),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <errno.h>
+#include <cmocka.h>
+#include <sof/audio/format.h>
+#include <sof/math/numbers.h>
+#include <rtos/string.h>
+#include <limiter/limiter.h>
+#include <user/limiter.h>
+
+#define TEST_RATE		48000
+#define TEST_MAX_FRAMES		3000
+#define TEST_MAX_CHANNELS	2
+#define TEST_RING_FRAMES	19
+
+static int32_t test_in[TEST_MAX_FRAMES * TEST_MAX_CHANNELS];
+static int32_t test_out[TEST_MAX_FRAMES * TEST_MAX_CHANNELS];
+
+static uint32_t test_seed;
+
+static int32_t test_rand(int32_t amplitude)
+{
+	test_seed = test_seed * 1664525 + 1013904223;
+	return ((int64_t)(int32_t)test_seed * amplitude) >> 31;
+}
+
+/*
+ * Runs the frames in chunks of varying length through circular source and
+ * sink buffers that wrap at different points than the delay line.
+ */
+static void test_run(struct limiter_state *state, const void *in, void *out,
+		     int frames, int frame_bytes)
+{
+	uint8_t x[TEST_RING_FRAMES * TEST_MAX_CHANNELS * sizeof(int32_t)];
+	uint8_t y[TEST_RING_FRAMES * TEST_MAX_CHANNELS * sizeof(int32_t)];
+	uint8_t *x_end = x + TEST_RING_FRAMES * frame_bytes;
+	uint8_t *y_end = y + TEST_RING_FRAMES * frame_bytes;
+	int chunk = 1;
+	int pos = 0;
+	int done;
+	int n;
+	int i;
+
+	for (done = 0; done < frames; done += n) {
+		n = MIN(chunk, frames - done);
+		chunk = chunk % 13 + 2;
+		for (i = 0; i < n; i++)
+			memcpy_s(x + (pos + i) % TEST_RING_FRAMES * frame_bytes, frame_bytes,
+				 (const uint8_t *)in + (done + i) * frame_bytes, frame_bytes);
+
+		state->func(state, x + pos * frame_bytes, x, x_end,
+			    y + pos * frame_bytes, y, y_end, n);
+
+		for (i = 0; i < n; i++)
+			memcpy_s((uint8_t *)out + (done + i) * frame_bytes, frame_bytes,
+				 y + (pos + i) % TEST_RING_FRAMES * frame_bytes, frame_bytes);
+
+		pos = (pos + n) % TEST_RING_FRAMES;
+	}
+}
+
+static void test_limiter_unity_s16(void **state)
+{
+	struct limiter_state limiter = { 0 };
+	int16_t *in = (int16_t *)test_in;
+	int16_t *out = (int16_t *)test_out;
+	const int nch = 2;
+	const int frames = 1000;
+	const int delay = 48; /* default 1 ms look-ahead */
+	int i;
+
+	(void)state;
+
+	test_seed = 1;
+	for (i = 0; i < frames * nch; i++)
+		in[i] = test_rand(16000);
+
+	assert_int_equal(limiter_setup(&limiter, NULL, nch, SOF_IPC_FRAME_S16_LE, TEST_RATE), 0);
+	test_run(&limiter, in, out, frames, nch * sizeof(int16_t));
+
+	/* below the -1 dBFS default threshold the output is the delayed input */
+	for (i = 0; i < delay * nch; i++)
+		assert_int_equal(out[i], 0);
+
+	for (i = delay * nch; i < frames * nch; i++)
+		assert_int_equal(out[i], in[i - delay * nch]);
+
+	limiter_free_buffers(&limiter);
+}
+
+static void test_limiter_burst_s32(void **state)
+{
+	struct sof_limiter_config config = {
+		.size = sizeof(config),
+		.threshold = 1 << 30,
+		.lookahead_us = 500,
+		.release_us = 1000,
+	};
+	struct limiter_state limiter = { 0 };
+	const int nch = 2;
+	const int frames = 3000;
+	const int delay = 24;
+	int32_t peak = 0;
+	int32_t s;
+	int i;
+
+	(void)state;
+
+	/* quiet, full scale, and quiet again noise */
+	test_seed = 2;
+	for (i = 0; i < frames * nch; i++)
+		test_in[i] = test_rand(i >= 200 * nch && i < 600 * nch ? INT32_MAX : 1 << 28);
+
+	test_in[300 * nch] = INT32_MIN;
+	test_in[301 * nch + 1] = INT32_MAX;
+
+	assert_int_equal(limiter_setup(&limiter, &config, nch, SOF_IPC_FRAME_S32_LE,
+				       TEST_RATE), 0);
+	test_run(&limiter, test_in, test_out, frames, nch * sizeof(int32_t));
+
+	for (i = 0; i < frames * nch; i++) {
+		s = test_out[i];
+		assert_true(s <= config.threshold && s >= -config.threshold);
+		peak = MAX(peak, ABS(s));
+	}
+
+	/* the burst is limited, not muted */
+	assert_true(peak > config.threshold / 10 * 9);
+
+	/* after the release the gain is unity again */
+	for (i = (frames - 500) * nch; i < frames * nch; i++)
+		assert_int_equal(test_out[i], test_in[i - delay * nch]);
+
+	limiter_free_buffers(&limiter);
+}
+
+static void test_limiter_step_s24(void **state)
+{
+	struct limiter_state limiter = { 0 };
+	const int32_t threshold = LIMITER_DEFAULT_THRESHOLD >> 8;
+	const int frames = 400;
+	const int delay = 48;
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < frames; i++)
+		test_in[i] = i < 100 ? 0 : INT24_MAXVALUE;
+
+	assert_int_equal(limiter_setup(&limiter, NULL, 1, SOF_IPC_FRAME_S24_4LE, TEST_RATE), 0);
+	test_run(&limiter, test_in, test_out, frames, sizeof(int32_t));
+
+	/* the first sample of the step is already attenuated */
+	for (i = 0; i < frames; i++)
+		assert_true(test_out[i] >= 0 && test_out[i] <= threshold);
+
+	assert_int_equal(test_out[100 + delay - 1], 0);
+	assert_true(test_out[100 + delay] > 0);
+
+	/* then the output settles to the threshold */
+	for (i = 100 + 2 * delay + 1; i < frames; i++)
+		assert_true(test_out[i] > threshold - 16);
+
+	limiter_free_buffers(&limiter);
+}
+
+static void test_limiter_negative_s16(void **state)
+{
+	struct limiter_state limiter = { 0 };
+	int16_t *in = (int16_t *)test_in;
+	int16_t *out = (int16_t *)test_out;
+	const int32_t threshold = LIMITER_DEFAULT_THRESHOLD >> 16;
+	const int frames = 400;
+	const int delay = 48;
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < frames; i++)
+		in[i] = i < 100 ? 0 : INT16_MIN;
+
+	assert_int_equal(limiter_setup(&limiter, NULL, 1, SOF_IPC_FRAME_S16_LE, TEST_RATE), 0);
+	test_run(&limiter, in, out, frames, sizeof(int16_t));
+
+	/* negative full scale is limited like positive, the arithmetic
+	 * shift of the gain product can round one LSB below -threshold
+	 */
+	for (i = 0; i < frames; i++)
+		assert_true(out[i] <= 0 && out[i] >= -threshold - 1);
+
+	assert_int_equal(out[100 + delay - 1], 0);
+	assert_true(out[100 + delay] < 0);
+
+	for (i = 100 + 2 * delay + 1; i < frames; i++)
+		assert_true(out[i] < -threshold + 2);
+
+	limiter_free_buffers(&limiter);
+}
+
+static void test_limiter_config(void **state)
+{
+	struct sof_limiter_config config = {
+		.size = sizeof(config),
+		.threshold = LIMITER_DEFAULT_THRESHOLD,
+		.lookahead_us = LIMITER_DEFAULT_LOOKAHEAD_US,
+		.release_us = LIMITER_DEFAULT_RELEASE_US,
+	};
+	struct limiter_state limiter = { 0 };
+
+	(void)state;
+
+	assert_int_equal(limiter_setup(&limiter, &config, 2, SOF_IPC_FRAME_U8, TEST_RATE),
+			 -EINVAL);
+
+	config.threshold = 0;
+	assert_int_equal(limiter_setup(&limiter, &config, 2, SOF_IPC_FRAME_S32_LE, TEST_RATE),
+			 -EINVAL);
+
+	config.threshold = INT32_MAX;
+	config.lookahead_us = 100000;
+	assert_int_equal(limiter_setup(&limiter, &config, 2, SOF_IPC_FRAME_S32_LE, TEST_RATE),
+			 -EINVAL);
+
+	/* zero look-ahead still gets one frame of delay */
+	config.lookahead_us = 0;
+	config.release_us = 0;
+	assert_int_equal(limiter_setup(&limiter, &config, 2, SOF_IPC_FRAME_S32_LE, TEST_RATE), 0);
+	assert_int_equal(limiter.window, 2);
+	assert_int_equal(limiter.release, INT32_MAX);
+	limiter_free_buffers(&limiter);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_limiter_unity_s16),
+		cmocka_unit_test(test_limiter_burst_s32),
+		cmocka_unit_test(test_limiter_step_s24),
+		cmocka_unit_test(test_limiter_negative_s16),
+		cmocka_unit_test(test_limiter_config),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
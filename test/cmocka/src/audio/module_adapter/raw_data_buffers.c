@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/audio/module_adapter/module/generic.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <string.h>
+#include <cmocka.h>
+
+#define RING_SIZE	16
+
+static void test_module_input_read(void **state)
+{
+	uint8_t ring[RING_SIZE];
+	uint8_t out[8];
+	struct input_stream_buffer input = { 0 };
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < RING_SIZE; i++)
+		ring[i] = i;
+
+	/* 8 bytes starting at 12, wrapping to the start of the ring */
+	input.data = ring + 12;
+	input.size = 8;
+	input.head_size = 4;
+	input.wrap_data = ring;
+
+	module_input_read(&input, 0, out, 8);
+	for (i = 0; i < 8; i++)
+		assert_int_equal(out[i], (12 + i) % RING_SIZE);
+
+	/* read crossing the wrap from an offset */
+	module_input_read(&input, 2, out, 4);
+	for (i = 0; i < 4; i++)
+		assert_int_equal(out[i], (14 + i) % RING_SIZE);
+
+	/* read fully after the wrap */
+	module_input_read(&input, 5, out, 3);
+	for (i = 0; i < 3; i++)
+		assert_int_equal(out[i], 1 + i);
+
+	/* linear buffer */
+	input.data = ring + 2;
+	input.wrap_data = NULL;
+	module_input_read(&input, 1, out, 8);
+	for (i = 0; i < 8; i++)
+		assert_int_equal(out[i], 3 + i);
+}
+
+static void test_module_output_write(void **state)
+{
+	uint8_t ring[RING_SIZE];
+	uint8_t in[8];
+	struct output_stream_buffer output = { 0 };
+	int i;
+
+	(void)state;
+
+	memset(ring, 0xff, sizeof(ring));
+	for (i = 0; i < 8; i++)
+		in[i] = 100 + i;
+
+	/* 10 free bytes starting at 10, wrapping to the start of the ring */
+	output.data = ring + 10;
+	output.head_size = 6;
+	output.free = 10;
+	output.wrap_data = ring;
+
+	assert_int_equal(module_output_write(&output, in, 4), 4);
+	assert_int_equal(module_output_write(&output, in + 4, 4), 4);
+	assert_int_equal(output.size, 8);
+	for (i = 0; i < 6; i++)
+		assert_int_equal(ring[10 + i], 100 + i);
+	assert_int_equal(ring[0], 106);
+	assert_int_equal(ring[1], 107);
+
+	/* the write is limited to the free space */
+	assert_int_equal(module_output_write(&output, in, 8), 2);
+	assert_int_equal(output.size, 10);
+	assert_int_equal(ring[2], 100);
+	assert_int_equal(ring[3], 101);
+	assert_int_equal(ring[4], 0xff);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_module_input_read),
+		cmocka_unit_test(test_module_output_write),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
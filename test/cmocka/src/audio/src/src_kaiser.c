@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/lib/memory.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <cmocka.h>
+
+#include "src_common.h"
+#include "coef/src_ipc4_int32_define.h"
+#include "coef/src_ipc4_int32_table.h"
+#include "src_kaiser_test.h"
+
+/*
+ * Largest accepted difference to the table. The single precision generator
+ * is within a few float ULPs of the 2^30 magnitude center taps. The largest
+ * measured difference is 1112 LSB, about -125 dBFS, the limit leaves a
+ * margin of about 15% for other float implementations.
+ */
+#define TEST_MAX_ERROR	1280
+
+/* generated coefficients of the stage, the largest error to the table */
+static int test_stage(const struct src_stage *ref, const struct src_stage *gen)
+{
+	size_t size = ref->filter_length * sizeof(int32_t);
+	int32_t *coefs;
+	int max_error = 0;
+	int i;
+
+	assert_int_equal(gen->idm, ref->idm);
+	assert_int_equal(gen->odm, ref->odm);
+	assert_int_equal(gen->num_of_subfilters, ref->num_of_subfilters);
+	assert_int_equal(gen->subfilter_length, ref->subfilter_length);
+	assert_int_equal(gen->filter_length, ref->filter_length);
+	assert_int_equal(gen->blk_in, ref->blk_in);
+	assert_int_equal(gen->blk_out, ref->blk_out);
+	assert_int_equal(gen->halfband, ref->halfband);
+	assert_int_equal(gen->shift, ref->shift);
+	assert_null(gen->coefs);
+	assert_non_null(gen->kaiser);
+
+	coefs = malloc(size);
+	assert_non_null(coefs);
+	assert_int_equal(src_kaiser_generate(coefs, size, gen), 0);
+
+	for (i = 0; i < ref->filter_length; i++)
+		max_error = MAX(max_error, abs(coefs[i] - ((const int32_t *)ref->coefs)[i]));
+
+	free(coefs);
+	return max_error;
+}
+
+static void test_src_kaiser_tables(void **state)
+{
+	const struct src_stage *ref, *gen;
+	int worst = 0;
+	int stages = 0;
+	int error;
+	int table, i, j;
+
+	(void)state;
+
+	for (i = 0; i < NUM_IN_FS; i++)
+		assert_int_equal(test_kaiser_in_fs(i), src_in_fs[i]);
+
+	for (i = 0; i < NUM_OUT_FS; i++)
+		assert_int_equal(test_kaiser_out_fs(i), src_out_fs[i]);
+
+	for (table = 1; table <= 2; table++) {
+		for (i = 0; i < NUM_OUT_FS; i++) {
+			for (j = 0; j < NUM_IN_FS; j++) {
+				ref = table == 1 ? src_table1[i][j] : src_table2[i][j];
+				gen = test_kaiser_stage(table, i, j);
+
+				/* pass-through and unsupported stages stay as tables */
+				if (!gen->kaiser) {
+					assert_int_equal(gen->filter_length, ref->filter_length);
+					if (ref->filter_length)
+						assert_memory_equal(gen->coefs, ref->coefs,
+								    ref->filter_length *
+								    sizeof(int32_t));
+					continue;
+				}
+
+				error = test_stage(ref, gen);
+				if (error > TEST_MAX_ERROR)
+					print_message("stage %d %d -> %d max error %d\n", table,
+						      src_in_fs[j], src_out_fs[i], error);
+
+				assert_true(error <= TEST_MAX_ERROR);
+				worst = MAX(worst, error);
+				stages++;
+			}
+		}
+	}
+
+	print_message("%d generated table entries, max error %d LSB\n", stages, worst);
+}
+
+static void test_src_kaiser_invalid(void **state)
+{
+	const struct src_stage *gen = test_kaiser_stage(1, 0, 1);
+	int32_t coefs[4];
+
+	(void)state;
+
+	assert_non_null(gen->kaiser);
+	assert_int_equal(src_kaiser_generate(coefs, sizeof(coefs), gen), -EINVAL);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_src_kaiser_tables),
+		cmocka_unit_test(test_src_kaiser_invalid),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/*
+ * The Kaiser design header uses the same names as the coefficient tables,
+ * so it's built in its own translation unit.
+ */
+
+#include <sof/lib/memory.h>
+#include <stdint.h>
+
+#include "src_common.h"
+#include "coef/src_ipc4_int32_kaiser.h"
+#include "src_kaiser_test.h"
+
+const struct src_stage *test_kaiser_stage(int table, int i, int j)
+{
+	return table == 1 ? src_table1[i][j] : src_table2[i][j];
+}
+
+int test_kaiser_in_fs(int i)
+{
+	return src_in_fs[i];
+}
+
+int test_kaiser_out_fs(int i)
+{
+	return src_out_fs[i];
+}
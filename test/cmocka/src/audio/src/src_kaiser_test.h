@@ -0,0 +1,16 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2026 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __TEST_SRC_KAISER_TEST_H__
+#define __TEST_SRC_KAISER_TEST_H__
+
+struct src_stage;
+
+/* stage of src_table1 or src_table2 of the Kaiser design header */
+const struct src_stage *test_kaiser_stage(int table, int i, int j);
+int test_kaiser_in_fs(int i);
+int test_kaiser_out_fs(int i);
+
+#endif /* __TEST_SRC_KAISER_TEST_H__ */
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/lib/memory.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <cmocka.h>
+
+#include "src_common.h"
+#include "coef/src_ipc4_int32_1_3_4535_5000.h"
+#include "coef/src_voice_int16_define.h"
+#include "coef/src_voice_int16_table.h"
+
+#define TEST_BLOCKS		4800
+#define TEST_FREQ		997.0
+#define TEST_SKIP		1000
+#define TEST_MAX_THDN_DB	-80.0	/* thdnf_db_max of src_test.m */
+
+/* Length of the voice set test signal and the part of the output skipped */
+#define TEST_VOICE_SECONDS	0.5
+#define TEST_VOICE_SKIP		0.1
+#define TEST_VOICE_STEP		1.2599	/* third octave */
+
+/* Runs a single stage conversion of the input with a kernel */
+static int32_t *test_stage(const struct src_stage *stage, const int32_t *x, int in_samples,
+			   int *out_samples, void (*func)(struct src_stage_prm *s))
+{
+	int times = in_samples / stage->blk_in;
+	struct src_stage_prm s = { 0 };
+	struct src_state state = { 0 };
+	int32_t *y;
+
+	*out_samples = times * stage->blk_out;
+	y = malloc(*out_samples * sizeof(int32_t));
+	assert_non_null(y);
+
+	state.fir_delay_size = src_fir_delay_length(stage);
+	state.out_delay_size = src_out_delay_length(stage);
+	state.fir_delay = calloc(state.fir_delay_size, sizeof(int32_t));
+	state.out_delay = calloc(state.out_delay_size, sizeof(int32_t));
+	assert_non_null(state.fir_delay);
+	assert_non_null(state.out_delay);
+	state.fir_wp = &state.fir_delay[state.fir_delay_size - 1];
+	state.out_rp = state.out_delay;
+
+	s.nch = 1;
+	s.times = times;
+	s.x_rptr = (int32_t *)x;
+	s.x_end_addr = (int32_t *)x + in_samples;
+	s.x_size = in_samples * sizeof(int32_t);
+	s.y_wptr = y;
+	s.y_addr = y;
+	s.y_end_addr = y + *out_samples;
+	s.y_size = *out_samples * sizeof(int32_t);
+	s.state = &state;
+	s.stage = stage;
+
+	func(&s);
+
+	free(state.fir_delay);
+	free(state.out_delay);
+	return y;
+}
+
+/* A -1 dBFS sine */
+static int32_t *test_sine(double freq, int fs, int n)
+{
+	int32_t *x = malloc(n * sizeof(int32_t));
+	int i;
+
+	assert_non_null(x);
+	for (i = 0; i < n; i++)
+		x[i] = (int32_t)(0.891 * INT32_MAX * sin(2 * M_PI * freq * i / fs));
+
+	return x;
+}
+
+/* Runs the single stage conversion of a -1 dBFS sine with a kernel */
+static int32_t *test_convert(const struct src_stage *stage, int fs_in,
+			     void (*func)(struct src_stage_prm *s))
+{
+	int in_samples = TEST_BLOCKS * stage->blk_in;
+	int32_t *x = test_sine(TEST_FREQ, fs_in, in_samples);
+	int32_t *y;
+	int n;
+
+	y = test_stage(stage, x, in_samples, &n, func);
+	free(x);
+	return y;
+}
+
+/*
+ * THD+N of the output, the residual of a least squares fit of the test
+ * frequency sine relative to the sine. The start with the filter delay is
+ * skipped.
+ */
+static double test_thdn(const int32_t *y, int skip, int n, double freq, int fs)
+{
+	double ss = 0, cc = 0, sc = 0, ys = 0, yc = 0;
+	double a, b, det, w, e;
+	double signal = 0;
+	double noise = 0;
+	int i;
+
+	for (i = skip; i < n; i++) {
+		w = 2 * M_PI * freq * i / fs;
+		ss += sin(w) * sin(w);
+		cc += cos(w) * cos(w);
+		sc += sin(w) * cos(w);
+		ys += y[i] * sin(w);
+		yc += y[i] * cos(w);
+	}
+
+	det = ss * cc - sc * sc;
+	a = (ys * cc - yc * sc) / det;
+	b = (yc * ss - ys * sc) / det;
+
+	for (i = skip; i < n; i++) {
+		w = 2 * M_PI * freq * i / fs;
+		e = a * sin(w) + b * cos(w);
+		signal += e * e;
+		noise += (y[i] - e) * (y[i] - e);
+	}
+
+	return 10 * log10(noise / signal);
+}
+
+static void test_src_short_thdn(const struct src_stage *stage32,
+				const struct src_stage *stage16, int fs_in)
+{
+	int32_t *y32 = test_convert(stage32, fs_in, src_polyphase_stage_cir);
+	int32_t *y16 = test_convert(stage16, fs_in, src_polyphase_stage_cir_c16);
+	int n = TEST_BLOCKS * stage32->blk_out;
+	int fs_out = fs_in * stage32->num_of_subfilters / stage32->blk_in;
+	double thdn32 = test_thdn(y32, TEST_SKIP, n, TEST_FREQ, fs_out);
+	double thdn16 = test_thdn(y16, TEST_SKIP, n, TEST_FREQ, fs_out);
+
+	print_message("%d -> %d Hz THD+N, 32-bit coefficients %.1f dB, 16-bit %.1f dB\n",
+		      fs_in, fs_out, thdn32, thdn16);
+	assert_true(thdn16 < TEST_MAX_THDN_DB);
+
+	free(y32);
+	free(y16);
+}
+
+static void test_src_short_48_to_16(void **state)
+{
+	(void)state;
+
+	test_src_short_thdn(&src_int32_1_3_4535_5000, &src_int16_1_3_4535_5000, 48000);
+}
+
+/* The copy stage of single stage conversions isn't run by the SRC */
+static bool test_is_copy(const struct src_stage *stage)
+{
+	return stage->num_of_subfilters == 1 && stage->filter_length == 1;
+}
+
+/*
+ * Worst THD+N of a conversion of the voice set, measured with sines from
+ * 50 Hz up to 0.43 times the lower rate in third octave steps.
+ */
+static double test_voice_thdn(int idx_in, int idx_out)
+{
+	const struct src_stage *stage[2] = {
+		src_table1[idx_out][idx_in], src_table2[idx_out][idx_in]
+	};
+	int fs_in = src_in_fs[idx_in];
+	int fs_out = src_out_fs[idx_out];
+	double f_max = 0.43 * MIN(fs_in, fs_out);
+	double worst = -200.0;
+	double freq;
+	int32_t *x, *y;
+	int n, j;
+
+	for (freq = 50.0; freq < f_max; freq *= TEST_VOICE_STEP) {
+		n = TEST_VOICE_SECONDS * fs_in;
+		x = test_sine(freq, fs_in, n);
+		for (j = 0; j < ARRAY_SIZE(stage); j++) {
+			if (test_is_copy(stage[j]))
+				continue;
+
+			y = test_stage(stage[j], x, n, &n, src_polyphase_stage_cir_c16);
+			free(x);
+			x = y;
+		}
+
+		worst = MAX(worst, test_thdn(x, TEST_VOICE_SKIP * fs_out, n, freq, fs_out));
+		free(x);
+	}
+
+	return worst;
+}
+
+static void test_src_short_voice_set(void **state)
+{
+	double thdn;
+	int i, j;
+
+	(void)state;
+
+	for (j = 0; j < NUM_OUT_FS; j++) {
+		for (i = 0; i < NUM_IN_FS; i++) {
+			/* unsupported conversions and the copy */
+			if (!src_table1[j][i]->filter_length ||
+			    src_in_fs[i] == src_out_fs[j])
+				continue;
+
+			thdn = test_voice_thdn(i, j);
+			print_message("%d -> %d Hz worst THD+N %.1f dB\n",
+				      src_in_fs[i], src_out_fs[j], thdn);
+			assert_true(thdn < TEST_MAX_THDN_DB);
+		}
+	}
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_src_short_48_to_16),
+		cmocka_unit_test(test_src_short_voice_set),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
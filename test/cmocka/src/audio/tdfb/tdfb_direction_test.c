@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmocka.h>
+
+#include <sof/math/numbers.h>
+#include <tdfb/tdfb.h>
+#include <tdfb/tdfb_comp.h>
+
+#define TEST_FS			48000
+#define TEST_PERIOD		48
+#define TEST_PERIODS		200
+#define TEST_NUM_MICS		4
+#define TEST_SOURCE_DISTANCE	3.0	/* meters */
+#define TEST_AMPLITUDE		0.25
+#define TEST_TOLERANCE_DEG	2.0
+
+/* Fractional delay filter length */
+#define TEST_FD_TAPS		33
+#define TEST_FD_HALF		(TEST_FD_TAPS / 2)
+#define TEST_NOISE_LENGTH	(TEST_PERIOD * TEST_PERIODS + 2 * TEST_FD_TAPS + 64)
+
+/* Microphone coordinates in meters */
+struct test_array {
+	const char *name;
+	double x[TEST_NUM_MICS];
+	double y[TEST_NUM_MICS];
+	bool line_array;
+};
+
+/* Line array of four microphones along y-axis with 40 mm spacing */
+static const struct test_array line_array = {
+	.name = "line",
+	.x = {0, 0, 0, 0},
+	.y = {-0.06, -0.02, 0.02, 0.06},
+	.line_array = true,
+};
+
+/* Circular array of four microphones with 50 mm radius */
+static const struct test_array circular_array = {
+	.name = "circular",
+	.x = {0.05, 0, -0.05, 0},
+	.y = {0, 0.05, 0, -0.05},
+	.line_array = false,
+};
+
+/* Deterministic white noise in range -1.0 .. +1.0 */
+static double test_rand(uint32_t *seed)
+{
+	*seed = *seed * 1664525 + 1013904223;
+	return (double)(int32_t)*seed / 2147483648.0;
+}
+
+/* Hann windowed sinc interpolation of noise at fractional position t */
+static double delayed_sample(const double *noise, double t)
+{
+	double sum = 0;
+	double u;
+	double w;
+	int n0 = (int)floor(t);
+	int n;
+
+	for (n = n0 - TEST_FD_HALF; n <= n0 + TEST_FD_HALF; n++) {
+		u = t - n;
+		w = 0.5 + 0.5 * cos(M_PI * u / (TEST_FD_HALF + 1));
+		sum += noise[n] * w * (fabs(u) < 1e-9 ? 1.0 : sin(M_PI * u) / (M_PI * u));
+	}
+
+	return sum;
+}
+
+/* Estimate direction of a white noise source at azimuth az_deg in the
+ * far field of array and return the estimated angle in degrees.
+ */
+static double estimate_direction(const struct test_array *array, double az_deg)
+{
+	struct sof_tdfb_mic_location mic_locations[TEST_NUM_MICS];
+	struct sof_tdfb_config *config;
+	struct tdfb_comp_data *cd;
+	double *noise;
+	double delay[TEST_NUM_MICS];
+	double az = az_deg * M_PI / 180;
+	double src_x = TEST_SOURCE_DISTANCE * cos(az);
+	double src_y = TEST_SOURCE_DISTANCE * sin(az);
+	double delay_min = 1e9;
+	double az_est;
+	double t;
+	uint32_t seed = 1;
+	int32_t x;
+	int emp_ch;
+	int ret;
+	int ch;
+	int i;
+	int j;
+
+	cd = calloc(1, sizeof(*cd));
+	config = calloc(1, sizeof(*config));
+	noise = malloc(TEST_NOISE_LENGTH * sizeof(double));
+	assert_non_null(cd);
+	assert_non_null(config);
+	assert_non_null(noise);
+
+	for (i = 0; i < TEST_NOISE_LENGTH; i++)
+		noise[i] = TEST_AMPLITUDE * test_rand(&seed);
+
+	for (ch = 0; ch < TEST_NUM_MICS; ch++) {
+		mic_locations[ch].x = (int16_t)round(array->x[ch] * 4096);
+		mic_locations[ch].y = (int16_t)round(array->y[ch] * 4096);
+		mic_locations[ch].z = 0;
+		delay[ch] = hypot(src_x - array->x[ch], src_y - array->y[ch]) *
+			TEST_FS / SPEED_OF_SOUND;
+		delay_min = fmin(delay_min, delay[ch]);
+	}
+
+	config->num_mic_locations = TEST_NUM_MICS;
+	config->angle_enum_mult = 15;
+	cd->config = config;
+	cd->mic_locations = mic_locations;
+	cd->max_frames = TEST_PERIOD;
+	cd->direction_updates = true;
+	ret = tdfb_direction_init(cd, TEST_FS, TEST_NUM_MICS);
+	assert_int_equal(ret, 0);
+	assert_int_equal(cd->direction.line_array, array->line_array);
+
+	for (i = 0; i < TEST_PERIODS; i++) {
+		emp_ch = 0;
+		for (j = 0; j < TEST_PERIOD; j++) {
+			for (ch = 0; ch < TEST_NUM_MICS; ch++) {
+				t = i * TEST_PERIOD + j + TEST_FD_TAPS - (delay[ch] - delay_min);
+				x = (int32_t)round(delayed_sample(noise, t) * 2147483648.0);
+				tdfb_direction_copy_emphasis(cd, TEST_NUM_MICS, &emp_ch, x);
+			}
+		}
+
+		tdfb_direction_estimate(cd, TEST_PERIOD, TEST_NUM_MICS);
+	}
+
+	az_est = (double)cd->direction.az / 4096 * 180 / M_PI;
+	printf("%s: %s array, angle %.1f, estimate %.1f, filtered %.1f\n", __func__,
+	       array->name, az_deg, az_est, (double)cd->direction.az_slow / 4096 * 180 / M_PI);
+
+	tdfb_direction_free(cd);
+	free(noise);
+	free(config);
+	free(cd);
+	return az_est;
+}
+
+static void check_direction(const struct test_array *array, double az_deg)
+{
+	double err = estimate_direction(array, az_deg) - az_deg;
+
+	/* Difference of angles in -180 .. +180 degrees */
+	err = fmod(err + 540, 360) - 180;
+	assert_true(fabs(err) < TEST_TOLERANCE_DEG);
+}
+
+static void test_tdfb_direction_line_array(void **state)
+{
+	(void)state;
+
+	check_direction(&line_array, -60);
+	check_direction(&line_array, -25);
+	check_direction(&line_array, 0);
+	check_direction(&line_array, 10);
+	check_direction(&line_array, 45);
+}
+
+static void test_tdfb_direction_circular_array(void **state)
+{
+	(void)state;
+
+	check_direction(&circular_array, -150);
+	check_direction(&circular_array, -80);
+	check_direction(&circular_array, 0);
+	check_direction(&circular_array, 35);
+	check_direction(&circular_array, 120);
+	check_direction(&circular_array, 175);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_tdfb_direction_line_array),
+		cmocka_unit_test(test_tdfb_direction_circular_array),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,406 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include "up_down_mixer.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <cmocka.h>
+
+#define TEST_FRAMES	64
+
+#define COEF_Q31(n, d)	((int32_t)((0x7fffffffULL * (n)) / (d)))
+#define COEF_Q15(n, d)	((int32_t)((0x7fffULL * (n)) / (d)))
+
+/* L, C, R, Ls, Rs, LS, RS, LFE as in the component tables */
+static const int32_t test_scaled_q31[UP_DOWN_MIX_COEFFS_LENGTH] = {
+	COEF_Q31(414, 1000), COEF_Q31(293, 1000), COEF_Q31(414, 1000), COEF_Q31(293, 1000),
+	COEF_Q31(293, 1000), COEF_Q31(100, 1000), COEF_Q31(100, 1000), COEF_Q31(0, 1000),
+};
+
+static const int32_t test_scaled_q15[UP_DOWN_MIX_COEFFS_LENGTH] = {
+	COEF_Q15(414, 1000), COEF_Q15(293, 1000), COEF_Q15(414, 1000), COEF_Q15(293, 1000),
+	COEF_Q15(293, 1000), COEF_Q15(100, 1000), COEF_Q15(100, 1000), COEF_Q15(0, 1000),
+};
+
+static const int32_t test_lo_ro_q31[UP_DOWN_MIX_COEFFS_LENGTH] = {
+	COEF_Q31(1, 1), COEF_Q31(707, 1000), COEF_Q31(1, 1), COEF_Q31(707, 1000),
+	COEF_Q31(707, 1000), COEF_Q31(100, 1000), COEF_Q31(100, 1000), COEF_Q31(0, 1000),
+};
+
+static int32_t test_in[TEST_FRAMES * UP_DOWN_MIX_CHANNELS_MAX];
+static int32_t test_out[TEST_FRAMES * UP_DOWN_MIX_CHANNELS_MAX];
+
+static int test_setup(void **state)
+{
+	struct up_down_mixer_data *cd = calloc(1, sizeof(*cd));
+
+	if (!cd)
+		return -1;
+
+	*state = cd;
+
+	return 0;
+}
+
+static int test_teardown(void **state)
+{
+	free(*state);
+
+	return 0;
+}
+
+static void test_init(struct up_down_mixer_data *cd, enum ipc4_channel_config in_config,
+		      size_t in_channels, enum ipc4_channel_config out_config,
+		      const int32_t *coefficients, enum ipc4_bit_depth depth, bool q15)
+{
+	cd->in_channel_config = in_config;
+	cd->in_channel_map = create_channel_map(in_config);
+	cd->in_channel_no = in_channels;
+	cd->out_channel_map = create_channel_map(out_config);
+	cd->downmix_coefficients = coefficients;
+
+	assert_int_equal(up_down_mixer_generic_init(cd, depth, q15), 0);
+}
+
+/* deterministic full scale signal */
+static void test_fill_s32(int channels)
+{
+	uint32_t seed = 12345;
+	int i;
+
+	for (i = 0; i < TEST_FRAMES * channels; i++) {
+		seed = seed * 1664525 + 1013904223;
+		test_in[i] = (int32_t)seed;
+	}
+}
+
+static void test_mix(struct up_down_mixer_data *cd, int in_bytes)
+{
+	memset(test_out, 0x55, sizeof(test_out));
+	cd->mix_routine(cd, (const uint8_t *)test_in, TEST_FRAMES * cd->in_channel_no * in_bytes,
+			(uint8_t *)test_out);
+}
+
+/* the engine keeps Q4.28 gains */
+static double test_gain(int32_t coef)
+{
+	return (coef >> 3) / 268435456.0;
+}
+
+static void test_check(double expected, int32_t out)
+{
+	if (expected > INT32_MAX)
+		expected = INT32_MAX;
+	if (expected < INT32_MIN)
+		expected = INT32_MIN;
+
+	assert_true(fabs(expected - out) <= 1.0);
+}
+
+static void test_mono_to_stereo(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	int i;
+
+	test_init(cd, IPC4_CHANNEL_CONFIG_MONO, 1, IPC4_CHANNEL_CONFIG_STEREO,
+		  test_lo_ro_q31, IPC4_DEPTH_32BIT, false);
+	test_fill_s32(1);
+	test_mix(cd, sizeof(int32_t));
+
+	for (i = 0; i < TEST_FRAMES; i++) {
+		assert_int_equal(test_out[2 * i], test_in[i]);
+		assert_int_equal(test_out[2 * i + 1], test_in[i]);
+	}
+}
+
+static void test_stereo_s16_copy(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	int16_t *in = (int16_t *)test_in;
+	int i;
+
+	test_init(cd, IPC4_CHANNEL_CONFIG_STEREO, 2, IPC4_CHANNEL_CONFIG_STEREO,
+		  test_lo_ro_q31, IPC4_DEPTH_16BIT, false);
+
+	for (i = 0; i < 2 * TEST_FRAMES; i++)
+		in[i] = i & 1 ? INT16_MIN + i : INT16_MAX - i;
+
+	test_mix(cd, sizeof(int16_t));
+
+	for (i = 0; i < 2 * TEST_FRAMES; i++)
+		assert_int_equal(test_out[i], (int32_t)in[i] << 16);
+}
+
+static void test_stereo_to_mono(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	int i;
+
+	test_init(cd, IPC4_CHANNEL_CONFIG_STEREO, 2, IPC4_CHANNEL_CONFIG_MONO,
+		  test_lo_ro_q31, IPC4_DEPTH_32BIT, false);
+	test_fill_s32(2);
+	test_mix(cd, sizeof(int32_t));
+
+	for (i = 0; i < TEST_FRAMES; i++)
+		test_check(((double)test_in[2 * i] + test_in[2 * i + 1]) / 2, test_out[i]);
+}
+
+/* 5.1 and 7.1 downmix, L = L + C + LFE + Ls (+ LS), R = R + C + LFE + Rs (+ RS) */
+static void test_downmix_stereo(struct up_down_mixer_data *cd, enum ipc4_channel_config config,
+				int channels)
+{
+	const int32_t *c = cd->downmix_coefficients;
+	enum ipc4_channel_index type;
+	double left, right, x;
+	int ch, i;
+
+	test_init(cd, config, channels, IPC4_CHANNEL_CONFIG_STEREO, c,
+		  IPC4_DEPTH_32BIT, false);
+	test_fill_s32(channels);
+	test_mix(cd, sizeof(int32_t));
+
+	for (i = 0; i < TEST_FRAMES; i++) {
+		left = 0;
+		right = 0;
+		for (ch = 0; ch < channels; ch++) {
+			type = get_channel_index(cd->in_channel_map, ch);
+			x = test_in[i * channels + ch] * test_gain(c[type]);
+			switch (type) {
+			case CHANNEL_LEFT:
+			case CHANNEL_LEFT_SURROUND:
+			case CHANNEL_LEFT_SIDE:
+				left += x;
+				break;
+			case CHANNEL_RIGHT:
+			case CHANNEL_RIGHT_SURROUND:
+			case CHANNEL_RIGHT_SIDE:
+				right += x;
+				break;
+			default:
+				left += x;
+				right += x;
+				break;
+			}
+		}
+
+		test_check(left, test_out[2 * i]);
+		test_check(right, test_out[2 * i + 1]);
+	}
+}
+
+static void test_5_1_to_stereo(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+
+	cd->downmix_coefficients = test_scaled_q31;
+	test_downmix_stereo(cd, IPC4_CHANNEL_CONFIG_5_POINT_1, 6);
+}
+
+static void test_7_1_to_stereo(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+
+	cd->downmix_coefficients = test_scaled_q31;
+	test_downmix_stereo(cd, IPC4_CHANNEL_CONFIG_7_POINT_1, 8);
+
+	/* unity coefficients saturate */
+	cd->downmix_coefficients = test_lo_ro_q31;
+	test_downmix_stereo(cd, IPC4_CHANNEL_CONFIG_7_POINT_1, 8);
+}
+
+static void test_4_0_s16_to_stereo(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	int16_t *in = (int16_t *)test_in;
+	double gain_lr = test_gain(test_scaled_q15[CHANNEL_LEFT] << 16);
+	double gain_c = test_gain(test_scaled_q15[CHANNEL_CENTER] << 16);
+	double gain_cs = test_gain(test_scaled_q15[CHANNEL_CENTER_SURROUND] << 16);
+	double center;
+	int i;
+
+	test_init(cd, IPC4_CHANNEL_CONFIG_4_POINT_0, 4, IPC4_CHANNEL_CONFIG_STEREO,
+		  test_scaled_q15, IPC4_DEPTH_16BIT, true);
+
+	for (i = 0; i < 4 * TEST_FRAMES; i++)
+		in[i] = (i * 7919) ^ (i << 9);
+
+	test_mix(cd, sizeof(int16_t));
+
+	/* L, C, R, Cs, the center surround goes to both sides */
+	for (i = 0; i < TEST_FRAMES; i++) {
+		center = in[4 * i + 1] * gain_c + in[4 * i + 3] * gain_cs;
+		test_check(65536.0 * (in[4 * i] * gain_lr + center), test_out[2 * i]);
+		test_check(65536.0 * (in[4 * i + 2] * gain_lr + center), test_out[2 * i + 1]);
+	}
+}
+
+static void test_stereo_to_5_1(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	int32_t *out;
+	int i;
+
+	test_init(cd, IPC4_CHANNEL_CONFIG_STEREO, 2, IPC4_CHANNEL_CONFIG_5_POINT_1,
+		  test_lo_ro_q31, IPC4_DEPTH_32BIT, false);
+	test_fill_s32(2);
+	test_mix(cd, sizeof(int32_t));
+
+	/* L, C, R, Ls, Rs, LFE, the surrounds repeat the fronts */
+	for (i = 0; i < TEST_FRAMES; i++) {
+		out = test_out + 6 * i;
+		assert_int_equal(out[0], test_in[2 * i]);
+		assert_int_equal(out[1], 0);
+		assert_int_equal(out[2], test_in[2 * i + 1]);
+		assert_int_equal(out[3], test_in[2 * i]);
+		assert_int_equal(out[4], test_in[2 * i + 1]);
+		assert_int_equal(out[5], 0);
+	}
+}
+
+static void test_stereo_to_7_1(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	int32_t *out;
+	int i;
+
+	test_init(cd, IPC4_CHANNEL_CONFIG_STEREO, 2, IPC4_CHANNEL_CONFIG_7_POINT_1,
+		  test_lo_ro_q31, IPC4_DEPTH_32BIT, false);
+	test_fill_s32(2);
+	test_mix(cd, sizeof(int32_t));
+
+	/* the side channels stay silent */
+	for (i = 0; i < TEST_FRAMES; i++) {
+		out = test_out + 8 * i;
+		assert_int_equal(out[3], test_in[2 * i]);
+		assert_int_equal(out[4], test_in[2 * i + 1]);
+		assert_int_equal(out[6], 0);
+		assert_int_equal(out[7], 0);
+	}
+}
+
+static void test_mono_to_5_1(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	int32_t *out;
+	int i;
+
+	test_init(cd, IPC4_CHANNEL_CONFIG_MONO, 1, IPC4_CHANNEL_CONFIG_5_POINT_1,
+		  test_lo_ro_q31, IPC4_DEPTH_32BIT, false);
+	test_fill_s32(1);
+	test_mix(cd, sizeof(int32_t));
+
+	for (i = 0; i < TEST_FRAMES; i++) {
+		out = test_out + 6 * i;
+		assert_int_equal(out[0], test_in[i]);
+		assert_int_equal(out[1], 0);
+		assert_int_equal(out[2], test_in[i]);
+		assert_int_equal(out[3], test_in[i]);
+		assert_int_equal(out[4], test_in[i]);
+		assert_int_equal(out[5], 0);
+	}
+}
+
+static void test_7_1_to_5_1(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	double gain = test_gain(test_scaled_q31[CHANNEL_LEFT_SIDE]);
+	int32_t *in, *out;
+	int i;
+
+	test_init(cd, IPC4_CHANNEL_CONFIG_7_POINT_1, 8, IPC4_CHANNEL_CONFIG_5_POINT_1,
+		  test_scaled_q31, IPC4_DEPTH_32BIT, false);
+	test_fill_s32(8);
+	test_mix(cd, sizeof(int32_t));
+
+	/* the sides are folded into the surrounds */
+	for (i = 0; i < TEST_FRAMES; i++) {
+		in = test_in + 8 * i;
+		out = test_out + 6 * i;
+		assert_int_equal(out[0], in[0]);
+		assert_int_equal(out[1], in[1]);
+		assert_int_equal(out[2], in[2]);
+		test_check(in[3] + in[6] * gain, out[3]);
+		test_check(in[4] + in[7] * gain, out[4]);
+		assert_int_equal(out[5], in[5]);
+	}
+}
+
+/* a custom map with no specialized layout takes the generic loop */
+static void test_custom_map(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+	int i;
+
+	/* R, -, L in three slots */
+	cd->in_channel_config = IPC4_CHANNEL_CONFIG_INVALID;
+	cd->in_channel_map = 0xFFFFF000 | CHANNEL_RIGHT | (CHANNEL_INVALID << 4) |
+			     (CHANNEL_LEFT << 8);
+	cd->in_channel_no = 7;
+	cd->out_channel_map = create_channel_map(IPC4_CHANNEL_CONFIG_STEREO);
+	cd->downmix_coefficients = test_scaled_q31;
+	assert_int_equal(up_down_mixer_generic_init(cd, IPC4_DEPTH_32BIT, false), 0);
+
+	test_fill_s32(7);
+	test_mix(cd, sizeof(int32_t));
+
+	for (i = 0; i < TEST_FRAMES; i++) {
+		test_check(test_in[7 * i + 2] * test_gain(test_scaled_q31[CHANNEL_LEFT]),
+			   test_out[2 * i]);
+		test_check(test_in[7 * i] * test_gain(test_scaled_q31[CHANNEL_RIGHT]),
+			   test_out[2 * i + 1]);
+	}
+}
+
+static void test_invalid(void **state)
+{
+	struct up_down_mixer_data *cd = *state;
+
+	cd->in_channel_config = IPC4_CHANNEL_CONFIG_STEREO;
+	cd->in_channel_map = create_channel_map(IPC4_CHANNEL_CONFIG_STEREO);
+	cd->in_channel_no = 2;
+	cd->out_channel_map = create_channel_map(IPC4_CHANNEL_CONFIG_STEREO);
+	cd->downmix_coefficients = test_lo_ro_q31;
+
+	assert_int_equal(up_down_mixer_generic_init(cd, IPC4_DEPTH_8BIT, false), -EINVAL);
+
+	cd->in_channel_no = UP_DOWN_MIX_CHANNELS_MAX + 1;
+	assert_int_equal(up_down_mixer_generic_init(cd, IPC4_DEPTH_32BIT, false), -EINVAL);
+
+	cd->in_channel_no = 2;
+	cd->out_channel_map = create_channel_map(IPC4_CHANNEL_CONFIG_INVALID);
+	assert_int_equal(up_down_mixer_generic_init(cd, IPC4_DEPTH_32BIT, false), -EINVAL);
+
+	/* two outputs without both left and right */
+	cd->out_channel_map = create_channel_map(IPC4_CHANNEL_CONFIG_DUAL_MONO);
+	assert_int_equal(up_down_mixer_generic_init(cd, IPC4_DEPTH_32BIT, false), -EINVAL);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(test_mono_to_stereo, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_stereo_s16_copy, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_stereo_to_mono, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_5_1_to_stereo, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_7_1_to_stereo, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_4_0_s16_to_stereo, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_stereo_to_5_1, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_stereo_to_7_1, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_mono_to_5_1, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_7_1_to_5_1, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_custom_map, test_setup, test_teardown),
+		cmocka_unit_test_setup_teardown(test_invalid, test_setup, test_teardown),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/* Tests and benchmarks the component ID, pipeline ID and driver UUID
+ * lookups with topologies of thousands of components. The lookup time is
+ * compared against a linear scan of the component list.
+ */
+
+#include <sof/audio/component_ext.h>
+#include <sof/audio/pipeline.h>
+#include <sof/ipc/common.h>
+#include <sof/ipc/topology.h>
+#include <sof/lib/uuid.h>
+#include <sof/list.h>
+#include <rtos/sof.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <cmocka.h>
+
+#define NUM_PIPELINES		256
+#define COMPS_PER_PIPELINE	16
+#define NUM_COMPS		(NUM_PIPELINES * COMPS_PER_PIPELINE)
+#define NUM_DRIVERS		1024
+
+/* IPC4 component IDs have the module ID in low and instance in high half */
+#define TEST_COMP_ID(i)		(((i) / 64) << 16 | ((i) % 64))
+
+struct lookup_data {
+	struct ipc_comp_dev *comps[NUM_COMPS];
+	struct ipc_comp_dev *pipes[NUM_PIPELINES];
+	struct comp_driver_info drv_info[NUM_DRIVERS];
+	struct comp_driver drv[NUM_DRIVERS];
+	struct sof_uuid uuid[NUM_DRIVERS];
+};
+
+static double elapsed_us(const struct timespec *t0)
+{
+	struct timespec t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return (t1.tv_sec - t0->tv_sec) * 1e6 + (t1.tv_nsec - t0->tv_nsec) / 1e3;
+}
+
+/* The lookup before the component index was added */
+static struct ipc_comp_dev *linear_get_comp_dev(struct ipc *ipc, uint16_t type, uint32_t id)
+{
+	struct ipc_comp_dev *icd;
+	struct list_item *clist;
+
+	list_for_item(clist, &ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->id == id && (type == icd->type || type == COMP_TYPE_ANY))
+			return icd;
+	}
+
+	return NULL;
+}
+
+static int setup(void **state)
+{
+	struct lookup_data *data = calloc(1, sizeof(*data));
+	struct ipc_comp_dev *icd;
+	struct comp_dev *dev;
+	struct pipeline *p;
+	int i;
+
+	if (!data)
+		return -1;
+
+	ipc_init(sof_get());
+	sys_comp_init(sof_get());
+
+	for (i = 0; i < NUM_PIPELINES; i++) {
+		p = calloc(1, sizeof(*p));
+		icd = calloc(1, sizeof(*icd));
+		if (!p || !icd)
+			return -1;
+
+		p->pipeline_id = i;
+		icd->type = COMP_TYPE_PIPELINE;
+		icd->id = i;
+		icd->pipeline = p;
+		ipc_comp_dev_add(ipc_get(), icd);
+		data->pipes[i] = icd;
+	}
+
+	for (i = 0; i < NUM_COMPS; i++) {
+		dev = calloc(1, sizeof(*dev));
+		icd = calloc(1, sizeof(*icd));
+		if (!dev || !icd)
+			return -1;
+
+		dev->ipc_config.id = TEST_COMP_ID(i);
+		dev->ipc_config.pipeline_id = i % NUM_PIPELINES;
+		list_init(&dev->bsource_list);
+		list_init(&dev->bsink_list);
+		icd->type = COMP_TYPE_COMPONENT;
+		icd->id = dev->ipc_config.id;
+		icd->cd = dev;
+		ipc_comp_dev_add(ipc_get(), icd);
+		data->comps[i] = icd;
+	}
+
+	*state = data;
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	struct lookup_data *data = *state;
+	int i;
+
+	for (i = 0; i < NUM_COMPS; i++) {
+		if (data->comps[i]) {
+			ipc_comp_dev_del(data->comps[i]);
+			free(data->comps[i]->cd);
+			free(data->comps[i]);
+		}
+	}
+
+	for (i = 0; i < NUM_PIPELINES; i++) {
+		ipc_comp_dev_del(data->pipes[i]);
+		free(data->pipes[i]->pipeline);
+		free(data->pipes[i]);
+	}
+
+	free(data);
+	return 0;
+}
+
+static void test_ipc_comp_lookup_by_id(void **state)
+{
+	struct lookup_data *data = *state;
+	struct ipc *ipc = ipc_get();
+	struct timespec t0;
+	double t_linear;
+	double t_index;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < NUM_COMPS; i++)
+		assert_ptr_equal(linear_get_comp_dev(ipc, COMP_TYPE_COMPONENT, TEST_COMP_ID(i)),
+				 data->comps[i]);
+	t_linear = elapsed_us(&t0);
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < NUM_COMPS; i++)
+		assert_ptr_equal(ipc_get_comp_by_id(ipc, TEST_COMP_ID(i)), data->comps[i]);
+	t_index = elapsed_us(&t0);
+
+	printf("%d component lookups: linear %.0f us, indexed %.0f us\n",
+	       NUM_COMPS, t_linear, t_index);
+
+	/* pipelines and components with the same ID are told apart by type */
+	for (i = 0; i < NUM_PIPELINES; i++) {
+		assert_ptr_equal(ipc_get_pipeline_by_id(ipc, i), data->pipes[i]);
+		assert_ptr_equal(ipc_get_comp_dev(ipc, COMP_TYPE_ANY, i),
+				 linear_get_comp_dev(ipc, COMP_TYPE_ANY, i));
+	}
+
+	assert_null(ipc_get_comp_by_id(ipc, TEST_COMP_ID(NUM_COMPS)));
+	assert_null(ipc_get_buffer_by_id(ipc, TEST_COMP_ID(0)));
+}
+
+static void test_ipc_comp_lookup_by_pipeline(void **state)
+{
+	struct lookup_data *data = *state;
+	struct ipc *ipc = ipc_get();
+	struct ipc_comp_dev *icd;
+	int i;
+
+	for (i = 0; i < NUM_PIPELINES; i++) {
+		/* the first component of the pipeline is found first */
+		icd = ipc_get_comp_by_ppl_id(ipc, COMP_TYPE_COMPONENT, i, IPC_COMP_ALL);
+		assert_ptr_equal(icd, data->comps[i]);
+
+		/* none of the components have buffers so all are endpoints */
+		assert_ptr_equal(ipc_get_ppl_src_comp(ipc, i), data->comps[i]);
+		assert_ptr_equal(ipc_get_ppl_sink_comp(ipc, i), data->comps[i]);
+
+		icd = ipc_get_comp_by_ppl_id(ipc, COMP_TYPE_PIPELINE, i, IPC_COMP_ALL);
+		assert_ptr_equal(icd, data->pipes[i]);
+	}
+
+	assert_null(ipc_get_comp_by_ppl_id(ipc, COMP_TYPE_COMPONENT, NUM_PIPELINES,
+					   IPC_COMP_ALL));
+}
+
+static void test_ipc_comp_lookup_after_del(void **state)
+{
+	struct lookup_data *data = *state;
+	struct ipc *ipc = ipc_get();
+	int i;
+
+	/* remove the first half of the components */
+	for (i = 0; i < NUM_COMPS / 2; i++) {
+		ipc_comp_dev_del(data->comps[i]);
+		free(data->comps[i]->cd);
+		free(data->comps[i]);
+		data->comps[i] = NULL;
+	}
+
+	for (i = 0; i < NUM_COMPS; i++)
+		assert_ptr_equal(ipc_get_comp_by_id(ipc, TEST_COMP_ID(i)), data->comps[i]);
+
+	/* the first remaining component of every pipeline */
+	for (i = 0; i < NUM_PIPELINES; i++)
+		assert_ptr_equal(ipc_get_comp_by_ppl_id(ipc, COMP_TYPE_COMPONENT, i,
+							IPC_COMP_ALL),
+				 data->comps[NUM_COMPS / 2 + i]);
+}
+
+static void test_comp_driver_find_by_uuid(void **state)
+{
+	struct lookup_data *data = *state;
+	uint8_t unaligned[UUID_SIZE + 1];
+	struct timespec t0;
+	double t_index;
+	int i;
+
+	for (i = 0; i < NUM_DRIVERS; i++) {
+		data->uuid[i].a = 0x12345678 + i * 0x10001;
+		data->uuid[i].b = 0xabcd;
+		data->uuid[i].c = i;
+		memset(data->uuid[i].d, i & 0xff, sizeof(data->uuid[i].d));
+		data->drv[i].uid = &data->uuid[i];
+		data->drv_info[i].drv = &data->drv[i];
+		comp_register(&data->drv_info[i]);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < NUM_DRIVERS; i++)
+		assert_ptr_equal(comp_driver_find_by_uuid(&data->uuid[i]), &data->drv[i]);
+	t_index = elapsed_us(&t0);
+
+	printf("%d driver lookups: indexed %.0f us\n", NUM_DRIVERS, t_index);
+
+	/* UUID from an IPC message can be unaligned */
+	memcpy(unaligned + 1, &data->uuid[7], UUID_SIZE);
+	assert_ptr_equal(comp_driver_find_by_uuid(unaligned + 1), &data->drv[7]);
+
+	for (i = 0; i < NUM_DRIVERS; i += 2)
+		comp_unregister(&data->drv_info[i]);
+
+	for (i = 0; i < NUM_DRIVERS; i++)
+		assert_ptr_equal(comp_driver_find_by_uuid(&data->uuid[i]),
+				 i & 1 ? &data->drv[i] : NULL);
+
+	for (i = 1; i < NUM_DRIVERS; i += 2)
+		comp_unregister(&data->drv_info[i]);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_ipc_comp_lookup_by_id),
+		cmocka_unit_test(test_ipc_comp_lookup_by_pipeline),
+		cmocka_unit_test(test_ipc_comp_lookup_after_del),
+		cmocka_unit_test(test_comp_driver_find_by_uuid),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, setup, teardown);
+}
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <sof/common.h>
+#include <sof/lib/tlsf.h>
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <cmocka.h>
+
+#define TEST_HEAP_SIZE		(64 * 1024)
+#define TEST_SLOTS		256
+#define TEST_TORTURE_OPS	50000
+
+static uint8_t test_heap[TEST_HEAP_SIZE] __aligned(64);
+
+/* deterministic sequence, the failing operation can be replayed */
+static uint32_t test_seed;
+
+static uint32_t test_rand(void)
+{
+	test_seed = test_seed * 1664525 + 1013904223;
+
+	return test_seed >> 8;
+}
+
+/* cycles on the simulator, nanoseconds on the host */
+static uint32_t test_ticks(void)
+{
+#ifdef __XTENSA__
+	uint32_t ccount;
+
+	__asm__ __volatile__("rsr %0, ccount" : "=a" (ccount));
+
+	return ccount;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static struct tlsf *test_init(size_t *free_bytes)
+{
+	struct tlsf *tlsf = tlsf_init(test_heap, sizeof(test_heap));
+
+	assert_non_null(tlsf);
+	assert_int_equal(tlsf_check(tlsf, free_bytes), 0);
+
+	return tlsf;
+}
+
+static void test_tlsf_init(void **state)
+{
+	struct tlsf *tlsf;
+	size_t free_bytes;
+	void *ptr;
+
+	(void)state;
+
+	assert_null(tlsf_init(test_heap, 64));
+
+	tlsf = test_init(&free_bytes);
+	assert_true(free_bytes > TEST_HEAP_SIZE - 4096);
+	assert_int_equal(tlsf_largest_free(tlsf), free_bytes);
+
+	/* a good fit request of the whole pool would round up past it */
+	ptr = tlsf_malloc(tlsf, free_bytes / 2);
+	assert_non_null(ptr);
+	assert_true(tlsf_block_size(ptr) >= free_bytes / 2);
+	assert_null(tlsf_malloc(tlsf, free_bytes));
+	assert_null(tlsf_malloc(tlsf, 0));
+
+	tlsf_free(tlsf, ptr);
+	tlsf_free(tlsf, NULL);
+	assert_int_equal(tlsf_largest_free(tlsf), free_bytes);
+	assert_int_equal(tlsf_check(tlsf, NULL), 0);
+}
+
+static void test_tlsf_align(void **state)
+{
+	void *ptrs[2][13];
+	struct tlsf *tlsf;
+	size_t free_bytes, check_bytes;
+	size_t align;
+	int i, j;
+
+	(void)state;
+
+	tlsf = test_init(&free_bytes);
+
+	/* odd sizes keep the following payloads misaligned */
+	for (j = 0; j < 2; j++)
+		for (i = 0, align = 1; i < 13; i++, align <<= 1) {
+			ptrs[j][i] = tlsf_memalign(tlsf, align, 3 + 40 * j + i);
+			assert_non_null(ptrs[j][i]);
+			assert_true(IS_ALIGNED((uintptr_t)ptrs[j][i], align));
+			assert_true(tlsf_block_size(ptrs[j][i]) >= 3 + 40 * j + i);
+			memset(ptrs[j][i], 0x5a, 3 + 40 * j + i);
+			assert_int_equal(tlsf_check(tlsf, NULL), 0);
+		}
+
+	for (i = 0; i < 13; i++) {
+		tlsf_free(tlsf, ptrs[0][i]);
+		assert_int_equal(tlsf_check(tlsf, NULL), 0);
+	}
+
+	for (i = 12; i >= 0; i--)
+		tlsf_free(tlsf, ptrs[1][i]);
+
+	assert_int_equal(tlsf_check(tlsf, &check_bytes), 0);
+	assert_int_equal(check_bytes, free_bytes);
+	assert_int_equal(tlsf_largest_free(tlsf), free_bytes);
+}
+
+struct test_slot {
+	uint8_t *ptr;
+	size_t size;
+	uint8_t pattern;
+};
+
+static size_t test_alloc_size(void)
+{
+	/* mostly small objects with some audio buffer sized ones */
+	if (test_rand() % 8)
+		return 1 + test_rand() % 256;
+
+	return 256 + test_rand() % 4096;
+}
+
+static void test_slot_free(struct tlsf *tlsf, struct test_slot *slot)
+{
+	size_t i;
+
+	/* an overlapping allocation would have overwritten the pattern */
+	for (i = 0; i < slot->size; i++)
+		assert_int_equal(slot->ptr[i], slot->pattern);
+
+	tlsf_free(tlsf, slot->ptr);
+	slot->ptr = NULL;
+}
+
+/*
+ * Random allocation and free of mixed sizes and alignments, checking the
+ * contents of every allocation and the allocator state, then that freeing
+ * everything coalesces the pool back into a single block.
+ */
+static void test_tlsf_torture(void **state)
+{
+	struct test_slot slots[TEST_SLOTS] = { 0 };
+	struct test_slot *slot;
+	struct tlsf *tlsf;
+	size_t free_bytes, check_bytes;
+	unsigned int failures = 0;
+	unsigned int frag_max = 0;
+	unsigned int frag;
+	size_t align;
+	int i;
+
+	(void)state;
+
+	tlsf = test_init(&free_bytes);
+	test_seed = 1;
+
+	for (i = 0; i < TEST_TORTURE_OPS; i++) {
+		slot = slots + test_rand() % TEST_SLOTS;
+
+		if (slot->ptr) {
+			test_slot_free(tlsf, slot);
+		} else {
+			slot->size = test_alloc_size();
+			align = test_rand() % 4 ? 0 : 1 << (test_rand() % 8);
+			slot->ptr = align ? tlsf_memalign(tlsf, align, slot->size) :
+				tlsf_malloc(tlsf, slot->size);
+			if (!slot->ptr) {
+				failures++;
+				continue;
+			}
+
+			if (align)
+				assert_true(IS_ALIGNED((uintptr_t)slot->ptr, align));
+
+			slot->pattern = i;
+			memset(slot->ptr, slot->pattern, slot->size);
+		}
+
+		if (i % 256)
+			continue;
+
+		assert_int_equal(tlsf_check(tlsf, &check_bytes), 0);
+
+		/* external fragmentation: free memory not in the largest block */
+		frag = check_bytes ? 100 - 100 * tlsf_largest_free(tlsf) / check_bytes : 0;
+		if (frag > frag_max)
+			frag_max = frag;
+	}
+
+	print_message("tlsf torture: %u of %d operations failed, max fragmentation %u%%\n",
+		      failures, TEST_TORTURE_OPS, frag_max);
+
+	for (i = 0; i < TEST_SLOTS; i++)
+		if (slots[i].ptr)
+			test_slot_free(tlsf, slots + i);
+
+	assert_int_equal(tlsf_check(tlsf, &check_bytes), 0);
+	assert_int_equal(check_bytes, free_bytes);
+	assert_int_equal(tlsf_largest_free(tlsf), free_bytes);
+}
+
+/*
+ * Worst case allocation time on an empty pool and on a pool shredded into
+ * hundreds of small free holes, which are the slow case for a list or
+ * block map search. TLSF looks only at bitmaps and list heads, so the two
+ * stay close. Timing isn't asserted, it depends on the machine.
+ */
+static uint32_t test_worst_alloc(struct tlsf *tlsf, void **ptrs, int count)
+{
+	uint32_t worst = 0;
+	uint32_t start, ticks;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		start = test_ticks();
+		ptrs[i] = tlsf_memalign(tlsf, 64, 1024);
+		ticks = test_ticks() - start;
+		assert_non_null(ptrs[i]);
+		if (ticks > worst)
+			worst = ticks;
+	}
+
+	for (i = 0; i < count; i++)
+		tlsf_free(tlsf, ptrs[i]);
+
+	return worst;
+}
+
+static void test_tlsf_determinism(void **state)
+{
+	void *holes[256];
+	void *ptrs[16];
+	struct tlsf *tlsf;
+	uint32_t empty, shredded;
+	int i;
+
+	(void)state;
+
+	tlsf = test_init(NULL);
+	empty = test_worst_alloc(tlsf, ptrs, ARRAY_SIZE(ptrs));
+
+	/* every other small block freed leaves holes too small for the request */
+	for (i = 0; i < ARRAY_SIZE(holes); i++) {
+		holes[i] = tlsf_malloc(tlsf, 32 + 8 * (i % 16));
+		assert_non_null(holes[i]);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(holes); i += 2)
+		tlsf_free(tlsf, holes[i]);
+
+	assert_int_equal(tlsf_check(tlsf, NULL), 0);
+	shredded = test_worst_alloc(tlsf, ptrs, ARRAY_SIZE(ptrs));
+
+	print_message("tlsf worst case alloc ticks: empty %u, %zu holes %u\n",
+		      empty, ARRAY_SIZE(holes) / 2, shredded);
+
+	for (i = 1; i < ARRAY_SIZE(holes); i += 2)
+		tlsf_free(tlsf, holes[i]);
+
+	assert_int_equal(tlsf_check(tlsf, NULL), 0);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_tlsf_init),
+		cmocka_unit_test(test_tlsf_align),
+		cmocka_unit_test(test_tlsf_torture),
+		cmocka_unit_test(test_tlsf_determinism),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -142,6 +142,65 @@ static void test_fast_get_refcounting(void **state)
 		fast_put(copy[1][i]);
 }
 
+static int generate_calls;
+
+static int test_generator(void *buf, size_t size, const void *key)
+{
+	const int *src = key;
+	int *dst = buf;
+	int i;
+
+	generate_calls++;
+
+	for (i = 0; i < size / sizeof(int); i++)
+		dst[i] = src[i] * 2;
+
+	return 0;
+}
+
+static int test_generator_fail(void *buf, size_t size, const void *key)
+{
+	generate_calls++;
+
+	return -EINVAL;
+}
+
+static void test_fast_get_generate(void **state)
+{
+	const int *copy[2];
+	const void *fail;
+	int i;
+
+	(void)state; /* unused */
+
+	generate_calls = 0;
+	copy[0] = fast_get_generate(testdata[2], sizeof(testdata[2]), test_generator);
+	copy[1] = fast_get_generate(testdata[2], sizeof(testdata[2]), test_generator);
+
+	assert(copy[0]);
+	assert(copy[0] == copy[1]);
+	assert(generate_calls == 1);
+	for (i = 0; i < ARRAY_SIZE(testdata[2]); i++)
+		assert(copy[0][i] == testdata[2][i] * 2);
+
+	/* a size mismatch doesn't regenerate */
+	assert(!fast_get_generate(testdata[2], sizeof(testdata[2]) - 1, test_generator));
+	assert(generate_calls == 1);
+
+	fast_put(copy[0]);
+	fast_put(copy[1]);
+
+	/* the last put released the data, the next get generates again */
+	copy[0] = fast_get_generate(testdata[2], sizeof(testdata[2]), test_generator);
+	assert(copy[0]);
+	assert(generate_calls == 2);
+	fast_put(copy[0]);
+
+	fail = fast_get_generate(testdata[3], sizeof(testdata[3]), test_generator_fail);
+	assert(!fail);
+	assert(generate_calls == 3);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
@@ -149,6 +208,7 @@ int main(void)
 		cmocka_unit_test(test_fast_get_size_missmatch_test),
 		cmocka_unit_test(test_over_32_fast_gets_and_puts),
 		cmocka_unit_test(test_fast_get_refcounting),
+		cmocka_unit_test(test_fast_get_generate),
 	};
 
 	cmocka_set_message_output(CM_OUTPUT_TAP);
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+#include <rtos/alloc.h>
+#include <sof/lib/heap_telemetry.h>
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <cmocka.h>
+
+#define TEST_DATA_SIZE	(sizeof(struct heap_telemetry_data) + \
+			 HEAP_TELEMETRY_CALLERS * sizeof(struct heap_telemetry_caller))
+
+/* host builds time stamp in nanoseconds */
+static uint64_t test_time = 1000000;
+
+int __wrap_clock_gettime(clockid_t clock, struct timespec *ts);
+
+int __wrap_clock_gettime(clockid_t clock, struct timespec *ts)
+{
+	ts->tv_sec = test_time / 1000000000;
+	ts->tv_nsec = test_time % 1000000000;
+
+	return 0;
+}
+
+unsigned int heap_telemetry_zones(struct heap_telemetry_zone *zones, unsigned int max)
+{
+	zones->zone = SOF_MEM_ZONE_BUFFER;
+	zones->size = 4096;
+	zones->used = 1024;
+	zones->free = 3072;
+	zones->largest_free = 2048;
+
+	return 1;
+}
+
+/* call sites are only compared, they don't need to be code addresses */
+static const void *test_caller(unsigned int i)
+{
+	return (const void *)(uintptr_t)(0x1000 + 4 * i);
+}
+
+static void test_alloc(enum mem_zone zone, size_t bytes, bool fail, unsigned int caller,
+		       uint64_t latency)
+{
+	heap_telemetry_alloc(zone, bytes, fail ? NULL : &test_time, test_caller(caller),
+			     test_time - latency);
+}
+
+/* runs first, on the initial empty state */
+static void test_heap_telemetry_latency(void **state)
+{
+	struct heap_telemetry_data *data = malloc(TEST_DATA_SIZE);
+	int i;
+
+	(void)state;
+
+	assert_non_null(data);
+
+	for (i = 0; i < 90; i++)
+		test_alloc(SOF_MEM_ZONE_RUNTIME, 16, false, 0, 3);
+	for (i = 0; i < 9; i++)
+		test_alloc(SOF_MEM_ZONE_RUNTIME, 16, false, 0, 100);
+	test_alloc(SOF_MEM_ZONE_RUNTIME, 16, false, 0, 5000);
+
+	heap_telemetry_free(test_time - 7);
+
+	assert_int_equal(heap_telemetry_get(data, TEST_DATA_SIZE),
+			 sizeof(*data) + sizeof(struct heap_telemetry_caller));
+
+	assert_int_equal(data->ticks_per_ms, 1000000);
+	assert_int_equal(data->num_zones, 1);
+	assert_int_equal(data->zones[0].largest_free, 2048);
+
+	/* percentiles are the upper bounds of the log2 bins, limited by the maximum */
+	assert_int_equal(data->alloc_latency.count, 100);
+	assert_int_equal(data->alloc_latency.p50, 3);
+	assert_int_equal(data->alloc_latency.p90, 3);
+	assert_int_equal(data->alloc_latency.p99, 127);
+	assert_int_equal(data->alloc_latency.max, 5000);
+
+	assert_int_equal(data->frees, 1);
+	assert_int_equal(data->free_latency.count, 1);
+	assert_int_equal(data->free_latency.p50, 7);
+
+	assert_int_equal(data->allocs[SOF_MEM_ZONE_RUNTIME], 100);
+	assert_int_equal(data->size_hist[5], 100);
+
+	free(data);
+}
+
+static void test_heap_telemetry_callers(void **state)
+{
+	struct heap_telemetry_data *data = malloc(TEST_DATA_SIZE);
+	size_t size;
+	int i;
+
+	(void)state;
+
+	assert_non_null(data);
+
+	/* caller 0 already has 100 allocations */
+	for (i = 0; i < 5; i++)
+		test_alloc(SOF_MEM_ZONE_BUFFER, 100 * i, false, 2, 1);
+	test_alloc(SOF_MEM_ZONE_BUFFER, 8192, true, 1, 1);
+	for (i = 0; i < 3; i++)
+		test_alloc(SOF_MEM_ZONE_SYS, 64, false, 3, 1);
+
+	heap_telemetry_get(data, TEST_DATA_SIZE);
+
+	assert_int_equal(data->allocs[SOF_MEM_ZONE_BUFFER], 6);
+	assert_int_equal(data->failures[SOF_MEM_ZONE_BUFFER], 1);
+	assert_int_equal(data->allocs[SOF_MEM_ZONE_SYS], 3);
+
+	assert_int_equal(data->num_callers, 4);
+	assert_int_equal(data->callers[0].caller, (uintptr_t)test_caller(0));
+	assert_int_equal(data->callers[1].caller, (uintptr_t)test_caller(2));
+	assert_int_equal(data->callers[1].allocs, 5);
+	assert_int_equal(data->callers[1].bytes, 1000);
+	assert_int_equal(data->callers[1].max_bytes, 400);
+	assert_int_equal(data->callers[2].caller, (uintptr_t)test_caller(3));
+	assert_int_equal(data->callers[3].caller, (uintptr_t)test_caller(1));
+	assert_int_equal(data->callers[3].failures, 1);
+
+	/* a short buffer gets the busiest call sites */
+	size = sizeof(*data) + 2 * sizeof(struct heap_telemetry_caller);
+	assert_int_equal(heap_telemetry_get(data, size), size);
+	assert_int_equal(data->num_callers, 2);
+	assert_int_equal(data->callers[1].caller, (uintptr_t)test_caller(2));
+
+	assert_int_equal(heap_telemetry_get(data, sizeof(*data) - 1), 0);
+
+	/* call sites beyond the table size are only counted */
+	for (i = 0; i < HEAP_TELEMETRY_CALLERS; i++)
+		test_alloc(SOF_MEM_ZONE_RUNTIME, 16, false, 10 + i, 1);
+
+	heap_telemetry_get(data, TEST_DATA_SIZE);
+	assert_int_equal(data->num_callers, HEAP_TELEMETRY_CALLERS);
+	assert_int_equal(data->caller_overflow, 4);
+
+	free(data);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_heap_telemetry_latency),
+		cmocka_unit_test(test_heap_telemetry_callers),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -8,6 +8,7 @@ function ref_window()
 	get_ref_window('blackman', 'ref_window_blackman.h', 160);
 	get_ref_window('hamming', 'ref_window_hamming.h', 256);
 	get_ref_window('povey', 'ref_window_povey.h', 200);
+	get_ref_window('hann', 'ref_window_hann.h', 256);
 
 end
 
@@ -22,6 +23,8 @@ function get_ref_window(wname, headerfn, wlength)
 			win = hamming(wlength);
 		case 'povey'
 			win = mfcc_povey(wlength);
+		case 'hann'
+			win = hann(wlength);
 		otherwise
 			fprintf(1, 'Illegal window name %s. ', wname);
 			error('Failed.');
@@ -20,6 +20,7 @@
 #include "ref_window_blackman.h"
 #include "ref_window_hamming.h"
 #include "ref_window_povey.h"
+#include "ref_window_hann.h"
 
 #define MAX_ERR_RMS		1.0
 #define MAX_STR_SIZE		256
@@ -59,6 +60,8 @@ static float test_window(char *window_name, const int16_t *ref_win, int window_l
 		win_hamming_16b(win, window_length);
 	} else if (!strcmp(window_name, "povey")) {
 		win_povey_16b(win, window_length);
+	} else if (!strcmp(window_name, "hann")) {
+		win_hann_16b(win, window_length);
 	} else {
 		fprintf(stderr, "Illegal window %s.\n", window_name);
 		free(win);
@@ -122,6 +125,16 @@ static void test_math_window_povey(void **state)
 	assert_true(err_rms < MAX_ERR_RMS);
 }
 
+static void test_math_window_hann(void **state)
+{
+	float err_rms;
+
+	(void)state;
+
+	err_rms = test_window("hann", ref_hann, LENGTH_HANN);
+	assert_true(err_rms < MAX_ERR_RMS);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
@@ -129,6 +142,7 @@ int main(void)
 		cmocka_unit_test(test_math_window_blackman),
 		cmocka_unit_test(test_math_window_hamming),
 		cmocka_unit_test(test_math_window_povey),
+		cmocka_unit_test(test_math_window_hann),
 	};
 
 	cmocka_set_message_output(CM_OUTPUT_TAP);
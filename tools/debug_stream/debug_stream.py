@@ -9,6 +9,7 @@ For receiving, decoding and printing debug-stream records over debug window slot
 
 import argparse
 import ctypes
+import json
 import time
 import sys
 import os
@@ -73,9 +74,148 @@ class ThreadInfo(ctypes.Structure):
     ]
 
 
+class TaskTraceInfo(ctypes.Structure):
+    """
+    Task Trace record header
+    """
+
+    _pack_ = 1
+    _fields_ = [
+        ("hdr", DebugStreamRecord),
+        ("core", ctypes.c_uint),
+        ("clock_hz", ctypes.c_uint),
+        ("lost", ctypes.c_uint),
+        ("event_count", ctypes.c_uint),
+    ]
+
+
+class TaskTraceEvent(ctypes.Structure):
+    """
+    Task Trace event for one task run or LL scheduler tick
+    """
+
+    _pack_ = 1
+    _fields_ = [
+        ("start", ctypes.c_uint),
+        ("end", ctypes.c_uint),
+        ("id", ctypes.c_uint),
+        ("uuid", ctypes.c_uint),
+        ("type", ctypes.c_ubyte),
+        ("reserved", ctypes.c_ubyte * 3),
+    ]
+
+
+TASK_TRACE_TYPE_LL_TICK = 0
+TASK_TRACE_TYPE_LL = 1
+TASK_TRACE_TYPE_DP = 2
+
 WSIZE = ctypes.sizeof(ctypes.c_uint)
 
 
+class TaskTraceWriter:
+    """
+    Writes task trace events to a file in Chrome trace event JSON format,
+    which can be opened with https://ui.perfetto.dev/ or chrome://tracing.
+    Each core is a process with separate tracks for LL ticks, LL tasks and
+    each DP task. The file is valid even if the writing is interrupted, as
+    the closing bracket of the event array is optional.
+    """
+
+    LL_TICK_TID = 0
+    LL_TID = 1
+
+    def __init__(self, file, tick_us, uuid_registry):
+        self.file = file
+        self.tick_us = tick_us
+        self.names = self.read_uuid_names(uuid_registry)
+        self.ref = None
+        self.tids = {}
+        self.first = True
+        self.file.write("[")
+
+    @staticmethod
+    def read_uuid_names(path):
+        """Returns a dict from the first 32 bits of the UUIDs to the names"""
+        names = {}
+        try:
+            with open(path, "r", encoding="utf-8") as file:
+                for line in file:
+                    fields = line.split()
+                    if len(fields) != 2 or fields[0].startswith("#"):
+                        continue
+                    names[int(fields[0].split("-")[0], 16)] = fields[1]
+        except (OSError, ValueError) as err:
+            logging.warning("Could not read UUID names from %s: %s", path, err)
+        return names
+
+    def write(self, event):
+        """Writes one trace event"""
+        self.file.write(("\n" if self.first else ",\n") + json.dumps(event))
+        self.first = False
+
+    def close(self):
+        """Terminates the event array"""
+        self.file.write("\n]\n")
+        self.file.close()
+
+    def unwrap(self, stamp):
+        """
+        Extends a 32-bit timestamp to 64 bits. The events of all cores are
+        close enough in time to be unwrapped against the latest event end.
+        """
+        if self.ref is None:
+            return stamp
+        return self.ref + ((stamp - self.ref + 0x80000000) & 0xFFFFFFFF) - 0x80000000
+
+    def get_tid(self, core, event):
+        """Returns the track of the event, naming the tracks on first use"""
+        if core not in self.tids:
+            self.tids[core] = {}
+            self.write({"name": "process_name", "ph": "M", "pid": core, "tid": 0,
+                        "args": {"name": "core %u" % core}})
+            self.write({"name": "thread_name", "ph": "M", "pid": core,
+                        "tid": self.LL_TICK_TID, "args": {"name": "LL tick"}})
+            self.write({"name": "thread_name", "ph": "M", "pid": core,
+                        "tid": self.LL_TID, "args": {"name": "LL tasks"}})
+        if event.type == TASK_TRACE_TYPE_LL_TICK:
+            return self.LL_TICK_TID
+        if event.type == TASK_TRACE_TYPE_LL:
+            return self.LL_TID
+        # DP tasks preempt each other, so each gets a track of its own
+        dp_tids = self.tids[core]
+        if event.id not in dp_tids:
+            dp_tids[event.id] = self.LL_TID + 1 + len(dp_tids)
+            self.write({"name": "thread_name", "ph": "M", "pid": core,
+                        "tid": dp_tids[event.id], "args": {"name": "DP 0x%08x" % event.id}})
+        return dp_tids[event.id]
+
+    def add_record(self, info, events):
+        """Converts the events of a task trace record"""
+        core = info.core
+        usec = 1000000.0 / info.clock_hz
+        if info.lost and len(events):
+            tid = self.get_tid(core, TaskTraceEvent(type=TASK_TRACE_TYPE_LL_TICK))
+            self.write({"name": "%u events lost" % info.lost, "ph": "i", "s": "p",
+                        "ts": self.unwrap(events[0].start) * usec, "pid": core, "tid": tid})
+        for event in events:
+            start = self.unwrap(event.start)
+            end = self.unwrap(event.end)
+            self.ref = end
+            dur = (end - start) * usec
+            tid = self.get_tid(core, event)
+            if event.type == TASK_TRACE_TYPE_LL_TICK:
+                name = "tick"
+            else:
+                name = "%s 0x%08x" % (self.names.get(event.uuid, "0x%08x" % event.uuid),
+                                      event.id)
+            self.write({"name": name, "ph": "X", "ts": start * usec, "dur": dur,
+                        "pid": core, "tid": tid})
+            if event.type == TASK_TRACE_TYPE_LL_TICK and dur > self.tick_us:
+                self.write({"name": "LL overrun", "ph": "i", "s": "t", "ts": end * usec,
+                            "pid": core, "tid": tid, "args": {"dur_us": dur}})
+        self.file.flush()
+
+
 class RecordPrinter:
     """
     Debug Stream record decoder and printer class
@@ -83,6 +223,9 @@ class RecordPrinter:
 
     RECORD_ID_UNINITIALIZED = 0
     RECORD_ID_THREAD_INFO = 1
+    RECORD_ID_TASK_TRACE = 2
+
+    task_trace_writer = None
 
     def print_record(self, record, cpu):
         """prints debug-stream record"""
@@ -92,6 +235,8 @@ class RecordPrinter:
         )
         if recp.contents.id == self.RECORD_ID_THREAD_INFO:
             return self.print_thread_info(record, cpu)
+        if recp.contents.id == self.RECORD_ID_TASK_TRACE:
+            return self.print_task_trace(record, cpu)
         logging.warning("cpu %u: Unsupported recodrd type %u", cpu, recp.contents.id)
         return True
 
@@ -141,6 +286,35 @@ class RecordPrinter:
             )
         return True
 
+    def print_task_trace(self, record, cpu):
+        """prints task trace record summary and passes the events to the trace writer"""
+        if len(record) < ctypes.sizeof(TaskTraceInfo):
+            logging.info("Buffer end reached, parsing failed")
+            return False
+        info = TaskTraceInfo.from_buffer_copy(record)
+        if info.clock_hz == 0 or len(record) < ctypes.sizeof(TaskTraceInfo) + \
+           info.event_count * ctypes.sizeof(TaskTraceEvent):
+            logging.info("Broken task trace record, %u events", info.event_count)
+            return False
+        events = (TaskTraceEvent * info.event_count).from_buffer_copy(
+            record, ctypes.sizeof(TaskTraceInfo)
+        )
+        ticks = [(e.end - e.start) & 0xFFFFFFFF for e in events
+                 if e.type == TASK_TRACE_TYPE_LL_TICK]
+        print(
+            "CPU %u: Task trace %u events, %u lost, longest LL tick %.1f us (seqno %u)"
+            % (
+                cpu,
+                info.event_count,
+                info.lost,
+                max(ticks, default=0) * 1000000.0 / info.clock_hz,
+                info.hdr.seqno,
+            )
+        )
+        if self.task_trace_writer is not None:
+            self.task_trace_writer.add_record(info, events)
+        return True
+
 
 class DebugStreamSectionDescriptor(ctypes.Structure):
     """
@@ -594,10 +768,37 @@ def parse_params():
         type=int,
         default=-1,
     )
+    parser.add_argument(
+        "-j",
+        "--trace-json",
+        help="Write task trace records to a Chrome trace JSON file, for Perfetto",
+    )
+    parser.add_argument(
+        "--tick-us",
+        help="LL scheduler tick length in microseconds for overrun marking, default 1000",
+        type=float,
+        default=1000,
+    )
+    parser.add_argument(
+        "--uuid-registry",
+        help="UUID registry file for the task names, default uuid-registry.txt of SOF tree",
+        default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..",
+                             "uuid-registry.txt"),
+    )
     parsed_args = parser.parse_args()
     return parsed_args
 
 
 if __name__ == "__main__":
     args = parse_params()
-    main_f(args)
+    if args.trace_json:
+        RecordPrinter.task_trace_writer = TaskTraceWriter(
+            open(args.trace_json, "w", encoding="utf-8"), args.tick_us, args.uuid_registry
+        )
+    try:
+        main_f(args)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if RecordPrinter.task_trace_writer is not None:
+            RecordPrinter.task_trace_writer.close()
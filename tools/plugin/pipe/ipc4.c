@@ -110,6 +110,43 @@ static int pipe_register_comp(struct sof_pipe *sp, uint16_t module_id)
 #define iCS(x) ((x) & SOF_CMD_TYPE_MASK)
 #define iGS(x) ((x) & SOF_GLB_TYPE_MASK)
 
+typedef int (*pipe_ipc_cmd_t)(struct sof_pipe *sp, void *mailbox, size_t bytes);
+
+/* run the local actions for each message in a pipeline batch */
+static int pipe_ipc_batch(struct sof_pipe *sp, void *mailbox, size_t bytes, pipe_ipc_cmd_t cmd)
+{
+	struct ipc4_pipeline_batch *batch = mailbox;
+	struct ipc4_pipeline_batch_entry *entry;
+	struct ipc4_message_request msg;
+	size_t avail;
+	int ret, i;
+
+	if (bytes < sizeof(*batch))
+		return -EINVAL;
+
+	avail = bytes - sizeof(*batch);
+	entry = (struct ipc4_pipeline_batch_entry *)(batch + 1);
+
+	for (i = 0; i < batch->primary.r.count; i++) {
+		if (avail < sizeof(*entry) || entry->size > avail - sizeof(*entry)) {
+			fprintf(stderr, "error: pipeline batch entry %d exceeds message\n", i);
+			return -EINVAL;
+		}
+
+		/* local actions only need the message header */
+		msg.primary.dat = entry->primary;
+		msg.extension.dat = entry->extension;
+		ret = cmd(sp, &msg, sizeof(msg));
+		if (ret < 0)
+			return ret;
+
+		avail -= sizeof(*entry) + entry->size;
+		entry = (struct ipc4_pipeline_batch_entry *)((char *)entry->data + entry->size);
+	}
+
+	return 0;
+}
+
 static int pipe_sof_ipc_cmd_before(struct sof_pipe *sp, void *mailbox, size_t bytes)
 {
 	struct ipc4_message_request *in = mailbox;
@@ -168,6 +205,9 @@ static int pipe_sof_ipc_cmd_before(struct sof_pipe *sp, void *mailbox, size_t by
 			}
 			break;
 		}
+		case SOF_IPC4_GLB_PIPELINE_BATCH:
+			ret = pipe_ipc_batch(sp, in, bytes, pipe_sof_ipc_cmd_before);
+			break;
 		default:
 			break;
 		}
@@ -263,6 +303,9 @@ static int pipe_sof_ipc_cmd_after(struct sof_pipe *sp, void *mailbox, size_t byt
 
 			break;
 		}
+		case SOF_IPC4_GLB_PIPELINE_BATCH:
+			ret = pipe_ipc_batch(sp, in, bytes, pipe_sof_ipc_cmd_after);
+			break;
 		default:
 			break;
 		}
@@ -110,6 +110,10 @@
 #include <audio/multiband_drc/multiband_drc.toml>
 #endif
 
+#if defined(CONFIG_COMP_LIMITER) || defined(LLEXT_FORCE_ALL_MODULAR)
+#include <audio/limiter/limiter.toml>
+#endif
+
 #if defined(CONFIG_COMP_DCBLOCK) || defined(LLEXT_FORCE_ALL_MODULAR)
 #include <audio/dcblock/dcblock.toml>
 #endif
@@ -134,5 +138,9 @@
 #include <audio/mfcc/mfcc.toml>
 #endif
 
+#if defined(CONFIG_COMP_STFT) || defined(LLEXT_FORCE_ALL_MODULAR)
+#include <audio/stft/stft.toml>
+#endif
+
 [module]
 count = __COUNTER__
@@ -0,0 +1,386 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+"""Quality and performance regression test of processing components.
+
+Runs the components through sof-testbench4 with the benchmark topologies
+in a matrix of sample formats, channel counts and rates. Each run records
+the pipeline MCPS and the heap usage from the testbench summary, and
+the THD+N and frequency response measured from the output. The results
+are compared to a stored baseline and the exit code is 1 if any of them
+has regressed more than the thresholds allow. The MCPS are checked only
+with xt-run, those of the native testbench depend on the host load.
+
+With a reference testbench, for example one built without an optimization,
+the output of each case must also be bit-identical to the output of the
+reference. Only the frames of the input length are compared, the pipeline
+keeps copying stale buffer data for a few periods after the end of input.
+
+Only the Python standard library is needed, the test signals are created
+and analyzed here without Octave or SoX. The measurements are simple
+sine fits, a quick check of a commit rather than the AES17 procedures of
+process_test.m.
+
+Usage: sof_regression.py [-m module,...] [-r testbench] [-u] [-x] [-k] [-v]
+"""
+
+import argparse
+import array
+import json
+import math
+import os
+import platform
+import re
+import subprocess
+import sys
+import tempfile
+
+SOF_DIR = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                        '..', '..', '..'))
+TESTBENCH = os.path.join(SOF_DIR, 'tools/testbench/build_testbench/install/bin/sof-testbench4')
+XT_TESTBENCH = os.path.join(SOF_DIR, 'tools/testbench/build_xt_testbench/sof-testbench4')
+XT_SETUP = os.path.join(SOF_DIR, 'tools/testbench/build_xt_testbench/xtrun_env.sh')
+TPLG_DIR = os.path.join(SOF_DIR, 'tools/build_tools/topology/topology2/development')
+BASELINE = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                        'sof_regression_baseline.json')
+
+# Components with sof-hda-benchmark-<module><bits>.tplg topologies and
+# that are built into sof-testbench4
+MODULES = ['asrc', 'dcblock', 'drc', 'drc_multiband', 'eqfir', 'eqiir', 'gain',
+           'limiter', 'src', 'tdfb', 'aria']
+MODULE_BITS = {'aria': [24]}
+# The playback sink rate of the benchmark topologies is fixed to 48 kHz
+MODULE_RATES = {'asrc': [(48000, 48000), (44100, 48000)],
+                'src': [(48000, 48000), (44100, 48000), (16000, 48000)]}
+DEFAULT_BITS = [16, 32]
+DEFAULT_CHANNELS = [2]
+DEFAULT_RATES = [(48000, 48000)]
+
+# Allowed change from the baseline before a result is a regression. The
+# baseline file can override these for each target.
+THRESHOLDS = {'mcps_percent': 10.0,	# pipeline MCPS increase
+              'heap_bytes': 0,		# heap usage increase
+              'thdn_db': 1.0,		# THD+N increase
+              'fr_db': 0.1}		# largest frequency response difference
+# The MCPS of the native testbench vary with the load of the host, only
+# those of xt-run are cycle exact and checked
+NATIVE_THRESHOLDS = {'mcps_percent': None}
+
+# Test signal, a THD+N sine followed by a stepped sine for the response
+THDN_FREQ = 997.0
+THDN_DBFS = -1.0
+THDN_LENGTH = 1.0
+FR_DBFS = -20.0
+FR_LENGTH = 0.2
+FR_FREQS = [20.0 * 2 ** (i / 3) for i in range(31)]
+
+# Part of the signal segments to analyze, this skips the latency and the
+# transients of the components
+ANALYZE_START = 0.4
+ANALYZE_END = 0.95
+
+# Full scale and sample type code of the raw files
+FORMATS = {16: ('S16_LE', 'h', 2 ** 15),
+           24: ('S24_LE', 'i', 2 ** 23),
+           32: ('S32_LE', 'i', 2 ** 31)}
+
+
+def fr_freqs(fs_in, fs_out):
+    """Stepped sine frequencies that pass the band limit of both rates"""
+    return [f for f in FR_FREQS if f < 0.45 * min(fs_in, fs_out)]
+
+
+def segments(fs_in, fs_out):
+    """Start time, length, frequency and level of each test signal segment"""
+    seg = [(0.0, THDN_LENGTH, THDN_FREQ, THDN_DBFS)]
+    t = THDN_LENGTH
+    for f in fr_freqs(fs_in, fs_out):
+        seg.append((t, FR_LENGTH, f, FR_DBFS))
+        t += FR_LENGTH
+    return seg
+
+
+def write_input(fn, bits, channels, fs_in, fs_out):
+    _, code, scale = FORMATS[bits]
+    peak = scale - 1
+    data = array.array(code)
+    for start, length, freq, dbfs in segments(fs_in, fs_out):
+        amp = scale * 10 ** (dbfs / 20)
+        for n in range(round(length * fs_in)):
+            x = round(amp * math.sin(2 * math.pi * freq * n / fs_in))
+            data.extend([max(-scale, min(peak, x))] * channels)
+
+    if sys.byteorder != 'little':
+        data.byteswap()
+    with open(fn, 'wb') as f:
+        data.tofile(f)
+
+
+def read_output(fn, bits, channels):
+    _, code, scale = FORMATS[bits]
+    data = array.array(code)
+    with open(fn, 'rb') as f:
+        data.frombytes(f.read())
+    if sys.byteorder != 'little':
+        data.byteswap()
+    if bits == 24:
+        # sign extend from bit 23, the upper byte isn't defined
+        data = array.array('i', [((x & 0xffffff) ^ 0x800000) - 0x800000 for x in data])
+    return [[x / scale for x in data[ch::channels]] for ch in range(channels)]
+
+
+def sine_fit(x, freq, fs):
+    """Least squares fit of a sine and DC, returns amplitude and residual power"""
+    n = len(x)
+    sin = [math.sin(2 * math.pi * freq * i / fs) for i in range(n)]
+    cos = [math.cos(2 * math.pi * freq * i / fs) for i in range(n)]
+
+    # normal equations of the sin, cos and DC basis
+    a = [[sum(p * q for p, q in zip(u, v)) for v in (sin, cos)] for u in (sin, cos)]
+    a = [row + [sum(u)] for row, u in zip(a, (sin, cos))]
+    a.append([sum(sin), sum(cos), n])
+    b = [sum(p * q for p, q in zip(u, x)) for u in (sin, cos)] + [sum(x)]
+
+    # Gaussian elimination of the symmetric 3x3 system
+    for k in range(3):
+        for j in range(k + 1, 3):
+            r = a[j][k] / a[k][k]
+            a[j] = [p - r * q for p, q in zip(a[j], a[k])]
+            b[j] -= r * b[k]
+    c = [0.0] * 3
+    for k in (2, 1, 0):
+        c[k] = (b[k] - sum(a[k][j] * c[j] for j in range(k + 1, 3))) / a[k][k]
+
+    residual = sum((y - c[0] * s - c[1] * co - c[2]) ** 2 for y, s, co in zip(x, sin, cos))
+    return math.hypot(c[0], c[1]), residual / n
+
+
+def analyze(out, fs_in, fs_out):
+    """THD+N and frequency response, the worst of the channels"""
+    thdn = 0.0
+    fr = {}
+    for i, (start, length, freq, dbfs) in enumerate(segments(fs_in, fs_out)):
+        i0 = round((start + ANALYZE_START * length) * fs_out)
+        i1 = round((start + ANALYZE_END * length) * fs_out)
+        fits = [sine_fit(ch[i0:i1], freq, fs_out) for ch in out]
+        if i == 0:
+            thdn = max(10 * math.log10(max(noise, 1e-20) / max(amp * amp / 2, 1e-20))
+                       for amp, noise in fits)
+        else:
+            gain = min(20 * math.log10(max(amp, 1e-10)) for amp, _ in fits) - dbfs
+            fr['%.1f' % freq] = round(gain, 3)
+    return round(thdn, 2), fr
+
+
+def heap_option(testbench):
+    """The heap telemetry option of a testbench, older ones don't have it"""
+    p = subprocess.run([testbench, '-h'], stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                       universal_newlines=True, check=False)
+    return ['-H'] if re.search(r'^\s*-H ', p.stdout, re.M) else []
+
+
+def run_testbench(args, case, fn_in, fn_out, testbench):
+    module, bits, channels, fs_in, fs_out = case
+    tplg = os.path.join(args.tplg_dir, 'sof-hda-benchmark-%s%d.tplg' % (module, bits))
+    if not os.path.isfile(tplg):
+        raise RuntimeError('topology %s is not found, build with scripts/build-tools.sh -Y'
+                           % tplg)
+
+    opts = ['-r', str(fs_in), '-R', str(fs_out), '-c', str(channels), '-n', str(channels),
+            '-b', FORMATS[bits][0], '-p', args.pipelines, '-t', tplg,
+            '-i', fn_in, '-o', fn_out, '-d', '1'] + args.heap_opts[testbench]
+    if args.xtrun:
+        cmd = ['bash', '-c', 'source "$0" && "$XTENSA_PATH"/xt-run "$@"', XT_SETUP,
+               testbench] + opts
+    else:
+        cmd = [testbench] + opts
+
+    if args.verbose:
+        print(' '.join(cmd))
+    if os.path.isfile(fn_out):
+        os.remove(fn_out)
+    p = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                       universal_newlines=True, check=False)
+    # a pipeline set up failure doesn't show in the exit code
+    if p.returncode or not os.path.isfile(fn_out):
+        raise RuntimeError('testbench failed:\n' + p.stderr[-2000:])
+
+    mcps = re.search(r'Pipeline MCPS:\s+([\d.]+)', p.stdout)
+    heap = re.search(r'zone all: size \d+ used (\d+)', p.stdout)
+    return (float(mcps.group(1)) if mcps else None,
+            int(heap.group(1)) if heap else None)
+
+
+def run_case(args, case, tmpdir):
+    module, bits, channels, fs_in, fs_out = case
+    fn_in = os.path.join(tmpdir, 'in-%s-%d-%d-%d.raw' % (module, bits, channels, fs_in))
+    fn_out = os.path.join(tmpdir, 'out-%s.raw' % '-'.join(str(x) for x in case))
+    if not os.path.isfile(fn_in):
+        write_input(fn_in, bits, channels, fs_in, fs_out)
+
+    # the lowest MCPS of the runs is the least disturbed by the host
+    mcps = []
+    for _ in range(args.repeat):
+        m, heap = run_testbench(args, case, fn_in, fn_out, args.testbench)
+        if m is not None:
+            mcps.append(m)
+
+    out = read_output(fn_out, bits, channels)
+    thdn, fr = analyze(out, fs_in, fs_out)
+    result = {'mcps': min(mcps) if mcps else None, 'heap_used': heap,
+              'thdn_db': thdn, 'fr_db': fr}
+
+    if args.reference:
+        fn_ref = fn_out.replace('out-', 'ref-', 1)
+        run_testbench(args, case, fn_in, fn_ref, args.reference)
+        ref = read_output(fn_ref, bits, channels)
+        frame_bytes = array.array(FORMATS[bits][1]).itemsize * channels
+        frames = os.path.getsize(fn_in) // frame_bytes * fs_out // fs_in
+        result['identical'] = all(len(a) >= frames and a[:frames] == b[:frames]
+                                  for a, b in zip(out, ref))
+    return result
+
+
+def compare(result, base, thr):
+    """Returns the list of regressions of a result"""
+    fails = []
+    if thr['mcps_percent'] is not None and result['mcps'] is not None and base.get('mcps'):
+        if result['mcps'] > base['mcps'] * (1 + thr['mcps_percent'] / 100):
+            fails.append('MCPS %.2f, baseline %.2f' % (result['mcps'], base['mcps']))
+    if result['heap_used'] is not None and base.get('heap_used') is not None:
+        if result['heap_used'] > base['heap_used'] + thr['heap_bytes']:
+            fails.append('heap %d bytes, baseline %d' % (result['heap_used'],
+                                                        base['heap_used']))
+    if 'thdn_db' in base and result['thdn_db'] > base['thdn_db'] + thr['thdn_db']:
+        fails.append('THD+N %.1f dB, baseline %.1f' % (result['thdn_db'], base['thdn_db']))
+    if 'fr_db' in base:
+        if sorted(base['fr_db']) != sorted(result['fr_db']):
+            fails.append('frequency response points differ from baseline')
+        else:
+            diff = max((abs(g - base['fr_db'][f]), float(f))
+                       for f, g in result['fr_db'].items())
+            if diff[0] > thr['fr_db']:
+                fails.append('response %.2f dB off at %.0f Hz' % diff)
+    return fails
+
+
+def cases(args):
+    for module in args.modules:
+        for bits in MODULE_BITS.get(module, args.bits):
+            for channels in args.channels:
+                for fs_in, fs_out in MODULE_RATES.get(module, DEFAULT_RATES):
+                    yield module, bits, channels, fs_in, fs_out
+
+
+def int_list(s):
+    return [int(x) for x in s.split(',')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-m', '--modules', type=lambda s: s.split(','), default=MODULES,
+                        help='comma separated components, default all')
+    parser.add_argument('-b', '--bits', type=int_list, default=DEFAULT_BITS,
+                        help='comma separated sample formats, default 16,32')
+    parser.add_argument('-c', '--channels', type=int_list, default=DEFAULT_CHANNELS,
+                        help='comma separated channel counts, default 2')
+    parser.add_argument('-p', '--pipelines', default='1,2',
+                        help='pipelines of the topology to run, default 1,2')
+    parser.add_argument('-n', '--repeat', type=int, default=3,
+                        help='testbench runs per case for the MCPS, default 3')
+    parser.add_argument('-f', '--baseline', default=BASELINE,
+                        help='baseline file, default %(default)s')
+    parser.add_argument('-u', '--update', action='store_true',
+                        help='store the results as the new baseline')
+    parser.add_argument('-x', '--xtrun', action='store_true',
+                        help='run the xtensa testbench with xt-run')
+    parser.add_argument('-k', '--keep', metavar='DIR',
+                        help='keep the raw files in the directory')
+    parser.add_argument('-t', '--testbench', help='testbench executable')
+    parser.add_argument('-r', '--reference', metavar='TESTBENCH',
+                        help='testbench executable the output must be bit-identical to')
+    parser.add_argument('--tplg-dir', default=TPLG_DIR, help='benchmark topologies')
+    parser.add_argument('-v', '--verbose', action='store_true')
+    args = parser.parse_args()
+
+    if not args.testbench:
+        args.testbench = XT_TESTBENCH if args.xtrun else TESTBENCH
+    if not os.access(args.testbench, os.X_OK):
+        sys.exit('No executable %s, build with scripts/rebuild-testbench.sh' % args.testbench)
+    if args.reference and not os.access(args.reference, os.X_OK):
+        sys.exit('No executable %s' % args.reference)
+    # the xtensa testbench can't be run for its help
+    args.heap_opts = {tb: ['-H'] if args.xtrun else heap_option(tb)
+                      for tb in (args.testbench, args.reference) if tb}
+
+    # MCPS of native builds depend on the host, keep them apart
+    target = 'xtensa' if args.xtrun else 'native-' + platform.machine()
+    baseline = {}
+    if os.path.isfile(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+    thr = dict(THRESHOLDS, **({} if args.xtrun else NATIVE_THRESHOLDS))
+    thr.update(baseline.get('thresholds', {}).get(target, {}))
+    base = baseline.setdefault('results', {}).setdefault(target, {})
+
+    if args.keep:
+        os.makedirs(args.keep, exist_ok=True)
+        tmp = None
+        tmpdir = args.keep
+    else:
+        tmp = tempfile.TemporaryDirectory(prefix='sof-regression-')
+        tmpdir = tmp.name
+
+    failed = 0
+    print('%-36s %8s %8s %8s  %s' % ('case', 'MCPS', 'heap', 'THD+N', 'result'))
+    for case in cases(args):
+        key = '%s-s%d-%dch-%d-%d' % case
+        try:
+            result = run_case(args, case, tmpdir)
+        except RuntimeError as e:
+            print('%-36s %s' % (key, e))
+            # a component the baseline build doesn't have gets no baseline
+            if not args.update:
+                failed += 1
+            continue
+
+        fails = []
+        if not result.pop('identical', True):
+            fails.append('output differs from reference')
+
+        if args.update:
+            base[key] = result
+            status = 'stored'
+        elif key not in base:
+            status = 'no baseline'
+        else:
+            fails += compare(result, base[key], thr)
+            status = 'pass'
+
+        if fails:
+            status = '; '.join(fails)
+            failed += 1
+
+        mcps = '%.2f' % result['mcps'] if result['mcps'] is not None else '-'
+        heap = str(result['heap_used']) if result['heap_used'] is not None else '-'
+        print('%-36s %8s %8s %8.1f  %s' % (key, mcps, heap, result['thdn_db'], status))
+
+    if tmp:
+        tmp.cleanup()
+
+    if args.update:
+        baseline.setdefault('thresholds', {}).setdefault(target, thr)
+        with open(args.baseline, 'w') as f:
+            json.dump(baseline, f, indent=1, sort_keys=True)
+            f.write('\n')
+        print('Baseline %s updated for %s' % (args.baseline, target))
+
+    if failed:
+        print('%d cases failed' % failed, file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,84 @@
+#!/bin/bash
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+# Runs the playback pipelines of every benchmark topology three times:
+# parsed, parsed and written to the compiled topology cache (-k), and
+# restored from the cache. The outputs must be identical and the last
+# run must use the cache. The topology load times of the parsed and the
+# cached runs are printed.
+
+set -e
+
+usage ()
+{
+    echo "Usage:   $1 [testbench] [topology directory]"
+    echo "Example: $1 ../../testbench/build_testbench/install/bin/sof-testbench4"
+}
+
+# $1 run name, $2 topology, $3 bits, $4.. extra options
+run_testbench ()
+{
+    local name=$1 tplg=$2 bits=$3
+    shift 3
+
+    "$TESTBENCH" -r 48000 -R 48000 -c 2 -n 2 -b "S${bits}_LE" -p 1,2 -t "$tplg" \
+        -i "$WORKDIR/in$bits.raw" -o "$WORKDIR/$name.raw" -d 4 "$@" \
+        > "$WORKDIR/$name.log" 2>&1 || {
+        tail -20 "$WORKDIR/$name.log"
+        return 1
+    }
+}
+
+load_time ()
+{
+    sed -n 's/^debug: topology load time \([0-9]*\) us/\1/p' "$WORKDIR/$1.log"
+}
+
+main ()
+{
+    local tplg name bits fails=0
+
+    if [ $# -gt 2 ]; then
+        usage "$0"
+        exit 1
+    fi
+
+    TESTBENCH=${1:-../../testbench/build_testbench/install/bin/sof-testbench4}
+    TPLG_DIR=${2:-../../build_tools/topology/topology2/development}
+    WORKDIR=$(mktemp -d)
+    trap 'rm -rf "$WORKDIR"' EXIT
+
+    # 1 s of noise in 16 and 32 bits
+    head -c 192000 /dev/urandom > "$WORKDIR/in16.raw"
+    head -c 384000 /dev/urandom > "$WORKDIR/in32.raw"
+
+    printf "%-40s %12s %12s\n" topology "parsed us" "cached us"
+    for tplg in "$TPLG_DIR"/sof-hda-benchmark-*.tplg; do
+        name=$(basename "$tplg" .tplg)
+        bits=${name##*[a-z]}
+        [ "$bits" = 16 ] || bits=32
+        rm -f "$WORKDIR/cache"
+
+        if ! run_testbench parsed "$tplg" "$bits" ||
+           ! run_testbench write "$tplg" "$bits" -k "$WORKDIR/cache" ||
+           ! run_testbench cached "$tplg" "$bits" -k "$WORKDIR/cache"; then
+            echo "$name: testbench failed"
+            fails=$((fails + 1))
+        elif ! grep -q "topology loaded from cache" "$WORKDIR/cached.log"; then
+            echo "$name: the cache was not used"
+            fails=$((fails + 1))
+        elif ! cmp -s "$WORKDIR/parsed.raw" "$WORKDIR/write.raw" ||
+             ! cmp -s "$WORKDIR/parsed.raw" "$WORKDIR/cached.raw"; then
+            echo "$name: output differs with the cache"
+            fails=$((fails + 1))
+        else
+            printf "%-40s %12s %12s\n" "$name" "$(load_time parsed)" "$(load_time cached)"
+        fi
+    done
+
+    echo "$fails failed"
+    [ "$fails" -eq 0 ]
+}
+
+main "$@"
@@ -38,6 +38,8 @@ int tb_delete_pipeline(struct testbench_prm *tp, struct tplg_pipeline_info *pipe
 int tb_free_all_pipelines(struct testbench_prm *tp);
 int tb_free_route(struct testbench_prm *tp, struct tplg_route_info *route_info);
 int tb_get_instance_id_from_pipeline_id(struct testbench_prm *tp, int id);
+int tb_ipc4_batch_begin(struct testbench_prm *tp);
+int tb_ipc4_batch_end(struct testbench_prm *tp);
 int tb_is_single_format(struct sof_ipc4_pin_format *fmts, int num_formats);
 int tb_match_audio_format(struct testbench_prm *tp, struct tplg_comp_info *comp_info,
 			  struct tb_config *config);
@@ -48,6 +50,7 @@ int tb_new_process(struct testbench_prm *tp);
 int tb_pipelines_set_state(struct testbench_prm *tp, int state, int dir);
 int tb_send_bytes_data(struct tb_mq_desc *ipc_tx, struct tb_mq_desc *ipc_rx,
 		       uint32_t module_id, uint32_t instance_id, struct sof_abi_hdr *abi);
+int tb_set_file_config(struct testbench_prm *tp, struct tplg_comp_info *comp_info);
 int tb_set_reset_state(struct testbench_prm *tp);
 int tb_set_running_state(struct testbench_prm *tp);
 int tb_set_up_pipeline(struct testbench_prm *tp, struct tplg_pipeline_info *pipe_info);
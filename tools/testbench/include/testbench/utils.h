@@ -41,8 +41,11 @@ struct file_comp_lookup {
 #define TB_MAX_DATA_SIZE	512
 #define TB_MAX_CTLS		16
 
+struct tb_ipc4_batch;
+
 struct tb_mq_desc {
 	char queue_name[TB_NAME_SIZE];
+	struct tb_ipc4_batch *batch;	/* messages queued for a pipeline batch */
 };
 
 struct tb_config {
@@ -92,12 +95,14 @@ struct testbench_prm {
 	char *input_file[TB_MAX_INPUT_FILE_NUM]; /* input file names */
 	char *output_file[TB_MAX_OUTPUT_FILE_NUM]; /* output file names */
 	char *tplg_file; /* topology file to use */
+	char *tplg_cache; /* compiled topology cache file */
 	char *bits_in; /* input bit format */
 	int input_file_num; /* number of input files */
 	int output_file_num; /* number of output files */
 	int pipeline_num;
 	int copy_iterations;
 	bool copy_check;
+	bool heap_telemetry; /* print heap telemetry after the test */
 	int trace_level;
 	int dynamic_pipeline_iterations;
 	int tick_period_us;
@@ -164,5 +169,6 @@ void tb_free_topology(struct testbench_prm *tp);
 void tb_getcycles(uint64_t *cycles);
 void tb_gettime(struct timespec *td);
 void tb_show_file_stats(struct testbench_prm *tp, int pipeline_id);
+void tb_show_heap_telemetry(void);
 
 #endif /* _TESTBENCH_UTILS_H */
@@ -118,7 +118,8 @@ static void print_usage(char *executable)
 	printf("Usage: %s <options> -i <input_file> ", executable);
 	printf("-o <output_file1,output_file2,...>\n\n");
 	printf("Options for processing:\n");
-	printf("  -t <topology file>\n\n");
+	printf("  -t <topology file>\n");
+	printf("  -k <compiled topology cache file, IPC4 only>\n\n");
 	printf("Options to control test:\n");
 	printf("  -d <level> Sets the traces print level:\n");
 	printf("     0 all traces are suppressed\n");
@@ -130,7 +131,8 @@ static void print_usage(char *executable)
 	printf("  -C <number of copy() iterations>\n");
 	printf("  -D <pipeline duration in ms>\n");
 	printf("  -P <number of dynamic pipeline iterations>\n");
-	printf("  -T <microseconds for tick, 0 for batch mode>\n\n");
+	printf("  -T <microseconds for tick, 0 for batch mode>\n");
+	printf("  -H Print heap telemetry after the test\n\n");
 	printf("Options for input and output format override:\n");
 	printf("  -b <input_format>, S16_LE, S24_LE, or S32_LE\n");
 	printf("  -c <input channels>\n");
@@ -148,7 +150,7 @@ static int parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 	int option = 0;
 	int ret = 0;
 
-	while ((option = getopt(argc, argv, "hd:i:o:t:b:r:R:c:n:C:P:p:T:D:")) != -1) {
+	while ((option = getopt(argc, argv, "hHd:i:o:t:k:b:r:R:c:n:C:P:p:T:D:")) != -1) {
 		switch (option) {
 		/* input sample file */
 		case 'i':
@@ -165,6 +167,11 @@ static int parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 			tp->tplg_file = strdup(optarg);
 			break;
 
+		/* compiled topology cache */
+		case 'k':
+			tp->tplg_cache = strdup(optarg);
+			break;
+
 		/* input samples bit format */
 		case 'b':
 			tp->bits_in = strdup(optarg);
@@ -228,6 +235,11 @@ static int parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 			tp->pipeline_duration_ms = atoi(optarg);
 			break;
 
+		/* heap telemetry dump */
+		case 'H':
+			tp->heap_telemetry = true;
+			break;
+
 		/* print usage */
 		case 'h':
 			print_usage(argv[0]);
@@ -305,6 +317,9 @@ static void test_pipeline_stats(struct testbench_prm *tp, long long delta_t)
 		printf("Total execution time: %lld us, %.2f x realtime\n",
 		       delta_t, (float)frames_out / tp->fs_out * 1000000 / delta_t);
 
+	if (tp->heap_telemetry)
+		tb_show_heap_telemetry();
+
 	printf("\n");
 }
 
@@ -500,6 +515,7 @@ out:
 	/* free all other data */
 	free(tp->bits_in);
 	free(tp->tplg_file);
+	free(tp->tplg_cache);
 	for (i = 0; i < tp->output_file_num; i++)
 		free(tp->output_file[i]);
 
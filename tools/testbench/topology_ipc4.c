@@ -53,17 +53,162 @@ static int tb_ipc_message(void *mailbox, size_t bytes)
 	return 0;
 }
 
+/*
+ * Pipeline batch. While the pipelines are set up the pipeline, module init,
+ * bind and single block bytes control messages are queued and sent to the
+ * firmware as SOF_IPC4_GLB_PIPELINE_BATCH messages. The batch is sent when
+ * the next message doesn't fit in it, before any other message and when
+ * the set up is complete.
+ */
+#define TB_IPC4_BATCH_MAX_SIZE	(SOF_IPC_MSG_MAX_SIZE - sizeof(struct ipc4_pipeline_batch))
+
+struct tb_ipc4_batch {
+	uint32_t count;
+	size_t size;
+	union {
+		struct ipc4_pipeline_batch hdr;
+		struct ipc4_message_reply reply;
+		char mailbox[SOF_IPC_MSG_MAX_SIZE];
+	};
+};
+
+static bool tb_ipc4_batch_can_queue(void *msg, size_t len)
+{
+	struct ipc4_module_large_config *config = msg;
+	struct ipc4_message_request *req = msg;
+
+	if (len < sizeof(*req) || (len - sizeof(*req)) % sizeof(uint32_t))
+		return false;
+
+	if (req->primary.r.msg_tgt == SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG)
+		return req->primary.r.type == SOF_IPC4_GLB_CREATE_PIPELINE;
+
+	switch (req->primary.r.type) {
+	case SOF_IPC4_MOD_INIT_INSTANCE:
+	case SOF_IPC4_MOD_BIND:
+		return true;
+	case SOF_IPC4_MOD_LARGE_CONFIG_SET:
+		return config->primary.r.module_id && config->extension.r.init_block &&
+			config->extension.r.final_block;
+	default:
+		return false;
+	}
+}
+
+static int tb_ipc4_batch_send(struct tb_ipc4_batch *batch)
+{
+	const struct ipc4_pipeline_batch_entry *entry;
+	uint32_t count = batch->count;
+	uint32_t failed;
+	uint32_t i;
+	int status;
+
+	if (!count)
+		return 0;
+
+	batch->hdr.primary.dat = 0;
+	batch->hdr.primary.r.count = count;
+	batch->hdr.primary.r.type = SOF_IPC4_GLB_PIPELINE_BATCH;
+	batch->hdr.primary.r.msg_tgt = SOF_IPC4_MESSAGE_TARGET_FW_GEN_MSG;
+	batch->hdr.primary.r.rsp = SOF_IPC4_MESSAGE_DIR_MSG_REQUEST;
+	batch->hdr.extension.dat = 0;
+	batch->hdr.extension.r.data_size = batch->size;
+
+	tb_ipc_message(batch->mailbox, sizeof(batch->hdr) + batch->size);
+	batch->count = 0;
+	batch->size = 0;
+
+	status = batch->reply.primary.r.status;
+	if (status == IPC4_SUCCESS)
+		return 0;
+
+	/* the reply overwrote only the header of the batch */
+	failed = batch->reply.extension.dat;
+	if (failed >= count) {
+		fprintf(stderr, "error: pipeline batch of %u entries failed with status %d\n",
+			count, status);
+		return -EINVAL;
+	}
+
+	entry = (const struct ipc4_pipeline_batch_entry *)(batch->mailbox + sizeof(batch->hdr));
+	for (i = 0; i < failed; i++)
+		entry = (const void *)((const char *)entry->data + entry->size);
+
+	fprintf(stderr, "error: pipeline batch entry %u of %u (0x%x 0x%x) failed with status %d\n",
+		failed, count, entry->primary, entry->extension, status);
+	return -EINVAL;
+}
+
+static int tb_ipc4_batch_queue(struct tb_ipc4_batch *batch, void *msg, size_t len)
+{
+	struct ipc4_pipeline_batch_entry *entry;
+	struct ipc4_message_request *req = msg;
+	size_t size = len - sizeof(*req);
+	int ret;
+
+	if (batch->size + sizeof(*entry) + size > TB_IPC4_BATCH_MAX_SIZE) {
+		ret = tb_ipc4_batch_send(batch);
+		if (ret < 0)
+			return ret;
+	}
+
+	entry = (struct ipc4_pipeline_batch_entry *)(batch->mailbox + sizeof(batch->hdr) +
+						     batch->size);
+	entry->primary = req->primary.dat;
+	entry->extension = req->extension.dat;
+	entry->size = size;
+	memcpy(entry->data, (char *)msg + sizeof(*req), size);
+
+	batch->size += sizeof(*entry) + size;
+	batch->count++;
+
+	return 0;
+}
+
+int tb_ipc4_batch_begin(struct testbench_prm *tp)
+{
+	tp->ipc_tx.batch = calloc(1, sizeof(*tp->ipc_tx.batch));
+	if (!tp->ipc_tx.batch)
+		return -ENOMEM;
+
+	return 0;
+}
+
+int tb_ipc4_batch_end(struct testbench_prm *tp)
+{
+	int ret = tb_ipc4_batch_send(tp->ipc_tx.batch);
+
+	free(tp->ipc_tx.batch);
+	tp->ipc_tx.batch = NULL;
+
+	return ret;
+}
+
 static int tb_mq_cmd_tx_rx(struct tb_mq_desc *ipc_tx, struct tb_mq_desc *ipc_rx,
 			   void *msg, size_t len, void *reply, size_t rlen)
 {
 	char mailbox[TB_IPC4_MAX_MSG_SIZE];
 	struct ipc4_message_reply *reply_msg = reply;
+	int ret;
 
 	if (len > TB_IPC4_MAX_MSG_SIZE || rlen > TB_IPC4_MAX_MSG_SIZE) {
 		fprintf(stderr, "ipc: message too big len=%zu rlen=%zu\n", len, rlen);
 		return -EINVAL;
 	}
 
+	if (ipc_tx->batch) {
+		/* the status of a queued message comes with the reply to the batch */
+		if (tb_ipc4_batch_can_queue(msg, len)) {
+			memset(reply, 0, rlen);
+			return tb_ipc4_batch_queue(ipc_tx->batch, msg, len);
+		}
+
+		/* the queued messages go first */
+		ret = tb_ipc4_batch_send(ipc_tx->batch);
+		if (ret < 0)
+			return ret;
+	}
+
 	memset(mailbox, 0, TB_IPC4_MAX_MSG_SIZE);
 	memcpy(mailbox, msg, len);
 	tb_ipc_message(mailbox, len);
@@ -530,7 +675,7 @@ int tb_pipelines_set_state(struct testbench_prm *tp, int state, int dir)
 
 static int tb_new_src(struct testbench_prm *tp)
 {
-	struct ipc4_config_src src;
+	struct ipc4_config_src src = {0};
 	struct tplg_context *ctx = &tp->tplg;
 	struct tplg_comp_info *comp_info = ctx->current_comp_info;
 	struct snd_soc_tplg_ctl_hdr *tplg_ctl;
@@ -727,6 +872,59 @@ static int tb_new_buffer(struct testbench_prm *tp)
 	return ret;
 }
 
+/* Set the file formats and names from the testbench command line */
+int tb_set_file_config(struct testbench_prm *tp, struct tplg_comp_info *comp_info)
+{
+	struct ipc4_file_module_cfg *file = comp_info->ipc_payload;
+	struct file_comp_lookup *fcl;
+	const char *type;
+
+	switch (comp_info->type) {
+	case SND_SOC_TPLG_DAPM_AIF_IN:
+	case SND_SOC_TPLG_DAPM_DAI_OUT:
+		file->config.mode = FILE_READ;
+		file->config.rate = tp->fs_in;
+		file->config.channels = tp->channels_in;
+		break;
+	case SND_SOC_TPLG_DAPM_AIF_OUT:
+	case SND_SOC_TPLG_DAPM_DAI_IN:
+		file->config.mode = FILE_WRITE;
+		file->config.rate = tp->fs_out;
+		file->config.channels = tp->channels_out;
+		break;
+	default:
+		return 0;
+	}
+
+	type = comp_info->type == SND_SOC_TPLG_DAPM_DAI_IN ||
+	       comp_info->type == SND_SOC_TPLG_DAPM_DAI_OUT ? "dai" : "aif";
+	file->config.frame_fmt = tp->frame_fmt;
+	file->config.fn = NULL;
+	if (!tb_is_pipeline_enabled(tp, comp_info->pipeline_id))
+		return 0;
+
+	if (file->config.mode == FILE_READ) {
+		if (tp->input_file_index >= tp->input_file_num) {
+			fprintf(stderr, "error: not enough input files for %s\n", type);
+			return -EINVAL;
+		}
+		file->config.fn = tp->input_file[tp->input_file_index];
+		fcl = &tp->fr[tp->input_file_index++];
+	} else {
+		if (tp->output_file_index >= tp->output_file_num) {
+			fprintf(stderr, "error: not enough output files for %s\n", type);
+			return -EINVAL;
+		}
+		file->config.fn = tp->output_file[tp->output_file_index];
+		fcl = &tp->fw[tp->output_file_index++];
+	}
+
+	fcl->id = comp_info->module_id;
+	fcl->instance_id = comp_info->instance_id;
+	fcl->pipeline_id = comp_info->pipeline_id;
+	return 0;
+}
+
 int tb_new_aif_in_out(struct testbench_prm *tp, int dir)
 {
 	struct tplg_context *ctx = &tp->tplg;
@@ -743,53 +941,22 @@ int tb_new_aif_in_out(struct testbench_prm *tp, int dir)
 	if (!comp_info->ipc_payload)
 		return -ENOMEM;
 
-	if (dir == SOF_IPC_STREAM_PLAYBACK) {
-		/* Set from testbench command line*/
-		file = (struct ipc4_file_module_cfg *)comp_info->ipc_payload;
-		file->config.mode = FILE_READ;
-		file->config.rate = tp->fs_in;
-		file->config.channels = tp->channels_in;
-		file->config.frame_fmt = tp->frame_fmt;
-		file->config.direction = dir;
+	file = (struct ipc4_file_module_cfg *)comp_info->ipc_payload;
+	file->config.direction = dir;
 
+	if (dir == SOF_IPC_STREAM_PLAYBACK) {
 		comp_info->instance_id = tp->instance_ids[SND_SOC_TPLG_DAPM_AIF_IN]++;
 		comp_info->module_id = TB_FILE_OUT_AIF_MODULE_ID;
-		if (tb_is_pipeline_enabled(tp, ctx->pipeline_id)) {
-			if (tp->input_file_index >= tp->input_file_num) {
-				fprintf(stderr, "error: not enough input files for aif\n");
-				return -EINVAL;
-			}
-			file->config.fn = tp->input_file[tp->input_file_index];
-			tp->fr[tp->input_file_index].id = comp_info->module_id;
-			tp->fr[tp->input_file_index].instance_id = comp_info->instance_id;
-			tp->fr[tp->input_file_index].pipeline_id = ctx->pipeline_id;
-			tp->input_file_index++;
-		}
-
-		tb_setup_widget_ipc_msg(comp_info);
 	} else {
-		file = (struct ipc4_file_module_cfg *)comp_info->ipc_payload;
-		file->config.mode = FILE_WRITE;
-		file->config.rate = tp->fs_out;
-		file->config.channels = tp->channels_out;
-		file->config.frame_fmt = tp->frame_fmt;
-		file->config.direction = dir;
-
 		comp_info->instance_id = tp->instance_ids[SND_SOC_TPLG_DAPM_AIF_OUT]++;
 		comp_info->module_id = TB_FILE_IN_AIF_MODULE_ID;
-		if (tb_is_pipeline_enabled(tp, ctx->pipeline_id)) {
-			if (tp->output_file_index >= tp->output_file_num) {
-				fprintf(stderr, "error: not enough output files for aif\n");
-				return -EINVAL;
-			}
-			file->config.fn = tp->output_file[tp->output_file_index];
-			tp->fw[tp->output_file_index].id = comp_info->module_id;
-			tp->fw[tp->output_file_index].instance_id = comp_info->instance_id;
-			tp->fw[tp->output_file_index].pipeline_id = ctx->pipeline_id;
-			tp->output_file_index++;
-		}
 	}
 
+	/* Set from testbench command line*/
+	ret = tb_set_file_config(tp, comp_info);
+	if (ret < 0)
+		return ret;
+
 	tb_setup_widget_ipc_msg(comp_info);
 	memcpy(comp_info->ipc_payload + sizeof(struct ipc4_file_module_cfg), &tb_file_uuid,
 	       sizeof(struct sof_uuid));
@@ -812,52 +979,22 @@ int tb_new_dai_in_out(struct testbench_prm *tp, int dir)
 	if (!comp_info->ipc_payload)
 		return -ENOMEM;
 
-	if (dir == SOF_IPC_STREAM_PLAYBACK) {
-		/* Set from testbench command line*/
-		file = (struct ipc4_file_module_cfg *)comp_info->ipc_payload;
-		file->config.mode = FILE_WRITE;
-		file->config.rate = tp->fs_out;
-		file->config.channels = tp->channels_out;
-		file->config.frame_fmt = tp->frame_fmt;
-		file->config.direction = dir;
+	file = (struct ipc4_file_module_cfg *)comp_info->ipc_payload;
+	file->config.direction = dir;
 
+	if (dir == SOF_IPC_STREAM_PLAYBACK) {
 		comp_info->instance_id = tp->instance_ids[SND_SOC_TPLG_DAPM_DAI_OUT]++;
 		comp_info->module_id = TB_FILE_OUT_DAI_MODULE_ID;
-		if (tb_is_pipeline_enabled(tp, ctx->pipeline_id)) {
-			if (tp->output_file_index >= tp->output_file_num) {
-				fprintf(stderr, "error: not enough output files for dai\n");
-				return -EINVAL;
-			}
-			file->config.fn = tp->output_file[tp->output_file_index];
-			tp->fw[tp->output_file_index].id = comp_info->module_id;
-			tp->fw[tp->output_file_index].instance_id = comp_info->instance_id;
-			tp->fw[tp->output_file_index].pipeline_id = ctx->pipeline_id;
-			tp->output_file_index++;
-		}
-		tb_setup_widget_ipc_msg(comp_info);
 	} else {
-		file = (struct ipc4_file_module_cfg *)comp_info->ipc_payload;
-		file->config.mode = FILE_READ;
-		file->config.rate = tp->fs_in;
-		file->config.channels = tp->channels_in;
-		file->config.frame_fmt = tp->frame_fmt;
-		file->config.direction = dir;
-
 		comp_info->instance_id = tp->instance_ids[SND_SOC_TPLG_DAPM_DAI_IN]++;
 		comp_info->module_id = TB_FILE_IN_DAI_MODULE_ID;
-		if (tb_is_pipeline_enabled(tp, ctx->pipeline_id)) {
-			if (tp->input_file_index >= tp->input_file_num) {
-				fprintf(stderr, "error: not enough input files for dai\n");
-				return -EINVAL;
-			}
-			file->config.fn = tp->input_file[tp->input_file_index];
-			tp->fr[tp->input_file_index].id = comp_info->module_id;
-			tp->fr[tp->input_file_index].instance_id = comp_info->instance_id;
-			tp->fr[tp->input_file_index].pipeline_id = ctx->pipeline_id;
-			tp->input_file_index++;
-		}
 	}
 
+	/* Set from testbench command line*/
+	ret = tb_set_file_config(tp, comp_info);
+	if (ret < 0)
+		return ret;
+
 	tb_setup_widget_ipc_msg(comp_info);
 	memcpy(comp_info->ipc_payload + sizeof(struct ipc4_file_module_cfg), &tb_file_uuid,
 	       sizeof(struct sof_uuid));
@@ -1360,6 +1497,108 @@ static int tb_kcontrol_cb_new(struct snd_soc_tplg_ctl_hdr *tplg_ctl,
 	return 0;
 }
 
+/* testbench state stored along with the parsed topology in the cache */
+struct tb_tplg_cache_priv {
+	int instance_ids[SND_SOC_TPLG_DAPM_LAST];
+	int comp_id;
+	uint32_t num_ctls;
+	struct tb_ctl ctl[];
+};
+
+static void tb_tplg_cache_data(struct testbench_prm *tp, struct tplg_cache_data *data)
+{
+	data->widget_list = &tp->widget_list;
+	data->route_list = &tp->route_list;
+	data->pcm_list = &tp->pcm_list;
+	data->pipeline_list = &tp->pipeline_list;
+}
+
+/* the instance IDs of a cached topology are only valid for the first load */
+static bool tb_tplg_cache_usable(struct testbench_prm *tp)
+{
+	int i;
+
+	for (i = 0; i < SND_SOC_TPLG_DAPM_LAST; i++)
+		if (tp->instance_ids[i])
+			return false;
+
+	return true;
+}
+
+/* returns 1 when the topology was restored from the cache, 0 for a cache miss */
+static int tb_read_topology_cache(struct testbench_prm *tp, uint64_t hash)
+{
+	struct tplg_context *ctx = &tp->tplg;
+	struct tplg_cache_data data = { NULL };
+	struct tb_tplg_cache_priv *priv;
+	struct list_item *item;
+	int ret;
+
+	tb_tplg_cache_data(tp, &data);
+	ret = tplg_cache_read(tp->tplg_cache, hash, &data);
+	if (ret < 0) {
+		if (ret != -ENOENT)
+			fprintf(stderr, "Info: topology cache %s not used: %d\n",
+				tp->tplg_cache, ret);
+		return 0;
+	}
+
+	priv = data.priv;
+	if (data.priv_size < sizeof(*priv) || priv->num_ctls > TB_MAX_CTLS ||
+	    data.priv_size != sizeof(*priv) + priv->num_ctls * sizeof(struct tb_ctl)) {
+		fprintf(stderr, "Info: topology cache %s has no testbench state\n",
+			tp->tplg_cache);
+		tplg_cache_free(&data);
+		return 0;
+	}
+
+	memcpy(tp->instance_ids, priv->instance_ids, sizeof(tp->instance_ids));
+	ctx->comp_id = priv->comp_id;
+	memcpy(tp->glb_ctx.ctl, priv->ctl, priv->num_ctls * sizeof(struct tb_ctl));
+	tp->glb_ctx.num_ctls = priv->num_ctls;
+	tp->glb_ctx.size += priv->num_ctls * sizeof(struct tb_ctl);
+	free(priv);
+
+	/* file names and formats are not part of the cache */
+	list_for_item(item, &tp->widget_list) {
+		struct tplg_comp_info *comp_info = container_of(item, struct tplg_comp_info, item);
+
+		ret = tb_set_file_config(tp, comp_info);
+		if (ret < 0)
+			return ret;
+	}
+
+	fprintf(stderr, "Info: topology loaded from cache %s\n", tp->tplg_cache);
+	return 1;
+}
+
+static void tb_write_topology_cache(struct testbench_prm *tp, uint64_t hash)
+{
+	struct tplg_cache_data data = { NULL };
+	struct tb_tplg_cache_priv *priv;
+	uint32_t num_ctls = tp->glb_ctx.num_ctls;
+	int ret;
+
+	data.priv_size = sizeof(*priv) + num_ctls * sizeof(struct tb_ctl);
+	priv = calloc(data.priv_size, 1);
+	if (!priv)
+		return;
+
+	memcpy(priv->instance_ids, tp->instance_ids, sizeof(priv->instance_ids));
+	priv->comp_id = tp->tplg.comp_id;
+	priv->num_ctls = num_ctls;
+	memcpy(priv->ctl, tp->glb_ctx.ctl, num_ctls * sizeof(struct tb_ctl));
+
+	tb_tplg_cache_data(tp, &data);
+	data.priv = priv;
+	ret = tplg_cache_write(tp->tplg_cache, hash, &data);
+	if (ret < 0)
+		fprintf(stderr, "warning: failed to write topology cache %s: %d\n",
+			tp->tplg_cache, ret);
+
+	free(priv);
+}
+
 /* parse topology file and set up pipeline */
 int tb_parse_topology(struct testbench_prm *tp)
 
@@ -1367,6 +1606,8 @@ int tb_parse_topology(struct testbench_prm *tp)
 	struct tplg_context *ctx = &tp->tplg;
 	struct snd_soc_tplg_hdr *hdr;
 	struct list_item *item;
+	bool use_cache = false;
+	uint64_t hash;
 	int i;
 	int ret = 0;
 	FILE *file;
@@ -1380,6 +1621,21 @@ int tb_parse_topology(struct testbench_prm *tp)
 		return -ENOMEM;
 	}
 
+	/* initialize widget, route, pipeline and pcm lists */
+	list_init(&tp->widget_list);
+	list_init(&tp->route_list);
+	list_init(&tp->pcm_list);
+	list_init(&tp->pipeline_list);
+
+	/* use the compiled topology if the cache matches the topology file */
+	if (tp->tplg_cache && tb_tplg_cache_usable(tp) &&
+	    !tplg_cache_hash(ctx->tplg_file, &hash)) {
+		use_cache = true;
+		ret = tb_read_topology_cache(tp, hash);
+		if (ret)
+			return ret < 0 ? ret : 0;
+	}
+
 	/* open topology file */
 	file = fopen(ctx->tplg_file, "rb");
 	if (!file) {
@@ -1420,12 +1676,6 @@ int tb_parse_topology(struct testbench_prm *tp)
 	}
 	fclose(file);
 
-	/* initialize widget, route, pipeline and pcm lists */
-	list_init(&tp->widget_list);
-	list_init(&tp->route_list);
-	list_init(&tp->pcm_list);
-	list_init(&tp->pipeline_list);
-
 	while (ctx->tplg_offset < ctx->tplg_size) {
 		/* read next topology header */
 		hdr = tplg_get_hdr(ctx);
@@ -1499,6 +1749,9 @@ int tb_parse_topology(struct testbench_prm *tp)
 		}
 	}
 
+	if (use_cache)
+		tb_write_topology_cache(tp, hash);
+
 	return 0;
 
 out:
@@ -6,8 +6,10 @@
 #include <platform/lib/ll_schedule.h>
 #include <sof/audio/component.h>
 #include <sof/ipc/topology.h>
+#include <sof/lib/heap_telemetry.h>
 #include <sof/lib/notifier.h>
 
+#include <inttypes.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,8 +26,11 @@
 int tb_load_topology(struct testbench_prm *tp)
 {
 	struct tplg_context *ctx = &tp->tplg;
+	struct timespec td0, td1;
 	int ret;
 
+	tb_gettime(&td0);
+
 	/* setup the thread virtual core config */
 	memset(ctx, 0, sizeof(*ctx));
 	ctx->comp_id = 1;
@@ -38,6 +43,12 @@ int tb_load_topology(struct testbench_prm *tp)
 	if (ret < 0)
 		fprintf(stderr, "error: parsing topology\n");
 
+	tb_gettime(&td1);
+	if (tb_check_trace(LOG_LEVEL_DEBUG))
+		printf("debug: topology load time %lld us\n",
+		       (td1.tv_sec - td0.tv_sec) * 1000000LL +
+		       (td1.tv_nsec - td0.tv_nsec) / 1000);
+
 	tb_debug_print("topology parsing complete\n");
 	return ret;
 }
@@ -158,6 +169,72 @@ void tb_show_file_stats(struct testbench_prm *tp, int pipeline_id)
 	}
 }
 
+static void tb_show_latency(const char *name, const struct heap_telemetry_latency *latency,
+			    uint32_t ticks_per_ms)
+{
+	double us = 1000.0 / ticks_per_ms;
+
+	printf("%s latency: count %u p50 %.2f us p90 %.2f us p99 %.2f us max %.2f us\n",
+	       name, latency->count, latency->p50 * us, latency->p90 * us,
+	       latency->p99 * us, latency->max * us);
+}
+
+void tb_show_heap_telemetry(void)
+{
+#if CONFIG_DEBUG_HEAP_TELEMETRY
+	size_t size = sizeof(struct heap_telemetry_data) +
+		HEAP_TELEMETRY_CALLERS * sizeof(struct heap_telemetry_caller);
+	struct heap_telemetry_data *data = malloc(size);
+	unsigned int i;
+
+	if (!data || !heap_telemetry_get(data, size)) {
+		fprintf(stderr, "error: failed to get heap telemetry\n");
+		free(data);
+		return;
+	}
+
+	printf("Heap telemetry:\n");
+	for (i = 0; i < data->num_zones; i++) {
+		const struct heap_telemetry_zone *zone = data->zones + i;
+
+		if (zone->zone == HEAP_TELEMETRY_ZONE_ALL)
+			printf("zone all:");
+		else
+			printf("zone %u:", zone->zone);
+		printf(" size %u used %u free %u largest free %u\n",
+		       zone->size, zone->used, zone->free, zone->largest_free);
+	}
+
+	for (i = 0; i < HEAP_TELEMETRY_ZONES; i++)
+		if (data->allocs[i])
+			printf("zone %u: allocs %u failures %u\n", i, data->allocs[i],
+			       data->failures[i]);
+	printf("frees %u\n", data->frees);
+
+	tb_show_latency("alloc", &data->alloc_latency, data->ticks_per_ms);
+	tb_show_latency("free", &data->free_latency, data->ticks_per_ms);
+
+	printf("allocation sizes:");
+	for (i = 0; i < HEAP_TELEMETRY_BINS; i++)
+		if (data->size_hist[i])
+			printf(" <%llu: %u", 1ULL << i, data->size_hist[i]);
+	printf("\n");
+
+	printf("callers (untracked allocs %u):\n", data->caller_overflow);
+	for (i = 0; i < data->num_callers; i++) {
+		const struct heap_telemetry_caller *caller = data->callers + i;
+
+		printf("  %#" PRIx64 ": allocs %u failures %u bytes %u max %u\n",
+		       caller->caller, caller->allocs, caller->failures, caller->bytes,
+		       caller->max_bytes);
+	}
+
+	free(data);
+#else
+	printf("Heap telemetry: not enabled, set CONFIG_DEBUG_HEAP_TELEMETRY\n");
+#endif
+}
+
 bool tb_is_pipeline_enabled(struct testbench_prm *tp, int pipeline_id)
 {
 	int i;
@@ -248,11 +325,18 @@ void tb_gettime(struct timespec *td)
 #endif
 }
 
+/*
+ * Native builds count the thread CPU time in nanoseconds, the MCPS that
+ * is reported is then for a 1 GHz equivalent of the host CPU.
+ */
 void tb_getcycles(uint64_t *cycles)
 {
 #if defined __XCC__
 	*cycles = XT_RSR_CCOUNT();
 #else
-	*cycles = 0;
+	struct timespec ts;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	*cycles = (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
 #endif
 }
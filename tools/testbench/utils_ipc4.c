@@ -55,6 +55,7 @@ int tb_setup(struct sof *sof, struct testbench_prm *tp)
 	sys_comp_module_gain_interface_init();
 	sys_comp_module_google_rtc_audio_processing_interface_init();
 	sys_comp_module_igo_nr_interface_init();
+	sys_comp_module_limiter_interface_init();
 	sys_comp_module_mfcc_interface_init();
 	sys_comp_module_mixin_interface_init();
 	sys_comp_module_mixout_interface_init();
@@ -64,6 +65,7 @@ int tb_setup(struct sof *sof, struct testbench_prm *tp)
 	sys_comp_module_selector_interface_init();
 	sys_comp_module_src_interface_init();
 	sys_comp_module_asrc_interface_init();
+	sys_comp_module_stft_interface_init();
 	sys_comp_module_tdfb_interface_init();
 	sys_comp_module_volume_interface_init();
 
@@ -450,15 +452,28 @@ int tb_set_up_all_pipelines(struct testbench_prm *tp)
 {
 	int ret;
 
+	/* the set up messages are sent in pipeline batches */
+	ret = tb_ipc4_batch_begin(tp);
+	if (ret < 0)
+		return ret;
+
 	ret = tb_set_up_pipelines(tp, SOF_IPC_STREAM_PLAYBACK);
 	if (ret) {
 		fprintf(stderr, "error: Failed tb_set_up_pipelines for playback\n");
+		tb_ipc4_batch_end(tp);
 		return ret;
 	}
 
 	ret = tb_set_up_pipelines(tp, SOF_IPC_STREAM_CAPTURE);
 	if (ret) {
 		fprintf(stderr, "error: Failed tb_set_up_pipelines for capture\n");
+		tb_ipc4_batch_end(tp);
+		return ret;
+	}
+
+	ret = tb_ipc4_batch_end(tp);
+	if (ret) {
+		fprintf(stderr, "error: Failed to send the pipeline batch\n");
 		return ret;
 	}
 
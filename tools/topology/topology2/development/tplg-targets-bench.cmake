@@ -16,9 +16,11 @@ set(components
 	"eqfir"
 	"gain"
 	"igo_nr"
+	"limiter"
 	"rtnr"
 	"src"
 	"src_lite"
+	"stft"
 	"tdfb"
 )
 
@@ -31,9 +33,11 @@ set(component_parameters
 	"BENCH_EQFIR_PARAMS=loudness"
 	"BENCH_GAIN_PARAMS=default"
 	"BENCH_IGO_NR_PARAMS=default"
+	"BENCH_LIMITER_PARAMS=default"
 	"BENCH_RTNR_PARAMS=default"
 	"BENCH_SRC_PARAMS=default"
 	"BENCH_SRC_LITE_PARAMS=default"
+	"BENCH_STFT_PARAMS=default"
 	"BENCH_TDFB_PARAMS=default"
 )
 
@@ -45,6 +49,14 @@ set(component_parameters_s24
 	"BENCH_ARIA_PARAMS=param_2"
 )
 
+set(components_s32
+	"asrc_multich"
+)
+
+set(component_parameters_s32
+	"BENCH_ASRC_MULTICH_PARAMS=default"
+)
+
 # Add components with all sample formats
 foreach(sf ${sampleformats})
 	foreach(comp bench_param IN ZIP_LISTS components component_parameters)
@@ -61,3 +73,10 @@ foreach(comp bench_param IN ZIP_LISTS components_s24 component_parameters_s24)
 	#message(STATUS "Item=" ${item})
 	list(APPEND TPLGS "${item}")
 endforeach()
+
+set (sf "32")
+foreach(comp bench_param IN ZIP_LISTS components_s32 component_parameters_s32)
+	set(item "sof-hda-generic\;sof-hda-benchmark-${comp}${sf}\;HDA_CONFIG=benchmark,BENCH_CONFIG=${comp}${sf},${bench_param}")
+	#message(STATUS "Item=" ${item})
+	list(APPEND TPLGS "${item}")
+endforeach()
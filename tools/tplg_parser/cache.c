@@ -0,0 +1,623 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2026 Intel Corporation. All rights reserved.
+
+/*
+ * Compiled topology cache. The widgets, routes, PCMs and pipelines resolved
+ * by the parser are stored with their IPC payloads in one flat file that is
+ * mapped and turned back into the parser lists without walking the topology
+ * or its token arrays again. The cache is keyed by a hash of the topology
+ * file so any change of the topology invalidates it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <ipc/topology.h>
+#include <sof/common.h>
+#include <sof/list.h>
+#include <sof/ipc/topology.h>
+#include <tplg_parser/topology.h>
+
+#define TPLG_CACHE_MAGIC	"SOFTPLGC"
+#define TPLG_CACHE_VERSION	1
+#define TPLG_CACHE_ALIGN	8
+
+/* offset 0 is the header so it can stand for a NULL pointer */
+#define TPLG_CACHE_NONE		0
+
+struct tplg_cache_hdr {
+	char magic[8];
+	uint32_t version;
+	uint32_t size;			/* size of the whole cache file */
+	uint64_t hash;			/* hash of the topology file */
+	uint16_t layout[4];		/* sizes of the cached firmware structures */
+	uint32_t num_pipelines;
+	uint32_t num_widgets;
+	uint32_t num_routes;
+	uint32_t num_pcms;
+	uint32_t priv;			/* offset of user private data */
+	uint32_t priv_size;
+};
+
+struct tplg_cache_pipeline {
+	int32_t id;
+	int32_t instance_id;
+	int32_t usage_count;
+	int32_t mem_usage;
+	uint32_t name;
+};
+
+struct tplg_cache_widget {
+	struct ipc4_module_init_instance module_init;
+	struct ipc4_base_module_cfg basecfg;
+	struct sof_uuid uuid;
+	struct tplg_pins_info pins_info;
+	int32_t id;
+	int32_t type;
+	int32_t pipeline_id;
+	int32_t instance_id;
+	int32_t module_id;
+	int32_t pipeline;		/* index of the pipeline record or -1 */
+	uint32_t name;
+	uint32_t stream_name;
+	uint32_t ipc_payload;
+	uint32_t ipc_size;
+	uint32_t input_pin_fmts;
+	uint32_t num_input_formats;
+	uint32_t output_pin_fmts;
+	uint32_t num_output_formats;
+};
+
+struct tplg_cache_route {
+	int32_t source;
+	int32_t sink;
+};
+
+struct tplg_cache_pcm {
+	int32_t id;
+	uint32_t name;
+	int32_t playback_host;
+	int32_t capture_host;
+};
+
+/* cache image under construction, nothing is copied while data is NULL */
+struct tplg_cache_image {
+	uint8_t *data;
+	size_t records;			/* next free record offset */
+	size_t blob;			/* next free blob offset */
+};
+
+static const uint16_t tplg_cache_layout[4] = {
+	sizeof(struct ipc4_module_init_instance),
+	sizeof(struct ipc4_base_module_cfg),
+	sizeof(struct sof_ipc4_pin_format),
+	sizeof(struct tplg_cache_widget),
+};
+
+/* FNV-1a, good enough to tell topology revisions apart */
+static uint64_t tplg_cache_fnv1a(const uint8_t *data, size_t size)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		hash ^= data[i];
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+int tplg_cache_hash(const char *tplg_file, uint64_t *hash)
+{
+	struct stat st;
+	void *data;
+	int fd;
+
+	fd = open(tplg_file, O_RDONLY);
+	if (fd < 0)
+		return -errno;
+
+	if (fstat(fd, &st) < 0 || !st.st_size) {
+		close(fd);
+		return -EINVAL;
+	}
+
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return -errno;
+
+	*hash = tplg_cache_fnv1a(data, st.st_size) ^ st.st_size;
+	munmap(data, st.st_size);
+	return 0;
+}
+
+/* records are packed back to back and all 32-bit aligned */
+static void tplg_cache_put_record(struct tplg_cache_image *img, const void *rec, size_t size)
+{
+	if (img->data)
+		memcpy(img->data + img->records, rec, size);
+
+	img->records += size;
+}
+
+static uint32_t tplg_cache_put_blob(struct tplg_cache_image *img, const void *src, size_t size)
+{
+	size_t pos = img->blob;
+
+	if (!src)
+		return TPLG_CACHE_NONE;
+
+	if (img->data)
+		memcpy(img->data + pos, src, size);
+
+	img->blob = pos + ALIGN_UP(size, TPLG_CACHE_ALIGN);
+	return pos;
+}
+
+static uint32_t tplg_cache_put_string(struct tplg_cache_image *img, const char *str)
+{
+	return str ? tplg_cache_put_blob(img, str, strlen(str) + 1) : TPLG_CACHE_NONE;
+}
+
+static int tplg_cache_index(struct list_item *list, struct list_item *entry)
+{
+	struct list_item *item;
+	int i = 0;
+
+	list_for_item(item, list) {
+		if (item == entry)
+			return i;
+		i++;
+	}
+
+	return -1;
+}
+
+static int tplg_cache_widget_index(const struct tplg_cache_data *data,
+				   struct tplg_comp_info *comp_info)
+{
+	return comp_info ? tplg_cache_index(data->widget_list, &comp_info->item) : -1;
+}
+
+static size_t tplg_cache_count(struct list_item *list)
+{
+	struct list_item *item;
+	size_t count = 0;
+
+	list_for_item(item, list)
+		count++;
+
+	return count;
+}
+
+/* lay out the cache image, with img->data NULL only the size is computed */
+static void tplg_cache_build(struct tplg_cache_image *img, const struct tplg_cache_data *data,
+			     struct tplg_cache_hdr *hdr)
+{
+	struct list_item *item;
+
+	img->records = ALIGN_UP(sizeof(*hdr), TPLG_CACHE_ALIGN);
+	img->blob = img->records +
+		ALIGN_UP(hdr->num_pipelines * sizeof(struct tplg_cache_pipeline) +
+			 hdr->num_widgets * sizeof(struct tplg_cache_widget) +
+			 hdr->num_routes * sizeof(struct tplg_cache_route) +
+			 hdr->num_pcms * sizeof(struct tplg_cache_pcm), TPLG_CACHE_ALIGN);
+
+	list_for_item(item, data->pipeline_list) {
+		struct tplg_pipeline_info *pipe_info =
+			container_of(item, struct tplg_pipeline_info, item);
+		struct tplg_cache_pipeline rec = {
+			.id = pipe_info->id,
+			.instance_id = pipe_info->instance_id,
+			.usage_count = pipe_info->usage_count,
+			.mem_usage = pipe_info->mem_usage,
+			.name = tplg_cache_put_string(img, pipe_info->name),
+		};
+
+		tplg_cache_put_record(img, &rec, sizeof(rec));
+	}
+
+	list_for_item(item, data->widget_list) {
+		struct tplg_comp_info *comp_info = container_of(item, struct tplg_comp_info, item);
+		struct sof_ipc4_available_audio_format *fmt = &comp_info->available_fmt;
+		struct tplg_pipeline_info *pipe_info = comp_info->pipe_info;
+		struct tplg_cache_widget rec = {
+			.module_init = comp_info->module_init,
+			.basecfg = comp_info->basecfg,
+			.uuid = comp_info->uuid,
+			.pins_info = comp_info->pins_info,
+			.id = comp_info->id,
+			.type = comp_info->type,
+			.pipeline_id = comp_info->pipeline_id,
+			.instance_id = comp_info->instance_id,
+			.module_id = comp_info->module_id,
+			.pipeline = pipe_info ?
+				tplg_cache_index(data->pipeline_list, &pipe_info->item) : -1,
+			.name = tplg_cache_put_string(img, comp_info->name),
+			.stream_name = tplg_cache_put_string(img, comp_info->stream_name),
+			.ipc_payload = tplg_cache_put_blob(img, comp_info->ipc_payload,
+							   comp_info->ipc_size),
+			.ipc_size = comp_info->ipc_size,
+			.input_pin_fmts = tplg_cache_put_blob(img, fmt->input_pin_fmts,
+							      fmt->num_input_formats *
+							      sizeof(struct sof_ipc4_pin_format)),
+			.num_input_formats = fmt->num_input_formats,
+			.output_pin_fmts = tplg_cache_put_blob(img, fmt->output_pin_fmts,
+							       fmt->num_output_formats *
+							       sizeof(struct sof_ipc4_pin_format)),
+			.num_output_formats = fmt->num_output_formats,
+		};
+
+		tplg_cache_put_record(img, &rec, sizeof(rec));
+	}
+
+	list_for_item(item, data->route_list) {
+		struct tplg_route_info *route_info =
+			container_of(item, struct tplg_route_info, item);
+		struct tplg_cache_route rec = {
+			.source = tplg_cache_widget_index(data, route_info->source),
+			.sink = tplg_cache_widget_index(data, route_info->sink),
+		};
+
+		tplg_cache_put_record(img, &rec, sizeof(rec));
+	}
+
+	list_for_item(item, data->pcm_list) {
+		struct tplg_pcm_info *pcm_info = container_of(item, struct tplg_pcm_info, item);
+		struct tplg_cache_pcm rec = {
+			.id = pcm_info->id,
+			.name = tplg_cache_put_string(img, pcm_info->name),
+			.playback_host = tplg_cache_widget_index(data, pcm_info->playback_host),
+			.capture_host = tplg_cache_widget_index(data, pcm_info->capture_host),
+		};
+
+		tplg_cache_put_record(img, &rec, sizeof(rec));
+	}
+
+	hdr->priv = tplg_cache_put_blob(img, data->priv, data->priv_size);
+	hdr->priv_size = data->priv_size;
+	hdr->size = img->blob;
+}
+
+int tplg_cache_write(const char *cache_file, uint64_t hash, const struct tplg_cache_data *data)
+{
+	struct tplg_cache_image img = { NULL };
+	struct tplg_cache_hdr hdr = {
+		.version = TPLG_CACHE_VERSION,
+		.hash = hash,
+	};
+	char *tmp_file;
+	ssize_t written;
+	int ret = 0;
+	int fd;
+
+	memcpy(hdr.magic, TPLG_CACHE_MAGIC, sizeof(hdr.magic));
+	memcpy(hdr.layout, tplg_cache_layout, sizeof(hdr.layout));
+	hdr.num_pipelines = tplg_cache_count(data->pipeline_list);
+	hdr.num_widgets = tplg_cache_count(data->widget_list);
+	hdr.num_routes = tplg_cache_count(data->route_list);
+	hdr.num_pcms = tplg_cache_count(data->pcm_list);
+
+	/* size the image first, then fill it in */
+	tplg_cache_build(&img, data, &hdr);
+	img.data = calloc(hdr.size, 1);
+	if (!img.data)
+		return -ENOMEM;
+
+	tplg_cache_build(&img, data, &hdr);
+	memcpy(img.data, &hdr, sizeof(hdr));
+
+	/* concurrent runs must never see a partially written cache */
+	tmp_file = malloc(strlen(cache_file) + sizeof(".XXXXXX"));
+	if (!tmp_file) {
+		ret = -ENOMEM;
+		goto out;
+	}
+	sprintf(tmp_file, "%s.XXXXXX", cache_file);
+
+	fd = mkstemp(tmp_file);
+	if (fd < 0) {
+		ret = -errno;
+		goto out;
+	}
+
+	written = write(fd, img.data, hdr.size);
+	if (written != hdr.size)
+		ret = written < 0 ? -errno : -EIO;
+	close(fd);
+
+	if (!ret && rename(tmp_file, cache_file) < 0)
+		ret = -errno;
+	if (ret)
+		unlink(tmp_file);
+
+out:
+	free(tmp_file);
+	free(img.data);
+	return ret;
+}
+
+/* duplicate a cached object after checking it lies within the cache */
+static void *tplg_cache_dup(const uint8_t *base, size_t size, uint32_t offset, size_t obj_size,
+			    int *err)
+{
+	void *obj;
+
+	if (offset == TPLG_CACHE_NONE || !obj_size)
+		return NULL;
+
+	if (offset >= size || obj_size > size - offset) {
+		*err = -EINVAL;
+		return NULL;
+	}
+
+	obj = malloc(obj_size);
+	if (!obj) {
+		*err = -ENOMEM;
+		return NULL;
+	}
+
+	memcpy(obj, base + offset, obj_size);
+	return obj;
+}
+
+static char *tplg_cache_dup_string(const uint8_t *base, size_t size, uint32_t offset, int *err)
+{
+	if (offset == TPLG_CACHE_NONE)
+		return NULL;
+
+	if (offset >= size) {
+		*err = -EINVAL;
+		return NULL;
+	}
+
+	return tplg_cache_dup(base, size, offset, strnlen((const char *)base + offset,
+							  size - offset - 1) + 1, err);
+}
+
+static struct tplg_comp_info *tplg_cache_widget(struct tplg_comp_info **widgets,
+						uint32_t num_widgets, int32_t index, int *err)
+{
+	if (index < 0)
+		return NULL;
+
+	if (index >= num_widgets) {
+		*err = -EINVAL;
+		return NULL;
+	}
+
+	return widgets[index];
+}
+
+void tplg_cache_free(struct tplg_cache_data *data)
+{
+	struct list_item *item, *_item;
+
+	list_for_item_safe(item, _item, data->pcm_list) {
+		struct tplg_pcm_info *pcm_info = container_of(item, struct tplg_pcm_info, item);
+
+		list_item_del(item);
+		free(pcm_info->name);
+		free(pcm_info);
+	}
+
+	list_for_item_safe(item, _item, data->route_list) {
+		list_item_del(item);
+		free(container_of(item, struct tplg_route_info, item));
+	}
+
+	list_for_item_safe(item, _item, data->widget_list) {
+		struct tplg_comp_info *comp_info = container_of(item, struct tplg_comp_info, item);
+
+		list_item_del(item);
+		free(comp_info->available_fmt.input_pin_fmts);
+		free(comp_info->available_fmt.output_pin_fmts);
+		free(comp_info->name);
+		free(comp_info->stream_name);
+		free(comp_info->ipc_payload);
+		free(comp_info);
+	}
+
+	list_for_item_safe(item, _item, data->pipeline_list) {
+		struct tplg_pipeline_info *pipe_info =
+			container_of(item, struct tplg_pipeline_info, item);
+
+		list_item_del(item);
+		free(pipe_info->name);
+		free(pipe_info);
+	}
+
+	free(data->priv);
+	data->priv = NULL;
+	data->priv_size = 0;
+}
+
+static int tplg_cache_restore(const uint8_t *base, const struct tplg_cache_hdr *hdr,
+			      struct tplg_cache_data *data)
+{
+	const uint8_t *rec = base + ALIGN_UP(sizeof(*hdr), TPLG_CACHE_ALIGN);
+	const size_t pipe_size = sizeof(struct tplg_cache_pipeline);
+	struct tplg_pipeline_info **pipes;
+	struct tplg_comp_info **widgets;
+	size_t size = hdr->size;
+	int err = 0;
+	int i;
+
+	pipes = calloc(hdr->num_pipelines + 1, sizeof(*pipes));
+	widgets = calloc(hdr->num_widgets + 1, sizeof(*widgets));
+	if (!pipes || !widgets) {
+		err = -ENOMEM;
+		goto out;
+	}
+
+	for (i = 0; i < hdr->num_pipelines && !err; i++, rec += pipe_size) {
+		const struct tplg_cache_pipeline *p = (const struct tplg_cache_pipeline *)rec;
+		struct tplg_pipeline_info *pipe_info = calloc(1, sizeof(*pipe_info));
+
+		if (!pipe_info) {
+			err = -ENOMEM;
+			break;
+		}
+
+		pipe_info->id = p->id;
+		pipe_info->instance_id = p->instance_id;
+		pipe_info->usage_count = p->usage_count;
+		pipe_info->mem_usage = p->mem_usage;
+		pipe_info->name = tplg_cache_dup_string(base, size, p->name, &err);
+		list_item_append(&pipe_info->item, data->pipeline_list);
+		pipes[i] = pipe_info;
+	}
+
+	for (i = 0; i < hdr->num_widgets && !err; i++, rec += sizeof(struct tplg_cache_widget)) {
+		const struct tplg_cache_widget *w = (const struct tplg_cache_widget *)rec;
+		struct tplg_comp_info *comp_info = calloc(1, sizeof(*comp_info));
+		struct sof_ipc4_available_audio_format *fmt;
+
+		if (!comp_info) {
+			err = -ENOMEM;
+			break;
+		}
+
+		list_item_append(&comp_info->item, data->widget_list);
+		widgets[i] = comp_info;
+
+		if (w->pipeline >= (int32_t)hdr->num_pipelines) {
+			err = -EINVAL;
+			break;
+		}
+
+		fmt = &comp_info->available_fmt;
+		comp_info->module_init = w->module_init;
+		comp_info->basecfg = w->basecfg;
+		comp_info->uuid = w->uuid;
+		comp_info->pins_info = w->pins_info;
+		comp_info->id = w->id;
+		comp_info->type = w->type;
+		comp_info->pipeline_id = w->pipeline_id;
+		comp_info->instance_id = w->instance_id;
+		comp_info->module_id = w->module_id;
+		comp_info->pipe_info = w->pipeline < 0 ? NULL : pipes[w->pipeline];
+		comp_info->name = tplg_cache_dup_string(base, size, w->name, &err);
+		comp_info->stream_name = tplg_cache_dup_string(base, size, w->stream_name, &err);
+		comp_info->ipc_payload = tplg_cache_dup(base, size, w->ipc_payload,
+							w->ipc_size, &err);
+		comp_info->ipc_size = w->ipc_size;
+		fmt->input_pin_fmts = tplg_cache_dup(base, size, w->input_pin_fmts,
+						     w->num_input_formats *
+						     sizeof(struct sof_ipc4_pin_format), &err);
+		fmt->num_input_formats = w->num_input_formats;
+		fmt->output_pin_fmts = tplg_cache_dup(base, size, w->output_pin_fmts,
+						      w->num_output_formats *
+						      sizeof(struct sof_ipc4_pin_format), &err);
+		fmt->num_output_formats = w->num_output_formats;
+	}
+
+	for (i = 0; i < hdr->num_routes && !err; i++, rec += sizeof(struct tplg_cache_route)) {
+		const struct tplg_cache_route *r = (const struct tplg_cache_route *)rec;
+		struct tplg_route_info *route_info = calloc(1, sizeof(*route_info));
+
+		if (!route_info) {
+			err = -ENOMEM;
+			break;
+		}
+
+		route_info->source = tplg_cache_widget(widgets, hdr->num_widgets, r->source, &err);
+		route_info->sink = tplg_cache_widget(widgets, hdr->num_widgets, r->sink, &err);
+		list_item_append(&route_info->item, data->route_list);
+	}
+
+	for (i = 0; i < hdr->num_pcms && !err; i++, rec += sizeof(struct tplg_cache_pcm)) {
+		const struct tplg_cache_pcm *p = (const struct tplg_cache_pcm *)rec;
+		struct tplg_pcm_info *pcm_info = calloc(1, sizeof(*pcm_info));
+
+		if (!pcm_info) {
+			err = -ENOMEM;
+			break;
+		}
+
+		pcm_info->id = p->id;
+		pcm_info->name = tplg_cache_dup_string(base, size, p->name, &err);
+		pcm_info->playback_host = tplg_cache_widget(widgets, hdr->num_widgets,
+							    p->playback_host, &err);
+		pcm_info->capture_host = tplg_cache_widget(widgets, hdr->num_widgets,
+							   p->capture_host, &err);
+		list_item_append(&pcm_info->item, data->pcm_list);
+	}
+
+	if (!err) {
+		data->priv = tplg_cache_dup(base, size, hdr->priv, hdr->priv_size, &err);
+		data->priv_size = data->priv ? hdr->priv_size : 0;
+	}
+
+out:
+	if (err)
+		tplg_cache_free(data);
+
+	free(widgets);
+	free(pipes);
+	return err;
+}
+
+int tplg_cache_read(const char *cache_file, uint64_t hash, struct tplg_cache_data *data)
+{
+	const struct tplg_cache_hdr *hdr;
+	size_t records;
+	struct stat st;
+	void *base;
+	int ret;
+	int fd;
+
+	data->priv = NULL;
+	data->priv_size = 0;
+
+	fd = open(cache_file, O_RDONLY);
+	if (fd < 0)
+		return -errno;
+
+	if (fstat(fd, &st) < 0 || st.st_size < sizeof(*hdr)) {
+		close(fd);
+		return -EINVAL;
+	}
+
+	base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED)
+		return -errno;
+
+	hdr = base;
+	records = ALIGN_UP(sizeof(*hdr), TPLG_CACHE_ALIGN) +
+		(size_t)hdr->num_pipelines * sizeof(struct tplg_cache_pipeline) +
+		(size_t)hdr->num_widgets * sizeof(struct tplg_cache_widget) +
+		(size_t)hdr->num_routes * sizeof(struct tplg_cache_route) +
+		(size_t)hdr->num_pcms * sizeof(struct tplg_cache_pcm);
+
+	/* stale or foreign caches are not an error, the caller parses instead */
+	if (memcmp(hdr->magic, TPLG_CACHE_MAGIC, sizeof(hdr->magic)) ||
+	    hdr->version != TPLG_CACHE_VERSION ||
+	    memcmp(hdr->layout, tplg_cache_layout, sizeof(hdr->layout)) ||
+	    hdr->size != st.st_size || records > hdr->size) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	if (hdr->hash != hash) {
+		ret = -ESTALE;
+		goto out;
+	}
+
+	ret = tplg_cache_restore(base, hdr, data);
+
+out:
+	munmap(base, st.st_size);
+	return ret;
+}
@@ -146,6 +146,19 @@ struct tplg_pipeline_list {
 	struct tplg_pipeline_info *pipelines[TPLG_MAX_PCM_PIPELINES];
 };
 
+/*
+ * Parsed topology state stored in and restored from the topology cache.
+ * The private data is owned by the parser user, e.g. testbench controls.
+ */
+struct tplg_cache_data {
+	struct list_item *widget_list;
+	struct list_item *route_list;
+	struct list_item *pcm_list;
+	struct list_item *pipeline_list;
+	void *priv;
+	size_t priv_size;
+};
+
 struct tplg_pcm_info {
 	char *name;
 	int id;
@@ -331,5 +344,9 @@ int tplg_parse_graph(struct tplg_context *ctx, struct list_item *widget_list,
 		     struct list_item *route_list);
 int tplg_parse_pcm(struct tplg_context *ctx, struct list_item *widget_list,
 		   struct list_item *pcm_list);
+void tplg_cache_free(struct tplg_cache_data *data);
+int tplg_cache_hash(const char *tplg_file, uint64_t *hash);
+int tplg_cache_read(const char *cache_file, uint64_t hash, struct tplg_cache_data *data);
+int tplg_cache_write(const char *cache_file, uint64_t hash, const struct tplg_cache_data *data);
 
 #endif
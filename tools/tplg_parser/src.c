@@ -59,6 +59,9 @@ static const struct sof_topology_token src4_tokens[] = {
 	{SOF_TKN_SRC_RATE_OUT, SND_SOC_TPLG_TUPLE_TYPE_WORD,
 		tplg_token_get_uint32_t,
 		offsetof(struct ipc4_config_src, sink_rate), 0},
+	{SOF_TKN_SRC_COEF_BITS, SND_SOC_TPLG_TUPLE_TYPE_WORD,
+		tplg_token_get_uint32_t,
+		offsetof(struct ipc4_config_src, coef_bits), 0},
 };
 
 static const struct sof_topology_token_group src_ipc4_tokens[] = {
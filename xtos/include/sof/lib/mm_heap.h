@@ -24,6 +24,7 @@
 #include <stdint.h>
 
 struct dma_copy;
+struct tlsf;
 struct dma_sg_config;
 
 struct mm_info {
@@ -61,6 +62,9 @@ struct mm_heap {
 	uint32_t size;
 	uint32_t caps;
 	struct mm_info info;
+#if CONFIG_XTOS_HEAP_TLSF
+	struct tlsf *tlsf;	/* runtime and buffer heaps, replaces the maps */
+#endif
 };
 
 /* heap block memory map */
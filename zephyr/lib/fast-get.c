@@ -80,6 +80,40 @@ static struct sof_fast_get_entry *fast_get_find_entry(struct sof_fast_get_data *
 	return NULL;
 }
 
+/* takes a reference to an existing entry, called with the lock held */
+static void *fast_get_ref(struct sof_fast_get_entry *entry, const void *dram_ptr, size_t size)
+{
+	if (entry->size != size || entry->dram_ptr != dram_ptr) {
+		tr_err(fast_get, "size %u != %u or ptr %p != %p mismatch",
+		       entry->size, size, entry->dram_ptr, dram_ptr);
+		return NULL;
+	}
+
+	entry->refcount++;
+	/*
+	 * The data is constant, so it's safe to use cached access to
+	 * it, but initially we have to invalidate cached
+	 */
+	dcache_invalidate_region((__sparse_force void __sparse_cache *)entry->sram_ptr, size);
+
+	return entry->sram_ptr;
+}
+
+/* finds the entry of dram_ptr or a free one, called with the lock held */
+static struct sof_fast_get_entry *fast_get_entry(struct sof_fast_get_data *data,
+						 const void *dram_ptr)
+{
+	struct sof_fast_get_entry *entry;
+
+	do {
+		entry = fast_get_find_entry(data, dram_ptr);
+		if (!entry && fast_get_realloc(data))
+			return NULL;
+	} while (!entry);
+
+	return entry;
+}
+
 const void *fast_get(const void *dram_ptr, size_t size)
 {
 	struct sof_fast_get_data *data = &fast_get_data;
@@ -88,31 +122,14 @@ const void *fast_get(const void *dram_ptr, size_t size)
 	void *ret;
 
 	key = k_spin_lock(&data->lock);
-	do {
-		entry = fast_get_find_entry(data, dram_ptr);
-		if (!entry) {
-			if (fast_get_realloc(data)) {
-				ret = NULL;
-				goto out;
-			}
-		}
-	} while (!entry);
+	entry = fast_get_entry(data, dram_ptr);
+	if (!entry) {
+		ret = NULL;
+		goto out;
+	}
 
 	if (entry->sram_ptr) {
-		if (entry->size != size || entry->dram_ptr != dram_ptr) {
-			tr_err(fast_get, "size %u != %u or ptr %p != %p mismatch",
-				entry->size, size, entry->dram_ptr, dram_ptr);
-			ret = NULL;
-			goto out;
-		}
-
-		ret = entry->sram_ptr;
-		entry->refcount++;
-		/*
-		 * The data is constant, so it's safe to use cached access to
-		 * it, but initially we have to invalidate cached
-		 */
-		dcache_invalidate_region((__sparse_force void __sparse_cache *)ret, size);
+		ret = fast_get_ref(entry, dram_ptr, size);
 		goto out;
 	}
 
@@ -133,6 +150,59 @@ out:
 }
 EXPORT_SYMBOL(fast_get);
 
+const void *fast_get_generate(const void *key, size_t size, fast_get_generator_t generate)
+{
+	struct sof_fast_get_data *data = &fast_get_data;
+	struct sof_fast_get_entry *entry;
+	k_spinlock_key_t lock_key;
+	void *ret;
+	void *buf;
+
+	lock_key = k_spin_lock(&data->lock);
+	entry = fast_get_find_entry(data, key);
+	if (entry && entry->sram_ptr) {
+		ret = fast_get_ref(entry, key, size);
+		k_spin_unlock(&data->lock, lock_key);
+		return ret;
+	}
+	k_spin_unlock(&data->lock, lock_key);
+
+	/* generating can take long, it isn't done with the lock held */
+	buf = rmalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM, size);
+	if (!buf)
+		return NULL;
+
+	if (generate(buf, size, key) < 0) {
+		tr_err(fast_get, "generating %p, size %u failed", key, size);
+		rfree(buf);
+		return NULL;
+	}
+
+	lock_key = k_spin_lock(&data->lock);
+	entry = fast_get_entry(data, key);
+	if (!entry) {
+		ret = NULL;
+	} else if (entry->sram_ptr) {
+		/* another user generated the same data meanwhile */
+		ret = fast_get_ref(entry, key, size);
+	} else {
+		entry->size = size;
+		entry->sram_ptr = buf;
+		entry->dram_ptr = key;
+		entry->refcount = 1;
+		ret = buf;
+	}
+	k_spin_unlock(&data->lock, lock_key);
+
+	if (ret != buf)
+		rfree(buf);
+
+	tr_dbg(fast_get, "generate %p, %p, size %u", key, ret, size);
+
+	return ret;
+}
+EXPORT_SYMBOL(fast_get_generate);
+
 static struct sof_fast_get_entry *fast_put_find_entry(struct sof_fast_get_data *data,
 						      const void *sram_ptr)
 {